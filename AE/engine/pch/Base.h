@@ -14,6 +14,7 @@
 #include "base/Algorithms/ArrayUtils.h"
 #include "base/Algorithms/Cast.h"
 #include "base/Algorithms/StringUtils.h"
+#include "base/Algorithms/StringBuilder.h"
 #include "base/Algorithms/Parser.h"
 
 // Containers
@@ -88,6 +89,7 @@
 #include "base/Math/SIMD_SSE.h"
 #include "base/Math/Packing.h"
 #include "base/Math/Frustum.h"
+#include "base/Math/FrustumCulling.h"
 #include "base/Math/AABB.h"
 #include "base/Math/Camera.h"
 #include "base/Math/FPVCamera.h"
@@ -6,6 +6,7 @@
 
 // Canvas
 #include "graphics_hl/Canvas/Canvas.h"
+#include "graphics_hl/Canvas/GlyphRunCache.h"
 
 // Resources
 #include "graphics_hl/Resources/FormattedText.h"
@@ -7,8 +7,10 @@
 // Containers
 #include "threading/Containers/LfChunkList.h"
 #include "threading/Containers/LfIndexedPool.h"
+#include "threading/Containers/LfSpscChannel.h"
 #include "threading/Containers/LfStaticIndexedPool.h"
 #include "threading/Containers/LfStaticPool.h"
+#include "threading/Containers/LfStaticQueue.h"
 
 // DataSource
 #include "threading/DataSource/AsyncDataSource.h"
@@ -26,6 +28,7 @@
 #include "threading/Memory/LfStaticBlockAllocator.h"
 #include "threading/Memory/MemoryManager.h"
 #include "threading/Memory/MemoryProfiler.h"
+#include "threading/Memory/ProfiledAllocator.h"
 #include "threading/Memory/TsLinearAllocator.h"
 #include "threading/Memory/TsSharedMem.h"
 #include "threading/Memory/TsStackAllocator.h"
@@ -38,6 +41,7 @@
 #include "threading/Primitives/Synchronized.h"
 #include "threading/Primitives/DataRaceCheck.h"
 #include "threading/Primitives/Semaphore.h"
+#include "threading/Primitives/Futex.h"
 
 // TaskSystem
 #include "threading/TaskSystem/EThread.h"
@@ -48,3 +52,5 @@
 #include "threading/TaskSystem/Promise.h"
 #include "threading/TaskSystem/Coroutine.h"
 #include "threading/TaskSystem/AsyncMutex.h"
+#include "threading/TaskSystem/ParallelParts.h"
+#include "threading/TaskSystem/ParallelFrustumCulling.h"
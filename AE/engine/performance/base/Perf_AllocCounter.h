@@ -35,6 +35,10 @@ public:
 		AE_LOGI( String{_name} << " allocations: "s << Base::ToString(_allocCount) );
 	}
 
+	// use with 'Benchmark::SetAllocCounter()'
+	ND_ uint  AllocCount ()		const	{ return _allocCount; }
+	ND_ uint  DeallocCount ()	const	{ return _deallocCount; }
+
 	ND_ void*  Allocate (Bytes size)
 	{
 		++_allocCount;
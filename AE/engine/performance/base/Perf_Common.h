@@ -3,4 +3,4 @@
 #pragma once
 
 #include "../../tests/shared/UnitTest_Shared.h"
-#include "../../tests/shared/IntervalProfiler.h"
+#include "../../tests/shared/Benchmark.h"
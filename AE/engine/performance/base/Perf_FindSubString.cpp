@@ -154,56 +154,78 @@ namespace
 
 	static void FindSubString_Test ()
 	{
-		IntervalProfiler	profiler{ "FindSubString" };
+		Benchmark			bench{ "FindSubString" };
 		String				large_str;
 		String				substr	= "394054890234923jsilaoskm";
 		const uint			N = 1000;
-		usize				sum1 = 0, sum2 = 0, sum3 = 0, sum4 = 0;
+		usize				res1 = 0, res2 = 0, res3 = 0, res4 = 0, res5 = 0, res6 = 0;
 
 		large_str.resize( 1000'000 );
 		large_str.insert( large_str.begin() + 500'001, substr.begin(), substr.end() );
 
-		profiler.BeginTest( "std" );
-		profiler.BeginIteration();
-		{
-			for (uint i = 0; i < N; ++i)
-				sum1 += FindSubString1( large_str, substr );
-		}
-		profiler.EndIteration();
-		profiler.EndTest();
-
-		profiler.BeginTest( "AE" );
-		profiler.BeginIteration();
-		{
-			for (uint i = 0; i < N; ++i)
-				sum2 += FindSubString2( large_str, substr );
-		}
-		profiler.EndIteration();
-		profiler.EndTest();
-
-		profiler.BeginTest( "64bit" );
-		profiler.BeginIteration();
-		{
-			for (uint i = 0; i < N; ++i)
-				sum3 += FindSubString3( large_str, substr );
-		}
-		profiler.EndIteration();
-		profiler.EndTest();
+		const auto	Test = [&] (StringView name, OUT usize &result, auto fn)
+		{{
+			bench.Run( name, [&] ()
+				{
+					usize	sum = 0;
+					for (uint i = 0; i < N; ++i)
+						sum += fn( large_str, substr );
+					result = sum;
+				});
+		}};
+
+		Test( "std",	OUT res1, [](StringView str, StringView sub) { return FindSubString1( str, sub ); });
+		Test( "AE",		OUT res2, [](StringView str, StringView sub) { return FindSubString2( str, sub ); });
+		Test( "64bit",	OUT res3, [](StringView str, StringView sub) { return FindSubString3( str, sub ); });
+		Test( "FindString",		OUT res5, [](StringView str, StringView sub) { usize i = FindString( str, sub );    return i < str.size() ? i : 0; });
+		Test( "FindStringIC",	OUT res6, [](StringView str, StringView sub) { usize i = FindStringIC( str, sub );  return i < str.size() ? i : 0; });
 
 	  #if AE_SIMD_AVX >= 2
-		profiler.BeginTest( "256bit" );
-		profiler.BeginIteration();
-		{
-			for (uint i = 0; i < N; ++i)
-				sum4 += FindSubString4( large_str, substr );
-		}
-		profiler.EndIteration();
-		profiler.EndTest();
+		Test( "256bit",	OUT res4, [](StringView str, StringView sub) { return FindSubString4( str, sub ); });
+		CHECK( res1 == res4 );
+	  #else
+		Unused( res4 );
 	  #endif
 
-		CHECK( sum1 == sum2 );
-		CHECK( sum1 == sum3 );
-		CHECK( sum1 == sum4 );
+		CHECK( res1 == res2 );
+		CHECK( res1 == res3 );
+		CHECK( res1 == res5 );
+		CHECK( res1 == res6 );
+	}
+
+
+	static void  StringBuilder_Test ()
+	{
+		Benchmark		bench{ "StringBuilder" };
+		const uint		N		= 100'000;
+		usize			res1	= 0,	res2 = 0;
+
+		bench.Run( "String",  [&] ()
+			{
+				usize	sum = 0;
+				for (uint i = 0; i < N; ++i)
+				{
+					String	str;
+					str << "value: " << ToString( i ) << ", hex: " << ToString<16>( i ) << ", " << ToString( i * 3 );
+					sum += str.size();
+				}
+				res1 = sum;
+			});
+
+		bench.Run( "StringBuilder",  [&] ()
+			{
+				usize	sum = 0;
+				for (uint i = 0; i < N; ++i)
+				{
+					StringBuilder<>	str;
+					str << "value: " << i << ", hex: ";
+					str.AppendInt<16>( i ) << ", " << (i * 3);
+					sum += str.size();
+				}
+				res2 = sum;
+			});
+
+		CHECK( res1 == res2 );
 	}
 }
 
@@ -211,6 +233,7 @@ namespace
 extern void PerfTest_FindSubString ()
 {
 	FindSubString_Test();
+	StringBuilder_Test();
 
 	TEST_PASSED();
 }
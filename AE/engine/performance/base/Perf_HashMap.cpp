@@ -8,34 +8,35 @@ namespace
 {
 	static void  HashMap_Insert ()
 	{
-		constexpr usize		N = 10'000'000;
-
-		IntervalProfiler	profiler{ "map insertion test" };
-
-		HashMap< usize, usize >		map1;
-		HashMap< usize, usize >		map2;
-
-		profiler.BeginTest( "1" );
-		profiler.BeginIteration();
-		{
-			for (size_t i = 0; i < N; i++)
-				map1.emplace( i, i * i );
-		}
-		profiler.EndIteration();
-		profiler.EndTest();
-
-		profiler.BeginTest( "2" );
-		profiler.BeginIteration();
-		{
-			for (const auto& it : map1)
-				map2.emplace( it.first, it.second * it.first );
-		}
-		profiler.EndIteration();
-		profiler.EndTest();
-
-		usize	summ = 0;
-		for (const auto& it : map2)
-			summ += it.second;
+		constexpr usize		N = 1'000'000;
+
+		using Map_t = std::unordered_map< usize, usize, std::hash<usize>, std::equal_to<usize>, StdAllocWithCounter< Pair< const usize, usize >>>;
+
+		Benchmark::Config				cfg;
+		cfg.minIterations = 5;
+
+		Benchmark						bench{ "map insertion test", cfg };
+		UntypedAllocatorWithCounter		alloc{ "map insertion test" };
+		usize							summ = 0;
+
+		bench.SetAllocCounter( [&alloc] () { return ulong(alloc.AllocCount()); });
+
+		bench.Run( "insert", [&] ()
+			{
+				Map_t	map1{ StdAllocWithCounter< Pair< const usize, usize >>{ &alloc }};
+				for (usize i = 0; i < N; ++i)
+					map1.emplace( i, i * i );
+				summ += map1.size();
+			});
+
+		bench.Run( "reserve + insert", [&] ()
+			{
+				Map_t	map2{ StdAllocWithCounter< Pair< const usize, usize >>{ &alloc }};
+				map2.reserve( N );
+				for (usize i = 0; i < N; ++i)
+					map2.emplace( i, i * i );
+				summ += map2.size();
+			});
 
 		AE_LOGI( ToString( summ ));
 	}
@@ -20,7 +20,7 @@
 namespace
 {
 	template <typename TSet, typename Iter>
-	ND_ ulong  SearchTest (const TSet &set, Iter keysBegin, Iter keysEnd, IntervalProfiler& profiler)
+	ND_ ulong  SearchTest (const TSet &set, Iter keysBegin, Iter keysEnd, Benchmark& profiler)
 	{
 		profiler.BeginIteration();
 
@@ -106,7 +106,7 @@ namespace
 			absl_set2.insert( k );
 		}
 
-		IntervalProfiler	profiler{ "set search test" };
+		Benchmark	profiler{ "set search test" };
 		/*
 		profiler.BeginTest( "std::set" );
 		sum[0] += SearchTest( tree_set, keys.begin(),  keys.end(),  profiler );
@@ -177,7 +177,7 @@ namespace
 
 
 	template <typename TSet, typename Iter>
-	ND_ ulong  InsertionTest (TSet &set, Iter keysBegin, Iter keysEnd, IntervalProfiler& profiler)
+	ND_ ulong  InsertionTest (TSet &set, Iter keysBegin, Iter keysEnd, Benchmark& profiler)
 	{
 		profiler.BeginIteration();
 
@@ -246,7 +246,7 @@ namespace
 			absl_set2.reserve( count*2 );
 		}
 
-		IntervalProfiler	profiler{ "set insertion test" };
+		Benchmark	profiler{ "set insertion test" };
 		/*
 		profiler.BeginTest( "std::set" );
 		sum[0] += InsertionTest( tree_set, keys.begin(),  keys.end(),  profiler );
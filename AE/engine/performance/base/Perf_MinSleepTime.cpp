@@ -10,7 +10,7 @@ namespace
 
 	static void  MinSleepTime_Test1 ()
 	{
-		IntervalProfiler	profiler{ "std sleep_for" };
+		Benchmark	profiler{ "std sleep_for" };
 
 		profiler.BeginTest( "1 us" );
 		for (uint i = 0; i < c_Count; ++i)
@@ -70,7 +70,7 @@ namespace
 
 	static void  MinSleepTime_Test2 ()
 	{
-		IntervalProfiler	profiler{ "AE" };
+		Benchmark	profiler{ "AE" };
 
 		profiler.BeginTest( "Pause" );
 		for (uint i = 0; i < c_Count; ++i)
@@ -121,7 +121,7 @@ namespace
 
 	static void  MinSleepTime_Test3 ()
 	{
-		IntervalProfiler	profiler{ "Micro Sleep" };
+		Benchmark	profiler{ "Micro Sleep" };
 
 		profiler.BeginTest( "100 ns" );
 		for (uint i = 0; i < c_Count; ++i)
@@ -199,7 +199,7 @@ namespace
 
 	static void  MinSleepTime_Test4 ()
 	{
-		IntervalProfiler	profiler{ "Nano Sleep" };
+		Benchmark	profiler{ "Nano Sleep" };
 
 		profiler.BeginTest( "70 ns" );
 		for (uint i = 0; i < c_Count; ++i)
@@ -251,30 +251,7 @@ namespace
 
 extern void PerfTest_MinSleepTime ()
 {
-	{
-		auto&	info	= CpuArchInfo::Get();
-		auto*	hp_core	= info.GetCore( ECoreType::HighPerformance );
-		auto*	p_core	= info.GetCore( ECoreType::Performance );
-		auto*	ee_core	= info.GetCore( ECoreType::EnergyEfficient );
-		int		core_id	= -1;
-
-		AE_LOGI( info.Print() );
-
-		if ( hp_core != null )
-			core_id = BitScanForward( hp_core->physicalBits.to_ullong() );
-		else
-		if ( p_core != null )
-			core_id = BitScanForward( p_core->physicalBits.to_ullong() );
-		else
-		if ( ee_core != null )
-			core_id = BitScanForward( ee_core->physicalBits.to_ullong() );
-
-		if ( core_id >= 0 )
-		{
-			AE_LOGI( "bind to core: "s << ToString(core_id) );
-			ThreadUtils::SetAffinity( uint(core_id) );
-		}
-	}
+	AE_LOGI( CpuArchInfo::Get().Print() );
 
 	MinSleepTime_Test1();
 	MinSleepTime_Test2();
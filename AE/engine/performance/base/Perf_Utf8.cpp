@@ -19,8 +19,8 @@ namespace
 
 	static void  Utf8Decode_Test ()
 	{
-		constexpr usize		N = 10'000'000;
-		IntervalProfiler	profiler{ "utf8 decode" };
+		constexpr usize		N = 1'000'000;
+		Benchmark			bench{ "utf8 decode" };
 		const CharUtf8		temp1 [] = u8"😭~👉я💮";
 		U8String			temp2 {temp1};
 		U8StringView		str {temp2};
@@ -75,39 +75,94 @@ namespace
 		}
 	#endif
 
-		profiler.BeginTest( "1" );
-		profiler.BeginIteration();
-		{
-			for (usize i = 0; i < N; ++i)
+		bench.Run( "1", [&] ()
+			{
+				usize	sum = 0;
+				for (usize i = 0; i < N; ++i)
+				{
+					usize	pos = 0;
+					sum += usize(Utf8Decode1( str.data(), str.size(), INOUT pos ));
+					sum += usize(Utf8Decode1( str.data(), str.size(), INOUT pos ));
+					sum += usize(Utf8Decode1( str.data(), str.size(), INOUT pos ));
+					sum += usize(Utf8Decode1( str.data(), str.size(), INOUT pos ));
+					sum += usize(Utf8Decode1( str.data(), str.size(), INOUT pos ));
+				}
+				sum1 = sum;
+			});
+
+		bench.Run( "2", [&] ()
 			{
-				usize	pos = 0;
-				sum1 += usize(Utf8Decode1( str.data(), str.size(), INOUT pos ));
-				sum1 += usize(Utf8Decode1( str.data(), str.size(), INOUT pos ));
-				sum1 += usize(Utf8Decode1( str.data(), str.size(), INOUT pos ));
-				sum1 += usize(Utf8Decode1( str.data(), str.size(), INOUT pos ));
-				sum1 += usize(Utf8Decode1( str.data(), str.size(), INOUT pos ));
-			}
+				usize	sum = 0;
+				for (usize i = 0; i < N; ++i)
+				{
+					usize	pos = 0;
+					sum += usize(Utf8Decode2( str.data(), str.size(), INOUT pos ));
+					sum += usize(Utf8Decode2( str.data(), str.size(), INOUT pos ));
+					sum += usize(Utf8Decode2( str.data(), str.size(), INOUT pos ));
+					sum += usize(Utf8Decode2( str.data(), str.size(), INOUT pos ));
+					sum += usize(Utf8Decode2( str.data(), str.size(), INOUT pos ));
+				}
+				sum2 = sum;
+			});
+
+		AE_LOGI( "sum: "s << ToString( sum1 == sum2 ));
+	}
+
+
+	static void  Utf8Bulk_Test ()
+	{
+		constexpr usize		N = 1'000;
+		Benchmark			bench{ "utf8 bulk" };
+		U8String			text;
+
+		// mostly ASCII with some multibyte symbols, like localized UI text
+		for (usize i = 0; i < 2'000; ++i) {
+			text << u8"Some text, \u0442\u0435\u043A\u0441\u0442, \u6587\u5B57 \U0001F600. ";
 		}
-		profiler.EndIteration();
-		profiler.EndTest();
 
-		profiler.BeginTest( "2" );
-		profiler.BeginIteration();
-		{
-			for (usize i = 0; i < N; ++i)
+		Array<CharUtf32>	symbols;
+		symbols.resize( text.size() );
+
+		usize	sum1 = 0, sum2 = 0, sum3 = 0, sum4 = 0;
+
+		bench.Run( "validate scalar", [&] ()
 			{
-				usize	pos = 0;
-				sum2 += usize(Utf8Decode2( str.data(), str.size(), INOUT pos ));
-				sum2 += usize(Utf8Decode2( str.data(), str.size(), INOUT pos ));
-				sum2 += usize(Utf8Decode2( str.data(), str.size(), INOUT pos ));
-				sum2 += usize(Utf8Decode2( str.data(), str.size(), INOUT pos ));
-				sum2 += usize(Utf8Decode2( str.data(), str.size(), INOUT pos ));
-			}
-		}
-		profiler.EndIteration();
-		profiler.EndTest();
+				usize	sum = 0;
+				for (usize i = 0; i < N; ++i)
+					sum += usize(Base::_hidden_::Utf8Validate_Scalar( text.data(), text.size() ));
+				sum1 = sum;
+			});
 
-		AE_LOGI( "sum: "s << ToString( sum1 == sum2 ));
+		bench.Run( "validate", [&] ()
+			{
+				usize	sum = 0;
+				for (usize i = 0; i < N; ++i)
+					sum += usize(Utf8Validate( text ));
+				sum2 = sum;
+			});
+
+		bench.Run( "char count", [&] ()
+			{
+				usize	sum = 0;
+				for (usize i = 0; i < N; ++i)
+					sum += Utf8CharCount( text );
+				sum3 = sum;
+			});
+
+		bench.Run( "decode", [&] ()
+			{
+				usize	sum = 0;
+				for (usize i = 0; i < N; ++i)
+				{
+					usize	pos = 0;
+					sum += Utf8Decode( text, INOUT pos, OUT symbols.data(), symbols.size() );
+				}
+				sum4 = sum;
+			});
+
+		CHECK( sum1 == N );
+		CHECK( sum2 == N );
+		CHECK( sum3 == sum4 );
 	}
 }
 
@@ -115,6 +170,7 @@ namespace
 extern void PerfTest_Utf8 ()
 {
 	Utf8Decode_Test();
+	Utf8Bulk_Test();
 
 	TEST_PASSED();
 }
@@ -17,13 +17,18 @@ int main (const int argc, char* argv[])
   #ifdef AE_RELEASE
 	BEGIN_TEST();
 
+  # ifndef AE_PLATFORM_ANDROID
+	BenchmarkReport::Instance().ParseArgs( argc, argv );
+  # endif
+
 	PerfTest_HashSet();
 	PerfTest_HashMap();
+	PerfTest_Utf8();
+	PerfTest_FindSubString();
+	PerfTest_MinSleepTime();
 
-	//PerfTest_MinSleepTime();
-	//PerfTest_Utf8();
-	//PerfTest_FindSubString();
-	//PerfTest_LogicOp();
+	if ( not BenchmarkReport::Instance().Finish() )
+		return 1;
 
 	AE_LOGI( "PerformanceTests.Base finished" );
 
@@ -26,6 +26,8 @@ namespace
 
 	const uint		c_WaitIOFreq	= 0xF;	// 1 or 'c_WaitIOFreq' requests will trigger IO event handling
 
+	const uint		c_LargeBlock	= 1u << 20;	// Mb, for large sequential read
+
 	StaticAssert( IsMultipleOf( c_FileSize, c_BufferSize ));
 
 
@@ -38,7 +40,7 @@ namespace
 
 
 	template <typename RFile, typename WFile>
-	static void  SyncSeqReadDS (IntervalProfiler &profiler)
+	static void  SyncSeqReadDS (Benchmark &profiler)
 	{
 		Unused( ThreadUtils::SetAffinity( uint(c_CoreId) ));
 
@@ -96,7 +98,7 @@ namespace
 
 
 	template <typename RFile, typename WFile>
-	static void  AsyncSeqReadDS (IntervalProfiler &profiler)
+	static void  AsyncSeqReadDS (Benchmark &profiler)
 	{
 		LocalTaskScheduler	scheduler	{IOThreadCount(1), c_CoreId};
 		TEST( scheduler->GetFileIOService() );
@@ -189,7 +191,7 @@ namespace
 
 
 	template <typename RFile, typename WFile>
-	static void  SyncRndReadDS (IntervalProfiler &profiler)
+	static void  SyncRndReadDS (Benchmark &profiler)
 	{
 		Unused( ThreadUtils::SetAffinity( uint(c_CoreId) ));
 
@@ -252,7 +254,7 @@ namespace
 
 
 	template <typename RFile, typename WFile>
-	static void  AsyncRndReadDS (IntervalProfiler &profiler)
+	static void  AsyncRndReadDS (Benchmark &profiler)
 	{
 		LocalTaskScheduler	scheduler	{IOThreadCount(1), c_CoreId};
 		TEST( scheduler->GetFileIOService() );
@@ -348,6 +350,136 @@ namespace
 		}
 		profiler.EndTest();
 	}
+
+
+	static void  WriteLargeFile (const Path &fname)
+	{
+		FileWStream		wfile { fname };
+		TEST( wfile.IsOpen() );
+
+		Array<ulong>	buf;	buf.resize( c_LargeBlock / sizeof(ulong) );
+
+		for (ulong pos = 0; pos < c_FileSize; pos += c_LargeBlock)
+		{
+			for (uint i = 0; i < buf.size(); ++i) {
+				buf[i] = pos + i;
+			}
+			TEST_Eq( wfile.WriteSeq( buf.data(), ArraySizeOf(buf) ), c_LargeBlock );
+		}
+		TEST_Eq( wfile.Position(), c_FileSize );
+	}
+
+
+	// Compare page cache, 'NoReuse' and 'Direct' modes for large file which is readn only once.
+	// Buffer is allocated by 'Array' and is not aligned for O_DIRECT, so 'Direct' mode will use bounce buffers.
+	template <typename RFile>
+	static void  SyncLargeSeqRead (Benchmark &profiler, const typename RFile::EMode mode, StringView name)
+	{
+		Unused( ThreadUtils::SetAffinity( uint(c_CoreId) ));
+
+		profiler.BeginTest( name );
+
+		const Path		fname {"perf2_data.bin"};
+		WriteLargeFile( fname );
+
+		ClearFileCache();
+		AE_LOGI( "begin sync large read test" );
+		{
+			auto	rfile = MakeRC<RFile>( fname, mode );
+			TEST( rfile->IsOpen() );
+			TEST_Eq( rfile->Size(), c_FileSize );
+
+			Array<ulong>	buf;	buf.resize( c_FileSize / sizeof(ulong) + 1 );
+			void*			dst = buf.data() + SizeOf<uint>;	// break alignment
+
+			profiler.BeginIteration();
+			for (ulong pos = 0; pos < c_FileSize; pos += c_LargeBlock)
+			{
+				TEST_Eq( rfile->ReadSeq( dst + Bytes{pos}, Bytes{c_LargeBlock} ), Bytes{c_LargeBlock});
+			}
+			profiler.EndIteration();
+
+			// validate data
+			for (ulong pos = 0; pos < c_FileSize; pos += c_LargeBlock)
+			{
+				ulong	val;
+				MemCopy( OUT &val, dst + Bytes{pos}, SizeOf<ulong> );
+				TEST_Eq( val, pos );
+			}
+		}
+		profiler.EndTest();
+	}
+
+
+	template <typename RFile>
+	static void  AsyncLargeSeqRead (Benchmark &profiler, const typename RFile::EMode mode, StringView name)
+	{
+		LocalTaskScheduler	scheduler	{IOThreadCount(1), c_CoreId};
+		TEST( scheduler->GetFileIOService() );
+
+		profiler.BeginTest( name );
+
+		const Path		fname {"perf2_data.bin"};
+		WriteLargeFile( fname );
+
+		ClearFileCache();
+		AE_LOGI( "begin async large read test" );
+		{
+			auto	rfile = MakeRC<RFile>( fname, mode );
+			TEST( rfile->IsOpen() );
+			TEST_Eq( rfile->Size(), c_FileSize );
+
+			Array<AsyncDSRequest>	req_arr;
+			req_arr.reserve( c_FileSize / c_LargeBlock );
+
+			profiler.BeginIteration();
+
+			// memory is allocated by data source, in 'Direct' mode it is aligned for O_DIRECT
+			for (ulong pos = 0; pos < c_FileSize; pos += c_LargeBlock)
+			{
+				for (;;)
+				{
+					AsyncDSRequest	req = rfile->ReadBlock( Bytes{pos}, Bytes{c_LargeBlock} );
+					if_unlikely( req->IsCancelled() )
+					{
+						Unused( scheduler->GetFileIOService()->ProcessEvents() );
+						continue;
+					}
+					req_arr.push_back( RVRef(req) );
+					break;
+				}
+			}
+
+			for (;;)
+			{
+				Unused( scheduler->GetFileIOService()->ProcessEvents() );
+
+				usize	complete = 0;
+				for (auto& req : req_arr)
+				{
+					complete += usize{req->IsFinished()};
+				}
+
+				if ( complete == req_arr.size() )
+					break;
+			}
+
+			profiler.EndIteration();
+
+			// validate data
+			for (auto& req : req_arr)
+			{
+				const auto	res = req->GetResult();
+				TEST( req->IsCompleted() );
+				TEST_Eq( res.dataSize, Bytes{c_LargeBlock} );
+				TEST_Eq( res.AsArray<ulong>()[0], ulong{res.pos} );
+			}
+
+			req_arr.clear();
+			TEST_Eq( rfile.use_count(), 1 );
+		}
+		profiler.EndTest();
+	}
 }
 
 extern void  PerfTest_AsyncFile (const Path &testFolder)
@@ -364,7 +496,7 @@ extern void  PerfTest_AsyncFile (const Path &testFolder)
 			c_CoreId = ECpuCoreId(core->FirstLogicalCore());
 	}
 
-	IntervalProfiler	profiler{ "AsyncFile test" };
+	Benchmark	profiler{ "AsyncFile test" };
 
 	SyncSeqReadDS< FileRStream,				FileWStream >( profiler );
 	AsyncSeqReadDS< FileAsyncRDataSource,	FileWStream >( profiler );
@@ -372,6 +504,19 @@ extern void  PerfTest_AsyncFile (const Path &testFolder)
 	SyncRndReadDS< FileRDataSource,			FileWStream >( profiler );
 	AsyncRndReadDS< FileAsyncRDataSource,	FileWStream >( profiler );
 
+  #ifdef AE_PLATFORM_UNIX_BASED
+	{
+		using EMode = FileRStream::EMode;
+
+		SyncLargeSeqRead< FileRStream >( profiler, EMode::SequentialScan,						"Sync Large Read (page cache)" );
+		SyncLargeSeqRead< FileRStream >( profiler, EMode::SequentialScan | EMode::NoReuse,	"Sync Large Read (no reuse)" );
+		SyncLargeSeqRead< FileRStream >( profiler, EMode::SequentialScan | EMode::Direct,		"Sync Large Read (direct)" );
+
+		AsyncLargeSeqRead< FileAsyncRDataSource >( profiler, EMode::SequentialScan,					"Async Large Read (page cache)" );
+		AsyncLargeSeqRead< FileAsyncRDataSource >( profiler, EMode::SequentialScan | EMode::Direct,	"Async Large Read (direct)" );
+	}
+  #endif
+
 	FileSystem::SetCurrentPath( testFolder );
 	FileSystem::DeleteDirectory( folder );
 
@@ -50,7 +50,7 @@ namespace
 	};
 
 
-	static void  AsyncMutex_Test2 (IntervalProfiler &profiler)
+	static void  AsyncMutex_Test2 (Benchmark &profiler)
 	{
 		LocalTaskScheduler	scheduler {WorkerQueueCount(1)};
 
@@ -84,7 +84,7 @@ namespace
 
 	static void  AsyncMutex_Test ()
 	{
-		IntervalProfiler	profiler{ "Async mutex test" };
+		Benchmark	profiler{ "Async mutex test" };
 
 		profiler.BeginTest( "AsyncMutex" );
 		for (uint i = 0; i < 10; ++i)
@@ -0,0 +1,235 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+/*
+	Compares lock-free queues with 'Synchronized< SpinLock, Array<T> >' which is used in handoff between threads.
+	Each iteration transfers 'Count' values from producers to consumers.
+*/
+
+#include "Perf_Common.h"
+
+namespace
+{
+	static constexpr uint	Count			= 1'000'000;
+	static constexpr uint	MPMC_Threads	= 4;		// producers and consumers
+	static constexpr uint	BatchSize		= 32;
+
+
+	//
+	// MPMC
+	//
+	template <typename PushFn, typename PopFn>
+	static void  MPMC_Run (Benchmark &profiler, PushFn &&push, PopFn &&pop)
+	{
+		Atomic<uint>		popped	{0};
+		Atomic<ulong>		sum		{0};
+		Array<StdThread>	threads;
+		Barrier				sync	{MPMC_Threads * 2 + 1};
+
+		for (uint t = 0; t < MPMC_Threads; ++t)
+		{
+			threads.push_back( StdThread{ [&, t] ()
+				{
+					sync.Wait();
+					for (uint i = t; i < Count; i += MPMC_Threads)
+					{
+						for (; not push( i );) {
+							ThreadUtils::Pause();
+						}
+					}
+				}});
+
+			threads.push_back( StdThread{ [&] ()
+				{
+					ulong	local_sum = 0;
+					sync.Wait();
+					for (; popped.load() < Count;)
+					{
+						uint	val;
+						if ( pop( OUT val ))
+						{
+							local_sum += val;
+							popped.fetch_add( 1 );
+						}
+						else
+							ThreadUtils::Pause();
+					}
+					sum.fetch_add( local_sum );
+				}});
+		}
+
+		profiler.BeginIteration();
+		sync.Wait();
+
+		for (auto& t : threads) {
+			t.join();
+		}
+		profiler.EndIteration();
+
+		TEST_Eq( sum.load(), ulong(Count) * (Count - 1) / 2 );
+	}
+
+
+	static void  MPMC_LfStaticQueue (Benchmark &profiler)
+	{
+		LfStaticQueue< uint, 1024 >		queue;
+
+		MPMC_Run( profiler,
+				  [&queue] (uint val)			{ return queue.Push( val ); },
+				  [&queue] (OUT uint &val)		{ return queue.Pop( OUT val ); });
+	}
+
+
+	static void  MPMC_SyncArray (Benchmark &profiler)
+	{
+		Synchronized< SpinLock, Array<uint> >	queue;
+
+		queue.WriteLock()->reserve( 1024 );
+
+		MPMC_Run( profiler,
+				  [&queue] (uint val)
+				  {
+					auto	arr = queue.WriteLock();
+					if ( arr->size() >= 1024 )
+						return false;
+					arr->push_back( val );
+					return true;
+				  },
+				  [&queue] (OUT uint &val)
+				  {
+					auto	arr = queue.WriteLock();
+					if ( arr->empty() )
+						return false;
+					val = arr->back();
+					arr->pop_back();
+					return true;
+				  });
+	}
+
+
+	//
+	// SPSC
+	//
+	template <typename PushFn, typename PopFn>
+	static void  SPSC_Run (Benchmark &profiler, PushFn &&push, PopFn &&pop)
+	{
+		ulong	sum = 0;
+
+		profiler.BeginIteration();
+
+		StdThread	producer{ [&] ()
+			{
+				StaticArray< uint, BatchSize >	batch;
+				for (uint i = 0; i < Count; i += BatchSize)
+				{
+					for (uint j = 0; j < BatchSize; ++j) {
+						batch[j] = i + j;
+					}
+					for (usize pushed = 0; pushed < BatchSize;)
+					{
+						pushed += push( ArrayView<uint>{ batch.data() + pushed, BatchSize - pushed });
+						ThreadUtils::Pause();
+					}
+				}
+			}};
+
+		StaticArray< uint, BatchSize >	batch;
+		for (uint received = 0; received < Count;)
+		{
+			const usize	n = pop( OUT batch.data(), batch.size() );
+			for (usize i = 0; i < n; ++i) {
+				sum += batch[i];
+			}
+			received += uint(n);
+
+			if ( n == 0 )
+				ThreadUtils::Pause();
+		}
+
+		producer.join();
+		profiler.EndIteration();
+
+		TEST_Eq( sum, ulong(Count) * (Count - 1) / 2 );
+	}
+
+
+	static void  SPSC_LfSpscChannel (Benchmark &profiler)
+	{
+		LfSpscChannel< uint, 1024 >		channel;
+
+		SPSC_Run( profiler,
+				  [&channel] (ArrayView<uint> values)			{ return channel.PushBatch( values ); },
+				  [&channel] (OUT uint* dst, usize maxCount)	{ return channel.PopBatch( OUT dst, maxCount ); });
+	}
+
+
+	static void  SPSC_SyncArray (Benchmark &profiler)
+	{
+		Synchronized< SpinLock, Array<uint> >	queue;
+		Array<uint>								local;
+		usize									local_pos = 0;
+
+		queue.WriteLock()->reserve( 1024 );
+
+		SPSC_Run( profiler,
+				  [&queue] (ArrayView<uint> values) -> usize
+				  {
+					auto		arr	= queue.WriteLock();
+					const usize	cnt	= Min( values.size(), usize{1024} - Min( arr->size(), usize{1024} ));
+					arr->insert( arr->end(), values.begin(), values.begin() + cnt );
+					return cnt;
+				  },
+				  [&] (OUT uint* dst, usize maxCount) -> usize
+				  {
+					// take all values under the lock, this is how handoff is implemented in most places
+					if ( local_pos >= local.size() )
+					{
+						local.clear();
+						local_pos = 0;
+						std::swap( local, *queue.WriteLock() );
+					}
+					const usize	cnt = Min( maxCount, local.size() - local_pos );
+					MemCopy( OUT dst, local.data() + local_pos, SizeOf<uint> * cnt );
+					local_pos += cnt;
+					return cnt;
+				  });
+	}
+
+
+	static void  LfQueue_Test ()
+	{
+		Benchmark	profiler{ "Lock-free queue test" };
+
+		profiler.BeginTest( "MPMC: LfStaticQueue" );
+		for (uint i = 0; i < 10; ++i) {
+			MPMC_LfStaticQueue( profiler );
+		}
+		profiler.EndTest();
+
+		profiler.BeginTest( "MPMC: Synchronized<Array>" );
+		for (uint i = 0; i < 10; ++i) {
+			MPMC_SyncArray( profiler );
+		}
+		profiler.EndTest();
+
+		profiler.BeginTest( "SPSC: LfSpscChannel" );
+		for (uint i = 0; i < 10; ++i) {
+			SPSC_LfSpscChannel( profiler );
+		}
+		profiler.EndTest();
+
+		profiler.BeginTest( "SPSC: Synchronized<Array>" );
+		for (uint i = 0; i < 10; ++i) {
+			SPSC_SyncArray( profiler );
+		}
+		profiler.EndTest();
+
+		AE_LOGI( "Transferred "s << ToString(Count) << " values per iteration" );
+	}
+}
+
+
+extern void  PerfTest_LfQueue ()
+{
+	LfQueue_Test();
+
+	TEST_PASSED();
+}
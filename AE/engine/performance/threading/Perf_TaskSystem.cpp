@@ -9,7 +9,7 @@
 		 - stage2: overhead 25-40%
 	----
 
-	AE_USE_THREAD_WAKEUP = 1
+	AE_USE_THREAD_WAKEUP = 1 (mutex and condition variable, before futex-based parking)
 		Test1:
 		 - stage0: overhead 75%
 		 - stage1: overhead 80%
@@ -7,6 +7,7 @@ extern void  PerfTest_AsyncFile (const AE::Base::Path &curr);
 extern void  PerfTest_TaskSystem ();
 extern void  PerfTest_TaskSystemCoro ();
 extern void  PerfTest_MtAllocator ();
+extern void  PerfTest_LfQueue ();
 
 extern void  PerfTest_Raw_Atomic ();
 extern void  PerfTest_Raw_ThreadWakeUp ();
@@ -21,16 +22,32 @@ int main (const int argc, char* argv[])
   #ifdef AE_RELEASE
 	BEGIN_TEST();
 
+	// tests are multithreaded, main thread should not be pinned
+	{
+		auto&	report	= BenchmarkReport::Instance();
+		auto	s		= report.GetSettings();
+		s.pinThread = false;
+		report.SetSettings( s );
+
+	  # ifndef AE_PLATFORM_ANDROID
+		report.ParseArgs( argc, argv );
+	  # endif
+	}
+
 	PerfTest_AsyncFile( curr );
 	PerfTest_AsyncMutex();
 	PerfTest_TaskSystem();
 	PerfTest_TaskSystemCoro();
+	PerfTest_LfQueue();
 
 	//PerfTest_MtAllocator();
 
 	//PerfTest_Raw_ThreadWakeUp();
 	//PerfTest_Raw_Atomic();
 
+	if ( not BenchmarkReport::Instance().Finish() )
+		return 1;
+
 	AE_LOGI( "PerformanceTests.Threading finished" );
 
   #else
@@ -2431,6 +2431,8 @@ bool  StartsWith (const string &, const string &);
 bool  StartsWithIC (const string &, const string &);
 bool  EndsWith (const string &, const string &);
 bool  EndsWithIC (const string &, const string &);
+bool  Utf8IsValid (const string &);
+uint  Utf8Length (const string &);
 RGBA32f  Lerp (const RGBA32f & x, const RGBA32f & y, float factor);
 RGBA32f  AdjustContrast (const RGBA32f & col, float factor);
 RGBA32f  Rainbow (float factor);
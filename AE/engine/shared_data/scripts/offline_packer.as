@@ -1085,6 +1085,8 @@ bool  StartsWith (const string &, const string &);
 bool  StartsWithIC (const string &, const string &);
 bool  EndsWith (const string &, const string &);
 bool  EndsWithIC (const string &, const string &);
+bool  Utf8IsValid (const string &);
+uint  Utf8Length (const string &);
 void  LogError (const string & msg);
 void  LogInfo (const string & msg);
 void  LogDebug (const string & msg);
@@ -1110,6 +1112,8 @@ struct PipelineCompiler
 	void  PipelineIncludeDir (const string &);
 	void  SetOutputCPPFile (const string &, const string &, uint);
 	void  SetOutputCPPFile (const string &, const string &, EReflectionFlags);
+	void  SetShaderCacheFolder (const string &);
+	void  SetOutputDepFile (const string &);
 	void  Compile (const string &);
 	void  CompileWithNameMapping (const string &);
 };
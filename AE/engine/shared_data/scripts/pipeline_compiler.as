@@ -2841,6 +2841,8 @@ bool  StartsWith (const string &, const string &);
 bool  StartsWithIC (const string &, const string &);
 bool  EndsWith (const string &, const string &);
 bool  EndsWithIC (const string &, const string &);
+bool  Utf8IsValid (const string &);
+uint  Utf8Length (const string &);
 string  ToString (int value);
 string  ToString (uint value);
 string  ToString (int64 value);
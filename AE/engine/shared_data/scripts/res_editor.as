@@ -1567,6 +1567,8 @@ bool  StartsWith (const string &, const string &);
 bool  StartsWithIC (const string &, const string &);
 bool  EndsWith (const string &, const string &);
 bool  EndsWithIC (const string &, const string &);
+bool  Utf8IsValid (const string &);
+uint  Utf8Length (const string &);
 const string Sampler_NearestClamp;
 const string Sampler_NearestRepeat;
 const string Sampler_NearestMirrorRepeat;
@@ -0,0 +1,231 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+/*
+	String builder which writes into stack buffer and moves to the heap only on overflow.
+	Numbers are converted by 'std::to_chars()' in place, without temporary strings.
+
+	Thread-safe: no
+*/
+
+#pragma once
+
+#include "base/Algorithms/StringUtils.h"
+
+namespace AE::Base
+{
+
+	//
+	// String Builder
+	//
+
+	template <usize StackSize = 256>
+	class StringBuilder final : public Noncopyable
+	{
+		StaticAssert( StackSize > 0 );
+
+	// types
+	public:
+		using Self	= StringBuilder< StackSize >;
+
+	private:
+		template <typename T>
+		static constexpr bool	_IsNumber	= IsInteger<T> and not IsSameTypes<T, bool> and not IsSameTypes<T, char>;
+
+
+	// variables
+	private:
+		usize		_length		= 0;
+		bool		_onHeap		= false;
+		String		_heap;
+		char		_stack [StackSize];
+
+
+	// methods
+	public:
+		StringBuilder ()											__NE___	{}
+
+		ND_ StringView	View ()										C_NE___	{ return StringView{ _onHeap ? _heap.data() : _stack, _length }; }
+		ND_ String		ToString ()									C_Th___	{ return String{ View() }; }
+		ND_ usize		size ()										C_NE___	{ return _length; }
+		ND_ bool		empty ()									C_NE___	{ return _length == 0; }
+		ND_ bool		IsOnHeap ()									C_NE___	{ return _onHeap; }
+
+			void		clear ()									__NE___	{ _length = 0;  if ( _onHeap ) _heap.clear(); }
+
+			Self&		Append (StringView str)						__Th___;
+			Self&		Append (char c)								__Th___	{ return Append( StringView{ &c, 1 }); }
+
+		template <uint Radix = 10, typename T>
+			Self&		AppendInt (T value)							__Th___;
+
+		// 11 -> 0011
+		template <uint Radix = 10, typename T>
+			Self&		AppendAligned (T value, usize align, char alignChar = '0')	__Th___;
+
+		// same as 'ToString( double, fractParts, exponent )'
+			Self&		AppendFloat (double value, uint fractParts, Bool exponent = False{})	__Th___;
+
+		// shortest representation which can be parsed without precision lost
+			Self&		AppendFloat (float value)					__Th___	{ return _AppendShortest( value ); }
+			Self&		AppendFloat (double value)					__Th___	{ return _AppendShortest( value ); }
+
+			Self&		operator << (StringView str)				__Th___	{ return Append( str ); }
+			Self&		operator << (const String &str)				__Th___	{ return Append( StringView{str} ); }
+			Self&		operator << (const char* str)				__Th___	{ return str != null ? Append( StringView{str} ) : *this; }
+			Self&		operator << (char c)						__Th___	{ return Append( c ); }
+			Self&		operator << (bool value)					__Th___	{ return Append( value ? "true"sv : "false"sv ); }
+			Self&		operator << (float value)					__Th___	{ return AppendFloat( value ); }
+			Self&		operator << (double value)					__Th___	{ return AppendFloat( value ); }
+
+		template <typename T>
+			EnableIf< _IsNumber<T>, Self& >  operator << (T value)	__Th___	{ return AppendInt<10>( value ); }
+
+	private:
+		ND_ char*		_Reserve (usize count)						__Th___;
+
+		template <typename T>
+			Self&		_AppendShortest (T value)					__Th___;
+	};
+
+
+
+/*
+=================================================
+	_Reserve
+----
+	returns pointer to 'count' chars after current end
+=================================================
+*/
+	template <usize S>
+	char*  StringBuilder<S>::_Reserve (const usize count) __Th___
+	{
+		if_likely( not _onHeap and _length + count <= S )
+			return _stack + _length;
+
+		if ( not _onHeap )
+		{
+			_heap.reserve( Max( S * 2, _length + count ));	// throw
+			_heap.assign( _stack, _length );
+			_onHeap = true;
+		}
+
+		_heap.resize( _length + count );	// throw
+		return _heap.data() + _length;
+	}
+
+/*
+=================================================
+	Append
+=================================================
+*/
+	template <usize S>
+	StringBuilder<S>&  StringBuilder<S>::Append (StringView str) __Th___
+	{
+		if_unlikely( str.empty() )
+			return *this;
+
+		char*	dst = _Reserve( str.size() );	// throw
+		MemCopy( OUT dst, str.data(), StringSizeOf( str ));
+		_length += str.size();
+		return *this;
+	}
+
+/*
+=================================================
+	AppendInt
+=================================================
+*/
+	template <usize S>
+	template <uint Radix, typename T>
+	StringBuilder<S>&  StringBuilder<S>::AppendInt (const T value) __Th___
+	{
+		StaticAssert( IsInteger<T> or IsEnum<T> );
+		StaticAssert( Radix >= 2 and Radix <= 36 );
+
+		char				buf [CT_SizeOfInBits<T> + 2];
+		std::to_chars_result	res;
+
+		// negative value is converted to unsigned for non-decimal radix, same as 'ToString<Radix>()'
+		if constexpr( Radix == 10 and not IsEnum<T> )
+			res = std::to_chars( buf, buf + CountOf(buf), value );
+		else
+			res = std::to_chars( buf, buf + CountOf(buf), ToNearUInt( value ), int(Radix) );
+
+		ASSERT( res.ec == std::errc{} );
+		return Append( StringView{ buf, usize(res.ptr - buf) });
+	}
+
+/*
+=================================================
+	AppendAligned
+=================================================
+*/
+	template <usize S>
+	template <uint Radix, typename T>
+	StringBuilder<S>&  StringBuilder<S>::AppendAligned (const T value, const usize align, const char alignChar) __Th___
+	{
+		ASSERT( alignChar != 0 );
+
+		StringBuilder<CT_SizeOfInBits<T> + 2>	tmp;
+		tmp.template AppendInt<Radix>( value );
+
+		for (usize i = tmp.size(); i < align; ++i) {
+			Append( alignChar );
+		}
+		return Append( tmp.View() );
+	}
+
+/*
+=================================================
+	AppendFloat
+=================================================
+*/
+	template <usize S>
+	StringBuilder<S>&  StringBuilder<S>::AppendFloat (const double value, uint fractParts, Bool exponent) __Th___
+	{
+		ASSERT( (fractParts > 0) and (fractParts < 100) );
+		fractParts = Clamp( fractParts, 1u, 99u );
+
+		// max double is ~1.8e308, so 'fixed' format may require 309 digits for integer part
+		char	buf [420];
+
+	  #ifdef __cpp_lib_to_chars
+		auto	res = std::to_chars( buf, buf + CountOf(buf), value, (exponent ? std::chars_format::scientific : std::chars_format::fixed), int(fractParts) );
+		ASSERT( res.ec == std::errc{} );
+
+		return Append( StringView{ buf, usize(res.ptr - buf) });
+	  #else
+		const char	fmt[8]	= {'%', '0', '.', char('0' + fractParts / 10), char('0' + fractParts % 10), (exponent ? 'e' : 'f'), '\0' };
+		const int	len		= std::snprintf( buf, CountOf(buf), fmt, value );
+		ASSERT( len > 0 );
+
+		return Append( StringView{ buf, usize(Clamp( len, 0, int(CountOf(buf))-1 ))});
+	  #endif
+	}
+
+/*
+=================================================
+	_AppendShortest
+=================================================
+*/
+	template <usize S>
+	template <typename T>
+	StringBuilder<S>&  StringBuilder<S>::_AppendShortest (const T value) __Th___
+	{
+		StaticAssert( IsFloatPoint<T> );
+		char	buf [32];
+
+	  #ifdef __cpp_lib_to_chars
+		auto	res = std::to_chars( buf, buf + CountOf(buf), value );
+		ASSERT( res.ec == std::errc{} );
+
+		return Append( StringView{ buf, usize(res.ptr - buf) });
+	  #else
+		const int	len = std::snprintf( buf, CountOf(buf), (IsSameTypes<T, float> ? "%.9g" : "%.17g"), double(value) );
+		ASSERT( len > 0 );
+
+		return Append( StringView{ buf, usize(Clamp( len, 0, int(CountOf(buf))-1 ))});
+	  #endif
+	}
+
+
+} // AE::Base
@@ -370,6 +370,138 @@ namespace _hidden_
 		return BasicStringView<T>{ first, usize(Max( 0, ssize(last - first) ))};
 	}
 
+#if AE_SIMD_AVX >= 2 or AE_SIMD_SSE >= 20
+#	define AE_PRIVATE_STRING_SIMD
+#endif
+
+namespace _hidden_
+{
+/*
+=================================================
+	StringSimd
+----
+	only ASCII characters are converted to lower case,
+	same as 'ToLowerCase()'.
+=================================================
+*/
+#if AE_SIMD_AVX >= 2
+	struct StringSimd
+	{
+		using V = __m256i;
+		static constexpr usize	Size	= 32;
+		static constexpr uint	AllBits	= ~0u;
+
+		ND_ static V	Load (const char* p)	__NE___	{ return _mm256_loadu_si256( Cast<__m256i>( p )); }
+		ND_ static V	Set (char c)			__NE___	{ return _mm256_set1_epi8( c ); }
+		ND_ static uint	EqMask (V a, V b)		__NE___	{ return uint(_mm256_movemask_epi8( _mm256_cmpeq_epi8( a, b ))); }
+
+		ND_ static V	ToLower (V x)			__NE___
+		{
+			// signed comparison, so non-ASCII characters are not in range
+			const V	upper = _mm256_and_si256( _mm256_cmpgt_epi8( x, Set( 'A'-1 )), _mm256_cmpgt_epi8( Set( 'Z'+1 ), x ));
+			return _mm256_or_si256( x, _mm256_and_si256( upper, Set( 0x20 )));
+		}
+	};
+
+#elif AE_SIMD_SSE >= 20
+	struct StringSimd
+	{
+		using V = __m128i;
+		static constexpr usize	Size	= 16;
+		static constexpr uint	AllBits	= 0xFFFF;
+
+		ND_ static V	Load (const char* p)	__NE___	{ return _mm_loadu_si128( Cast<__m128i>( p )); }
+		ND_ static V	Set (char c)			__NE___	{ return _mm_set1_epi8( c ); }
+		ND_ static uint	EqMask (V a, V b)		__NE___	{ return uint(_mm_movemask_epi8( _mm_cmpeq_epi8( a, b ))); }
+
+		ND_ static V	ToLower (V x)			__NE___
+		{
+			// signed comparison, so non-ASCII characters are not in range
+			const V	upper = _mm_and_si128( _mm_cmpgt_epi8( x, Set( 'A'-1 )), _mm_cmplt_epi8( x, Set( 'Z'+1 )));
+			return _mm_or_si128( x, _mm_and_si128( upper, Set( 0x20 )));
+		}
+	};
+#endif
+
+/*
+=================================================
+	EqualIC
+=================================================
+*/
+	ND_ inline bool  EqualIC (const char* lhs, const char* rhs, const usize size) __NE___
+	{
+		usize	i = 0;
+
+	  #ifdef AE_PRIVATE_STRING_SIMD
+		using S = StringSimd;
+		for (; i + S::Size <= size; i += S::Size)
+		{
+			if_unlikely( S::EqMask( S::ToLower( S::Load( lhs + i )), S::ToLower( S::Load( rhs + i ))) != S::AllBits )
+				return false;
+		}
+	  #endif
+
+		for (; i < size; ++i)
+		{
+			if_unlikely( ToLowerCase( lhs[i] ) != ToLowerCase( rhs[i] ))
+				return false;
+		}
+		return true;
+	}
+
+/*
+=================================================
+	FindString_SIMD
+----
+	from http://0x80.pl/articles/simd-strfind.html#generic-sse-avx2
+	compares first and last characters of 'substr' for whole block,
+	then checks only candidates.
+	Returns position of match or position from which search must be continued by scalar code.
+=================================================
+*/
+#ifdef AE_PRIVATE_STRING_SIMD
+	template <bool IgnoreCase>
+	ND_ usize  FindString_SIMD (StringView str, StringView substr, usize first, const usize cnt, OUT bool &found) __NE___
+	{
+		using S = StringSimd;
+
+		const auto		Prepare		= [] (S::V v) __NE___ { if constexpr( IgnoreCase ) return S::ToLower( v ); else return v; };
+		const usize		last_off	= substr.size() - 1;
+		const usize		mid_len		= last_off > 0 ? last_off - 1 : 0;
+		const S::V		first_ch	= S::Set( IgnoreCase ? ToLowerCase( substr[0] )        : substr[0] );
+		const S::V		last_ch		= S::Set( IgnoreCase ? ToLowerCase( substr[last_off] ) : substr[last_off] );
+
+		found = false;
+
+		// 'first + last_off + S::Size <= str.size()'
+		for (; first + S::Size <= cnt; first += S::Size)
+		{
+			uint	mask =	S::EqMask( Prepare( S::Load( str.data() + first )),				first_ch ) &
+							S::EqMask( Prepare( S::Load( str.data() + first + last_off )),	last_ch );
+
+			for (; mask != 0;)
+			{
+				const usize	i = first + ExtractBitIndex<uint>( INOUT mask );
+				bool		eq;
+
+				if constexpr( IgnoreCase )
+					eq = EqualIC( str.data() + i + 1, substr.data() + 1, mid_len );
+				else
+					eq = (std::memcmp( str.data() + i + 1, substr.data() + 1, mid_len ) == 0);
+
+				if_unlikely( eq )
+				{
+					found = true;
+					return i;
+				}
+			}
+		}
+		return first;
+	}
+#endif
+
+} // _hidden_
+
 /*
 =================================================
 	EqualIC
@@ -383,12 +515,7 @@ namespace _hidden_
 		if ( lhs.size() != rhs.size() )
 			return false;
 
-		for (usize i = 0; i < lhs.length(); ++i)
-		{
-			if_unlikely( ToLowerCase( lhs[i] ) != ToLowerCase( rhs[i] ))
-				return false;
-		}
-		return true;
+		return _hidden_::EqualIC( lhs.data(), rhs.data(), lhs.size() );
 	}
 
 /*
@@ -404,8 +531,20 @@ namespace _hidden_
 		if ( str.size() < substr.size() )
 			return str.size();
 
+		if_unlikely( substr.empty() )
+			return Min( first, str.size() );
+
 		const usize	cnt = str.size() - substr.size() + 1;
 
+	  #ifdef AE_PRIVATE_STRING_SIMD
+		{
+			bool	found;
+			first = _hidden_::FindString_SIMD<false>( str, substr, first, cnt, OUT found );
+			if ( found )
+				return first;
+		}
+	  #endif
+
 		for_likely (; first < cnt;)
 		{
 			first = FindChar( str.data(), first, cnt, substr[0] );
@@ -431,44 +570,32 @@ namespace _hidden_
 	comparison is case insensitive.
 =================================================
 */
-	ND_ inline usize  FindStringIC (StringView str, StringView substr, const usize first = 0) __NE___
+	ND_ inline usize  FindStringIC (StringView str, StringView substr, usize first = 0) __NE___
 	{
 		if ( str.size() < substr.size() )
 			return str.size();
 
+		if_unlikely( substr.empty() )
+			return Min( first, str.size() );
+
 		const usize	cnt = str.size() - substr.size() + 1;
-		const char	up	= ToUpperCase( substr[0] );
-		const char	low	= ToLowerCase( substr[0] );
 
-		for_likely (usize i = first; i < cnt;)
+	  #ifdef AE_PRIVATE_STRING_SIMD
 		{
-			i = FindChar( str.data(), i, cnt, up );
-			if_likely( i < cnt )
-			{
-				usize j = 1;
-				for (;(j < substr.size()) and (ToUpperCase( substr[j] ) == ToUpperCase( str[i+j] )); ++j)
-				{}
-				if_unlikely( j >= substr.size() )
-					return i;
-				++i;
-			}
+			bool	found;
+			first = _hidden_::FindString_SIMD<true>( str, substr, first, cnt, OUT found );
+			if ( found )
+				return first;
 		}
+	  #endif
 
-		if_likely( up == low )
-			return str.size();
+		const char	low = ToLowerCase( substr[0] );
 
-		for_likely (usize i = first; i < cnt;)
+		for_likely (; first < cnt; ++first)
 		{
-			i = FindChar( str.data(), i, cnt, low );
-			if_likely( i < cnt )
-			{
-				usize j = 1;
-				for (;(j < substr.size()) and (ToLowerCase( substr[j] ) == ToLowerCase( str[i+j] )); ++j)
-				{}
-				if_unlikely( j >= substr.size() )
-					return i;
-				++i;
-			}
+			if ( ToLowerCase( str[first] ) == low and
+				 _hidden_::EqualIC( str.data() + first + 1, substr.data() + 1, substr.size() - 1 ))
+				return first;
 		}
 		return str.size();
 	}
@@ -528,12 +655,7 @@ namespace _hidden_
 		if ( str.length() < substr.length() )
 			return false;
 
-		for_likely (usize i = 0; i < substr.length(); ++i)
-		{
-			if_unlikely( ToLowerCase( str[i] ) != ToLowerCase( substr[i] ))
-				return false;
-		}
-		return true;
+		return _hidden_::EqualIC( str.data(), substr.data(), substr.length() );
 	}
 
 /*
@@ -565,12 +687,7 @@ namespace _hidden_
 		if ( str.length() < substr.length() )
 			return false;
 
-		for_likely (usize i = 1; i <= substr.length(); ++i)
-		{
-			if_unlikely( ToLowerCase(str[str.length() - i]) != ToLowerCase(substr[substr.length() - i]) )
-				return false;
-		}
-		return true;
+		return _hidden_::EqualIC( str.data() + str.length() - substr.length(), substr.data(), substr.length() );
 	}
 
 /*
@@ -801,11 +918,13 @@ namespace _hidden_
 			return std::to_string( value );
 		}
 		else
-		if constexpr( Radix == 16 )
 		{
-			std::stringstream	str;
-			str << std::hex << ToNearUInt( value );
-			return str.str();
+			StaticAssert( Radix >= 2 and Radix <= 36 );
+
+			char	buf [CT_SizeOfInBits<T> + 1];
+			auto	res = std::to_chars( buf, buf + CountOf(buf), ToNearUInt( value ), int(Radix) );
+			ASSERT( res.ec == std::errc{} );
+			return String{ buf, res.ptr };
 		}
 	}
 
@@ -7,6 +7,7 @@
 
 #ifdef AE_ENABLE_UTF8PROC
 # include "base/Algorithms/Cast.h"
+# include "base/Memory/MemUtils.h"
 # include "utf8proc.h"
 
 # if UTF8PROC_VERSION_MAJOR != 2 or UTF8PROC_VERSION_MINOR != 9
@@ -166,6 +167,197 @@ namespace _hidden_
 		return false;
 	}
 
+/*
+=================================================
+	Utf8Validate_Scalar
+----
+	rejects overlong encoding, surrogates, code points above 0x10FFFF
+	and incomplete sequences.
+=================================================
+*/
+	ND_ inline bool  Utf8Validate_Scalar (const CharUtf8 *str, const usize length) __NE___
+	{
+		constexpr ulong	ascii_mask = 0x8080'8080'8080'8080ull;
+
+		for (usize i = 0; i < length;)
+		{
+			if ( i + 8 <= length )
+			{
+				ulong	bits;
+				MemCopy( OUT &bits, str + i, SizeOf<ulong> );
+
+				if_likely( (bits & ascii_mask) == 0 )
+				{
+					i += 8;
+					continue;
+				}
+			}
+
+			const uint	c = uint{str[i]};
+			if ( c < 0x80 )
+			{
+				++i;
+				continue;
+			}
+
+			uint	n;
+			uint	cp;
+			uint	min_cp;
+
+			if ( (c & 0xE0) == 0xC0 )		{ n = 1;  cp = c & 0x1F;  min_cp = 0x80; }
+			else
+			if ( (c & 0xF0) == 0xE0 )		{ n = 2;  cp = c & 0x0F;  min_cp = 0x800; }
+			else
+			if ( (c & 0xF8) == 0xF0 )		{ n = 3;  cp = c & 0x07;  min_cp = 0x1'0000; }
+			else
+				return false;
+
+			if_unlikely( i + n >= length )
+				return false;
+
+			for (uint j = 1; j <= n; ++j)
+			{
+				const uint	b = uint{str[i+j]};
+				if_unlikely( (b & 0xC0) != 0x80 )
+					return false;
+
+				cp = (cp << 6) | (b & 0x3F);
+			}
+
+			if_unlikely( cp < min_cp or cp > 0x10'FFFF or (cp >= 0xD800 and cp <= 0xDFFF) )
+				return false;
+
+			i += n + 1;
+		}
+		return true;
+	}
+
+/*
+=================================================
+	Utf8Validate_SSSE3
+----
+	from 'Validating UTF-8 In Less Than One Instruction Per Byte', John Keiser, Daniel Lemire, 2020.
+	Each byte is classified by 3 lookup tables: high and low nibbles of previous byte and high nibble of current byte,
+	error bits are set only if all tables agree. 3- and 4-byte sequences are additionally checked by 'must23'.
+=================================================
+*/
+#if AE_SIMD_SSE >= 31
+	ND_ inline bool  Utf8Validate_SSSE3 (const CharUtf8 *str, const usize length) __NE___
+	{
+		enum : ubyte
+		{
+			TOO_SHORT		= 1 << 0,	// 11______ 0_______,  11______ 11______
+			TOO_LONG		= 1 << 1,	// 0_______ 10______
+			OVERLONG_3		= 1 << 2,	// 11100000 100_____
+			TOO_LARGE		= 1 << 3,	// 11110100 1001____,  11110100 101_____,  11110101..11111111 10______
+			SURROGATE		= 1 << 4,	// 11101101 101_____
+			OVERLONG_2		= 1 << 5,	// 1100000_ 10______
+			TOO_LARGE_1000	= 1 << 6,	// 11110101..11111111 1000____
+			OVERLONG_4		= 1 << 6,	// 11110000 1000____
+			TWO_CONTS		= 1 << 7,	// 10______ 10______
+			CARRY			= TOO_SHORT | TOO_LONG | TWO_CONTS,
+		};
+		#define B( _x_ )	char(_x_)
+
+		const __m128i	byte_1_high_tbl	= _mm_setr_epi8(
+			// 0_______
+			B(TOO_LONG), B(TOO_LONG), B(TOO_LONG), B(TOO_LONG), B(TOO_LONG), B(TOO_LONG), B(TOO_LONG), B(TOO_LONG),
+			// 10______
+			B(TWO_CONTS), B(TWO_CONTS), B(TWO_CONTS), B(TWO_CONTS),
+			// 1100____, 1101____
+			B(TOO_SHORT | OVERLONG_2), B(TOO_SHORT),
+			// 1110____
+			B(TOO_SHORT | OVERLONG_3 | SURROGATE),
+			// 1111____
+			B(TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4) );
+
+		const __m128i	byte_1_low_tbl	= _mm_setr_epi8(
+			// ____0000, ____0001
+			B(CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4), B(CARRY | OVERLONG_2),
+			// ____001_
+			B(CARRY), B(CARRY),
+			// ____0100, ____0101
+			B(CARRY | TOO_LARGE), B(CARRY | TOO_LARGE | TOO_LARGE_1000),
+			// ____011_
+			B(CARRY | TOO_LARGE | TOO_LARGE_1000), B(CARRY | TOO_LARGE | TOO_LARGE_1000),
+			// ____1___, ____1101
+			B(CARRY | TOO_LARGE | TOO_LARGE_1000), B(CARRY | TOO_LARGE | TOO_LARGE_1000),
+			B(CARRY | TOO_LARGE | TOO_LARGE_1000), B(CARRY | TOO_LARGE | TOO_LARGE_1000),
+			B(CARRY | TOO_LARGE | TOO_LARGE_1000), B(CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE),
+			B(CARRY | TOO_LARGE | TOO_LARGE_1000), B(CARRY | TOO_LARGE | TOO_LARGE_1000) );
+
+		const __m128i	byte_2_high_tbl	= _mm_setr_epi8(
+			// 0_______
+			B(TOO_SHORT), B(TOO_SHORT), B(TOO_SHORT), B(TOO_SHORT), B(TOO_SHORT), B(TOO_SHORT), B(TOO_SHORT), B(TOO_SHORT),
+			// 1000____
+			B(TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4),
+			// 1001____
+			B(TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE),
+			// 101_____
+			B(TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE),
+			B(TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE),
+			// 11______
+			B(TOO_SHORT), B(TOO_SHORT), B(TOO_SHORT), B(TOO_SHORT) );
+
+		// last 3 bytes must not start 2, 3 or 4 byte sequence
+		const __m128i	max_incomplete	= _mm_setr_epi8( -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, B(0xF0-1), B(0xE0-1), B(0xC0-1) );
+		#undef B
+
+		const __m128i	nibble_mask		= _mm_set1_epi8( 0x0F );
+		const __m128i	third_byte		= _mm_set1_epi8( char(0xE0 - 0x80) );
+		const __m128i	fourth_byte		= _mm_set1_epi8( char(0xF0 - 0x80) );
+		const __m128i	high_bit		= _mm_set1_epi8( char(0x80) );
+
+		__m128i			error			= _mm_setzero_si128();
+		__m128i			prev_input		= _mm_setzero_si128();
+		__m128i			prev_incomplete	= _mm_setzero_si128();
+
+		const auto	CheckBlock = [&] (const __m128i input) __NE___
+		{
+			if_likely( _mm_movemask_epi8( input ) == 0 )
+			{
+				// ASCII block after incomplete sequence
+				error			= _mm_or_si128( error, prev_incomplete );
+				prev_incomplete	= _mm_setzero_si128();
+				prev_input		= input;
+				return;
+			}
+
+			const __m128i	prev1		= _mm_alignr_epi8( input, prev_input, 15 );
+			const __m128i	byte_1_high	= _mm_shuffle_epi8( byte_1_high_tbl, _mm_and_si128( _mm_srli_epi16( prev1, 4 ), nibble_mask ));
+			const __m128i	byte_1_low	= _mm_shuffle_epi8( byte_1_low_tbl,  _mm_and_si128( prev1, nibble_mask ));
+			const __m128i	byte_2_high	= _mm_shuffle_epi8( byte_2_high_tbl, _mm_and_si128( _mm_srli_epi16( input, 4 ), nibble_mask ));
+			const __m128i	special		= _mm_and_si128( _mm_and_si128( byte_1_high, byte_1_low ), byte_2_high );
+
+			const __m128i	prev2		= _mm_alignr_epi8( input, prev_input, 14 );
+			const __m128i	prev3		= _mm_alignr_epi8( input, prev_input, 13 );
+			const __m128i	must23		= _mm_or_si128( _mm_subs_epu8( prev2, third_byte ), _mm_subs_epu8( prev3, fourth_byte ));
+			const __m128i	must23_80	= _mm_and_si128( must23, high_bit );
+
+			error			= _mm_or_si128( error, _mm_xor_si128( must23_80, special ));
+			prev_incomplete	= _mm_subs_epu8( input, max_incomplete );
+			prev_input		= input;
+		};
+
+		usize	i = 0;
+		for (; i + 16 <= length; i += 16)
+		{
+			CheckBlock( _mm_loadu_si128( Cast<__m128i>( str + i )));
+		}
+
+		if ( i < length )
+		{
+			// zero padding is ASCII
+			alignas(16) CharUtf8	tail [16] = {};
+			MemCopy( OUT tail, str + i, Bytes{length - i} );
+			CheckBlock( _mm_load_si128( Cast<__m128i>( tail )));
+		}
+
+		error = _mm_or_si128( error, prev_incomplete );
+		return _mm_movemask_epi8( _mm_cmpeq_epi8( error, _mm_setzero_si128() )) == 0xFFFF;
+	}
+#endif
+
 } // _hidden_
 //-----------------------------------------------------------------------------
 
@@ -194,13 +386,24 @@ namespace _hidden_
 	Utf8CharCount
 =================================================
 */
-	ND_ forceinline usize  Utf8CharCount (const CharUtf8 *str, const usize length) __NE___
+	ND_ inline usize  Utf8CharCount (const CharUtf8 *str, const usize length) __NE___
 	{
 		usize	count = 0;
-		for (usize pos = 0; pos < length; ++count)
+		for (usize pos = 0; pos < length;)
 		{
+		  #if AE_SIMD_SSE >= 20
+			// ASCII block
+			if ( (pos + 16 <= length) and (_mm_movemask_epi8( _mm_loadu_si128( Cast<__m128i>( str + pos ))) == 0) )
+			{
+				pos		+= 16;
+				count	+= 16;
+				continue;
+			}
+		  #endif
+
 			// to avoid infinite loop always add at least 1
-			pos += Base::_hidden_::Utf8CharWidth( str, length, 1u );
+			pos += Base::_hidden_::Utf8CharWidth( str + pos, length - pos, 1u );
+			++count;
 		}
 		return count;
 	}
@@ -210,6 +413,101 @@ namespace _hidden_
 		return Utf8CharCount( str.data(), str.length() );
 	}
 
+/*
+=================================================
+	Utf8Validate
+----
+	returns 'true' if string is well-formed UTF-8.
+=================================================
+*/
+	ND_ inline bool  Utf8Validate (const CharUtf8 *str, const usize length) __NE___
+	{
+	  #if AE_SIMD_SSE >= 31
+		return Base::_hidden_::Utf8Validate_SSSE3( str, length );
+	  #else
+		return Base::_hidden_::Utf8Validate_Scalar( str, length );
+	  #endif
+	}
+
+	ND_ inline bool  Utf8Validate (BasicStringView<CharUtf8> str) __NE___
+	{
+		return Utf8Validate( str.data(), str.length() );
+	}
+
+/*
+=================================================
+	Utf8Decode (batch)
+----
+	Decodes up to 'dstSize' symbols starting from 'pos', returns number of decoded symbols.
+	ASCII is checked 16 (SSE2) or 8 bytes at a time, other symbols are decoded by 'Utf8Decode_v2()',
+	if it fails then 'Utf8Decode_v1()' is used, it always moves forward.
+=================================================
+*/
+	ND_ inline usize  Utf8Decode (const CharUtf8 *str, const usize length, INOUT usize &pos, OUT CharUtf32 *dst, const usize dstSize) __NE___
+	{
+		constexpr ulong	ascii_mask	= 0x8080'8080'8080'8080ull;
+
+		usize	count = 0;
+		for (; (pos < length) and (count < dstSize);)
+		{
+		  #if AE_SIMD_SSE >= 20
+			if ( (pos + 16 <= length) and (count + 16 <= dstSize) )
+			{
+				const __m128i	v = _mm_loadu_si128( Cast<__m128i>( str + pos ));
+
+				if_likely( _mm_movemask_epi8( v ) == 0 )
+				{
+					// zero extend 16 x u8 to 16 x u32
+					const __m128i	zero	= _mm_setzero_si128();
+					const __m128i	lo		= _mm_unpacklo_epi8( v, zero );
+					const __m128i	hi		= _mm_unpackhi_epi8( v, zero );
+
+					_mm_storeu_si128( Cast<__m128i>( dst + count +  0 ), _mm_unpacklo_epi16( lo, zero ));
+					_mm_storeu_si128( Cast<__m128i>( dst + count +  4 ), _mm_unpackhi_epi16( lo, zero ));
+					_mm_storeu_si128( Cast<__m128i>( dst + count +  8 ), _mm_unpacklo_epi16( hi, zero ));
+					_mm_storeu_si128( Cast<__m128i>( dst + count + 12 ), _mm_unpackhi_epi16( hi, zero ));
+
+					pos		+= 16;
+					count	+= 16;
+					continue;
+				}
+			}
+		  #endif
+
+			if ( (pos + 8 <= length) and (count + 8 <= dstSize) )
+			{
+				ulong	bits;
+				MemCopy( OUT &bits, str + pos, SizeOf<ulong> );
+
+				if_likely( (bits & ascii_mask) == 0 )
+				{
+					for (usize i = 0; i < 8; ++i) {
+						dst[count + i] = CharUtf32( str[pos + i] );
+					}
+					pos		+= 8;
+					count	+= 8;
+					continue;
+				}
+			}
+
+			usize		width	= 0;
+			CharUtf32	c		= Base::_hidden_::Utf8Decode_v2( str + pos, length - pos, INOUT width );
+
+			if_likely( c != UMax )
+				pos += width;
+			else
+				c = Base::_hidden_::Utf8Decode_v1( str, length, INOUT pos );
+
+			dst[count++] = c;
+		}
+		return count;
+	}
+
+	ND_ inline usize  Utf8Decode (BasicStringView<CharUtf8> str, INOUT usize &pos, OUT CharUtf32 *dst, const usize dstSize) __NE___
+	{
+		return Utf8Decode( str.data(), str.length(), INOUT pos, OUT dst, dstSize );
+	}
+
 /*
 =================================================
 	Utf8Encode
@@ -39,6 +39,12 @@ namespace AE::Base
 		ND_ forceinline bool  Read (OUT T& value)						__NE___	{ return Read( OUT &value, SizeOf<T> ); }
 		ND_ forceinline bool  Read (OUT void* buffer, Bytes size)		__NE___;
 		ND_ forceinline Bytes ReadRemaining (OUT void* buffer)			__NE___;
+		ND_ forceinline bool  Skip (Bytes size)							__NE___;
+
+		// Returns pointer to the data in current memory block without copying.
+		// Returns 'null' if data is not contiguous or not aligned, stream position is not changed in this case.
+		// Returned pointer is valid while memory block is valid, it depends on source stream.
+		ND_ forceinline const void*  ReadInPlace (Bytes size, Bytes align) __NE___;
 	};
 
 
@@ -70,6 +76,10 @@ namespace AE::Base
 		template <typename T>
 		ND_ forceinline bool  Write (const T& value)					__NE___	{ return Write( &value, SizeOf<T> ); }
 		ND_ forceinline bool  Write (const void* buffer, Bytes size)	__NE___;
+
+		// Returns number of bytes which must be written to align data which will be placed at ('Position()' + 'offset').
+		// Alignment is relative to the stream begin or to the absolute address if stream is not used.
+		ND_ Bytes	AlignmentPadding (Bytes align, Bytes offset = 0_b)	C_NE___;
 	};
 //-----------------------------------------------------------------------------
 
@@ -171,6 +181,55 @@ namespace AE::Base
 
 		return size;
 	}
+
+/*
+=================================================
+	Skip
+=================================================
+*/
+	forceinline bool  FastRStream::Skip (Bytes size) __NE___
+	{
+		NonNull( _ptr );
+
+		for_likely(; size > 0; )
+		{
+			Bytes	part_size = Min( Bytes{_end} - Bytes{_ptr}, size );
+			_ptr += part_size;
+
+			if_likely( size == part_size )
+				return true; // early exit
+
+			size -= part_size;
+
+			if_likely( _stream )
+			{
+				_stream->UpdateFastStream( OUT _ptr, OUT _end );
+				NonNull( _ptr );
+			}
+
+			if_unlikely( Empty() )
+				return false; // stream is completely read
+		}
+		return true;
+	}
+
+/*
+=================================================
+	ReadInPlace
+=================================================
+*/
+	forceinline const void*  FastRStream::ReadInPlace (Bytes size, Bytes align) __NE___
+	{
+		NonNull( _ptr );
+
+		if_unlikely( size > RemainingSize() or not IsMultipleOf( _ptr, align ))
+			return null;
+
+		const void*	result = _ptr;
+		_ptr += size;
+
+		return result;
+	}
 //-----------------------------------------------------------------------------
 
 
@@ -218,6 +277,17 @@ namespace AE::Base
 			return UMax;  // error
 	}
 
+/*
+=================================================
+	AlignmentPadding
+=================================================
+*/
+	inline Bytes  FastWStream::AlignmentPadding (Bytes align, Bytes offset) C_NE___
+	{
+		const Bytes	pos = (_stream ? _stream->GetFastStreamPosition( _ptr ) : Bytes{_ptr}) + offset;
+		return AlignUp( pos, align ) - pos;
+	}
+
 /*
 =================================================
 	Write
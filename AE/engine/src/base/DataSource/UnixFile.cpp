@@ -11,24 +11,173 @@
 # include "base/Algorithms/StringUtils.h"
 # include "base/DataSource/UnixFile.h"
 # include "base/FileSystem/FileSystem.h"
+# include "base/Memory/UntypedAllocator.h"
+# include "base/Utils/Atomic.h"
 
 namespace AE::Base
 {
 #	include "base/DataSource/UnixFileHelper.cpp.h"
 
+namespace
+{
+	//
+	// Direct IO Buffer Pool
+	//
+	class DirectIOBufferPool final : public Noncopyable
+	{
+	// types
+	public:
+		static constexpr uint	Count		= 8;
+		static constexpr Bytes	BlockSize	{1 << 20};
+		static constexpr Bytes	Align		= UnixFileRStream::DirectIOAlign;
+
+
+	// variables
+	private:
+		Atomic<uint>	_available	{ToBitMask<uint>( Count )};
+		void*			_blocks		= null;		// physical memory will be allocated by OS on first access
+
+
+	// methods
+	public:
+		DirectIOBufferPool () __NE___ :
+			_blocks{ UntypedAllocator::Allocate( SizeAndAlign{ BlockSize * Count, Align })}
+		{
+			if_unlikely( _blocks == null )
+				_available.store( 0 );
+		}
+
+		~DirectIOBufferPool () __NE___
+		{
+			ASSERT( _blocks == null or _available.load() == ToBitMask<uint>( Count ));
+
+			if ( _blocks != null )
+				UntypedAllocator::Deallocate( _blocks, SizeAndAlign{ BlockSize * Count, Align });
+		}
+
+		ND_ static DirectIOBufferPool&  Instance () __NE___
+		{
+			static DirectIOBufferPool	pool;
+			return pool;
+		}
+
+		ND_ void*  Acquire () __NE___
+		{
+			for (uint bits = _available.load();;)
+			{
+				// pool is empty, use temporary allocation
+				if_unlikely( bits == 0 )
+					return UntypedAllocator::Allocate( SizeAndAlign{ BlockSize, Align });
+
+				const uint	idx = uint(BitScanForward( bits ));
+
+				if_likely( _available.CAS( INOUT bits, bits & ~(1u << idx), EMemoryOrder::Acquire, EMemoryOrder::Relaxed ))
+					return _blocks + BlockSize * idx;
+			}
+		}
+
+		void  Release (void* ptr) __NE___
+		{
+			if ( _blocks != null and Bytes{ptr} >= Bytes{_blocks} and Bytes{ptr} < Bytes{_blocks} + BlockSize * Count )
+			{
+				const uint	idx = uint( (Bytes{ptr} - Bytes{_blocks}) / BlockSize );
+				ASSERT( not HasBit( _available.load(), idx ));
+
+				_available.fetch_or( 1u << idx, EMemoryOrder::Release );
+				return;
+			}
+			UntypedAllocator::Deallocate( ptr, SizeAndAlign{ BlockSize, Align });
+		}
+	};
+
+/*
+=================================================
+	ReadDirect
+----
+	O_DIRECT requires aligned offset, size and memory address.
+	Aligned part is read directly into 'buffer', other data is copied from aligned temporary buffer.
+=================================================
+*/
+	ND_ static Bytes  ReadDirect (const int file, const Bytes pos, OUT void* buffer, const Bytes size) __NE___
+	{
+		constexpr Bytes	align	= DirectIOBufferPool::Align;
+		Bytes			readn;
+
+		if ( IsMultipleOf( pos, align ) and CheckPointerAlignment( buffer, usize{align} ))
+		{
+			const Bytes	body = AlignDown( size, align );
+			if ( body > 0 )
+			{
+				const ssize_t	res = ::pread( file, OUT buffer, size_t{body}, off_t{pos} );
+				if_unlikely( res < 0 )
+				{
+					UNIX_CHECK_DEV( "pread failed: " );
+					return 0_b;
+				}
+				readn = Bytes{ulong(res)};
+
+				if ( readn < body )
+					return readn;	// end of file
+			}
+		}
+
+		if ( readn == size )
+			return readn;
+
+		auto&	pool	= DirectIOBufferPool::Instance();
+		void*	tmp		= pool.Acquire();
+
+		if_unlikely( tmp == null )
+			return readn;
+
+		Bytes	aligned_pos	= AlignDown( pos + readn, align );
+		Bytes	skip		= pos + readn - aligned_pos;
+
+		while ( readn < size )
+		{
+			const Bytes		req	= Min( DirectIOBufferPool::BlockSize, AlignUp( skip + size - readn, align ));
+			const ssize_t	res	= ::pread( file, OUT tmp, size_t{req}, off_t{aligned_pos} );
+
+			if_unlikely( res < 0 )
+			{
+				UNIX_CHECK_DEV( "pread failed: " );
+				break;
+			}
+			if ( Bytes{ulong(res)} <= skip )
+				break;	// end of file
+
+			const Bytes		cnt	= Min( Bytes{ulong(res)} - skip, size - readn );
+
+			MemCopy( OUT buffer + readn, tmp + skip, cnt );
+
+			readn		+= cnt;
+			aligned_pos	+= Bytes{ulong(res)};
+			skip		= 0_b;
+
+			if ( Bytes{ulong(res)} < req )
+				break;	// end of file
+		}
+
+		pool.Release( tmp );
+		return readn;
+	}
+
+} // namespace
+
 /*
 =================================================
 	constructor
 =================================================
 */
-	UnixFileRStream::UnixFileRStream (Handle_t file DEBUG_ONLY(, Path filename)) __NE___ :
+	UnixFileRStream::UnixFileRStream (Handle_t file, EMode mode DEBUG_ONLY(, Path filename)) __NE___ :
 		_file{ file },
-		_fileSize{ GetFileSize( _file )}
+		_fileSize{ GetFileSize( _file )},
+		_mode{ ValidateReadMode( _file, mode )}
 		DEBUG_ONLY(, _filename{ FileSystem::ToAbsolute( filename )})
 	{}
 
 	UnixFileRStream::UnixFileRStream (const char* filename, EMode mode)		__NE___ :
-		UnixFileRStream{ Handle_t{OpenFileForRead( filename, mode )} DEBUG_ONLY(, filename )}
+		UnixFileRStream{ Handle_t{OpenFileForRead( filename, mode )}, mode DEBUG_ONLY(, filename )}
 	{
 		if_unlikely( not IsOpen() )
 			UNIX_CHECK_DEV( "Can't open file: \""s << filename << "\": " );
@@ -46,7 +195,12 @@ namespace AE::Base
 	UnixFileRStream::~UnixFileRStream () __NE___
 	{
 		if ( IsOpen() )
+		{
+			if ( AllBits( _mode, EMode::NoReuse ))
+				DropFromPageCache( _file, _dropPos, 0_b );	// until the end of file
+
 			::close( _file );
+		}
 	}
 
 /*
@@ -107,7 +261,31 @@ namespace AE::Base
 	{
 		ASSERT( IsOpen() );
 
-		ssize_t	readn = ::read( _file, OUT buffer, size_t{size} );
+		if ( AllBits( _mode, EMode::Direct ))
+		{
+			const Bytes	pos		= _Position();
+			const Bytes	readn	= ReadDirect( _file, pos, OUT buffer, size );
+
+			CHECK( SetPositionInFileFromBegin( _file, slong(pos + readn) ));
+			return readn;
+		}
+
+		const ssize_t	readn = ::read( _file, OUT buffer, size_t{size} );
+
+		if ( AllBits( _mode, EMode::NoReuse ) and readn > 0 )
+		{
+			const Bytes	pos = _Position();
+
+			// release pages by large blocks to minimize syscalls
+			if ( pos < _dropPos )
+				_dropPos = pos - Bytes{ulong(readn)};
+			else
+			if ( pos - _dropPos >= c_DropBehind )
+			{
+				DropFromPageCache( _file, _dropPos, pos - _dropPos );
+				_dropPos = pos;
+			}
+		}
 
 		return Bytes{ulong( Max( 0, readn ))};
 	}
@@ -257,16 +435,17 @@ namespace AE::Base
 	constructor
 =================================================
 */
-	UnixFileRDataSource::UnixFileRDataSource (Handle_t file DEBUG_ONLY(, Path filename)) __NE___ :
+	UnixFileRDataSource::UnixFileRDataSource (Handle_t file, EMode mode DEBUG_ONLY(, Path filename)) __NE___ :
 		_file{ file },
-		_fileSize{ GetFileSize( _file )}
+		_fileSize{ GetFileSize( _file )},
+		_mode{ ValidateReadMode( _file, mode )}
 		DEBUG_ONLY(, _filename{ FileSystem::ToAbsolute( filename )})
 	{}
 
 	UnixFileRDataSource::UnixFileRDataSource (NtStringView filename, EMode mode)	__NE___	: UnixFileRDataSource{ filename.c_str(), mode } {}
 	UnixFileRDataSource::UnixFileRDataSource (const String &filename, EMode mode)	__NE___	: UnixFileRDataSource{ filename.c_str(), mode } {}
 	UnixFileRDataSource::UnixFileRDataSource (const char* filename, EMode mode)		__NE___	:
-		UnixFileRDataSource{ Handle_t{OpenFileForRead( filename, mode, 0 )} DEBUG_ONLY(, filename )}
+		UnixFileRDataSource{ Handle_t{OpenFileForRead( filename, mode, 0 )}, mode DEBUG_ONLY(, filename )}
 	{
 		if_unlikely( not IsOpen() )
 			UNIX_CHECK_DEV( "Can't open file: \""s << filename << "\": " );
@@ -306,9 +485,17 @@ namespace AE::Base
 	{
 		ASSERT( IsOpen() );
 
+		if ( AllBits( _mode, EMode::Direct ))
+			return ReadDirect( _file, pos, OUT buffer, size );
+
 		ssize_t	readn = ::pread( _file, OUT buffer, size_t{size}, off_t{pos} );
 		if_likely( readn >= 0 )
+		{
+			if ( AllBits( _mode, EMode::NoReuse ))
+				DropFromPageCache( _file, pos, Bytes{ulong(readn)} );
+
 			return Bytes{ulong(readn)};
+		}
 
 		UNIX_CHECK_DEV( "ReadBlock failed: " );
 		return 0_b;
@@ -24,28 +24,36 @@ namespace AE::Base
 			Unknown			= 0,
 			RandomAccess	= 1 << 0,	// access is intended to be random
 			SequentialScan	= 1 << 1,	// access is intended to be sequential from beginning to end
-			Direct			= 1 << 2,	// Try to minimize cache effects of the I/O to and from this file.
+			Direct			= 1 << 2,	// Bypass page cache (O_DIRECT), unaligned reads go through aligned buffers from internal pool.
+										// If not supported by file system then 'NoReuse' is used instead.
+			NoReuse			= 1 << 3,	// Data will be accessed only once, read pages are released from page cache.
 
 			Unix_LargeFile	= 1 << 16,	// 64 bit address
 		};
 
+		// Offset, size and memory address alignment which allows to read directly into user memory in 'Direct' mode.
+		static constexpr Bytes	DirectIOAlign	{4 << 10};
+
 	private:
 		using Handle_t	= int;	// fd
 
-		static constexpr EMode	c_DefaultMode = EMode::SequentialScan;
+		static constexpr EMode	c_DefaultMode	= EMode::SequentialScan;
+		static constexpr Bytes	c_DropBehind	{8 << 20};	// for 'NoReuse' mode
 
 
 	// variables
 	private:
 		Handle_t		_file		= -1;
 		const Bytes		_fileSize;
+		const EMode		_mode;
+		Bytes			_dropPos;	// start of range which is not yet released from page cache
 
 		DEBUG_ONLY( const Path  _filename;)
 
 
 	// methods
 	private:
-		UnixFileRStream (Handle_t file DEBUG_ONLY(, Path filename))						__NE___;
+		UnixFileRStream (Handle_t file, EMode mode DEBUG_ONLY(, Path filename))			__NE___;
 
 	public:
 		explicit UnixFileRStream (const char* filename, EMode mode = c_DefaultMode)		__NE___;
@@ -61,6 +69,8 @@ namespace AE::Base
 		ESourceType	GetSourceType ()													C_NE_OV;
 		PosAndSize	PositionAndSize ()													C_NE_OV	{ return { _Position(), _fileSize }; }
 
+		ND_ EMode	Mode ()																C_NE___	{ return _mode; }
+
 		bool		SeekFwd (Bytes offset)												__NE_OV;
 		bool		SeekSet (Bytes newPos)												__NE_OV;
 
@@ -158,13 +168,14 @@ namespace AE::Base
 	private:
 		Handle_t		_file		= -1;
 		const Bytes 	_fileSize;
+		const EMode		_mode;
 
 		DEBUG_ONLY( const Path  _filename;)
 
 
 	// methods
 	private:
-		UnixFileRDataSource (Handle_t file DEBUG_ONLY(, Path filename))						__NE___;
+		UnixFileRDataSource (Handle_t file, EMode mode DEBUG_ONLY(, Path filename))			__NE___;
 
 	public:
 		explicit UnixFileRDataSource (const char* filename, EMode mode = c_DefaultMode)		__NE___;
@@ -181,6 +192,8 @@ namespace AE::Base
 		Bytes		Size ()																	C_NE_OV	{ return _fileSize; }
 
 		Bytes		ReadBlock (Bytes, OUT void*, Bytes)										__NE_OV;
+
+		ND_ EMode	Mode ()																	C_NE___	{ return _mode; }
 	};
 
 
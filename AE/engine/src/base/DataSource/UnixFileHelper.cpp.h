@@ -23,14 +23,18 @@ namespace
 		if ( file >= 0 and AllBits( inFlags, RFileFlags::Direct ))
 			CHECK( ::fcntl( file, F_GLOBAL_NOCACHE , 1 ) == 0 );
 
+		if ( file >= 0 and AllBits( inFlags, RFileFlags::NoReuse ))
+			CHECK( ::fcntl( file, F_NOCACHE , 1 ) == 0 );
+
 		return file;
 	}
 
 #else
 	ND_ static int  OpenFileForRead (const char* filename, RFileFlags inFlags, int addFlags = 0) __NE___
 	{
-		int	flags	= O_RDONLY | addFlags;
-		int	advise	= POSIX_FADV_NORMAL;
+		int		flags		= O_RDONLY | addFlags;
+		int		advise		= POSIX_FADV_NORMAL;
+		bool	no_reuse	= false;
 
 		for (auto t : BitfieldIterate( inFlags ))
 		{
@@ -39,6 +43,7 @@ namespace
 				case RFileFlags::RandomAccess :		advise = POSIX_FADV_RANDOM;			break;
 				case RFileFlags::SequentialScan :	advise = POSIX_FADV_SEQUENTIAL;		break;
 				case RFileFlags::Direct :			flags |= O_DIRECT;					break;
+				case RFileFlags::NoReuse :			no_reuse = true;					break;
 				case RFileFlags::Unix_LargeFile :	flags |= O_LARGEFILE;				break;
 				case RFileFlags::Unknown :
 				default :							RETURN_ERR( "unknown rfile open flag!", -1 );
@@ -48,13 +53,68 @@ namespace
 
 		int	file = ::open( filename, flags );
 
+		// some file systems (tmpfs, overlayfs) don't support O_DIRECT, use page cache with 'no reuse' hint instead
+		if ( file < 0 and errno == EINVAL and AllBits( flags, O_DIRECT ))
+		{
+			file		= ::open( filename, flags & ~O_DIRECT );
+			no_reuse	= true;
+		}
+
 		if ( file >= 0 )
 			CHECK( ::posix_fadvise( file, 0, 0, advise ) == 0 );
 
+		// hint is ignored on Linux before 6.3
+		if ( file >= 0 and no_reuse )
+			Unused( ::posix_fadvise( file, 0, 0, POSIX_FADV_NOREUSE ));
+
 		return file;
 	}
 #endif
 
+/*
+=================================================
+	ValidateReadMode
+----
+	returns mode which is actually used for opened file
+=================================================
+*/
+#ifdef AE_PLATFORM_APPLE
+	ND_ inline RFileFlags  ValidateReadMode (int, RFileFlags mode) __NE___
+	{
+		// F_GLOBAL_NOCACHE has no alignment requirements
+		return mode & ~RFileFlags::Direct;
+	}
+
+#else
+	ND_ inline RFileFlags  ValidateReadMode (int file, RFileFlags mode) __NE___
+	{
+		if ( file >= 0 and AllBits( mode, RFileFlags::Direct ))
+		{
+			const int	flags = ::fcntl( file, F_GETFL );
+
+			if ( flags == -1 or not AllBits( flags, O_DIRECT ))
+				mode = (mode & ~RFileFlags::Direct) | RFileFlags::NoReuse;
+		}
+		return mode;
+	}
+#endif
+
+/*
+=================================================
+	DropFromPageCache
+----
+	release pages of already read data
+=================================================
+*/
+	inline void  DropFromPageCache (int file, Bytes offset, Bytes size) __NE___
+	{
+	#ifdef AE_PLATFORM_APPLE
+		Unused( file, offset, size );	// F_NOCACHE is used instead
+	#else
+		Unused( ::posix_fadvise( file, off_t{offset}, off_t{size}, POSIX_FADV_DONTNEED ));
+	#endif
+	}
+
 /*
 =================================================
 	OpenFileForWrite
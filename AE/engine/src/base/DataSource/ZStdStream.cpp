@@ -4,6 +4,7 @@
 
 # include "base/Defines/StdInclude.h"
 # include "zstd.h"
+# include "zdict.h"
 # include "base/DataSource/ZStdStream.h"
 # include "base/Algorithms/StringUtils.h"
 
@@ -19,15 +20,153 @@ namespace AE::Base
 	constructor
 =================================================
 */
-	ZStdRStream::ZStdRStream (RC<RStream> stream) __NE___ :
-		_stream{ RVRef(stream) }
+	ZStdDictionary::ZStdDictionary (Array<ubyte> data) __NE___ :
+		_data{ RVRef(data) }
+	{
+		CHECK_ERRV( not _data.empty() );
+
+		_id		= ZSTD_getDictID_fromDict( _data.data(), _data.size() );
+		_ddict	= ZSTD_createDDict( _data.data(), _data.size() );
+		ASSERT( _ddict != null );
+	}
+
+/*
+=================================================
+	destructor
+=================================================
+*/
+	ZStdDictionary::~ZStdDictionary () __NE___
+	{
+		ZSTD_freeDDict( static_cast< ZSTD_DDict *>(_ddict) );
+
+		for (auto& [lvl, cdict] : _cdicts) {
+			ZSTD_freeCDict( static_cast< ZSTD_CDict *>(cdict) );
+		}
+	}
+
+/*
+=================================================
+	_GetCDict
+----
+	CDict is created once per compression level,
+	it contains preprocessed dictionary and reused by all streams.
+=================================================
+*/
+	void*  ZStdDictionary::_GetCDict (const int level) C_NE___
+	{
+		EXLOCK( _cdictGuard );
+
+		for (auto& [lvl, cdict] : _cdicts)
+		{
+			if ( lvl == level )
+				return cdict;
+		}
+
+		void*	cdict = ZSTD_createCDict( _data.data(), _data.size(), level );
+		CHECK_ERR( cdict != null );
+
+		NOTHROW_ERR( _cdicts.emplace_back( level, cdict ));
+		return cdict;
+	}
+
+/*
+=================================================
+	Train
+=================================================
+*/
+	RC<ZStdDictionary>  ZStdDictionary::Train (ArrayView<ArrayView<ubyte>> samples, const Bytes maxSize) __NE___
+	{
+		CHECK_ERR( not samples.empty() );
+		CHECK_ERR( maxSize > 0 );
+
+		Array<ubyte>	samples_buf;
+		Array<usize>	sample_sizes;
+		Array<ubyte>	dict;
+
+		TRY{
+			usize	total = 0;
+			for (auto& smp : samples) {
+				total += smp.size();
+			}
+			samples_buf.reserve( total );				// throw
+			sample_sizes.reserve( samples.size() );		// throw
+
+			for (auto& smp : samples)
+			{
+				samples_buf.insert( samples_buf.end(), smp.begin(), smp.end() );
+				sample_sizes.push_back( smp.size() );
+			}
+			dict.resize( usize{maxSize} );				// throw
+		}
+		CATCH_ALL(
+			return Default;
+		)
+
+		const usize	dict_size = ZDICT_trainFromBuffer( OUT dict.data(), dict.size(),
+													   samples_buf.data(), sample_sizes.data(), uint(sample_sizes.size()) );
+		if_unlikely( ZDICT_isError( dict_size ))
+		{
+			AE_LOGW( "Failed to train ZStd dictionary: "s << ZDICT_getErrorName( dict_size ));
+			return Default;
+		}
+
+		dict.resize( dict_size );
+
+		auto	result = MakeRC<ZStdDictionary>( RVRef(dict) );
+		CHECK_ERR( result->IsValid() );
+		return result;
+	}
+
+/*
+=================================================
+	Load
+=================================================
+*/
+	RC<ZStdDictionary>  ZStdDictionary::Load (RStream &stream, const Bytes size) __NE___
+	{
+		CHECK_ERR( stream.IsOpen() );
+		CHECK_ERR( size > 0 );
+
+		Array<ubyte>	data;
+		CHECK_ERR( stream.Read( usize{size}, OUT data ));
+
+		auto	result = MakeRC<ZStdDictionary>( RVRef(data) );
+		CHECK_ERR( result->IsValid() );
+		return result;
+	}
+//-----------------------------------------------------------------------------
+
+
+
+/*
+=================================================
+	constructor
+=================================================
+*/
+	ZStdRStream::ZStdRStream (RC<RStream> stream, const Config &cfg) __NE___ :
+		_stream{ RVRef(stream) },
+		_dict{ cfg.dict }
 	{
 		_context = ZSTD_createDStream();
 		ASSERT( _context != null );
 
 		if ( _context != null )
 		{
-			//ZSTD_DCtx_setParameter( static_cast< ZSTD_DStream *>(_context), ZSTD_dParameter::ZSTD_d_windowLogMax,  );
+			auto*	ctx = static_cast< ZSTD_DStream *>(_context);
+
+			if ( cfg.windowLogMax > 0 )
+				ZSTD_DCtx_setParameter( ctx, ZSTD_dParameter::ZSTD_d_windowLogMax, int(cfg.windowLogMax) );
+
+			if ( _dict )
+			{
+				const usize	code = ZSTD_DCtx_refDDict( ctx, static_cast< ZSTD_DDict *>(_dict->_GetDDict()) );
+				if_unlikely( ZSTD_isError( code ))
+				{
+					ASSERT_MSG( false, ZSTD_getErrorName( code ));
+					ZSTD_freeDStream( ctx );
+					_context = null;
+				}
+			}
 		}
 	}
 
@@ -121,6 +260,45 @@ namespace {
 	{
 		level	= int( ZSTD_maxCLevel() * Saturate( cfg.level ) + 0.5f);
 	}
+
+/*
+=================================================
+	ApplyConfig
+=================================================
+*/
+	ND_ static bool  ApplyConfig (ZSTD_CCtx* ctx, const ZStdWStream::Config &cfg)
+	{
+		int		comp_lvl = 0;
+		ExtractConfig( cfg, OUT comp_lvl );
+
+		ZSTD_CCtx_setParameter( ctx, ZSTD_cParameter::ZSTD_c_compressionLevel, comp_lvl );
+
+		if ( cfg.threadCount > 0 )
+		{
+			// returns error if zstd built without ZSTD_MULTITHREAD, in this case compression is performed in current thread
+			const usize	code = ZSTD_CCtx_setParameter( ctx, ZSTD_cParameter::ZSTD_c_nbWorkers, int(cfg.threadCount) );
+			if_unlikely( ZSTD_isError( code ))
+				AE_LOGW( "ZStd multithreading is not supported: "s << ZSTD_getErrorName( code ));
+		}
+
+		if ( cfg.longDistMatching )
+			ZSTD_CCtx_setParameter( ctx, ZSTD_cParameter::ZSTD_c_enableLongDistanceMatching, 1 );
+
+		if ( cfg.windowLog > 0 )
+		{
+			const auto	bounds = ZSTD_cParam_getBounds( ZSTD_cParameter::ZSTD_c_windowLog );
+			ZSTD_CCtx_setParameter( ctx, ZSTD_cParameter::ZSTD_c_windowLog, Clamp( int(cfg.windowLog), bounds.lowerBound, bounds.upperBound ));
+		}
+
+		if ( cfg.dict )
+		{
+			// compression parameters are taken from CDict
+			const usize	code = ZSTD_CCtx_refCDict( ctx, static_cast< ZSTD_CDict *>(cfg.dict->_GetCDict( comp_lvl )));
+			if_unlikely( ZSTD_isError( code ))
+				RETURN_ERR( ZSTD_getErrorName( code ));
+		}
+		return true;
+	}
 }
 /*
 =================================================
@@ -128,18 +306,19 @@ namespace {
 =================================================
 */
 	ZStdWStream::ZStdWStream (RC<WStream> stream, const Config &cfg) __NE___ :
-		_stream{ RVRef(stream) }
+		_stream{ RVRef(stream) },
+		_dict{ cfg.dict }
 	{
 		_context = ZSTD_createCStream();
 		ASSERT( _context != null );
 
 		if ( _context != null )
 		{
-			int		comp_lvl = 0;
-			ExtractConfig( cfg, OUT comp_lvl );
-
-			ZSTD_CCtx_setParameter( static_cast< ZSTD_CStream *>(_context),	ZSTD_cParameter::ZSTD_c_compressionLevel,	comp_lvl );
-			// TODO: more params
+			if_unlikely( not ApplyConfig( static_cast< ZSTD_CStream *>(_context), cfg ))
+			{
+				ZSTD_freeCStream( static_cast< ZSTD_CStream *>(_context) );
+				_context = null;
+			}
 		}
 	}
 
@@ -150,7 +329,9 @@ namespace {
 */
 	ZStdWStream::~ZStdWStream () __NE___
 	{
-		_End();
+		if ( IsOpen() )
+			_End();
+
 		ZSTD_freeCStream( static_cast< ZSTD_CStream *>(_context) );
 	}
 
@@ -158,9 +339,15 @@ namespace {
 =================================================
 	SetTotalSize
 =================================================
-*
+*/
 	void  ZStdWStream::SetTotalSize (Bytes size) __NE___
 	{
+		ASSERT( IsOpen() );
+		ASSERT( _position == 0 );
+
+		const usize	code = ZSTD_CCtx_setPledgedSrcSize( static_cast< ZSTD_CStream *>(_context), ulong{size} );
+		ASSERT_MSG( not ZSTD_isError( code ), ZSTD_getErrorName( code ));
+		Unused( code );
 	}
 
 /*
@@ -182,24 +369,29 @@ namespace {
 	{
 		ASSERT( IsOpen() );
 
-		// ZSTD_compressStream2 or ZSTD_compressStream
-
 		ubyte			temp	[_BufferSize];
 		ZSTD_inBuffer	in_buf	{ buffer, usize{size}, 0 };
 		ZSTD_outBuffer	out_buf	{ temp, _BufferSize, 0 };
-		usize			code	= 1;
 
-		for (; code > 0;)
-		{
+		// In multithreaded mode function is non-blocking and returns when input is passed to the workers,
+		// so stop when all input is consumed instead of waiting until internal buffers are flushed.
+		do {
 			out_buf.pos = 0;
 
-			code = ZSTD_compressStream2( static_cast< ZSTD_CStream *>(_context), INOUT &out_buf, INOUT &in_buf, ZSTD_e_continue );
+			const usize	code = ZSTD_compressStream2( static_cast< ZSTD_CStream *>(_context), INOUT &out_buf, INOUT &in_buf, ZSTD_e_continue );
 
-			ASSERT_MSG( not ZSTD_isError( code ), ZSTD_getErrorName( code ));
+			if_unlikely( ZSTD_isError( code ))
+			{
+				ASSERT_MSG( false, ZSTD_getErrorName( code ));
+				break;
+			}
 
 			if ( out_buf.pos > 0 )
 				CHECK_ERR( _stream->Write( &temp[0], Bytes{out_buf.pos} ));
 		}
+		while ( in_buf.pos < in_buf.size );
+
+		size = Bytes{in_buf.pos};
 
 		_position += size;
 		return size;
@@ -281,10 +473,30 @@ namespace {
 							   const void* srcData, Bytes srcSize,
 							   const ZStdWStream::Config &cfg) __NE___
 	{
-		int		comp_lvl = 0;
-		ExtractConfig( cfg, OUT comp_lvl );
+		usize	comp_size;
 
-		usize	comp_size = ZSTD_compress( OUT dstData, usize{dstSize}, srcData, usize{srcSize}, comp_lvl );
+		if ( cfg.threadCount == 0 and not cfg.longDistMatching and cfg.windowLog == 0 and not cfg.dict )
+		{
+			int		comp_lvl = 0;
+			ExtractConfig( cfg, OUT comp_lvl );
+
+			comp_size = ZSTD_compress( OUT dstData, usize{dstSize}, srcData, usize{srcSize}, comp_lvl );
+		}
+		else
+		{
+			ZSTD_CCtx*	ctx = ZSTD_createCCtx();
+			CHECK_ERR( ctx != null );
+
+			if_unlikely( not ApplyConfig( ctx, cfg ))
+			{
+				ZSTD_freeCCtx( ctx );
+				dstSize = 0_b;
+				return false;
+			}
+
+			comp_size = ZSTD_compress2( ctx, OUT dstData, usize{dstSize}, srcData, usize{srcSize} );
+			ZSTD_freeCCtx( ctx );
+		}
 
 		if_likely( ZSTD_isError( comp_size ) == 0 )
 		{
@@ -303,9 +515,24 @@ namespace {
 =================================================
 */
 	bool  ZStdUtils::Decompress (OUT void* dstData, INOUT Bytes &dstSize,
-								 const void* srcData, Bytes srcSize) __NE___
+								 const void* srcData, Bytes srcSize,
+								 const ZStdDictionary* dict) __NE___
 	{
-		usize	dec_size = ZSTD_decompress( OUT dstData, usize{dstSize}, srcData, usize{srcSize} );
+		usize	dec_size;
+
+		if ( dict == null )
+		{
+			dec_size = ZSTD_decompress( OUT dstData, usize{dstSize}, srcData, usize{srcSize} );
+		}
+		else
+		{
+			ZSTD_DCtx*	ctx = ZSTD_createDCtx();
+			CHECK_ERR( ctx != null );
+
+			dec_size = ZSTD_decompress_usingDDict( ctx, OUT dstData, usize{dstSize}, srcData, usize{srcSize},
+												   static_cast< const ZSTD_DDict *>(dict->_GetDDict()) );
+			ZSTD_freeDCtx( ctx );
+		}
 
 		if_likely( ZSTD_isError( dec_size ) == 0 )
 		{
@@ -318,6 +545,41 @@ namespace {
 		return false;
 	}
 
+/*
+=================================================
+	CompressBound
+=================================================
+*/
+	Bytes  ZStdUtils::CompressBound (Bytes srcSize) __NE___
+	{
+		return Bytes{ ZSTD_compressBound( usize{srcSize} )};
+	}
+
+/*
+=================================================
+	GetDictID
+=================================================
+*/
+	uint  ZStdUtils::GetDictID (const void* srcData, Bytes srcSize) __NE___
+	{
+		return ZSTD_getDictID_fromFrame( srcData, usize{srcSize} );
+	}
+
+/*
+=================================================
+	ReadDictID
+=================================================
+*/
+	uint  ZStdUtils::ReadDictID (RStream &stream) __NE___
+	{
+		ubyte		header [18];	// ZSTD_FRAMEHEADERSIZE_MAX
+		const Bytes	pos		= stream.Position();
+		const Bytes	size	= stream.ReadSeq( OUT header, Sizeof(header) );
+
+		CHECK( stream.SeekSet( pos ));
+		return GetDictID( header, size );
+	}
+
 
 } // AE::Base
 
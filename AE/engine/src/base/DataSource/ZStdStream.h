@@ -4,28 +4,82 @@
 
 #ifdef AE_ENABLE_ZSTD
 # include "base/DataSource/DataStream.h"
+# include "base/Utils/Threading.h"
 
 namespace AE::Base
 {
 
+	//
+	// ZStd Dictionary
+	//
+
+	class ZStdDictionary final : public EnableRC< ZStdDictionary >
+	{
+	// variables
+	private:
+		Array<ubyte>					_data;
+		uint							_id			= 0;
+		void *							_ddict		= null;		// ZSTD_DDict
+
+		mutable Mutex					_cdictGuard;
+		mutable Array<Pair<int, void*>>	_cdicts;				// ZSTD_CDict per compression level
+
+		static constexpr Bytes	_DefaultMaxSize	{110_Kb};
+
+
+	// methods
+	public:
+		explicit ZStdDictionary (Array<ubyte> data)										__NE___;
+		~ZStdDictionary ()																__NE_OV;
+
+		ND_ bool				IsValid ()												C_NE___	{ return _ddict != null; }
+
+		// Returns 0 for raw content dictionary.
+		ND_ uint				ID ()													C_NE___	{ return _id; }
+		ND_ ArrayView<ubyte>	Data ()													C_NE___	{ return _data; }
+
+		// Small samples of typical content, optimal dictionary size is ~100x smaller than total size of samples.
+		ND_ static RC<ZStdDictionary>  Train (ArrayView<ArrayView<ubyte>> samples, Bytes maxSize = _DefaultMaxSize)	__NE___;
+		ND_ static RC<ZStdDictionary>  Load (RStream &stream, Bytes size)				__NE___;
+
+		// internal
+		ND_ void*				_GetCDict (int level)									C_NE___;	// ZSTD_CDict
+		ND_ void*				_GetDDict ()											C_NE___	{ return _ddict; }
+	};
+
+
+
 	//
 	// Read-only ZStd Decompression Stream
 	//
 
 	class ZStdRStream final : public RStream
 	{
+	// types
+	public:
+		struct Config
+		{
+			RC<ZStdDictionary>	dict;					// must be the same as used for compression
+			uint				windowLogMax	= 0;	// 0 - default, required if stream was compressed with 'windowLog' > 27
+
+			Config () __NE___ {}
+		};
+
+
 	// variables
 	private:
-		RC<RStream>		_stream;
-		void *			_context	= null;		// ZSTD_DCtx
-		Bytes			_position;				// uncompressed size
+		RC<RStream>			_stream;
+		void *				_context	= null;		// ZSTD_DCtx
+		Bytes				_position;				// uncompressed size
+		RC<ZStdDictionary>	_dict;
 
 		static constexpr usize	_BufferSize	= 4u << 10;
 
 
 	// methods
 	public:
-		explicit ZStdRStream (RC<RStream> stream)							__NE___;
+		explicit ZStdRStream (RC<RStream>		stream,
+							  const Config		&cfg	= Default)			__NE___;
 		~ZStdRStream ()														__NE_OV;
 
 	// RStream //
@@ -50,7 +104,22 @@ namespace AE::Base
 	public:
 		struct Config
 		{
-			float	level	= 0.2f;		// 0..1
+			float				level			= 0.2f;		// 0..1
+
+			// Number of worker threads, compression is performed in parallel with 'WriteSeq()' call.
+			// 0 - compression in current thread.
+			// Ignored if zstd is built without ZSTD_MULTITHREAD.
+			uint				threadCount		= 0;
+
+			// Long distance matching, increases compression ratio for big streams with repeated content.
+			bool				longDistMatching = false;
+
+			// log2 of window size, 0 - default, 10..31.
+			// Decompression of stream with 'windowLog' > 27 requires 'ZStdRStream::Config::windowLogMax'.
+			uint				windowLog		= 0;
+
+			// Trained dictionary for small data.
+			RC<ZStdDictionary>	dict;
 
 			Config () __NE___ {}
 		};
@@ -58,9 +127,10 @@ namespace AE::Base
 
 	// variables
 	private:
-		RC<WStream>		_stream;
-		void *			_context	= null;		// ZSTD_CStream
-		Bytes			_position;				// uncompressed size
+		RC<WStream>			_stream;
+		void *				_context	= null;		// ZSTD_CStream
+		Bytes				_position;				// uncompressed size
+		RC<ZStdDictionary>	_dict;
 
 		static constexpr usize	_BufferSize	= 4u << 10;
 
@@ -71,6 +141,8 @@ namespace AE::Base
 							  const Config		&cfg	= Default)			__NE___;
 		~ZStdWStream ()														__NE_OV;
 
+		// Must be called before first write.
+		// Allows to store size in frame header and to split work between threads.
 		void		SetTotalSize (Bytes size)								__NE___;
 
 
@@ -105,7 +177,17 @@ namespace AE::Base
 								   const ZStdWStream::Config &cfg = Default)	__NE___;
 
 		ND_ static bool  Decompress (OUT void* dstData, INOUT Bytes &dstSize,
-									 const void* srcData, Bytes srcSize)		__NE___;
+									 const void* srcData, Bytes srcSize,
+									 const ZStdDictionary* dict = null)			__NE___;
+
+		// Returns max size of compressed data.
+		ND_ static Bytes  CompressBound (Bytes srcSize)							__NE___;
+
+		// Returns dictionary ID from frame header or 0 if dictionary is not used or ID is not stored.
+		ND_ static uint  GetDictID (const void* srcData, Bytes srcSize)			__NE___;
+
+		// Reads frame header and restores stream position.
+		ND_ static uint  ReadDictID (RStream &stream)							__NE___;
 	};
 
 
@@ -0,0 +1,316 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+/*
+	Batch frustum culling for bounding volumes in SoA layout.
+
+	Each iteration tests 16 (AVX512), 8 (AVX) or 4 (SSE, Neon) objects against all planes,
+	results are written as compacted list of visible indices.
+	Result is the same as in 'TFrustum<float>::IsVisible()'.
+
+	For parallel culling see 'Threading::ParallelFrustumCulling'.
+*/
+
+#pragma once
+
+#include "base/Math/Frustum.h"
+#include "base/Math/SIMD_SSE.h"
+#include "base/Math/SIMD_Neon.h"
+
+namespace AE::Math
+{
+
+	//
+	// Frustum Culling
+	//
+
+	struct FrustumCulling final : Noninstanceable
+	{
+	// types
+	public:
+		using Frustum_t		= TFrustum<float>;
+
+		// Axis aligned bounding boxes in SoA layout, all arrays must have the same size.
+		struct AABBs
+		{
+			const float*	minX	= null;
+			const float*	minY	= null;
+			const float*	minZ	= null;
+			const float*	maxX	= null;
+			const float*	maxY	= null;
+			const float*	maxZ	= null;
+			usize			count	= 0;
+		};
+
+		// Bounding spheres in SoA layout, all arrays must have the same size.
+		struct Spheres
+		{
+			const float*	x		= null;
+			const float*	y		= null;
+			const float*	z		= null;
+			const float*	radius	= null;
+			usize			count	= 0;
+		};
+
+		// Output for 'TransformAABBs()'.
+		struct MutableAABBs
+		{
+			float*			minX	= null;
+			float*			minY	= null;
+			float*			minZ	= null;
+			float*			maxX	= null;
+			float*			maxY	= null;
+			float*			maxZ	= null;
+
+			ND_ AABBs  Get (usize count) C_NE___ { return AABBs{ minX, minY, minZ, maxX, maxY, maxZ, count }; }
+		};
+
+	  #if AE_SIMD_AVX >= 3
+		using Simd_t	= SimdFloat16;
+	  #elif AE_SIMD_AVX >= 1
+		using Simd_t	= SimdFloat8;
+	  #elif defined(AE_SIMD_SimdFloat4)
+		using Simd_t	= SimdFloat4;
+	  #endif
+
+	  #ifdef AE_SIMD_SimdFloat4
+		static constexpr uint	BatchSize	= uint(sizeof(Simd_t) / sizeof(float));
+	  #else
+		static constexpr uint	BatchSize	= 1;
+	  #endif
+
+	private:
+		static constexpr uint	_PlaneCount		= uint(Frustum_t::EPlane::_Count);
+		static constexpr float	_Err			= Epsilon<float>();
+		static constexpr uint	_TransformChunk	= 256;
+
+
+	// functions
+	public:
+		// Returns number of visible objects, indices are in range [first, first+count).
+		// 'visible' must have space for 'count' elements.
+		ND_ static usize  CullAABBs (const Frustum_t &frustum, const AABBs &boxes, usize first, usize count, OUT uint* visible)			__NE___;
+		ND_ static usize  CullAABBs (const Frustum_t &frustum, const AABBs &boxes, OUT uint* visible)									__NE___	{ return CullAABBs( frustum, boxes, 0, boxes.count, OUT visible ); }
+
+		ND_ static usize  CullSpheres (const Frustum_t &frustum, const Spheres &spheres, usize first, usize count, OUT uint* visible)	__NE___;
+		ND_ static usize  CullSpheres (const Frustum_t &frustum, const Spheres &spheres, OUT uint* visible)								__NE___	{ return CullSpheres( frustum, spheres, 0, spheres.count, OUT visible ); }
+
+		// Bounding boxes are in local space, 'transforms' contains local to world matrix for each object.
+		ND_ static usize  CullAABBs (const Frustum_t &frustum, const AABBs &localBoxes, const float4x4* transforms,
+									 usize first, usize count, OUT uint* visible)														__NE___;
+
+		// Calculates world space AABB which contains transformed local AABB.
+			static void  TransformAABBs (const AABBs &localBoxes, const float4x4* transforms, usize first, usize count,
+										 OUT MutableAABBs worldBoxes)																	__NE___;
+	};
+
+
+
+/*
+=================================================
+	CullAABBs
+----
+	'Max( min * n, max * n )' from 'TFrustum::IsVisible()' is replaced by
+	selecting min or max for whole batch, because plane normal is the same for all objects.
+=================================================
+*/
+	inline usize  FrustumCulling::CullAABBs (const Frustum_t &frustum, const AABBs &boxes, const usize first, const usize count, OUT uint* visible) __NE___
+	{
+		ASSERT( first + count <= boxes.count );
+		NonNull( visible );
+
+		usize		result	= 0;
+		usize		i		= first;
+		const usize	last	= first + count;
+
+		struct PlaneData
+		{
+			const float*	x;
+			const float*	y;
+			const float*	z;
+			float3			norm;
+			float			dist;
+		};
+		StaticArray< PlaneData, _PlaneCount >	planes;
+
+		for (uint p = 0; p < _PlaneCount; ++p)
+		{
+			const auto&	src = frustum.GetPlane( p );
+			planes[p].x		= src.norm.x >= 0.f ? boxes.maxX : boxes.minX;
+			planes[p].y		= src.norm.y >= 0.f ? boxes.maxY : boxes.minY;
+			planes[p].z		= src.norm.z >= 0.f ? boxes.maxZ : boxes.minZ;
+			planes[p].norm	= src.norm;
+			planes[p].dist	= src.dist;
+		}
+
+	  #ifdef AE_SIMD_SimdFloat4
+		{
+			const Simd_t	neg_err	{-_Err};
+			Simd_t			nx [_PlaneCount], ny [_PlaneCount], nz [_PlaneCount], dist [_PlaneCount];
+
+			for (uint p = 0; p < _PlaneCount; ++p)
+			{
+				nx[p]	= Simd_t{ planes[p].norm.x };
+				ny[p]	= Simd_t{ planes[p].norm.y };
+				nz[p]	= Simd_t{ planes[p].norm.z };
+				dist[p]	= Simd_t{ planes[p].dist };
+			}
+
+			constexpr uint	all_bits = ToBitMask<uint>( BatchSize );
+
+			for (; i + BatchSize <= last; i += BatchSize)
+			{
+				uint	outside = 0;
+				for (uint p = 0; p < _PlaneCount; ++p)
+				{
+					const Simd_t	d = Simd_t{ planes[p].x + i } * nx[p] +
+										Simd_t{ planes[p].y + i } * ny[p] +
+										Simd_t{ planes[p].z + i } * nz[p] + dist[p];
+					outside |= d.Less( neg_err ).ToMask();
+				}
+
+				for (uint vis = ~outside & all_bits; vis != 0;)
+				{
+					visible[ result++ ] = uint(i) + ExtractBitIndex<uint>( INOUT vis );
+				}
+			}
+		}
+	  #endif
+
+		for (; i < last; ++i)
+		{
+			bool	inside = true;
+			for (auto& p : planes)
+			{
+				inside &= (p.x[i] * p.norm.x + p.y[i] * p.norm.y + p.z[i] * p.norm.z + p.dist) >= -_Err;
+			}
+			if ( inside )
+				visible[ result++ ] = uint(i);
+		}
+		return result;
+	}
+
+/*
+=================================================
+	CullSpheres
+=================================================
+*/
+	inline usize  FrustumCulling::CullSpheres (const Frustum_t &frustum, const Spheres &spheres, const usize first, const usize count, OUT uint* visible) __NE___
+	{
+		ASSERT( first + count <= spheres.count );
+		NonNull( visible );
+
+		usize		result	= 0;
+		usize		i		= first;
+		const usize	last	= first + count;
+
+	  #ifdef AE_SIMD_SimdFloat4
+		{
+			const Simd_t	neg_err	{-_Err};
+			Simd_t			nx [_PlaneCount], ny [_PlaneCount], nz [_PlaneCount], dist [_PlaneCount];
+
+			for (uint p = 0; p < _PlaneCount; ++p)
+			{
+				const auto&	src = frustum.GetPlane( p );
+				nx[p]	= Simd_t{ src.norm.x };
+				ny[p]	= Simd_t{ src.norm.y };
+				nz[p]	= Simd_t{ src.norm.z };
+				dist[p]	= Simd_t{ src.dist };
+			}
+
+			constexpr uint	all_bits = ToBitMask<uint>( BatchSize );
+
+			for (; i + BatchSize <= last; i += BatchSize)
+			{
+				const Simd_t	x	{ spheres.x + i };
+				const Simd_t	y	{ spheres.y + i };
+				const Simd_t	z	{ spheres.z + i };
+				const Simd_t	r	{ spheres.radius + i };
+				uint			outside = 0;
+
+				for (uint p = 0; p < _PlaneCount; ++p)
+				{
+					const Simd_t	d = x * nx[p] + y * ny[p] + z * nz[p] + dist[p] + r;
+					outside |= d.Less( neg_err ).ToMask();
+				}
+
+				for (uint vis = ~outside & all_bits; vis != 0;)
+				{
+					visible[ result++ ] = uint(i) + ExtractBitIndex<uint>( INOUT vis );
+				}
+			}
+		}
+	  #endif
+
+		for (; i < last; ++i)
+		{
+			if ( frustum.IsVisible( BoundingSphere<float>{ float3{ spheres.x[i], spheres.y[i], spheres.z[i] }, spheres.radius[i] }))
+				visible[ result++ ] = uint(i);
+		}
+		return result;
+	}
+
+/*
+=================================================
+	TransformAABBs
+----
+	from 'Transforming Axis-Aligned Bounding Boxes' by James Arvo, Graphics Gems 1990.
+=================================================
+*/
+	inline void  FrustumCulling::TransformAABBs (const AABBs &localBoxes, const float4x4* transforms, const usize first, const usize count,
+												 OUT MutableAABBs worldBoxes) __NE___
+	{
+		ASSERT( first + count <= localBoxes.count );
+		NonNull( transforms );
+
+		for (usize i = first, j = 0; j < count; ++i, ++j)
+		{
+			const float4x4&	m		= transforms[i];
+			const float3	center	{ (localBoxes.minX[i] + localBoxes.maxX[i]) * 0.5f,
+									  (localBoxes.minY[i] + localBoxes.maxY[i]) * 0.5f,
+									  (localBoxes.minZ[i] + localBoxes.maxZ[i]) * 0.5f };
+			const float3	extent	{ (localBoxes.maxX[i] - localBoxes.minX[i]) * 0.5f,
+									  (localBoxes.maxY[i] - localBoxes.minY[i]) * 0.5f,
+									  (localBoxes.maxZ[i] - localBoxes.minZ[i]) * 0.5f };
+
+			const float3	c	= float3{m[0]} * center.x + float3{m[1]} * center.y + float3{m[2]} * center.z + float3{m[3]};
+			const float3	e	= Abs(float3{m[0]}) * extent.x + Abs(float3{m[1]}) * extent.y + Abs(float3{m[2]}) * extent.z;
+
+			worldBoxes.minX[j] = c.x - e.x;		worldBoxes.maxX[j] = c.x + e.x;
+			worldBoxes.minY[j] = c.y - e.y;		worldBoxes.maxY[j] = c.y + e.y;
+			worldBoxes.minZ[j] = c.z - e.z;		worldBoxes.maxZ[j] = c.z + e.z;
+		}
+	}
+
+/*
+=================================================
+	CullAABBs (with transforms)
+----
+	bounds are transformed by small chunks which fit into L1 cache
+=================================================
+*/
+	inline usize  FrustumCulling::CullAABBs (const Frustum_t &frustum, const AABBs &localBoxes, const float4x4* transforms,
+											 const usize first, const usize count, OUT uint* visible) __NE___
+	{
+		ASSERT( first + count <= localBoxes.count );
+
+		alignas(64) float	tmp [6][_TransformChunk];
+		const MutableAABBs	world	{ tmp[0], tmp[1], tmp[2], tmp[3], tmp[4], tmp[5] };
+		usize				result	= 0;
+
+		for (usize i = first, last = first + count; i < last;)
+		{
+			const usize	n = Min( last - i, usize{_TransformChunk} );
+
+			TransformAABBs( localBoxes, transforms, i, n, OUT world );
+
+			const usize	cnt = CullAABBs( frustum, world.Get( n ), 0, n, OUT visible + result );
+			for (usize j = 0; j < cnt; ++j) {
+				visible[ result + j ] += uint(i);
+			}
+			result	+= cnt;
+			i		+= n;
+		}
+		return result;
+	}
+
+
+} // AE::Math
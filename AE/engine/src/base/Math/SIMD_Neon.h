@@ -833,6 +833,8 @@ namespace AE::Math
 			ND_ bool  All ()							C_NE___	{ return uint(_value[0] & _value[1] & _value[2] & _value[3]) == UMax; }
 			ND_ bool  Any ()							C_NE___	{ return uint(_value[0] | _value[1] | _value[2] | _value[3]) == UMax; }
 			ND_ bool  None ()							C_NE___	{ return uint(_value[0] | _value[1] | _value[2] | _value[3]) == 0; }
+
+			ND_ uint  ToMask ()							C_NE___	{ return uint((_value[0] & 1) | (_value[1] & 2) | (_value[2] & 4) | (_value[3] & 8)); }	// 1 bit per element
 		};
 
 
@@ -857,6 +859,7 @@ namespace AE::Math
 
 		ND_ Value_t			operator [] (usize i)		C_NE___	{ ASSERT( i < count );  return _value[i]; }
 		ND_ Native_t const&	Get ()						C_NE___	{ return _value; }
+			void			ToArray (OUT Value_t* dst)	C_NE___	{ vst1q_f32( OUT dst, _value ); }
 
 		ND_ Self  Add (const Self &rhs)					C_NE___	{ return Self{ vaddq_f32( _value, rhs._value )}; }
 		ND_ Self  Sub (const Self &rhs)					C_NE___	{ return Self{ vsubq_f32( _value, rhs._value )}; }
@@ -870,8 +873,17 @@ namespace AE::Math
 		ND_ Bool4  operator == (const Self &rhs)		C_NE___	{ return Equal( rhs ); }
 		ND_ Bool4  operator != (const Self &rhs)		C_NE___	{ return NotEqual( rhs ); }
 
+		ND_ Bool4  operator >  (const Self &rhs)		C_NE___	{ return Greater( rhs ); }
+		ND_ Bool4  operator <  (const Self &rhs)		C_NE___	{ return Less( rhs ); }
+		ND_ Bool4  operator >= (const Self &rhs)		C_NE___	{ return GEqual( rhs ); }
+		ND_ Bool4  operator <= (const Self &rhs)		C_NE___	{ return LEqual( rhs ); }
+
 		ND_ Bool4  Equal (const Self &rhs)				C_NE___	{ return Bool4{ vceqq_f32( _value, rhs._value )}; }
 		ND_ Bool4  NotEqual (const Self &rhs)			C_NE___	{ return ~Equal( rhs ); }
+		ND_ Bool4  Greater (const Self &rhs)			C_NE___	{ return Bool4{ vcgtq_f32( _value, rhs._value )}; }
+		ND_ Bool4  Less (const Self &rhs)				C_NE___	{ return Bool4{ vcltq_f32( _value, rhs._value )}; }
+		ND_ Bool4  GEqual (const Self &rhs)				C_NE___	{ return Bool4{ vcgeq_f32( _value, rhs._value )}; }
+		ND_ Bool4  LEqual (const Self &rhs)				C_NE___	{ return Bool4{ vcleq_f32( _value, rhs._value )}; }
 
 		ND_ Self  Abs ()								C_NE___	{ return Self{ vabsq_f32( _value )}; }							// abs(x)
 		ND_ Self  Negative ()							C_NE___	{ return Self{ vnegq_f32( _value )}; }							// -x
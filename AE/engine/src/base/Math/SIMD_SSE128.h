@@ -47,6 +47,8 @@ namespace AE::Math
 			ND_ bool  All ()								C_NE___	{ return _mm_movemask_epi8( _value ) == 0xFFFF; }
 			ND_ bool  Any ()								C_NE___	{ return _mm_movemask_epi8( _value ) != 0; }
 			ND_ bool  None ()								C_NE___	{ return _mm_movemask_epi8( _value ) == 0; }
+
+			ND_ uint  ToMask ()								C_NE___	{ return uint(_mm_movemask_ps( _mm_castsi128_ps( _value ))); }	// 1 bit per element
 		};
 
 
@@ -44,6 +44,8 @@ namespace AE::Math
 			ND_ bool  All ()								C_NE___	{ return _mm256_movemask_epi8( _value ) == -1; }
 			ND_ bool  Any ()								C_NE___	{ return _mm256_movemask_epi8( _value ) != 0; }
 			ND_ bool  None ()								C_NE___	{ return _mm256_movemask_epi8( _value ) == 0; }
+
+			ND_ uint  ToMask ()								C_NE___	{ return uint(_mm256_movemask_ps( _mm256_castsi256_ps( _value ))); }	// 1 bit per element
 		};
 
 
@@ -96,6 +96,27 @@ namespace AE::Math
 		using Self		= SimdFloat16;
 
 
+		struct Bool16
+		{
+		private:
+			__mmask16	_value;		// 1 bit per element
+
+		public:
+			explicit Bool16 (__mmask16 val)					__NE___	: _value{val} {}
+
+			ND_ Bool16  operator | (const Bool16 &rhs)		C_NE___	{ return Bool16{ __mmask16( _value | rhs._value )}; }
+			ND_ Bool16  operator & (const Bool16 &rhs)		C_NE___	{ return Bool16{ __mmask16( _value & rhs._value )}; }
+			ND_ Bool16  operator ^ (const Bool16 &rhs)		C_NE___	{ return Bool16{ __mmask16( _value ^ rhs._value )}; }
+			ND_ Bool16  operator ~ ()						C_NE___	{ return Bool16{ __mmask16( ~_value )}; }
+
+			ND_ bool  All ()								C_NE___	{ return _value == 0xFFFF; }
+			ND_ bool  Any ()								C_NE___	{ return _value != 0; }
+			ND_ bool  None ()								C_NE___	{ return _value == 0; }
+
+			ND_ uint  ToMask ()								C_NE___	{ return uint(_value); }
+		};
+
+
 	// variables
 	private:
 		__m512		_value;		// float[16]
@@ -103,7 +124,33 @@ namespace AE::Math
 
 	// methods
 	public:
-		SimdFloat16 ()	__NE___	: _value{_mm512_setzero_ps()}	{}
+		SimdFloat16 ()											__NE___	: _value{_mm512_setzero_ps()}	{}
+		explicit SimdFloat16 (float v)							__NE___	: _value{ _mm512_set1_ps( v )} {}
+		explicit SimdFloat16 (const float* ptr)					__NE___	: _value{ _mm512_loadu_ps( ptr )} { NonNull( ptr ); }
+		explicit SimdFloat16 (const __m512 &v)					__NE___	: _value{v} {}
+
+		ND_ Self  operator +  (const Self &rhs)					C_NE___	{ return Add( rhs ); }
+		ND_ Self  operator -  (const Self &rhs)					C_NE___	{ return Sub( rhs ); }
+		ND_ Self  operator *  (const Self &rhs)					C_NE___	{ return Mul( rhs ); }
+
+		ND_ Bool16  operator >  (const Self &rhs)				C_NE___	{ return Greater( rhs ); }
+		ND_ Bool16  operator <  (const Self &rhs)				C_NE___	{ return Less( rhs ); }
+
+		ND_ __m512 const&  Get ()								C_NE___	{ return _value; }
+
+		ND_ Self  Add (const Self &rhs)							C_NE___	{ return Self{ _mm512_add_ps( _value, rhs._value )}; }
+		ND_ Self  Sub (const Self &rhs)							C_NE___	{ return Self{ _mm512_sub_ps( _value, rhs._value )}; }
+		ND_ Self  Mul (const Self &rhs)							C_NE___	{ return Self{ _mm512_mul_ps( _value, rhs._value )}; }
+		ND_ Self  Min (const Self &rhs)							C_NE___	{ return Self{ _mm512_min_ps( _value, rhs._value )}; }
+		ND_ Self  Max (const Self &rhs)							C_NE___	{ return Self{ _mm512_max_ps( _value, rhs._value )}; }
+		ND_ Self  Abs ()										C_NE___	{ return Self{ _mm512_abs_ps( _value )}; }
+
+		ND_ Self  FusedMulAdd (const Self &b, const Self &c)	C_NE___ { return Self{ _mm512_fmadd_ps( _value, b._value, c._value )}; }	// a * b + c
+
+		ND_ Bool16  Greater (const Self &rhs)					C_NE___	{ return Bool16{ _mm512_cmp_ps_mask( _value, rhs._value, _CMP_GT_OQ )}; }
+		ND_ Bool16  Less    (const Self &rhs)					C_NE___	{ return Bool16{ _mm512_cmp_ps_mask( _value, rhs._value, _CMP_LT_OQ )}; }
+
+			void	ToArray (OUT Value_t* dst)					C_NE___	{ _mm512_storeu_ps( OUT dst, _value ); }
 	};
 
 
@@ -45,6 +45,22 @@ namespace AE::Base
 		return false;
 	}
 
+/*
+=================================================
+	HWCounters_Get
+=================================================
+*/
+	bool  PerformanceStat::HWCounters_Get (OUT HWCounters &result) __NE___
+	{
+		result = Default;
+		return false;	// not supported
+	}
+
+	bool  PerformanceStat::HWCounters_IsSupported () __NE___
+	{
+		return false;
+	}
+
 /*
 =================================================
 	Battery_Get
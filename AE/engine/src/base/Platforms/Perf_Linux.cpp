@@ -7,6 +7,9 @@
 # include <fstream>
 # include <sys/auxv.h>
 # include <sys/resource.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+# include <linux/perf_event.h>
 
 # include "base/Platforms/CPUInfo.h"
 # include "base/Platforms/PerformanceStat.h"
@@ -259,6 +262,201 @@ namespace
 //-----------------------------------------------------------------------------
 
 
+namespace
+{
+	//
+	// Perf Event Group
+	//
+	struct PerfEventGroup
+	{
+	// types
+		enum class ECounter : ubyte
+		{
+			Cycles,
+			Instructions,
+			L1dMisses,
+			LLCMisses,
+			BranchMisses,
+			_Count
+		};
+
+		struct ReadFormat
+		{
+			ulong	nr;
+			ulong	values [uint(ECounter::_Count)];
+		};
+
+	// variables
+		StaticArray< int, uint(ECounter::_Count) >		fds;
+		StaticArray< ECounter, uint(ECounter::_Count) >	order;		// order of counters in group
+		uint											count		= 0;
+		bool											initialized	= false;
+
+	// methods
+		PerfEventGroup ()							__NE___	{ fds.fill( -1 ); }
+		~PerfEventGroup ()							__NE___;
+
+		ND_ bool  Init ()							__NE___;
+		ND_ bool  Read (OUT PerformanceStat::HWCounters &)	C_NE___;
+		ND_ bool  IsValid ()						C_NE___	{ return count > 0; }
+	};
+
+	static thread_local PerfEventGroup	t_PerfEvents;
+	static std::atomic<int>				s_PerfEventSupported {-1};	// -1 - unknown
+
+/*
+=================================================
+	PerfEventOpen
+=================================================
+*/
+	ND_ static int  PerfEventOpen (uint type, ulong config, int groupFd) __NE___
+	{
+		perf_event_attr		attr = {};
+		attr.size			= sizeof(attr);
+		attr.type			= type;
+		attr.config			= config;
+		attr.disabled		= 0;
+		attr.exclude_kernel	= 1;	// allowed with 'perf_event_paranoid' == 2
+		attr.exclude_hv		= 1;
+		attr.read_format	= PERF_FORMAT_GROUP;
+
+		// pid = 0, cpu = -1 : calling thread on any cpu
+		return int(::syscall( __NR_perf_event_open, &attr, 0, -1, groupFd, PERF_FLAG_FD_CLOEXEC ));
+	}
+
+/*
+=================================================
+	PerfEventGroup
+=================================================
+*/
+	PerfEventGroup::~PerfEventGroup () __NE___
+	{
+		for (int fd : fds) {
+			if ( fd >= 0 )
+				::close( fd );
+		}
+	}
+
+	bool  PerfEventGroup::Init () __NE___
+	{
+		if ( initialized )
+			return IsValid();
+
+		initialized = true;
+
+		if ( s_PerfEventSupported.load() == 0 )
+			return false;
+
+		const auto	CacheConfig = [] (ulong cache) {{
+			return cache | (ulong{PERF_COUNT_HW_CACHE_OP_READ} << 8) | (ulong{PERF_COUNT_HW_CACHE_RESULT_MISS} << 16);
+		}};
+
+		const Pair< uint, ulong >	configs [] = {
+			{ PERF_TYPE_HARDWARE,	PERF_COUNT_HW_CPU_CYCLES },
+			{ PERF_TYPE_HARDWARE,	PERF_COUNT_HW_INSTRUCTIONS },
+			{ PERF_TYPE_HW_CACHE,	CacheConfig( PERF_COUNT_HW_CACHE_L1D )},
+			{ PERF_TYPE_HARDWARE,	PERF_COUNT_HW_CACHE_MISSES },
+			{ PERF_TYPE_HARDWARE,	PERF_COUNT_HW_BRANCH_MISSES },
+		};
+		StaticAssert( CountOf(configs) == uint(ECounter::_Count) );
+
+		for (uint i = 0; i < CountOf(configs); ++i)
+		{
+			const int	leader	= count > 0 ? fds[0] : -1;
+			const int	fd		= PerfEventOpen( configs[i].first, configs[i].second, leader );
+
+			if_unlikely( fd < 0 )
+			{
+				// cycles counter is a group leader
+				if ( i == 0 )
+					break;
+
+				continue;	// counter is not supported on this CPU
+			}
+
+			fds[count]		= fd;
+			order[count]	= ECounter(i);
+			++count;
+		}
+
+		s_PerfEventSupported.store( IsValid() ? 1 : 0 );
+
+		if_unlikely( not IsValid() )
+			AE_LOGI( "perf_event_open is not available, hardware counters are disabled" );
+
+		return IsValid();
+	}
+
+/*
+=================================================
+	PerfEventGroup::Read
+=================================================
+*/
+	bool  PerfEventGroup::Read (OUT PerformanceStat::HWCounters &result) C_NE___
+	{
+		ReadFormat	data = {};
+
+		if_unlikely( ::read( fds[0], OUT &data, sizeof(data) ) <= 0 )
+			return false;
+
+		ASSERT( data.nr == count );
+
+		for (uint i = 0, cnt = Min( uint(data.nr), count ); i < cnt; ++i)
+		{
+			const ulong	val = data.values[i];
+			switch_enum( order[i] )
+			{
+				case ECounter::Cycles :			result.cycles		= val;	break;
+				case ECounter::Instructions :	result.instructions	= val;	break;
+				case ECounter::L1dMisses :		result.l1dMisses	= val;	break;
+				case ECounter::LLCMisses :		result.llcMisses	= val;	break;
+				case ECounter::BranchMisses :	result.branchMisses	= val;	break;
+				case ECounter::_Count :			break;
+			}
+			switch_end
+		}
+		result.hwAvailable = true;
+		return true;
+	}
+
+} // namespace
+
+/*
+=================================================
+	HWCounters_Get
+=================================================
+*/
+	bool  PerformanceStat::HWCounters_Get (OUT HWCounters &result) __NE___
+	{
+		result = Default;
+
+		// context switches are counted by kernel, use 'getrusage' which does not require permissions
+		::rusage	usage = {};
+		if ( ::getrusage( RUSAGE_THREAD, OUT &usage ) == 0 )
+			result.contextSwitches = ulong(usage.ru_nvcsw) + ulong(usage.ru_nivcsw);
+
+		auto&	group = t_PerfEvents;
+		if_likely( group.Init() )
+			return group.Read( OUT result );
+
+		return false;
+	}
+
+/*
+=================================================
+	HWCounters_IsSupported
+=================================================
+*/
+	bool  PerformanceStat::HWCounters_IsSupported () __NE___
+	{
+		if ( s_PerfEventSupported.load() < 0 )
+			Unused( t_PerfEvents.Init() );
+
+		return s_PerfEventSupported.load() == 1;
+	}
+//-----------------------------------------------------------------------------
+
+
 #ifdef AE_PLATFORM_ANDROID
 namespace
 {
@@ -452,6 +452,22 @@ namespace
 		return res;
 	}
 
+/*
+=================================================
+	HWCounters_Get
+=================================================
+*/
+	bool  PerformanceStat::HWCounters_Get (OUT HWCounters &result) __NE___
+	{
+		result = Default;
+		return false;	// not supported
+	}
+
+	bool  PerformanceStat::HWCounters_IsSupported () __NE___
+	{
+		return false;
+	}
+
 /*
 =================================================
 	Battery_Get
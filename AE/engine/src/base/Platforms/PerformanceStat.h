@@ -69,6 +69,33 @@ namespace AE::Base
 			Array<Pair<String, Temperature_t>>	sensors;
 		};
 
+		// Hardware performance counters for current thread.
+		// Counters are monotonic, use difference between two samples.
+		struct HWCounters
+		{
+			ulong			cycles			= 0;
+			ulong			instructions	= 0;
+			ulong			l1dMisses		= 0;	// L1 data cache read misses
+			ulong			llcMisses		= 0;	// last level cache misses
+			ulong			branchMisses	= 0;
+			ulong			contextSwitches	= 0;	// voluntary + involuntary
+			bool			hwAvailable		= false;// 'false' - only 'contextSwitches' is valid
+
+				HWCounters&	operator += (const HWCounters &rhs)	__NE___;
+			ND_ HWCounters	operator -  (const HWCounters &rhs)	C_NE___;
+
+			// instructions per cycle, low IPC with high cache misses indicates memory-bound code
+			ND_ float		IPC ()								C_NE___	{ return cycles > 0 ? float(double(instructions) / double(cycles)) : 0.f; }
+
+			// misses per 1000 instructions
+			ND_ float		L1dMPKI ()							C_NE___	{ return _PerKI( l1dMisses ); }
+			ND_ float		LLCMPKI ()							C_NE___	{ return _PerKI( llcMisses ); }
+			ND_ float		BranchMPKI ()						C_NE___	{ return _PerKI( branchMisses ); }
+
+		private:
+			ND_ float		_PerKI (ulong x)					C_NE___	{ return instructions > 0 ? float(double(x) * 1000.0 / double(instructions)) : 0.f; }
+		};
+
 
 	// methods
 		ND_ static MHz_t	CPU_GetFrequency (uint core)										__NE___;
@@ -80,6 +107,12 @@ namespace AE::Base
 											 OUT PerThreadCounters *,
 											 OUT MemoryCounters *)								__NE___;
 
+		// Read hardware counters for current thread, counters are created at first call in each thread.
+		// Linux/Android: 'perf_event_open', requires 'perf_event_paranoid' <= 2.
+		// Fallback: only 'contextSwitches' is valid.
+		ND_ static bool		HWCounters_Get (OUT HWCounters &)									__NE___;
+		ND_ static bool		HWCounters_IsSupported ()											__NE___;
+
 		ND_ static bool		Battery_Get (OUT BatteryStat &)										__NE___;
 		ND_ static bool		Temperature_Get (OUT TemperatureStat &)								__NE___;
 
@@ -93,4 +126,37 @@ namespace AE::Base
 		#endif
 	};
 
+
+/*
+=================================================
+	HWCounters
+=================================================
+*/
+	inline PerformanceStat::HWCounters&  PerformanceStat::HWCounters::operator += (const HWCounters &rhs) __NE___
+	{
+		cycles			+= rhs.cycles;
+		instructions	+= rhs.instructions;
+		l1dMisses		+= rhs.l1dMisses;
+		llcMisses		+= rhs.llcMisses;
+		branchMisses	+= rhs.branchMisses;
+		contextSwitches	+= rhs.contextSwitches;
+		hwAvailable		|= rhs.hwAvailable;
+		return *this;
+	}
+
+	inline PerformanceStat::HWCounters  PerformanceStat::HWCounters::operator - (const HWCounters &rhs) C_NE___
+	{
+		const auto	Sub = [] (ulong lhs, ulong rhs) {{ return lhs > rhs ? lhs - rhs : 0; }};
+
+		HWCounters	res;
+		res.cycles			= Sub( cycles,			rhs.cycles );
+		res.instructions	= Sub( instructions,	rhs.instructions );
+		res.l1dMisses		= Sub( l1dMisses,		rhs.l1dMisses );
+		res.llcMisses		= Sub( llcMisses,		rhs.llcMisses );
+		res.branchMisses	= Sub( branchMisses,	rhs.branchMisses );
+		res.contextSwitches	= Sub( contextSwitches,	rhs.contextSwitches );
+		res.hwAvailable		= hwAvailable and rhs.hwAvailable;
+		return res;
+	}
+
 } // AE::Base
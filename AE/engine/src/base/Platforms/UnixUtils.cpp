@@ -5,6 +5,9 @@
 #ifdef AE_PLATFORM_UNIX_BASED
 # include <unistd.h>
 # include <fcntl.h>
+# ifndef AE_PLATFORM_EMSCRIPTEN
+#	include <unwind.h>
+# endif
 
 # include "base/Platforms/UnixUtils.h"
 # include "base/Algorithms/StringUtils.h"
@@ -220,6 +223,53 @@ namespace AE::Base
 		}
 		return result;
 	}
+
+/*
+=================================================
+	CaptureCallStack
+----
+	'_Unwind_Backtrace()' is async-signal-safe and does not allocate memory.
+	Emscripten has no access to native call stack.
+=================================================
+*/
+	uint  UnixUtils::CaptureCallStack (OUT void** frames, const uint maxFrames, const uint skipFrames) __NE___
+	{
+	  #ifdef AE_PLATFORM_EMSCRIPTEN
+		Unused( frames, maxFrames, skipFrames );
+		return 0;
+	  #else
+		struct State
+		{
+			void**	frames;
+			uint	count;
+			uint	maxFrames;
+			uint	skip;
+		};
+		State	state { frames, 0, maxFrames, skipFrames + 1 };	// skip this function
+
+		const auto	Callback = [] (_Unwind_Context* ctx, void* arg) -> _Unwind_Reason_Code
+		{{
+			auto&		st	= *static_cast<State*>(arg);
+			const usize	pc	= usize(_Unwind_GetIP( ctx ));
+
+			if ( pc == 0 )
+				return _URC_END_OF_STACK;
+
+			if ( st.skip > 0 ) {
+				--st.skip;
+				return _URC_NO_REASON;
+			}
+
+			st.frames[ st.count++ ] = BitCast<void*>( pc );
+			return st.count < st.maxFrames ? _URC_NO_REASON : _URC_END_OF_STACK;
+		}};
+
+		if ( maxFrames > 0 )
+			::_Unwind_Backtrace( Callback, OUT &state );
+
+		return state.count;
+	  #endif
+	}
 //-----------------------------------------------------------------------------
 
 
@@ -72,6 +72,12 @@ namespace AE::Base
 		ND_ static Bytes	GetDefaultStackSize ()											__NE___;
 
 
+		// Debugging //
+
+		// Returns number of captured return addresses, without symbolization.
+		ND_ static uint		CaptureCallStack (OUT void** frames, uint maxFrames, uint skipFrames = 0) __NE___;
+
+
 	private:
 		ND_ static bool  _CheckError (int err, StringView msg, const SourceLoc &loc, ELogLevel level, ELogScope scope)	__NE___;
 	};
@@ -808,6 +808,17 @@ namespace
 	  #endif
 	}
 
+/*
+=================================================
+	CaptureCallStack
+=================================================
+*/
+	uint  WindowsUtils::CaptureCallStack (OUT void** frames, const uint maxFrames, const uint skipFrames) __NE___
+	{
+		// skip this function
+		return ::RtlCaptureStackBackTrace( skipFrames + 1, maxFrames, OUT frames, null );
+	}
+
 
 } // AE::Base
 
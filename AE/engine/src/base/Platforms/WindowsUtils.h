@@ -80,6 +80,12 @@ namespace AE::Base
 		ND_ static Bytes	GetCurrentThreadStackSize ()									__NE___;
 
 
+		// Debugging //
+
+		// Returns number of captured return addresses, without symbolization.
+		ND_ static uint		CaptureCallStack (OUT void** frames, uint maxFrames, uint skipFrames = 0) __NE___;
+
+
 		// OS //
 		ND_ static Version3		GetOSVersion ()												__NE___;
 		ND_ static bool			IsUnderDebugger ()											__NE___;
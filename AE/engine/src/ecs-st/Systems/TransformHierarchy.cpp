@@ -0,0 +1,464 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "ecs-st/Systems/TransformHierarchy.h"
+#include "base/Math/SIMD_SSE.h"
+#include "base/Math/SIMD_Neon.h"
+
+namespace AE::ECS::Systems
+{
+	using namespace AE::Threading;
+
+/*
+=================================================
+	CreateNode
+=================================================
+*/
+	TransformHierarchy::NodeID  TransformHierarchy::CreateNode (const float4x4 &local, const NodeID parent) __NE___
+	{
+		if ( parent != UMax )
+			CHECK_ERR( IsValid( parent ), UMax );
+
+		const usize	slot	= _local.size();
+		CHECK_ERR( slot < _Root, UMax );
+
+		// reserve first, so 'push_back' will not throw and arrays stay in sync,
+		// capacity grows geometrically, otherwise each call will reallocate all arrays
+		const auto	Reserve = [] (auto &arr, usize count)
+		{{
+			if ( count > arr.capacity() )
+				arr.reserve( Max( count, arr.capacity()*2, usize{64} ));	// throw
+		}};
+		NOTHROW_ERR(
+			Reserve( _local, slot+1 );
+			Reserve( _world, slot+1 );
+			Reserve( _parent, slot+1 );
+			Reserve( _flags, slot+1 );
+			Reserve( _slotToNode, slot+1 );
+			Reserve( _nodeToSlot, _nodeToSlot.size()+1 );
+			Reserve( _freeNodes, _nodeToSlot.size()+1 ),
+			UMax );
+
+		NodeID	id;
+		if ( not _freeNodes.empty() )
+		{
+			id = _freeNodes.back();
+			_freeNodes.pop_back();
+		}
+		else
+		{
+			id = NodeID(_nodeToSlot.size());
+			_nodeToSlot.push_back( UMax );
+		}
+
+		_nodeToSlot[id] = Slot_t(slot);
+		_local.push_back( local );
+		_world.push_back( local );
+		_parent.push_back( parent != UMax ? _nodeToSlot[parent] : _Root );
+		_flags.push_back( _Dirty );
+		_slotToNode.push_back( id );
+
+		++_nodeCount;
+		_rebuild = true;
+		return id;
+	}
+
+/*
+=================================================
+	DestroyNode
+----
+	node will be removed from arrays in next 'Update()'
+=================================================
+*/
+	bool  TransformHierarchy::DestroyNode (const NodeID id) __NE___
+	{
+		CHECK_ERR( IsValid( id ));
+
+		// '_freeNodes' capacity is reserved in 'CreateNode()'
+		const Slot_t	slot = _nodeToSlot[id];
+		_slotToNode[slot]	= UMax;
+		_nodeToSlot[id]		= UMax;
+		_freeNodes.push_back( id );
+
+		--_nodeCount;
+		_rebuild = true;
+		return true;
+	}
+
+/*
+=================================================
+	SetParent
+=================================================
+*/
+	bool  TransformHierarchy::SetParent (const NodeID id, const NodeID parent) __NE___
+	{
+		CHECK_ERR( IsValid( id ));
+
+		const Slot_t	slot		= _nodeToSlot[id];
+		Slot_t			parent_slot	= _Root;
+
+		if ( parent != UMax )
+		{
+			CHECK_ERR( IsValid( parent ));
+			parent_slot = _nodeToSlot[parent];
+
+			// check for cycles, destroyed node is the same as root
+			for (Slot_t p = parent_slot; p != _Root and _slotToNode[p] != UMax; p = _parent[p])
+			{
+				CHECK_ERR( p != slot );
+			}
+		}
+
+		if ( _parent[slot] == parent_slot )
+			return true;
+
+		_parent[slot]	= parent_slot;
+		_flags[slot]	|= _Dirty;
+		_rebuild		= true;
+		return true;
+	}
+
+/*
+=================================================
+	SetLocal
+=================================================
+*/
+	bool  TransformHierarchy::SetLocal (const NodeID id, const float4x4 &local) __NE___
+	{
+		CHECK_ERR( IsValid( id ));
+
+		const Slot_t	slot = _nodeToSlot[id];
+		_local[slot] = local;
+		_SetDirty( slot );
+		return true;
+	}
+
+/*
+=================================================
+	_SetDirty
+=================================================
+*/
+	void  TransformHierarchy::_SetDirty (const Slot_t slot) __NE___
+	{
+		_flags[slot] |= _Dirty;
+
+		// levels will be recalculated in '_Rebuild()'
+		if ( _rebuild )
+			return;
+
+		auto	it = std::upper_bound( _levels.begin(), _levels.end(), slot,
+									   [] (Slot_t lhs, const Level &rhs) { return lhs < rhs.first; });
+		ASSERT( it != _levels.begin() );
+		--it;
+		ASSERT( slot < it->first + it->count );
+		it->dirty = true;
+	}
+
+/*
+=================================================
+	GetParent
+=================================================
+*/
+	TransformHierarchy::NodeID  TransformHierarchy::GetParent (const NodeID id) C_NE___
+	{
+		CHECK_ERR( IsValid( id ), UMax );
+
+		const Slot_t	p = _parent[ _nodeToSlot[id] ];
+		return p != _Root ? _slotToNode[p] : NodeID(UMax);
+	}
+
+/*
+=================================================
+	_Rebuild
+----
+	Removes destroyed nodes and sorts nodes by depth (stable).
+	Children of destroyed node become dirty root nodes.
+=================================================
+*/
+	bool  TransformHierarchy::_Rebuild () __NE___
+	{
+		const usize		old_count	= _local.size();
+		Array<uint>		depth;
+		Array<Slot_t>	stack;
+		Array<Slot_t>	remap;
+		Array<uint>		level_size;
+
+		Array<float4x4>	local;
+		Array<float4x4>	world;
+		Array<Slot_t>	parent;
+		Array<ubyte>	flags;
+		Array<NodeID>	slot_to_node;
+
+		NOTHROW_ERR(
+			depth.resize( old_count, UMax );
+			remap.resize( old_count, UMax );
+			local.resize( _nodeCount );
+			world.resize( _nodeCount );
+			parent.resize( _nodeCount );
+			flags.resize( _nodeCount );
+			slot_to_node.resize( _nodeCount ),
+			false );
+
+		// calculate depth
+		uint	max_depth = 0;
+		for (usize i = 0; i < old_count; ++i)
+		{
+			if ( _slotToNode[i] == UMax )
+				continue;
+
+			Slot_t	cur = Slot_t(i);
+			while ( depth[cur] == UMax )
+			{
+				const Slot_t	p = _parent[cur];
+
+				if ( p == _Root or _slotToNode[p] == UMax )
+				{
+					if ( p != _Root )
+					{
+						_parent[cur] = _Root;
+						_flags[cur]  |= _Dirty;
+					}
+					depth[cur] = 0;
+					break;
+				}
+
+				NOTHROW_ERR( stack.push_back( cur ), false );
+				cur = p;
+			}
+
+			for (; not stack.empty(); stack.pop_back())
+			{
+				const Slot_t	s = stack.back();
+				depth[s]	= depth[ _parent[s] ] + 1;
+				max_depth	= Max( max_depth, depth[s] );
+			}
+		}
+
+		// counting sort by depth
+		NOTHROW_ERR(
+			level_size.resize( _nodeCount > 0 ? max_depth+1 : 0 );
+			_levels.resize( level_size.size() ),
+			false );
+
+		for (usize i = 0; i < old_count; ++i)
+		{
+			if ( _slotToNode[i] != UMax )
+				++level_size[ depth[i] ];
+		}
+
+		for (usize d = 0, first = 0; d < _levels.size(); ++d)
+		{
+			auto&	level = _levels[d];
+			level.first		= Slot_t(first);
+			level.count		= level_size[d];
+			level.dirty		= false;
+			level.updated	= false;
+
+			first			+= level.count;
+			level_size[d]	= level.first;	// used as write position
+		}
+
+		for (usize i = 0; i < old_count; ++i)
+		{
+			if ( _slotToNode[i] == UMax )
+				continue;
+
+			const Slot_t	dst = level_size[ depth[i] ]++;
+			remap[i]			= dst;
+			local[dst]			= _local[i];
+			world[dst]			= _world[i];
+			flags[dst]			= _flags[i];
+			slot_to_node[dst]	= _slotToNode[i];
+
+			auto&	level = _levels[ depth[i] ];
+			level.dirty		|= (_flags[i] & _Dirty) != 0;
+			level.updated	|= (_flags[i] & _Updated) != 0;
+		}
+
+		for (usize i = 0; i < old_count; ++i)
+		{
+			if ( _slotToNode[i] == UMax )
+				continue;
+
+			const Slot_t	p = _parent[i];
+			parent[ remap[i] ] = (p != _Root ? remap[p] : _Root);
+		}
+
+		_local		= RVRef(local);
+		_world		= RVRef(world);
+		_parent		= RVRef(parent);
+		_flags		= RVRef(flags);
+		_slotToNode	= RVRef(slot_to_node);
+
+		for (usize i = 0; i < _slotToNode.size(); ++i) {
+			_nodeToSlot[ _slotToNode[i] ] = Slot_t(i);
+		}
+
+		_rebuild = false;
+		return true;
+	}
+
+/*
+=================================================
+	Update
+----
+	Levels are processed from root to leaves.
+	Level is skipped if it has no dirty nodes, parent level is not updated
+	and it has no 'Updated' flags from previous pass which must be cleared.
+=================================================
+*/
+	void  TransformHierarchy::Update (const ETaskQueue queue, const usize minPerTask) __NE___
+	{
+		if ( _rebuild )
+			CHECK_ERRV( _Rebuild() );
+
+		bool	parent_updated = false;
+
+		for (auto& level : _levels)
+		{
+			if ( level.dirty or level.updated or parent_updated )
+			{
+				level.updated	= _UpdateLevel( level, queue, minPerTask );
+				level.dirty		= false;
+			}
+			parent_updated = level.updated;
+		}
+	}
+
+/*
+=================================================
+	_UpdateLevel
+----
+	Level is split into parts, see 'ParallelParts'.
+=================================================
+*/
+	bool  TransformHierarchy::_UpdateLevel (const Level &level, const ETaskQueue queue, const usize minPerTask) __NE___
+	{
+		const usize		part_count = Clamp( level.count / Max( minPerTask, usize{1} ), usize{1}, usize{MaxParts} );
+
+		if ( part_count <= 1 )
+			return _UpdateRange( level.first, level.count );
+
+		const usize						part_size	= DivCeil( usize{level.count}, part_count );
+		StaticArray< bool, MaxParts >	updated		= {};
+
+		const usize		num_parts = ParallelParts::Run( level.count, part_size, queue,
+										[this, &level, &updated] (usize idx, usize first, usize cnt) __NE___
+										{
+											updated[idx] = _UpdateRange( level.first + Slot_t(first), uint(cnt) );
+										});
+		CHECK_ERR( num_parts > 0 );
+
+		bool	result = false;
+		for (usize i = 0; i < num_parts; ++i) {
+			result |= updated[i];
+		}
+		return result;
+	}
+
+/*
+=================================================
+	_UpdateRange
+----
+	Parent is always on the previous level, so it is already updated.
+	Returns 'true' if at least one node is updated.
+=================================================
+*/
+	bool  TransformHierarchy::_UpdateRange (const Slot_t first, const uint count) __NE___
+	{
+		bool	any_updated = false;
+
+		for (Slot_t i = first, end = first + count; i < end; ++i)
+		{
+			const Slot_t	p		= _parent[i];
+			const bool		update	= ((_flags[i] & _Dirty) != 0) or
+									  (p != _Root and (_flags[p] & _Updated) != 0);
+			if ( update )
+			{
+				ASSERT( p == _Root or p < first );
+				_world[i] = (p != _Root ? _Mul( _world[p], _local[i] ) : _local[i]);
+			}
+
+			_flags[i]	= ubyte(update ? _Updated : 0);
+			any_updated	|= update;
+		}
+		return any_updated;
+	}
+
+/*
+=================================================
+	_Mul
+----
+	result[c] = lhs[0] * rhs[c].x + lhs[1] * rhs[c].y + lhs[2] * rhs[c].z + lhs[3] * rhs[c].w
+=================================================
+*/
+	float4x4  TransformHierarchy::_Mul (const float4x4 &lhs, const float4x4 &rhs) __NE___
+	{
+	  #ifdef AE_SIMD_SimdFloat4
+		const SimdFloat4	c0 {&lhs[0].x};
+		const SimdFloat4	c1 {&lhs[1].x};
+		const SimdFloat4	c2 {&lhs[2].x};
+		const SimdFloat4	c3 {&lhs[3].x};
+
+		float4x4	result;
+		for (usize c = 0; c < 4; ++c)
+		{
+			const auto&			r = rhs[c];
+			const SimdFloat4	v = c0 * SimdFloat4{r.x} + c1 * SimdFloat4{r.y} + c2 * SimdFloat4{r.z} + c3 * SimdFloat4{r.w};
+			v.ToArray( OUT &result[c].x );
+		}
+		return result;
+	  #else
+		return lhs * rhs;
+	  #endif
+	}
+
+/*
+=================================================
+	Register
+=================================================
+*/
+	void  TransformHierarchy::Register (Registry &reg) __NE___
+	{
+		reg.RegisterComponents< Components::TransformNode, Components::WorldTransform >();
+
+		_query = reg.CreateQuery< ReadAccess<Components::TransformNode>, WriteAccess<Components::WorldTransform> >();
+		ASSERT( _query );
+	}
+
+/*
+=================================================
+	CopyToComponents
+=================================================
+*/
+	void  TransformHierarchy::CopyToComponents (Registry &reg, const Bool onlyUpdated) C_NE___
+	{
+		CHECK_ERRV( _query );
+		ASSERT( not _rebuild );
+
+		const ubyte		mask = ubyte(onlyUpdated ? _Updated : 0);
+
+		reg.Execute( _query,
+			[this, mask] (ArrayView<Tuple< usize, ReadAccess<Components::TransformNode>, WriteAccess<Components::WorldTransform> >> chunks) __NE___
+			{
+				for (auto& chunk : chunks)
+				{
+					chunk.Apply(
+						[this, mask] (const usize cnt, ReadAccess<Components::TransformNode> nodes, WriteAccess<Components::WorldTransform> dst) __NE___
+						{
+							for (usize i = 0; i < cnt; ++i)
+							{
+								const NodeID	id = nodes[i].id;
+								if_unlikely( not IsValid( id ))
+									continue;
+
+								const Slot_t	slot = _nodeToSlot[id];
+								if ( (_flags[slot] & mask) == mask )
+									dst[i].matrix = _world[slot];
+							}
+						});
+				}
+			});
+	}
+
+
+} // AE::ECS::Systems
@@ -0,0 +1,139 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+/*
+	Scene graph with batched update of world matrices.
+
+	Nodes are stored in SoA layout and sorted by depth, so parent is always updated before child
+	and all nodes on the same level can be processed in parallel.
+	Only dirty subtrees are recalculated: node is updated if local transform was changed
+	or if parent world transform was updated in the same pass.
+
+	Structural changes (create, destroy, change parent) are applied in the next 'Update()'.
+	When node is destroyed its children become root nodes.
+
+	Thread-safe: no, but 'Update()' internally runs in parallel.
+*/
+
+#pragma once
+
+#include "ecs-st/Core/Registry.h"
+#include "threading/TaskSystem/ParallelParts.h"
+
+namespace AE::ECS::Components
+{
+
+	// Link between entity and node in 'Systems::TransformHierarchy'.
+	struct TransformNode
+	{
+		uint		id	= UMax;
+	};
+
+
+	// Copy of node world matrix, see 'Systems::TransformHierarchy::CopyToComponents()'.
+	struct WorldTransform
+	{
+		float4x4	matrix;
+	};
+
+} // AE::ECS::Components
+
+
+namespace AE::ECS::Systems
+{
+
+	//
+	// Transform Hierarchy
+	//
+
+	class TransformHierarchy final : public Noncopyable
+	{
+	// types
+	public:
+		using NodeID		= uint;		// stable ID, node position in arrays may be changed in 'Update()'
+		using ETaskQueue	= Threading::ETaskQueue;
+
+		static constexpr usize	DefaultMinPerTask	= 8 << 10;
+		static constexpr uint	MaxParts			= Threading::ParallelParts::MaxParts;
+
+	private:
+		using Slot_t	= uint;
+
+		// node flags
+		static constexpr ubyte		_Dirty		= 1 << 0;	// local transform or parent was changed
+		static constexpr ubyte		_Updated	= 1 << 1;	// world transform was changed in last 'Update()'
+
+		struct Level
+		{
+			Slot_t		first	= 0;
+			uint		count	= 0;
+			bool		dirty	= false;	// has nodes with 'Dirty' flag
+			bool		updated	= false;	// has nodes with 'Updated' flag
+		};
+
+		static constexpr Slot_t		_Root		= UMax;		// parent of root node
+
+
+	// variables
+	private:
+		// SoA, indexed by slot, sorted by depth
+		Array<float4x4>		_local;
+		Array<float4x4>		_world;
+		Array<Slot_t>		_parent;
+		Array<ubyte>		_flags;
+		Array<NodeID>		_slotToNode;	// 'UMax' for destroyed node
+
+		Array<Slot_t>		_nodeToSlot;	// 'UMax' for unused ID
+		Array<NodeID>		_freeNodes;
+		usize				_nodeCount	= 0;
+
+		Array<Level>		_levels;
+		bool				_rebuild	= false;
+
+		QueryID				_query;
+
+
+	// methods
+	public:
+		TransformHierarchy ()																	__NE___	{}
+		~TransformHierarchy ()																	__NE___	{}
+
+		// Returns 'UMax' on error.
+		ND_ NodeID			CreateNode (const float4x4 &local, NodeID parent = UMax)			__NE___;
+			bool			DestroyNode (NodeID id)												__NE___;
+
+		// Returns 'false' if 'parent' is a child of 'id'.
+			bool			SetParent (NodeID id, NodeID parent)								__NE___;
+			bool			SetLocal (NodeID id, const float4x4 &local)							__NE___;
+
+		ND_ bool			IsValid (NodeID id)													C_NE___	{ return id < _nodeToSlot.size() and _nodeToSlot[id] != UMax; }
+		ND_ NodeID			GetParent (NodeID id)												C_NE___;
+		ND_ float4x4 const&	GetLocal (NodeID id)												C_NE___	{ ASSERT( IsValid( id ));  return _local[ _nodeToSlot[id] ]; }
+		ND_ float4x4 const&	GetWorld (NodeID id)												C_NE___	{ ASSERT( IsValid( id ));  return _world[ _nodeToSlot[id] ]; }
+
+		// Returns 'true' if world matrix was changed in last 'Update()'.
+		ND_ bool			IsUpdated (NodeID id)												C_NE___	{ ASSERT( IsValid( id ));  return (_flags[ _nodeToSlot[id] ] & _Updated) != 0; }
+
+		ND_ usize			NodeCount ()														C_NE___	{ return _nodeCount; }
+		ND_ usize			LevelCount ()														C_NE___	{ return _levels.size(); }
+
+		// Recalculates world matrices for dirty subtrees.
+		// Levels with more than 'minPerTask' nodes are split into parts which are processed in parallel.
+			void			Update (ETaskQueue queue = ETaskQueue::PerFrame,
+									usize minPerTask = DefaultMinPerTask)						__NE___;
+
+		// Registers components and creates query for 'CopyToComponents()'.
+			void			Register (Registry &reg)											__NE___;
+
+		// Writes world matrices to 'WorldTransform' components.
+		// If 'onlyUpdated' is true then only matrices which are changed in last 'Update()' will be written.
+			void			CopyToComponents (Registry &reg, Bool onlyUpdated = True{})			C_NE___;
+
+	private:
+		ND_ bool			_Rebuild ()															__NE___;
+		ND_ bool			_UpdateLevel (const Level &, ETaskQueue queue, usize minPerTask)	__NE___;
+		ND_ bool			_UpdateRange (Slot_t first, uint count)								__NE___;
+		ND_ static float4x4	_Mul (const float4x4 &lhs, const float4x4 &rhs)						__NE___;
+			void			_SetDirty (Slot_t slot)												__NE___;
+	};
+
+
+} // AE::ECS::Systems
@@ -112,6 +112,9 @@ namespace AE::Graphics
 		ASSERT( _allocator.use_count() == 1 );
 		_allocator = null;
 
+		// serialized objects may refer to this memory
+		_pplnBlockData = Default;
+
 		GFX_DBG_ONLY( _debugName.clear() );
 	}
 
@@ -779,6 +782,9 @@ namespace AE::Graphics
 			Serializing::Deserializer	des{ mem_stream->ToSubStream( base_off ), _allocator.get() };
 			EMarker						marker;
 
+			des.inPlaceLayout	= true;
+			des.inPlaceViews	= true;
+
 			CHECK_ERR( des( OUT marker ));
 			CHECK_ERR( usize(marker) == i );
 
@@ -832,6 +838,9 @@ namespace AE::Graphics
 			}
 			switch_end
 		}
+
+		// keep memory, 'ArrayView' and 'StringView' in serialized objects point to it
+		_pplnBlockData = mem_stream->ReleaseData();
 		return true;
 	}
 
@@ -319,6 +319,8 @@ namespace AE::Graphics
 		Bytes						_shaderOffset;
 		Bytes						_shaderDataSize;
 
+		Array<ubyte>				_pplnBlockData;		// used for in-place deserialization
+
 		Ptr<const PPLNPACK>			_parentPack;
 		Strong<PipelinePackID>		_parentPackId;
 		EPixelFormat				_surfaceFormat	= Default;
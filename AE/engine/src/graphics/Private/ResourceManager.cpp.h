@@ -118,7 +118,7 @@ namespace {
 				ASSERT( res->IsCreated() );
 
 				res->Destroy( *this );
-				pool.Unassign( id.Index() );
+				_Unassign( id );
 			}
 		}
 	}
@@ -1187,6 +1187,47 @@ namespace {
 //-----------------------------------------------------------------------------
 
 
+/*
+=================================================
+	GetResourcePoolStat
+=================================================
+*/
+	IResourceManager::ResourcePoolStat  ResourceManager::GetResourcePoolStat () C_NE___
+	{
+		ResourcePoolStat	res;
+		res.released	= _poolReleased.load();
+		res.created		= Max( _poolCreated.load(), res.released );
+		return res;
+	}
+
+/*
+=================================================
+	GetStagingBufferFrameStat
+=================================================
+*/
+	IResourceManager::StagingBufferStat  ResourceManager::GetStagingBufferFrameStat (FrameUID frameId) C_NE___
+	{
+		auto	res		= _stagingMngr.GetFrameStat( frameId );
+		auto&	stat	= _coalescerStat[ frameId.Remap2() ];
+
+		res.coalescedSaved	= stat.bytesSaved.load();
+		res.coalescedCopies	= stat.copiesSaved.load();
+		return res;
+	}
+
+/*
+=================================================
+	AddUploadCoalescerStat
+=================================================
+*/
+	void  ResourceManager::AddUploadCoalescerStat (FrameUID frameId, Bytes saved, ulong copies) __NE___
+	{
+		auto&	stat = _coalescerStat[ frameId.Remap2() ];
+
+		stat.bytesSaved.fetch_add( saved );
+		stat.copiesSaved.fetch_add( copies );
+	}
+
 /*
 =================================================
 	_OnBeginFrame
@@ -1196,13 +1237,14 @@ namespace {
 	{
 	  #ifdef AE_ENABLE_VULKAN
 		_expiredResources._currentFrameId.store( frameId );
+		_expiredResources.Get( frameId ).frameId = frameId;
+	  #endif
+
 		{
-			auto&	list = _expiredResources.Get( frameId );
-			EXLOCK( list.guard );
-			ASSERT( list.resources.empty() );
-			list.frameId = frameId;
+			auto&	stat = _coalescerStat[ frameId.Remap2() ];
+			stat.bytesSaved.store( 0_b );
+			stat.copiesSaved.store( 0 );
 		}
-	  #endif
 
 		GetStagingManager().OnBeginFrame( frameId, cfg );
 		GetQueryManager().NextFrame( frameId );
@@ -1263,18 +1305,8 @@ namespace {
 
 		for (auto& list : _expiredResources.All())
 		{
-			EXLOCK( list.guard );
 			list.frameId = Default;
-
-			non_empty |= not list.resources.empty();
-
-			for (auto& res : list.resources)
-			{
-				_releaseResIDs[ res.type ]( *this, res.id );
-			}
-			list.resources.clear();
-
-			// TODO: trim memory
+			non_empty |= _expiredResources.Release( *this, list );
 		}
 
 	  #ifdef AE_ENABLE_REMOTE_GRAPHICS
@@ -1289,11 +1321,47 @@ namespace {
 	ExpiredResources ctor
 =================================================
 */
-	ResourceManager::ExpiredResources::ExpiredResources () __Th___
+	ResourceManager::ExpiredResources::ExpiredResources () __NE___
+	{
+		for (auto& item : _list) {
+			CHECK( item.resources.Init( _alloc ));
+		}
+	}
+
+/*
+=================================================
+	ExpiredResources dtor
+=================================================
+*/
+	ResourceManager::ExpiredResources::~ExpiredResources () __NE___
 	{
 		for (auto& item : _list) {
-			item.resources.reserve( 1u << 10 );
+			item.resources.Destroy( _alloc );
+		}
+	}
+
+/*
+=================================================
+	ExpiredResources::Release
+----
+	Returns 'true' if list was not empty.
+=================================================
+*/
+	bool  ResourceManager::ExpiredResources::Release (ResourceManager &resMngr, ExpiredResArray &list) __NE___
+	{
+		auto	resources	= list.resources.Release();
+		bool	non_empty	= false;
+
+		CHECK( list.resources.Init( _alloc ));
+
+		for (auto& res : resources)
+		{
+			resMngr._releaseResIDs[ res.type ]( resMngr, res.id );
+			non_empty = true;
 		}
+
+		resources.Destroy( _alloc );
+		return non_empty;
 	}
 
 /*
@@ -1304,13 +1372,7 @@ namespace {
 	void  ResourceManager::ReleaseExpiredResourcesTask::Run ()
 	{
 		auto&	res_mngr = GraphicsScheduler().GetResourceManager();
-		auto&	list	 = res_mngr._expiredResources.Get( _frameId );
-		EXLOCK( list.guard );
 
-		for (auto& res : list.resources)
-		{
-			res_mngr._releaseResIDs[ res.type ]( res_mngr, res.id );
-		}
-		list.resources.clear();
+		res_mngr._expiredResources.Release( res_mngr, res_mngr._expiredResources.Get( _frameId ));
 	}
 //-----------------------------------------------------------------------------
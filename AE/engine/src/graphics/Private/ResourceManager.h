@@ -135,26 +135,37 @@ namespace AE::Graphics
 		using ReleaseResourceByIDFns_t	= StaticArray< ReleaseResourceByID_t, ExpResourceTypes_t::Count >;
 		struct _InitReleaseResourceByID;
 
+		using ExpiredResList_t = Threading::LfChunkList< ExpiredResource, 1u << 10 >;
+
 		struct alignas(AE_CACHE_LINE) ExpiredResArray
 		{
-			SpinLock					guard;
 			FrameUID					frameId;
-			Array< ExpiredResource >	resources;	// TODO: lock-free ?
+			ExpiredResList_t			resources;	// lock-free append from any thread
 		};
 		static constexpr uint		ExpiredResFrameOffset = 2;
-		using ExpiredResources_t	= StaticArray< ExpiredResArray, GraphicsConfig::MaxFrames + ExpiredResFrameOffset >;
+
+		// +1 to guarantee that list which is released in 'ReleaseExpiredResourcesTask' is not used in current frame
+		using ExpiredResources_t	= StaticArray< ExpiredResArray, GraphicsConfig::MaxFrames + ExpiredResFrameOffset + 1 >;
 
 		struct ExpiredResources
 		{
 			AtomicFrameUID			_currentFrameId;
 			ExpiredResources_t		_list;
+			UntypedAllocator		_alloc;
 
-			ExpiredResources ()								__Th___;
+			ExpiredResources ()								__NE___;
+			~ExpiredResources ()							__NE___;
 
 			ND_ ExpiredResArray&		Get (FrameUID id)	__NE___	{ return _list[ id.Remap( _list.size() )]; }
 			ND_ ExpiredResArray&		GetCurrent ()		__NE___	{ return Get( GetFrameId() ); }
 			ND_ FrameUID				GetFrameId ()		C_NE___	{ return _currentFrameId.load(); }
 			ND_ ExpiredResources_t&		All ()				__NE___	{ return _list; }
+
+			// thread-safe
+			ND_ bool  Add (const ExpiredResource &res)				__NE___	{ return GetCurrent().resources.Emplace( _alloc, res ); }
+
+			// must be externally synchronized with 'Add()' for the same list
+				bool  Release (ResourceManager &, ExpiredResArray &)	__NE___;
 		};
 
 
@@ -215,6 +226,20 @@ namespace AE::Graphics
 		ExpiredResources				_expiredResources;
 		ReleaseResourceByIDFns_t		_releaseResIDs	{};
 
+		// statistics for profiler, acquired in different threads, released in frame end
+		alignas(AE_CACHE_LINE)
+		  Atomic<ulong>					_poolCreated	{0};
+		alignas(AE_CACHE_LINE)
+		  Atomic<ulong>					_poolReleased	{0};
+
+		// statistics from 'UploadCoalescer', double buffered
+		struct alignas(AE_CACHE_LINE) CoalescerStat
+		{
+			AtomicByte<Bytes>				bytesSaved;
+			Atomic<ulong>					copiesSaved		{0};
+		};
+		StaticArray< CoalescerStat, 2 >	_coalescerStat;
+
 		StrongAtom<PipelinePackID>		_defaultPack;
 		Strong<SamplerID>				_defaultSampler;
 		Strong<DescriptorSetLayoutID>	_emptyDSLayout;
@@ -430,7 +455,10 @@ namespace AE::Graphics
 		ND_ StagingBufferManager_t&	GetStagingManager ()												__NE___	{ return _stagingMngr; }
 		ND_ QueryManager_t&			GetQueryManager ()													__NE___	{ return _queryMngr; }
 
-		ND_ StagingBufferStat		GetStagingBufferFrameStat (FrameUID frameId)						C_NE_OV	{ return _stagingMngr.GetFrameStat( frameId ); }
+		ND_ StagingBufferStat		GetStagingBufferFrameStat (FrameUID frameId)						C_NE_OV;
+		ND_ ResourcePoolStat		GetResourcePoolStat ()												C_NE_OV;
+
+			void					AddUploadCoalescerStat (FrameUID frameId, Bytes saved, ulong copies) __NE___;
 
 		// memory allocators
 		ND_ GfxMemAllocatorPtr		CreateLinearGfxMemAllocator (Bytes pageSize = 0_b)					C_NE_OV;
@@ -680,11 +708,8 @@ namespace AE::Graphics
 		expired.id		= BitCastRlx< ExpiredResource::IDValue_t >( id );
 		expired.type	= uint( ExpResourceTypes_t::Index<ID> );
 
-		auto&	dst = _expiredResources.GetCurrent();
-		EXLOCK( dst.guard );
-		ASSERT( dst.frameId == _expiredResources.GetFrameId() );
-
-		dst.resources.push_back( expired );
+		ASSERT( _expiredResources.GetCurrent().frameId == _expiredResources.GetFrameId() );
+		CHECK( _expiredResources.Add( expired ));
 	}
 
 /*
@@ -820,9 +845,9 @@ namespace AE::Graphics
 =================================================
 	_Assign
 ----
-	acquire free index from cache (cache is local in thread),
-	if cache empty then acquire new indices from main pool (internally synchronized),
-	if pool is full then error (false) will be returned.
+	Acquire free index from lock-free pool, on contention pool switches to the chunk which depends on thread ID.
+	Generation is incremented when resource is destroyed, so stale handles are rejected in O(1) by 'GetResource()' and 'IsAlive()'.
+	If pool is full then error (false) will be returned.
 =================================================
 */
 	template <typename ID>
@@ -832,6 +857,8 @@ namespace AE::Graphics
 		auto	index	= pool.Assign();
 		CHECK_ERR( index != UMax );
 
+		_poolCreated.fetch_add( 1 );
+
 		id = ID{ index, pool[index].GetGeneration() };
 		return true;
 	}
@@ -847,7 +874,8 @@ namespace AE::Graphics
 		ASSERT( id );
 		auto&	pool = _GetResourcePool( id );
 
-		pool.Unassign( id.Index() );
+		if_likely( pool.Unassign( id.Index() ))
+			_poolReleased.fetch_add( 1 );
 	}
 
 /*
@@ -887,7 +915,7 @@ namespace AE::Graphics
 				if_unlikely( count == 0 and res->IsCreated() )
 				{
 					res->Destroy( *this );
-					pool.Unassign( id.Index() );
+					_Unassign( id );
 				}
 				return count;
 			}
@@ -0,0 +1,327 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "graphics/Public/UploadCoalescer.h"
+#include "graphics/GraphicsImpl.h"
+
+namespace AE::Graphics
+{
+	using namespace AE::Threading;
+
+/*
+=================================================
+	constructor
+=================================================
+*/
+	UploadCoalescer::UploadCoalescer (EStagingHeapType heap) __NE___ :
+		_heapType{ heap }
+	{
+		CHECK( _requests.Init( _allocator ));
+	}
+
+/*
+=================================================
+	destructor
+=================================================
+*/
+	UploadCoalescer::~UploadCoalescer () __NE___
+	{
+		DRC_EXLOCK( _drCheck );
+
+		// memory will be released by allocator
+		Unused( _requests.Release() );
+	}
+
+/*
+=================================================
+	_CopyToArena
+=================================================
+*/
+	void*  UploadCoalescer::_CopyToArena (Allocator_t &alloc, const void* data, const Bytes size) __NE___
+	{
+		void*	ptr = alloc.Allocate( SizeAndAlign{ size, 16_b });
+		if_likely( ptr != null )
+			MemCopy( OUT ptr, data, size );
+		return ptr;
+	}
+
+/*
+=================================================
+	Upload
+=================================================
+*/
+	bool  UploadCoalescer::Upload (BufferID dst, Bytes offset, Bytes size, const void* data) __NE___
+	{
+		DRC_SHAREDLOCK( _drCheck );
+		CHECK_ERR( dst and data != null );
+
+		if_unlikely( size == 0 )
+			return true;
+
+		Request		req;
+		req.dst		= dst;
+		req.seq		= _seq.fetch_add( 1 );
+		req.offset	= offset;
+		req.size	= size;
+		req.data	= _CopyToArena( _allocator, data, size );
+
+		CHECK_ERR( req.data != null );
+		CHECK_ERR( _requests.Emplace( _allocator, req ));
+		return true;
+	}
+
+/*
+=================================================
+	Flush
+----
+	Requests are sorted by destination and offset,
+	ranges which are adjacent or overlapped are merged into single staging allocation and single copy command.
+=================================================
+*/
+	void  UploadCoalescer::Flush (ITransferContext &ctx) __Th___
+	{
+		DRC_EXLOCK( _drCheck );
+
+		_stat = Default;
+
+		auto	list		= _requests.Release();
+		bool	recycled	= false;
+
+		// On exception request list must be initialized again,
+		// requests are restored, their data is still stored in '_allocator'.
+		ON_DESTROY( [this, &list, &recycled] ()
+			{
+				if ( recycled )
+					return;
+
+				CHECK( _requests.Init( _allocator ));
+				for (auto& req : list) {
+					CHECK( _requests.Emplace( _allocator, req ));
+				}
+			});
+
+		Array<Request>	requests;
+		requests.reserve( list.Count() );	// throw
+
+		for (auto& req : list) {
+			requests.push_back( req );
+		}
+
+		std::sort( requests.begin(), requests.end(),
+				   [] (const Request &lhs, const Request &rhs) __NE___
+				   {
+						return	lhs.dst    != rhs.dst    ? lhs.dst    < rhs.dst    :
+								lhs.offset != rhs.offset ? lhs.offset < rhs.offset :
+														   lhs.seq    < rhs.seq;
+				   });
+
+		// merge adjacent and overlapped ranges
+		struct Run
+		{
+			usize	first		= 0;
+			usize	count		= 0;
+			Bytes	offset;
+			Bytes	size;
+			bool	overlapped	= false;
+		};
+		Array<Run>	runs;
+
+		for (usize i = 0; i < requests.size(); ++i)
+		{
+			const auto&	req = requests[i];
+
+			if ( runs.empty() or requests[ runs.back().first ].dst != req.dst or req.offset > runs.back().offset + runs.back().size )
+			{
+				auto&	run	= runs.emplace_back();	// throw
+				run.first	= i;
+				run.offset	= req.offset;
+			}
+
+			auto&	run	= runs.back();
+			const Bytes	end = run.offset + run.size;
+
+			run.overlapped	|= (req.offset < end);
+			run.size		=  Max( end, req.offset + req.size ) - run.offset;
+			run.count		++;
+
+			_stat.dataSize += req.size;
+		}
+		_stat.requests = uint(requests.size());
+
+		// allocate staging memory and record copy commands
+		Array<BufferMemView>	mem_views;
+		Array<CopyJob>			jobs;
+		Array<Request>			pending;
+		Bytes					saved;
+
+		mem_views.resize( runs.size() );	// throw
+		jobs.reserve( requests.size() );	// throw
+
+		for (usize r = 0; r < runs.size(); ++r)
+		{
+			auto&			run		= runs[r];
+			auto			reqs	= ArrayView<Request>{ requests }.section( run.first, run.count );
+			BufferMemView&	mem		= mem_views[r];
+
+			ctx.UploadBuffer( reqs.front().dst, UploadBufferDesc{ run.offset, run.size }.HeapType( _heapType ), OUT mem );
+
+			const Bytes	written = mem.DataSize();
+
+			_stat.copies		+= uint(mem.Parts().size());
+			_stat.stagingSize	+= written;
+
+			// latest request must be copied last
+			if ( run.overlapped )
+			{
+				std::sort( requests.begin() + run.first, requests.begin() + run.first + run.count,
+						   [] (const Request &lhs, const Request &rhs) __NE___ { return lhs.seq < rhs.seq; });
+			}
+
+			for (auto& req : reqs)
+			{
+				const Bytes	dst_off = req.offset - run.offset;
+
+				saved += AlignUp( req.size, GraphicsConfig::StagingBufferOffsetAlign );
+
+				if ( dst_off < written )
+				{
+					CopyJob&	job	= jobs.emplace_back();
+					job.mem			= &mem;
+					job.dstOffset	= dst_off;
+					job.size		= Min( req.size, written - dst_off );
+					job.data		= req.data;
+					job.runStart	= (&req == reqs.data());
+				}
+
+				// staging memory is not enough, move remaining part to the next flush
+				if ( dst_off + req.size > written )
+				{
+					const Bytes	skip	= (dst_off < written ? written - dst_off : 0_b);
+					const Bytes	begin	= req.offset + skip;
+					const Bytes	end		= req.offset + req.size;
+
+					// skip if remaining part is overwritten by later request,
+					// requests in overlapped run are sorted by 'seq'
+					if ( run.overlapped and _IsCovered( reqs.section( usize(&req - reqs.data()) + 1, UMax ), begin, end ))
+						continue;
+
+					Request&	p	= pending.emplace_back();	// throw
+					p.dst			= req.dst;
+					p.seq			= req.seq;
+					p.offset		= req.offset + skip;
+					p.size			= req.size - skip;
+					p.data			= Cast<ubyte>(req.data) + skip;
+				}
+			}
+
+			saved -= Min( saved, AlignUp( written, GraphicsConfig::StagingBufferOffsetAlign ));
+		}
+
+		if ( _stat.stagingSize >= _ParallelCopyThreshold )
+			_ParallelCopy( jobs, _stat.stagingSize );
+		else
+			_CopyToStaging( jobs );
+
+		GraphicsScheduler().GetResourceManager().AddUploadCoalescerStat( ctx.GetFrameId(), saved,
+																		 uint(requests.size() - Min( requests.size(), usize(_stat.copies) )));
+
+		// recycle memory
+		{
+			Array<ubyte>	tmp;
+			Bytes			tmp_size;
+
+			for (auto& p : pending) {
+				tmp_size += p.size;
+			}
+			tmp.resize( usize(tmp_size) );	// throw
+
+			tmp_size = 0_b;
+			for (auto& p : pending)
+			{
+				MemCopy( OUT tmp.data() + tmp_size, p.data, p.size );
+				p.data		=  tmp.data() + tmp_size;
+				tmp_size	+= p.size;
+			}
+
+			recycled = true;
+			_allocator.Discard();
+			CHECK( _requests.Init( _allocator ));
+
+			for (auto& p : pending)
+			{
+				p.data = _CopyToArena( _allocator, p.data, p.size );
+				CHECK_THROW( p.data != null and _requests.Emplace( _allocator, p ));
+			}
+		}
+	}
+
+/*
+=================================================
+	_IsCovered
+----
+	returns 'true' if any of 'requests' contains range [begin, end)
+=================================================
+*/
+	bool  UploadCoalescer::_IsCovered (ArrayView<Request> requests, const Bytes begin, const Bytes end) __NE___
+	{
+		for (auto& req : requests)
+		{
+			if ( req.offset <= begin and req.offset + req.size >= end )
+				return true;
+		}
+		return false;
+	}
+
+/*
+=================================================
+	_CopyToStaging
+=================================================
+*/
+	void  UploadCoalescer::_CopyToStaging (ArrayView<CopyJob> jobs) __NE___
+	{
+		for (auto& job : jobs)
+		{
+			Unused( job.mem->CopyFrom( job.data, job.size, job.dstOffset ));
+		}
+	}
+
+/*
+=================================================
+	_ParallelCopy
+----
+	Jobs are split on the run boundary, so overlapped ranges are copied in the same thread.
+=================================================
+*/
+	void  UploadCoalescer::_ParallelCopy (ArrayView<CopyJob> jobs, const Bytes totalSize) __NE___
+	{
+		const Bytes		part_size	= totalSize / _MaxCopyTasks;
+		Bytes			accum;
+		usize			first		= 0;
+		FixedArray< AsyncTask, _MaxCopyTasks >	tasks;
+
+		for (usize i = 0; i < jobs.size(); ++i)
+		{
+			if ( jobs[i].runStart and accum >= part_size and tasks.size()+1 < tasks.capacity() )
+			{
+				auto	part = jobs.section( first, i - first );
+				auto	task = MakeRCNe< AsyncTaskFn >( [part] () { _CopyToStaging( part ); },
+														"UploadCoalescer::Copy",
+														ETaskQueue::PerFrame );
+				if ( task and Scheduler().Run( task ))
+					tasks.push_back( RVRef(task) );
+				else
+					_CopyToStaging( part );
+
+				first = i;
+				accum = 0_b;
+			}
+			accum += jobs[i].size;
+		}
+
+		// copy last part in current thread
+		_CopyToStaging( jobs.section( first, jobs.size() - first ));
+
+		for (; not Scheduler().Wait( tasks, EThreadArray{ EThread::PerFrame }, microseconds{100} );) {}
+	}
+
+
+} // AE::Graphics
@@ -270,6 +270,17 @@ namespace AE::Graphics
 
 			Bytes	staticWrite;
 			Bytes	staticRead;
+
+			Bytes	coalescedSaved;		// staging memory which is saved by 'UploadCoalescer'
+			ulong	coalescedCopies	= 0;	// number of copy commands which are saved by 'UploadCoalescer'
+		};
+
+		struct ResourcePoolStat
+		{
+			ulong	created		= 0;	// total number of handles which are acquired from resource pools
+			ulong	released	= 0;	// total number of handles which are returned to resource pools
+
+			ND_ ulong  Alive ()		C_NE___	{ return created - released; }
 		};
 
 
@@ -425,6 +436,7 @@ namespace AE::Graphics
 
 		// statistics
 		ND_ virtual StagingBufferStat			GetStagingBufferFrameStat (FrameUID frameId)						C_NE___ = 0;
+		ND_ virtual ResourcePoolStat			GetResourcePoolStat ()												C_NE___ = 0;
 
 		ND_ virtual FeatureSet const&			GetFeatureSet ()													C_NE___	= 0;
 
@@ -0,0 +1,108 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+/*
+	Thread-safe:  yes, except 'Flush()' which must be externally synchronized with all other methods.
+
+	Collects small buffer uploads from multiple threads and records them in a single transfer pass.
+	In 'Flush()' uploads are sorted by destination buffer and offset, adjacent and overlapping ranges are merged,
+	so each merged range requires single staging allocation and single copy command instead of one per upload.
+	If ranges are overlapped then data from the latest 'Upload()' call will be used.
+
+	Data is copied to the internal storage in 'Upload()', so source memory can be released immediately.
+	Copying to the staging memory is distributed between worker threads if total size is large.
+	Uploads which are not fit into the staging memory are moved to the next 'Flush()',
+	except parts which are overwritten by later uploads.
+
+	Exceptions only in fatal error:
+		- transfer context exceptions (failed to allocate space for command).
+		- Array allocation exceptions.
+*/
+
+#pragma once
+
+#include "graphics/Public/CommandBuffer.h"
+
+namespace AE::Graphics
+{
+
+	//
+	// Upload Coalescer
+	//
+
+	class UploadCoalescer final : public Noncopyable
+	{
+	// types
+	public:
+		struct Statistic
+		{
+			uint	requests		= 0;	// number of 'Upload()' calls
+			uint	copies			= 0;	// number of recorded copy commands
+			Bytes	dataSize;				// sum of all requests
+			Bytes	stagingSize;			// staging memory which is used for merged ranges
+		};
+
+	private:
+		struct Request
+		{
+			BufferID			dst;
+			uint				seq		= 0;	// order of 'Upload()' calls
+			Bytes				offset;
+			Bytes				size;
+			void const*			data	= null;
+		};
+
+		struct CopyJob
+		{
+			BufferMemView*		mem			= null;
+			Bytes				dstOffset;				// relative to 'mem'
+			Bytes				size;
+			void const*			data		= null;
+			bool				runStart	= false;	// first copy in merged range
+		};
+
+		static constexpr Bytes	_BlockSize				= 4_Mb;
+		static constexpr Bytes	_ParallelCopyThreshold	= 1_Mb;
+		static constexpr uint	_MaxCopyTasks			= 8;
+
+		using Allocator_t	= Threading::LfLinearAllocator< usize{_BlockSize}, 16, 16 >;
+		using RequestList_t	= Threading::LfChunkList< Request, 256 >;
+
+
+	// variables
+	private:
+		Allocator_t				_allocator;
+		RequestList_t			_requests;
+		Atomic<uint>			_seq			{0};
+
+		const EStagingHeapType	_heapType;
+		Statistic				_stat;
+
+		DRC_ONLY( Threading::RWDataRaceCheck	_drCheck;)
+
+
+	// methods
+	public:
+		explicit UploadCoalescer (EStagingHeapType heap = EStagingHeapType::Dynamic)			__NE___;
+		~UploadCoalescer ()																		__NE___;
+
+		// thread-safe
+		ND_ bool  Upload (BufferID dst, Bytes offset, Bytes size, const void* data)				__NE___;
+
+		template <typename T>
+		ND_ bool  Upload (BufferID dst, Bytes offset, ArrayView<T> data)						__NE___	{ return Upload( dst, offset, ArraySizeOf(data), data.data() ); }
+
+		// Records copy commands for all pending uploads.
+		// Must be externally synchronized with 'Upload()'.
+			void  Flush (ITransferContext &ctx)													__Th___;
+
+		// statistic for the last 'Flush()'
+		ND_ Statistic  GetStatistic ()															C_NE___	{ DRC_SHAREDLOCK( _drCheck );  return _stat; }
+
+	private:
+		ND_ static void*  _CopyToArena (Allocator_t &, const void* data, Bytes size)			__NE___;
+		ND_ static bool   _IsCovered (ArrayView<Request> requests, Bytes begin, Bytes end)		__NE___;
+		static void  _CopyToStaging (ArrayView<CopyJob> jobs)									__NE___;
+		static void  _ParallelCopy (ArrayView<CopyJob> jobs, Bytes totalSize)					__NE___;
+	};
+
+
+} // AE::Graphics
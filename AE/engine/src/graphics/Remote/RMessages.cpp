@@ -396,9 +396,9 @@ namespace AE::RemoteGraphics::Msg
 	#define Ser_UploadImageDesc( _desc_ )\
 		_desc_.imageOffset, _desc_.imageDim, _desc_.arrayLayer, _desc_.mipLevel, _desc_.dataRowPitch, _desc_.dataSlicePitch, _desc_.aspectMask, _desc_.heapType
 
-	StaticAssert( sizeof(IResourceManager::StagingBufferStat) == 32 );
+	StaticAssert( sizeof(IResourceManager::StagingBufferStat) == 48 );
 	#define Ser_StagingBufferStat( _desc_ )\
-		_desc_.dynamicWrite, _desc_.dynamicRead, _desc_.staticWrite, _desc_.staticRead
+		_desc_.dynamicWrite, _desc_.dynamicRead, _desc_.staticWrite, _desc_.staticRead, _desc_.coalescedSaved, _desc_.coalescedCopies
 
 
 	DECL_SERIALIZER( SBM_GetBufferRanges,					reqSize, blockSize, memOffsetAlign, frameId, heap, upload )
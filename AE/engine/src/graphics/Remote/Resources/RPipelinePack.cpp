@@ -593,6 +593,8 @@ namespace AE::Graphics
 		Serializing::Deserializer	des{ memStream.ToSubStream( blockOffset ), _allocator.get() };
 		StackAllocator_t			stack_alloc;
 
+		des.inPlaceLayout = true;
+
 		EMarker	marker;
 		uint	count = 0;
 
@@ -697,6 +699,8 @@ namespace AE::Graphics
 		uint		count	= 0;
 		EMarker		marker;
 
+		des.inPlaceLayout = true;
+
 		CHECK_ERR( des( OUT marker, OUT count ));
 		CHECK_ERR( marker == EMarker::PipelineLayouts and count <= PipelineStorage::MaxPplnLayoutCount );
 		CHECK_ERR( usize{count} == rmPplnLayouts.size() );
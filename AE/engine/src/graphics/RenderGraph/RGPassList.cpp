@@ -0,0 +1,189 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "graphics/RenderGraph/RGPassList.h"
+#include "graphics/Private/EnumUtils.h"
+
+namespace AE::RG::_hidden_
+{
+
+/*
+=================================================
+	_IsCompatible
+----
+	passes can be reordered only if both of them read resource in the same state
+=================================================
+*/
+	bool  RGPassListBase::_IsCompatible (EResourceState lhs, EResourceState rhs) __NE___
+	{
+		return	lhs == rhs and EResourceState_IsReadOnly( lhs );
+	}
+
+/*
+=================================================
+	CalcLevels
+=================================================
+*/
+	uint  RGPassListBase::CalcLevels (ArrayView<ResUsage> resources, ArrayView<PassRange> passes, OUT ArrayView<uint> levels) __NE___
+	{
+		CHECK_ERR( passes.size() == levels.size() );
+
+		struct LastUsage
+		{
+			EResourceState	state;
+			uint			minLevel	= 0;	// passes with compatible state can be placed after this level
+			uint			maxLevel	= 0;	// passes with incompatible state must be placed after this level
+		};
+		FlatHashMap< ResourceKey, LastUsage, ResourceKeyHash >	last_usage;
+		uint													level_count	= 0;
+
+		NOTHROW_ERR( last_usage.reserve( resources.size() ));
+
+		for (usize p = 0; p < passes.size(); ++p)
+		{
+			const auto	res		= resources.section( passes[p].firstRes, passes[p].resCount );
+			uint		level	= 0;
+
+			for (auto& r : res)
+			{
+				auto	it = last_usage.find( r.key );
+				if ( it != last_usage.end() )
+					level = Max( level, _IsCompatible( it->second.state, r.state ) ? it->second.minLevel : it->second.maxLevel + 1 );
+			}
+
+			for (auto& r : res)
+			{
+				auto	it = last_usage.find( r.key );
+				if ( it == last_usage.end() )
+				{
+					NOTHROW_ERR( last_usage.emplace( r.key, LastUsage{ r.state, 0, level }));
+				}
+				else
+				if ( _IsCompatible( it->second.state, r.state ))
+				{
+					it->second.maxLevel = Max( it->second.maxLevel, level );
+				}
+				else
+				{
+					it->second.minLevel	= it->second.maxLevel + 1;
+					it->second.maxLevel	= level;
+					it->second.state	= r.state;
+				}
+			}
+
+			levels[p]	= level;
+			level_count	= Max( level_count, level+1 );
+		}
+		return level_count;
+	}
+
+/*
+=================================================
+	SplitToTasks
+=================================================
+*/
+	uint  RGPassListBase::SplitToTasks (ArrayView<uint> levels, uint maxTasks, OUT Array<uint> &order, OUT Array<uint> &taskStart) __Th___
+	{
+		order.clear();
+		taskStart.clear();
+
+		if_unlikely( levels.empty() )
+			return 0;
+
+		maxTasks = Max( 1u, maxTasks );
+
+		uint	level_count = 0;
+		for (uint lvl : levels) {
+			level_count = Max( level_count, lvl+1 );
+		}
+
+		// sort by level, keep submission order inside level
+		order.resize( levels.size() );	// throw
+		for (usize i = 0; i < order.size(); ++i) {
+			order[i] = uint(i);
+		}
+		std::stable_sort( order.begin(), order.end(), [levels] (uint lhs, uint rhs) { return levels[lhs] < levels[rhs]; });
+
+		const uint	pass_count = uint(order.size());
+
+		if ( level_count > maxTasks )
+		{
+			// merge neighbour levels, intermediate barriers will be added inside render task
+			uint	prev_task = UMax;
+			for (uint i = 0; i < pass_count; ++i)
+			{
+				const uint	task = levels[ order[i] ] * maxTasks / level_count;
+				if ( task != prev_task )
+				{
+					taskStart.push_back( i );	// throw
+					prev_task = task;
+				}
+			}
+		}
+		else
+		{
+			// split level into multiple tasks, passes inside level are independent
+			const uint	extra = maxTasks - level_count;
+
+			for (uint i = 0; i < pass_count;)
+			{
+				const uint	lvl		= levels[ order[i] ];
+				uint		count	= 0;
+
+				for (; i + count < pass_count and levels[ order[i + count] ] == lvl; ++count) {}
+
+				const uint	tasks = Min( 1 + (extra * count) / pass_count, count );
+
+				for (uint t = 0; t < tasks; ++t) {
+					taskStart.push_back( i + (count * t) / tasks );	// throw
+				}
+				i += count;
+			}
+		}
+
+		ASSERT( taskStart.size() <= maxTasks );
+		return uint(taskStart.size());
+	}
+
+/*
+=================================================
+	_Prepare
+=================================================
+*/
+	void  RGPassListBase::_Prepare (ArrayView<PassRange> passes, uint maxTasks, OUT Array<uint> &order, OUT Array<uint> &taskStart) __Th___
+	{
+		Array<uint>		levels;
+		levels.resize( passes.size() );	// throw
+
+		_stat.passes	= uint(passes.size());
+		_stat.levels	= CalcLevels( _resources, passes, OUT levels );
+		_stat.tasks		= SplitToTasks( levels, maxTasks, OUT order, OUT taskStart );	// throw
+	}
+
+/*
+=================================================
+	_TaskResources
+=================================================
+*/
+	void  RGPassListBase::_TaskResources (ArrayView<ResUsage> resources, ArrayView<PassRange> passes, ArrayView<uint> order,
+										  const uint first, const uint last, OUT Array<TaskRes> &result) __Th___
+	{
+		FlatHashMap< ResourceKey, usize, ResourceKeyHash >	key_to_idx;
+		result.clear();
+
+		for (uint i = first; i < last; ++i)
+		{
+			const auto&	range = passes[ order[i] ];
+
+			for (auto& r : resources.section( range.firstRes, range.resCount ))
+			{
+				auto [it, inserted] = key_to_idx.emplace( r.key, result.size() );	// throw
+				if ( inserted )
+					result.emplace_back( r.key, r.state );	// throw
+				else
+					result[ it->second ].final = r.state;
+			}
+		}
+	}
+
+
+} // AE::RG::_hidden_
@@ -0,0 +1,342 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+/*
+	thread-safe:  no
+
+	Records passes into multiple render tasks of a single command batch.
+	Each pass declares resources with state, passes are sorted by dependency levels:
+	passes in the same level don't have conflicting access (write after read, read after write, write after write)
+	so they can be placed in any order.
+	Sorted passes are split into render tasks, each render task is recorded in separate command buffer
+	on any worker thread, command buffers are executed in submission order.
+	Barriers between render tasks are generated by 'RGCommandBatchPtr::RenderTaskBuilder',
+	barriers between passes inside render task - by context 'ResourceState()'.
+
+	Warning: pass function is called in worker thread, captured data must be valid until render task is complete.
+*/
+
+#pragma once
+
+#include "graphics/RenderGraph/RGCommandContext.h"
+
+namespace AE::RG::_hidden_
+{
+
+	//
+	// Render Graph Pass List base
+	//
+	class RGPassListBase : public Noncopyable
+	{
+	// types
+	public:
+		struct ResUsage
+		{
+			ResourceKey			key;
+			EResourceState		state	= Default;
+
+			ResUsage (ResourceKey key, EResourceState state) __NE___ : key{key}, state{state} {}
+		};
+
+		struct PassRange
+		{
+			uint				firstRes	= 0;
+			uint				resCount	= 0;
+		};
+
+		struct TaskRes
+		{
+			ResourceKey			key;
+			EResourceState		initial	= Default;	// state in first pass of render task
+			EResourceState		final	= Default;	// state in last pass of render task
+
+			TaskRes (ResourceKey key, EResourceState state) __NE___ : key{key}, initial{state}, final{state} {}
+		};
+
+		struct Statistic
+		{
+			uint				passes		= 0;
+			uint				levels		= 0;	// number of dependency levels
+			uint				tasks		= 0;	// number of render tasks
+		};
+
+		static constexpr uint	DefaultMaxTasks	= 8;
+
+
+	// variables
+	protected:
+		Array< ResUsage >		_resources;
+		Statistic				_stat;
+
+
+	// methods
+	public:
+		ND_ Statistic  GetStatistic ()																C_NE___	{ return _stat; }
+
+		// Returns number of levels.
+		// Pass depends on previous pass if they use same resource and one of them has write access or states are different.
+		ND_ static uint  CalcLevels (ArrayView<ResUsage> resources, ArrayView<PassRange> passes, OUT ArrayView<uint> levels)	__NE___;
+
+		// Returns passes sorted by level and index of first pass for each render task.
+		// Passes in the same level are distributed between tasks, levels are not mixed if there are enough tasks.
+		ND_ static uint  SplitToTasks (ArrayView<uint> levels, uint maxTasks, OUT Array<uint> &order, OUT Array<uint> &taskStart) __Th___;
+
+	protected:
+		RGPassListBase ()																			__NE___	{}
+
+		ND_ static bool  _IsCompatible (EResourceState lhs, EResourceState rhs)						__NE___;
+
+			void  _Prepare (ArrayView<PassRange> passes, uint maxTasks, OUT Array<uint> &order, OUT Array<uint> &taskStart) __Th___;
+
+			static void  _TaskResources (ArrayView<ResUsage> resources, ArrayView<PassRange> passes, ArrayView<uint> order,
+										 uint first, uint last, OUT Array<TaskRes> &result)						__Th___;
+	};
+
+
+
+	//
+	// Render Graph Pass List
+	//
+	template <typename CtxType>
+	class RGPassList final : public RGPassListBase
+	{
+	// types
+	public:
+		using PassFn_t	= Function< void (CtxType &) >;
+
+		struct PassBuilder;
+
+	private:
+		struct Pass
+		{
+			PassFn_t			fn;
+			PassRange			range;
+			GFX_DBG_ONLY(
+				String			dbgName;
+				RGBA8u			dbgColor;)
+		};
+
+		struct SharedData final : EnableRC<SharedData>
+		{
+			Array< Pass >		passes;
+			Array< ResUsage >	resources;
+			Array< uint >		order;
+		};
+
+
+	// variables
+	private:
+		Array< Pass >		_passes;
+
+
+	// methods
+	public:
+		RGPassList ()																				__NE___	{}
+
+		ND_ PassBuilder  AddPass (PassFn_t fn, DebugLabel dbg = Default)							__Th___;
+
+		// Pass list will be cleared.
+		// Returns last render task.
+		ND_ AsyncTask  Run (RGCommandBatchPtr	batch,
+							Bool				submit		= False{"submit batch"},
+							uint				maxTasks	= DefaultMaxTasks)						__NE___;
+
+		ND_ usize  PassCount ()																		C_NE___	{ return _passes.size(); }
+
+	private:
+		static void  _RecordPasses (RenderTaskFn &task, const SharedData &data, uint first, uint last)	__Th___;
+		static void  _ResourceState (CtxType &ctx, const ResUsage &res)								__Th___;
+	};
+
+
+
+	//
+	// Pass Builder
+	//
+	template <typename CtxType>
+	struct RGPassList<CtxType>::PassBuilder
+	{
+		friend class RGPassList<CtxType>;
+
+	// variables
+	private:
+		RGPassList &	_list;
+		const uint		_passIdx;
+
+	// methods
+	private:
+		PassBuilder (RGPassList &list, uint idx)					__NE___ : _list{list}, _passIdx{idx} {}
+
+			void  _UseResource (ResourceKey key, EResourceState state)	__Th___;
+
+	public:
+		// resource state inside pass
+		ND_ PassBuilder &&	UseResource (ImageID      id, EResourceState state)	rvTh___	{ _UseResource( ResourceKey{id}, state );  return RVRef(*this); }
+		ND_ PassBuilder &&	UseResource (BufferID     id, EResourceState state)	rvTh___	{ _UseResource( ResourceKey{id}, state );  return RVRef(*this); }
+		ND_ PassBuilder &&	UseResource (RTGeometryID id, EResourceState state)	rvTh___	{ _UseResource( ResourceKey{id}, state );  return RVRef(*this); }
+		ND_ PassBuilder &&	UseResource (RTSceneID    id, EResourceState state)	rvTh___	{ _UseResource( ResourceKey{id}, state );  return RVRef(*this); }
+		ND_ PassBuilder &&	UseResource (ImageViewID  id, EResourceState state)	rvTh___;
+		ND_ PassBuilder &&	UseResource (BufferViewID id, EResourceState state)	rvTh___;
+	};
+//-----------------------------------------------------------------------------
+
+
+
+/*
+=================================================
+	AddPass
+=================================================
+*/
+	template <typename CtxType>
+	typename RGPassList<CtxType>::PassBuilder  RGPassList<CtxType>::AddPass (PassFn_t fn, DebugLabel dbg) __Th___
+	{
+		auto&	pass = _passes.emplace_back();	// throw
+		pass.fn				= RVRef(fn);
+		pass.range.firstRes	= uint(_resources.size());
+		GFX_DBG_ONLY(
+			pass.dbgName	= String{dbg.label};	// throw
+			pass.dbgColor	= dbg.color;)
+		Unused( dbg );
+
+		return PassBuilder{ *this, uint(_passes.size()-1) };
+	}
+
+/*
+=================================================
+	_UseResource
+=================================================
+*/
+	template <typename CtxType>
+	void  RGPassList<CtxType>::PassBuilder::_UseResource (ResourceKey key, EResourceState state) __Th___
+	{
+		auto&	pass = _list._passes[ _passIdx ];
+		CHECK_ERRV( pass.range.firstRes + pass.range.resCount == _list._resources.size() );	// resources must be added immediately after 'AddPass()'
+
+		_list._resources.emplace_back( key, state );	// throw
+		++pass.range.resCount;
+	}
+
+	template <typename CtxType>
+	typename RGPassList<CtxType>::PassBuilder&&  RGPassList<CtxType>::PassBuilder::UseResource (ImageViewID id, EResourceState state) rvTh___
+	{
+		auto&	view = GraphicsScheduler().GetResourceManager().GetResourcesOrThrow( id );	// throw
+		return RVRef(*this).UseResource( view.ImageId(), state );
+	}
+
+	template <typename CtxType>
+	typename RGPassList<CtxType>::PassBuilder&&  RGPassList<CtxType>::PassBuilder::UseResource (BufferViewID id, EResourceState state) rvTh___
+	{
+		auto&	view = GraphicsScheduler().GetResourceManager().GetResourcesOrThrow( id );	// throw
+		return RVRef(*this).UseResource( view.BufferId(), state );
+	}
+
+/*
+=================================================
+	Run
+=================================================
+*/
+	template <typename CtxType>
+	AsyncTask  RGPassList<CtxType>::Run (RGCommandBatchPtr batch, Bool submit, uint maxTasks) __NE___
+	{
+		CHECK_ERR( batch and batch.IsRecording() );
+
+		_stat = Default;
+
+		if_unlikely( _passes.empty() )
+			return null;
+
+		RC<SharedData>		data = MakeRC<SharedData>();
+		Array<uint>			task_start;
+		Array<PassRange>	ranges;
+		Array<TaskRes>		task_res;
+
+		NOTHROW_ERR(
+			ranges.resize( _passes.size() );
+			for (usize i = 0; i < ranges.size(); ++i) {
+				ranges[i] = _passes[i].range;
+			}
+			_Prepare( ranges, Min( maxTasks, GraphicsConfig::MaxCmdBufPerBatch ), OUT data->order, OUT task_start );
+
+			data->passes	= RVRef(_passes);
+			data->resources	= RVRef(_resources);
+		);
+		_passes.clear();
+		_resources.clear();
+
+		AsyncTask	last_task;
+
+		for (uint t = 0; t < _stat.tasks; ++t)
+		{
+			const uint	first	= task_start[t];
+			const uint	last	= (t+1 < _stat.tasks ? task_start[t+1] : uint(data->order.size()));
+
+			NOTHROW_ERR( _TaskResources( data->resources, ranges, data->order, first, last, OUT task_res ));
+
+			auto	builder = batch.Task< RenderTaskFn >(
+								Tuple{ [data, first, last] (RenderTaskFn &task) { _RecordPasses( task, *data, first, last ); }},
+								DebugLabel{ "RGPassList" });
+
+			for (auto& res : task_res)
+			{
+				if ( res.key.IsImage() )		Unused( RVRef(builder).UseResource( res.key.AsImage(),		res.initial, res.final ));
+				else
+				if ( res.key.IsBuffer() )		Unused( RVRef(builder).UseResource( res.key.AsBuffer(),		res.initial, res.final ));
+				else
+				if ( res.key.IsRTGeometry() )	Unused( RVRef(builder).UseResource( res.key.AsRTGeometry(),	res.initial, res.final ));
+				else
+				if ( res.key.IsRTScene() )		Unused( RVRef(builder).UseResource( res.key.AsRTScene(),	res.initial, res.final ));
+			}
+
+			if ( t+1 == _stat.tasks and submit )
+				Unused( RVRef(builder).SubmitBatch() );
+
+			last_task = RVRef(builder).Run();
+		}
+		return last_task;
+	}
+
+/*
+=================================================
+	_RecordPasses
+=================================================
+*/
+	template <typename CtxType>
+	void  RGPassList<CtxType>::_RecordPasses (RenderTaskFn &task, const SharedData &data, const uint first, const uint last) __Th___
+	{
+		CtxType		ctx{ task };
+
+		for (uint i = first; i < last; ++i)
+		{
+			const auto&	pass = data.passes[ data.order[i] ];
+
+			GFX_DBG_ONLY( ctx.PushDebugGroup( DebugLabel{ pass.dbgName, pass.dbgColor });)
+
+			for (uint r = 0; r < pass.range.resCount; ++r) {
+				_ResourceState( ctx, data.resources[ pass.range.firstRes + r ]);
+			}
+
+			pass.fn( ctx );
+
+			GFX_DBG_ONLY( ctx.PopDebugGroup();)
+		}
+
+		task.Execute( ctx );
+	}
+
+/*
+=================================================
+	_ResourceState
+=================================================
+*/
+	template <typename CtxType>
+	void  RGPassList<CtxType>::_ResourceState (CtxType &ctx, const ResUsage &res) __Th___
+	{
+		if ( res.key.IsImage() )		ctx.ResourceState( res.key.AsImage(),		res.state );
+		else
+		if ( res.key.IsBuffer() )		ctx.ResourceState( res.key.AsBuffer(),		res.state );
+		else
+		if ( res.key.IsRTGeometry() )	ctx.ResourceState( res.key.AsRTGeometry(),	res.state );
+		else
+		if ( res.key.IsRTScene() )		ctx.ResourceState( res.key.AsRTScene(),		res.state );
+	}
+
+
+} // AE::RG::_hidden_
@@ -20,6 +20,7 @@
 #include "graphics/RenderGraph/ResStateTracker.h"
 #include "graphics/RenderGraph/RenderGraph.h"
 #include "graphics/RenderGraph/RGCommandContext.h"
+#include "graphics/RenderGraph/RGPassList.h"
 
 namespace AE::RG
 {
@@ -53,4 +54,7 @@ namespace AE::RG
 	using ResStateTracker	= RG::_hidden_::ResStateTracker;
 	using CommandBatchPtr	= RG::_hidden_::RGCommandBatchPtr;
 
+	template <typename CtxType>
+	using PassList			= RG::_hidden_::RGPassList< CtxType >;
+
 } // AE::RG
@@ -36,6 +36,8 @@ namespace AE::Graphics
 	{
 		CHECK( pageSize >= blockSize );
 		CHECK( _bitsPerPage > 0 );
+
+		MEMPROF_ONLY( MemoryProfilerApi::Register( this, MemoryProfilerApi::EAllocator::GpuMemory, "VBlockMemAllocator" );)
 	}
 
 /*
@@ -71,9 +73,12 @@ namespace AE::Graphics
 					dev.vkUnmapMemory( dev.GetVkDevice(), page.memory );
 
 				ASSERT( page.memory != Default );
+				MEMPROF_ONLY( MemoryProfilerApi::Deallocate( this, VGfxMemAllocatorUtils::ProfilerId( page.memory ), _PageSize() );)
 				dev.vkFreeMemory( dev.GetVkDevice(), page.memory, null );
 			}
 		}
+
+		MEMPROF_ONLY( MemoryProfilerApi::Unregister( this );)
 	}
 
 /*
@@ -206,6 +211,8 @@ namespace AE::Graphics
 			page.memory			= memory.Release();
 			page.mapped			= mapped_ptr;
 			page.memTypeIndex	= mem_alloc.memoryTypeIndex;
+
+			MEMPROF_ONLY( MemoryProfilerApi::Allocate( this, MemoryProfilerApi::EAllocator::GpuMemory, VGfxMemAllocatorUtils::ProfilerId( page.memory ), _PageSize() );)
 		}
 
 		return _AllocInPage( *page_arr, OUT outData );
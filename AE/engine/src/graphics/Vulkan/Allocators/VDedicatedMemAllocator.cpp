@@ -3,6 +3,7 @@
 #ifdef AE_ENABLE_VULKAN
 # include "graphics/Vulkan/Allocators/VDedicatedMemAllocator.h"
 # include "graphics/Vulkan/Allocators/VAutoreleaseMemory.h"
+# include "graphics/Vulkan/Allocators/VGfxMemAllocatorUtils.h"
 # include "graphics/Vulkan/VRenderTaskScheduler.h"
 
 namespace AE::Graphics
@@ -15,7 +16,9 @@ namespace AE::Graphics
 */
 	VDedicatedMemAllocator::VDedicatedMemAllocator () __NE___ :
 		_supportDedicated{ GraphicsScheduler().GetDevice().GetVExtensions().dedicatedAllocation }
-	{}
+	{
+		MEMPROF_ONLY( MemoryProfilerApi::Register( this, MemoryProfilerApi::EAllocator::GpuMemory, "VDedicatedMemAllocator" );)
+	}
 
 /*
 =================================================
@@ -25,6 +28,7 @@ namespace AE::Graphics
 	VDedicatedMemAllocator::~VDedicatedMemAllocator () __NE___
 	{
 		CHECK( _counter.load() == 0 );
+		MEMPROF_ONLY( MemoryProfilerApi::Unregister( this );)
 	}
 
 /*
@@ -119,6 +123,8 @@ namespace AE::Graphics
 		mem_data.mapped	= mapped_ptr;
 		mem_data.index	= mem_alloc.memoryTypeIndex;
 
+		MEMPROF_ONLY( MemoryProfilerApi::Allocate( this, MemoryProfilerApi::EAllocator::GpuMemory, VGfxMemAllocatorUtils::ProfilerId( mem_data.mem ), mem_data.size );)
+
 		_counter.fetch_add( 1 );
 		return true;
 	}
@@ -231,6 +237,8 @@ namespace AE::Graphics
 		mem_data.mapped	= mapped_ptr;
 		mem_data.index	= mem_alloc.memoryTypeIndex;
 
+		MEMPROF_ONLY( MemoryProfilerApi::Allocate( this, MemoryProfilerApi::EAllocator::GpuMemory, VGfxMemAllocatorUtils::ProfilerId( mem_data.mem ), mem_data.size );)
+
 		_counter.fetch_add( 1 );
 		return true;
 	}
@@ -271,6 +279,7 @@ namespace AE::Graphics
 			if ( mem_data.mapped != null )
 				dev.vkUnmapMemory( dev.GetVkDevice(), mem_data.mem );
 
+			MEMPROF_ONLY( MemoryProfilerApi::Deallocate( this, VGfxMemAllocatorUtils::ProfilerId( mem_data.mem ), mem_data.size );)
 			dev.vkFreeMemory( dev.GetVkDevice(), mem_data.mem, null );
 			mem_data = Default;
 
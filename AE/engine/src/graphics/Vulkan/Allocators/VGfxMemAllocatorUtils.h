@@ -4,9 +4,12 @@
 
 #ifdef AE_ENABLE_VULKAN
 # include "graphics/Vulkan/VCommon.h"
+# include "threading/Memory/MemoryProfiler.h"
 
 namespace AE::Graphics
 {
+	using AE::Threading::MemoryProfilerApi;
+
 
 	//
 	// Vulkan Graphics Memory Allocator Utils
@@ -40,6 +43,9 @@ namespace AE::Graphics
 			ND_ bool  IsImage ()							C_NE___	{ return HasBit( value, _IsImageBit ); }
 			ND_ bool  IsMappedMemory ()						C_NE___	{ return HasBit( value, _MappedMemBit ); }
 		};
+
+		// used as pointer in memory profiler
+		ND_ static const void*  ProfilerId (VkDeviceMemory mem)	__NE___	{ return BitCast<const void*>( usize(mem) ); }
 	};
 
 
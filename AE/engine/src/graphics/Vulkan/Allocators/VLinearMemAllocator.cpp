@@ -40,7 +40,9 @@ namespace
 */
 	VLinearMemAllocator::VLinearMemAllocator (Bytes pageSize) __NE___ :
 		_pageSize{ ValidatePageSize( pageSize )}
-	{}
+	{
+		MEMPROF_ONLY( MemoryProfilerApi::Register( this, MemoryProfilerApi::EAllocator::GpuMemory, "VLinearMemAllocator" );)
+	}
 
 /*
 =================================================
@@ -63,9 +65,12 @@ namespace
 					dev.vkUnmapMemory( dev.GetVkDevice(), page.memory );
 
 				ASSERT( page.memory != Default );
+				MEMPROF_ONLY( MemoryProfilerApi::Deallocate( this, VGfxMemAllocatorUtils::ProfilerId( page.memory ), page.capacity );)
 				dev.vkFreeMemory( dev.GetVkDevice(), page.memory, null );
 			}
 		}
+
+		MEMPROF_ONLY( MemoryProfilerApi::Unregister( this );)
 	}
 
 /*
@@ -177,6 +182,8 @@ namespace
 		page.mapped			= mapped_ptr;
 		page.propertyFlags	= VkMemoryPropertyFlagBits(mem_props.memoryTypes[ mem_alloc.memoryTypeIndex ].propertyFlags);
 
+		MEMPROF_ONLY( MemoryProfilerApi::Allocate( this, MemoryProfilerApi::EAllocator::GpuMemory, VGfxMemAllocatorUtils::ProfilerId( page.memory ), page.capacity );)
+
 		outData.page		= &page;
 		outData.offset		= 0_b;
 		outData.size		= memSize;
@@ -1,6 +1,7 @@
 // Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
 
 #include "graphics_hl/Canvas/Canvas.h"
+#include "graphics_hl/Canvas/GlyphRunCache.h"
 #include "graphics_hl/Resources/RasterFont.h"
 #include "graphics_hl/Resources/FormattedText.h"
 
@@ -129,96 +130,183 @@ namespace AE::Graphics
 				_topology = EPrimitive::TriangleList;
 		)
 
+		if ( _textCache != null )
+			return _DrawCachedText( text, font, params, regionInVP );
+
+		const uint	max_chars = uint(Utf8CharCount( text ));
+
+		// allocate space
+		CHECK_ERRV( _AllocDrawCall( 1, max_chars * 4, SizeOf<FontPosition_t>, SizeOf<FontAttribs_t>, SizeOf<BatchIndex_t> * (max_chars * 6) ));
+
+		auto&	buf	= _buffers[ _drawCalls.back().rangeIdx ];
+		NonNull( buf.ptr );
+
+		const uint	vert_count = _LayoutText( text, font, params, regionInVP, max_chars,
+											  OUT Cast<FontPosition_t>( buf.CurrPositions() ),
+											  OUT Cast<FontAttribs_t>( buf.CurrAttribs() ));
+		_AddGlyphQuads( vert_count );
+	}
+
+/*
+=================================================
+	_DrawCachedText
+=================================================
+*/
+	void  Canvas::_DrawCachedText (U8StringView text, const RasterFont &font, const FontParams &params, const RectF &regionInVP) __NE___
+	{
+		StaticAssert( IsSameTypes< FontPosition_t, GlyphRunCache::Position_t >);
+		StaticAssert( IsSameTypes< FontAttribs_t,  GlyphRunCache::Attribs_t >);
+
+		const GlyphRunCache::Key	key	{ font, params, regionInVP, _surfDim.GetPixelsToViewport() };
+		GlyphRunCache::Run const*	run	= _textCache->Find( text, key );
+
+		if_unlikely( run == null )
+		{
+			auto*	new_run = _textCache->Add( text, key );
+			CHECK_ERRV( new_run != null );
+
+			const uint	max_chars = uint(Utf8CharCount( text ));
+			NOTHROW_ERRV(
+				new_run->positions.resize( max_chars * 4 );
+				new_run->attribs.resize( max_chars * 4 ));
+
+			const uint	vert_count = _LayoutText( text, font, params, regionInVP, max_chars,
+												  OUT new_run->positions.data(), OUT new_run->attribs.data() );
+			new_run->positions.resize( vert_count );
+			new_run->attribs.resize( vert_count );
+
+			run = new_run;
+		}
+
+		const uint	vert_count = run->VertexCount();
+		if_unlikely( vert_count == 0 )
+			return;
+
+		// allocate space
+		CHECK_ERRV( _AllocDrawCall( 1, vert_count, SizeOf<FontPosition_t>, SizeOf<FontAttribs_t>, SizeOf<BatchIndex_t> * (vert_count / 4 * 6) ));
+
+		auto&	buf	= _buffers[ _drawCalls.back().rangeIdx ];
+		NonNull( buf.ptr );
+
+		MemCopy( OUT buf.CurrPositions(), run->positions.data(), ArraySizeOf(run->positions) );
+		MemCopy( OUT buf.CurrAttribs(),   run->attribs.data(),   ArraySizeOf(run->attribs) );
+
+		_AddGlyphQuads( vert_count );
+	}
+
+/*
+=================================================
+	_LayoutText
+----
+	Writes 4 vertices per visible glyph, returns number of vertices.
+	Symbols are decoded and glyphs are searched by blocks.
+=================================================
+*/
+	uint  Canvas::_LayoutText (U8StringView text, const RasterFont &font, const FontParams &params, const RectF &regionInVP,
+							   const uint maxChars, OUT FontPosition_t* positions, OUT FontAttribs_t* attribs) C_NE___
+	{
+		using Glyph = RasterFont::Glyph;
+
 		const RectF		region_px		= _surfDim.ViewportToPixels( regionInVP );
 		const float		line_h_px		= params.heightInPx * params.spacing;
 		float2			line_px			{ region_px.left, region_px.top + line_h_px };
 		const uint		font_h_px		= font.ValidateHeight( params.heightInPx );
 		const float		font_scale_px	= params.heightInPx / float(font_h_px);
 		const float2	px_to_vp		= _surfDim.GetPixelsToViewport();
-		const usize		max_chars		= Utf8CharCount( text );
+		uint			vert_count		= 0;
 
-		// allocate space
-		CHECK_ERRV( _AllocDrawCall( 1, uint(max_chars * 4), SizeOf<FontPosition_t>, SizeOf<FontAttribs_t>, SizeOf<BatchIndex_t> * uint(max_chars * 6) ));
-
-		auto&	dc			= _drawCalls.back();
-		auto&	buf			= _buffers[ dc.rangeIdx ];
-		uint	vert_count	= 0;
-		uint	idx_count	= 0;
+		StaticArray< CharUtf32, 64 >		symbols;
+		StaticArray< Glyph const*, 64 >		glyphs;
 
-		// draw
-		for (usize num_chars = 0, idx = 0; idx < text.length();)
+		for (usize idx = 0; idx < text.length();)
 		{
-			const CharUtf32	c = Utf8Decode( text, INOUT idx );
+			const usize	count = Utf8Decode( text, INOUT idx, OUT symbols.data(), symbols.size() );
+			font.GetGlyphs( ArrayView<CharUtf32>{ symbols.data(), count }, font_h_px, OUT glyphs.data() );
 
-			if_unlikely( c == '\n' )
+			for (usize i = 0; i < count; ++i)
 			{
-				line_px.x  = region_px.left;
-				line_px.y += line_h_px;
-				continue;
-			}
+				if_unlikely( symbols[i] == '\n' )
+				{
+					line_px.x  = region_px.left;
+					line_px.y += line_h_px;
+					continue;
+				}
 
-			auto*	glyph = font.GetGlyph( c, font_h_px );
-			if_unlikely( glyph == null )
-				continue;
+				auto*	glyph = glyphs[i];
+				if_unlikely( glyph == null )
+					continue;
 
-			ASSERT( num_chars < max_chars );  Unused( num_chars );
-			++num_chars;
+				const float  width_px = glyph->advance * font_scale_px;	// pixels
 
-			const float  width_px = glyph->advance * font_scale_px;	// pixels
+				// in viewport space
+				const float  pos_x1 = (line_px.x + glyph->offset.left	* font_scale_px) * px_to_vp.x - 1.0f;
+				const float  pos_x2 = (line_px.x + glyph->offset.right	* font_scale_px) * px_to_vp.x - 1.0f;
+				const float  pos_y1 = (line_px.y + glyph->offset.top	* font_scale_px) * px_to_vp.y - 1.0f;
+				const float  pos_y2 = (line_px.y + glyph->offset.bottom	* font_scale_px) * px_to_vp.y - 1.0f;
 
-			// in viewport space
-			const float  pos_x1 = (line_px.x + glyph->offset.left	* font_scale_px) * px_to_vp.x - 1.0f;
-			const float  pos_x2 = (line_px.x + glyph->offset.right	* font_scale_px) * px_to_vp.x - 1.0f;
-			const float  pos_y1 = (line_px.y + glyph->offset.top	* font_scale_px) * px_to_vp.y - 1.0f;
-			const float  pos_y2 = (line_px.y + glyph->offset.bottom	* font_scale_px) * px_to_vp.y - 1.0f;
+				line_px.x += width_px;
 
-			line_px.x += width_px;
+				// if completely outside
+				if_unlikely( (pos_x1 > regionInVP.right) or (pos_y1 > regionInVP.bottom) )
+					continue;
 
-			// if completely outside
-			if_unlikely( (pos_x1 > regionInVP.right) or (pos_y1 > regionInVP.bottom) )
-				continue;
+				if_unlikely( not glyph->HasImage() )
+					continue;
 
-			if_unlikely( not glyph->HasImage() )
-				continue;
+				ASSERT( vert_count + 4 <= maxChars * 4 );  Unused( maxChars );
 
-			// add vertices & indices
-			{
-				auto*		indices		= buf.CurrIndices() + idx_count;
-				const auto	first_idx	= BatchIndex_t(dc.vertexOffset + vert_count);
-				NonNull( buf.ptr );
-
-				indices[0] = 0 + first_idx;
-				indices[1] = 1 + first_idx;
-				indices[2] = 2 + first_idx;
-				indices[3] = 2 + first_idx;
-				indices[4] = 1 + first_idx;
-				indices[5] = 3 + first_idx;
-
-				auto*	pos = Cast<FontPosition_t>( buf.CurrPositions() ) + vert_count;
+				auto*	pos = positions + vert_count;
 				pos[0] = FontPosition_t{ float2{ pos_x1, pos_y1 }};
 				pos[1] = FontPosition_t{ float2{ pos_x1, pos_y2 }};
 				pos[2] = FontPosition_t{ float2{ pos_x2, pos_y1 }};
 				pos[3] = FontPosition_t{ float2{ pos_x2, pos_y2 }};
 
-				auto*	attr = Cast<FontAttribs_t>( buf.CurrAttribs() ) + vert_count;
+				auto*	attr = attribs + vert_count;
 				attr[0] = FontAttribs_t{ packed_ushort2{glyph->texcoord.left,  glyph->texcoord.top   },	params.bold, params.color };
 				attr[1] = FontAttribs_t{ packed_ushort2{glyph->texcoord.left,  glyph->texcoord.bottom},	params.bold, params.color };
 				attr[2] = FontAttribs_t{ packed_ushort2{glyph->texcoord.right, glyph->texcoord.top   },	params.bold, params.color };
 				attr[3] = FontAttribs_t{ packed_ushort2{glyph->texcoord.right, glyph->texcoord.bottom},	params.bold, params.color };
 
-				idx_count  += 6;
 				vert_count += 4;
 			}
 		}
+		return vert_count;
+	}
+
+/*
+=================================================
+	_AddGlyphQuads
+----
+	Vertices must be already written to the current position in the buffer.
+=================================================
+*/
+	void  Canvas::_AddGlyphQuads (const uint vertCount) __NE___
+	{
+		ASSERT( IsMultipleOf( vertCount, 4 ));
+
+		auto&		dc			= _drawCalls.back();
+		auto&		buf			= _buffers[ dc.rangeIdx ];
+		auto*		indices		= buf.CurrIndices();
+		const uint	idx_count	= vertCount / 4 * 6;
 
-		ASSERT( vert_count <= uint(max_chars * 4) );
-		ASSERT( idx_count  <= uint(max_chars * 6) );
+		for (uint v = 0; v < vertCount; v += 4)
+		{
+			const auto	first_idx = BatchIndex_t(dc.vertexOffset + v);
+
+			indices[0] = 0 + first_idx;
+			indices[1] = 1 + first_idx;
+			indices[2] = 2 + first_idx;
+			indices[3] = 2 + first_idx;
+			indices[4] = 1 + first_idx;
+			indices[5] = 3 + first_idx;
+			indices += 6;
+		}
 
 		dc.indexCount	+= idx_count;
-		dc.vertexOffset	+= vert_count;
+		dc.vertexOffset	+= vertCount;
 
-		buf.posSize		+= SizeOf<FontPosition_t>   * vert_count;
-		buf.attribsSize	+= SizeOf<FontAttribs_t>    * vert_count;
+		buf.posSize		+= SizeOf<FontPosition_t>   * vertCount;
+		buf.attribsSize	+= SizeOf<FontAttribs_t>    * vertCount;
 		buf.indexSize	+= SizeOf<BatchIndex_t>		* idx_count;
 	}
 
@@ -284,7 +372,10 @@ namespace AE::Graphics
 			vert_count += 4;
 		}};
 
-		// draw text chunks
+		StaticArray< CharUtf32, 64 >				symbols;
+		StaticArray< RasterFont::Glyph const*, 64 >	glyphs;
+
+		// draw text chunks, symbols are decoded and glyphs are searched by blocks
 		for (auto* chunk = text.Text().GetFirst(); chunk; chunk = chunk->next)
 		{
 			const uint		font_h_px		= font.ValidateHeight( chunk->Height() );
@@ -294,42 +385,48 @@ namespace AE::Graphics
 
 			for (usize idx = 0; idx < chunk->length;)
 			{
-				const CharUtf32	c = Utf8Decode( chunk->Text(), INOUT idx );
+				const usize	count = Utf8Decode( chunk->Text(), INOUT idx, OUT symbols.data(), symbols.size() );
+				font.GetGlyphs( ArrayView<CharUtf32>{ symbols.data(), count }, font_h_px, OUT glyphs.data() );
 
-				if_unlikely( c == '\n' )
+				for (usize i = 0; i < count; ++i)
 				{
-					line_px.x  = region_px.left;
-					line_px.y += text.LineHeights()[ line_idx++ ];
-					continue;
-				}
+					const CharUtf32	c = symbols[i];
 
-				auto*	glyph = font.GetGlyph( c, font_h_px );
-				if_unlikely( glyph == null )
-					continue;
+					if_unlikely( c == '\n' )
+					{
+						line_px.x  = region_px.left;
+						line_px.y += text.LineHeights()[ line_idx++ ];
+						continue;
+					}
 
-				ASSERT( num_chars < max_chars );  Unused( num_chars );
-				++num_chars;
+					auto*	glyph = glyphs[i];
+					if_unlikely( glyph == null )
+						continue;
 
-				const float  width_px = glyph->advance * font_scale_px;	// pixels
+					ASSERT( num_chars < max_chars );  Unused( num_chars );
+					++num_chars;
 
-				if_unlikely( text.IsWordWrap() and (line_px.x + width_px > region_w_px) )
-				{
-					line_px.x  = region_px.left;
-					line_px.y += text.LineHeights()[ line_idx++ ];
-				}
+					const float  width_px = glyph->advance * font_scale_px;	// pixels
 
-				// in viewport space
-				const float  pos_x1 = (line_px.x + glyph->offset.left	* font_scale_px) * px_to_vp.x - 1.0f;
-				const float  pos_x2 = (line_px.x + glyph->offset.right	* font_scale_px) * px_to_vp.x - 1.0f;
-				const float  pos_y1 = (line_px.y + glyph->offset.top	* font_scale_px) * px_to_vp.y - 1.0f;
-				const float  pos_y2 = (line_px.y + glyph->offset.bottom	* font_scale_px) * px_to_vp.y - 1.0f;
+					if_unlikely( text.IsWordWrap() and (line_px.x + width_px > region_w_px) )
+					{
+						line_px.x  = region_px.left;
+						line_px.y += text.LineHeights()[ line_idx++ ];
+					}
 
-				line_px.x += width_px;
+					// in viewport space
+					const float  pos_x1 = (line_px.x + glyph->offset.left	* font_scale_px) * px_to_vp.x - 1.0f;
+					const float  pos_x2 = (line_px.x + glyph->offset.right	* font_scale_px) * px_to_vp.x - 1.0f;
+					const float  pos_y1 = (line_px.y + glyph->offset.top	* font_scale_px) * px_to_vp.y - 1.0f;
+					const float  pos_y2 = (line_px.y + glyph->offset.bottom	* font_scale_px) * px_to_vp.y - 1.0f;
 
-				if_unlikely( not glyph->HasImage() )
-					continue;
+					line_px.x += width_px;
 
-				AddGlyph( pos_x1, pos_x2, pos_y1, pos_y2, glyph->texcoord, 0, color );
+					if_unlikely( not glyph->HasImage() )
+						continue;
+
+					AddGlyph( pos_x1, pos_x2, pos_y1, pos_y2, glyph->texcoord, 0, color );
+				}
 			}
 
 			if_unlikely( chunk->underline )
@@ -5,6 +5,9 @@
 	Canvas does not allocate memory, it uses vstream from 'StagingBufferManager'.
 	VStream allocation granularity defined in 'Canvas::_MaxVertsPerBatch' and 'Canvas::_IndexBufSize'.
 	You should reuse canvas for small draw commands in single thread.
+
+	'GlyphRunCache' is optional, if it is set then 'DrawText()' copies vertices from the cache
+	instead of decoding and layouting unchanged text on each call.
 */
 
 #pragma once
@@ -16,6 +19,7 @@ namespace AE::Graphics
 {
 	class RasterFont;
 	class PrecalculatedFormattedText;
+	class GlyphRunCache;
 
 
 	//
@@ -131,6 +135,8 @@ namespace AE::Graphics
 
 		SurfaceDimensions	_surfDim;
 
+		GlyphRunCache*		_textCache	= null;
+
 		DEBUG_ONLY(
 			EPrimitive		_topology	= Default;
 		)
@@ -147,6 +153,8 @@ namespace AE::Graphics
 
 		ND_ SurfaceDimensions const&  Dimensions ()																		C_NE___	{ return _surfDim; }
 
+		void  SetTextCache (GlyphRunCache* cache)																		__NE___	{ _textCache = cache; }
+
 
 		void  NextFrame (FrameUID frameId)																				__NE___;
 
@@ -177,6 +185,11 @@ namespace AE::Graphics
 
 		ND_ bool  _AllocDrawCall (uint instanceCount, uint vertCount, Bytes32u posSize, Bytes32u attrSize, Bytes32u idxDataSize)	__NE___;
 		ND_ bool  _Alloc ()																											__NE___;
+
+			void  _DrawCachedText (U8StringView text, const RasterFont &font, const FontParams &params, const RectF &regionInVP)	__NE___;
+		ND_ uint  _LayoutText (U8StringView text, const RasterFont &font, const FontParams &params, const RectF &regionInVP,
+							   uint maxChars, OUT FontPosition_t* positions, OUT FontAttribs_t* attribs)						C_NE___;
+			void  _AddGlyphQuads (uint vertCount)																				__NE___;
 	};
 
 
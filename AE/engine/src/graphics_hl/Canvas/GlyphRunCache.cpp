@@ -0,0 +1,195 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "graphics_hl/Canvas/GlyphRunCache.h"
+#include "graphics_hl/Resources/RasterFont.h"
+
+namespace AE::Graphics
+{
+
+/*
+=================================================
+	Key
+=================================================
+*/
+	GlyphRunCache::Key::Key (const RasterFont &inFont, const Canvas::FontParams &params, const RectF &inRegion, const float2 &inPxToVp) __NE___ :
+		font{ &inFont },				fontImage{ inFont.GetImageID() },
+		heightInPx{ params.heightInPx },	spacing{ params.spacing },
+		color{ params.color },			bold{ params.bold },
+		region{ inRegion },				pxToVp{ inPxToVp }
+	{}
+
+	bool  GlyphRunCache::Key::operator == (const Key &rhs) C_NE___
+	{
+		return	(font		== rhs.font)		and
+				(fontImage	== rhs.fontImage)	and
+				(heightInPx	== rhs.heightInPx)	and
+				(spacing	== rhs.spacing)		and
+				(color		== rhs.color)		and
+				(bold		== rhs.bold)		and
+				All( region == rhs.region )		and
+				All( pxToVp == rhs.pxToVp );
+	}
+
+	HashVal  GlyphRunCache::Key::CalcHash () C_NE___
+	{
+		return	HashOf( font )		+ HashOf( fontImage )	+
+				HashOf( heightInPx )+ HashOf( spacing )		+
+				HashOf( color )		+ HashOf( bold )		+
+				HashOf( region )	+ HashOf( pxToVp );
+	}
+//-----------------------------------------------------------------------------
+
+
+
+/*
+=================================================
+	constructor
+=================================================
+*/
+	GlyphRunCache::GlyphRunCache (uint maxRuns) __NE___ :
+		_maxRuns{ Max( maxRuns, 1u )}
+	{
+		NOTHROW( _entries.reserve( _maxRuns );)
+		NOTHROW( _map.reserve( _maxRuns );)
+	}
+
+/*
+=================================================
+	_CalcHash
+=================================================
+*/
+	HashVal  GlyphRunCache::_CalcHash (U8StringView text, const Key &key) __NE___
+	{
+		return HashOf( text.data(), text.size() ) + key.CalcHash();
+	}
+
+/*
+=================================================
+	Find
+=================================================
+*/
+	GlyphRunCache::Run const*  GlyphRunCache::Find (U8StringView text, const Key &key) __NE___
+	{
+		auto	it = _map.find( _CalcHash( text, key ));
+
+		if_likely( it != _map.end() )
+		{
+			auto&	e = _entries[ it->second ];
+
+			// check for hash collision
+			if_likely( e.key == key and U8StringView{e.text} == text )
+			{
+				if ( _head != it->second )
+				{
+					_Unlink( it->second );
+					_PushFront( it->second );
+				}
+				++_stat.hits;
+				return &e.run;
+			}
+		}
+
+		++_stat.misses;
+		return null;
+	}
+
+/*
+=================================================
+	Add
+=================================================
+*/
+	GlyphRunCache::Run*  GlyphRunCache::Add (U8StringView text, const Key &key) __NE___
+	{
+		const HashVal	hash	= _CalcHash( text, key );
+		uint			idx		= UMax;
+
+		if ( auto it = _map.find( hash );  it != _map.end() )
+		{
+			// replace entry with the same hash
+			idx = it->second;
+			_Unlink( idx );
+		}
+		else
+		if ( _entries.size() < _maxRuns )
+		{
+			idx = uint(_entries.size());
+			NOTHROW_ERR( _entries.emplace_back();  _map.emplace( hash, idx ), null );
+		}
+		else
+		{
+			// evict least recently used run
+			idx = _tail;
+			ASSERT( idx < _entries.size() );
+
+			_Unlink( idx );
+			_map.erase( _entries[idx].hash );
+			++_stat.evicted;
+
+			NOTHROW_ERR( _map.emplace( hash, idx ), null );
+		}
+
+		auto&	e = _entries[idx];
+		e.hash	= hash;
+		e.key	= key;
+		e.run.positions.clear();
+		e.run.attribs.clear();
+		NOTHROW_ERR( e.text.assign( text.data(), text.size() ), null );
+
+		_PushFront( idx );
+		return &e.run;
+	}
+
+/*
+=================================================
+	Clear
+=================================================
+*/
+	void  GlyphRunCache::Clear () __NE___
+	{
+		_entries.clear();
+		_map.clear();
+		_head	= UMax;
+		_tail	= UMax;
+	}
+
+/*
+=================================================
+	_Unlink
+=================================================
+*/
+	void  GlyphRunCache::_Unlink (const uint idx) __NE___
+	{
+		auto&	e = _entries[idx];
+
+		if ( e.prev != UMax )	_entries[ e.prev ].next = e.next;
+		else					_head = e.next;
+
+		if ( e.next != UMax )	_entries[ e.next ].prev = e.prev;
+		else					_tail = e.prev;
+
+		e.prev = e.next = UMax;
+	}
+
+/*
+=================================================
+	_PushFront
+=================================================
+*/
+	void  GlyphRunCache::_PushFront (const uint idx) __NE___
+	{
+		auto&	e = _entries[idx];
+
+		e.prev	= UMax;
+		e.next	= _head;
+
+		if ( _head != UMax )
+			_entries[ _head ].prev = idx;
+
+		_head = idx;
+
+		if ( _tail == UMax )
+			_tail = idx;
+	}
+
+
+} // AE::Graphics
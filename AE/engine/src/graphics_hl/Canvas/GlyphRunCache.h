@@ -0,0 +1,110 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+/*
+	Thread-safe:  no
+
+	Cache for text which is drawn by 'Canvas::DrawText()'.
+	Glyph run contains vertices in viewport space, so it depends on text, font, font params, region and surface size.
+	Vertices are copied to the vertex stream as is, indices are generated because they depend on draw call.
+	Least recently used run is removed when the cache is full.
+*/
+
+#pragma once
+
+#include "graphics_hl/Canvas/Canvas.h"
+
+namespace AE::Graphics
+{
+
+	//
+	// Glyph Run Cache
+	//
+
+	class GlyphRunCache final
+	{
+	// types
+	public:
+		using Position_t	= VB_Position_f2;
+		using Attribs_t		= VB_UVs2_SCs1_Col8;
+
+		struct Key
+		{
+			RasterFont const*	font		= null;
+			ImageID				fontImage;
+			float				heightInPx	= 0.f;
+			float				spacing		= 0.f;
+			RGBA8u				color;
+			ushort				bold		= 0;
+			RectF				region;			// in viewport space
+			float2				pxToVp;
+
+			Key ()										__NE___ = default;
+			Key (const RasterFont &, const Canvas::FontParams &, const RectF &region, const float2 &pxToVp) __NE___;
+
+			ND_ bool	operator == (const Key &rhs)	C_NE___;
+			ND_ HashVal	CalcHash ()						C_NE___;
+		};
+
+		struct Run
+		{
+			Array< Position_t >		positions;
+			Array< Attribs_t >		attribs;
+
+			ND_ uint  VertexCount ()					C_NE___	{ return uint(positions.size()); }
+		};
+
+		struct Statistic
+		{
+			ulong	hits		= 0;
+			ulong	misses		= 0;
+			ulong	evicted		= 0;
+		};
+
+	private:
+		struct Entry
+		{
+			HashVal			hash;
+			Key				key;
+			U8String		text;
+			Run				run;
+			uint			prev	= UMax;		// more recently used
+			uint			next	= UMax;		// less recently used
+		};
+
+		using EntryMap_t = FlatHashMap< HashVal, uint >;
+
+
+	// variables
+	private:
+		Array< Entry >		_entries;
+		EntryMap_t			_map;
+		uint				_head		= UMax;		// most recently used
+		uint				_tail		= UMax;		// least recently used
+		const uint			_maxRuns;
+		Statistic			_stat;
+
+
+	// methods
+	public:
+		explicit GlyphRunCache (uint maxRuns = 1024)					__NE___;
+		~GlyphRunCache ()												__NE___	{}
+
+		// Returns 'null' if not found.
+		ND_ Run const*	Find (U8StringView text, const Key &key)		__NE___;
+
+		// Returns empty run which must be filled by caller.
+		ND_ Run*		Add (U8StringView text, const Key &key)			__NE___;
+
+			void		Clear ()										__NE___;
+
+		ND_ usize		Count ()										C_NE___	{ return _map.size(); }
+		ND_ Statistic	GetStatistic ()									C_NE___	{ return _stat; }
+
+	private:
+		ND_ static HashVal  _CalcHash (U8StringView text, const Key &key) __NE___;
+
+		void  _Unlink (uint idx)										__NE___;
+		void  _PushFront (uint idx)										__NE___;
+	};
+
+
+} // AE::Graphics
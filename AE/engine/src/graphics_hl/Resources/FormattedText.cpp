@@ -64,6 +64,8 @@ namespace {
 
 	FormattedText&  FormattedText::Append (U8StringView str)
 	{
+		ASSERT( Utf8Validate( str ));
+
 		struct State
 		{
 			EChunkType	type		= Default;
@@ -292,33 +294,31 @@ namespace {
 
 		for (; pos < str.length();)
 		{
-			const usize	old_pos = pos;
+			// search pattern '[<key>...]' or '[/<key>]',
+			// ASCII symbol can not be a part of multibyte UTF-8 sequence, so search by bytes without decoding
+			pos = FindChar( Cast<char>(str.data()), pos, str.length(), '[' );
+			if ( pos >= str.length() )
+				break;
 
-			// search pattern '[<key>...]' or '[/<key>]'
-			const CharUtf32	c = Utf8Decode( str, INOUT pos );
+			const usize		old_pos	= pos++;
+			const State		state	= states.back();
+			bool			processed;
 
-			if_unlikely( c == '[' )
+			if ( pos < str.length() and str[pos] == '/' )
 			{
-				const usize		tmp		= pos;
-				const CharUtf32	n		= Utf8Decode( str, INOUT pos );
-				const State		state	= states.back();
-				bool			processed;
-
-				if ( n == '/' )
-					processed = ParseClosingTag( INOUT pos );
-				else {
-					pos = tmp;
-					processed = ParseOpeningTag( INOUT pos );
-				}
+				++pos;
+				processed = ParseClosingTag( INOUT pos );
+			}
+			else
+				processed = ParseOpeningTag( INOUT pos );
 
-				if ( processed )
-				{
-					AddChunk( str.data() + start, old_pos - start, state );
-					start = pos;
-					continue;
-				}
+			if ( processed )
+			{
+				AddChunk( str.data() + start, old_pos - start, state );
+				start = pos;
 			}
 		}
+		pos = Min( pos, str.length() );
 
 		AddChunk( str.data() + start, pos - start, states.back() );
 
@@ -495,18 +495,57 @@ namespace {
 /*
 =================================================
 	Serialize
+----
+	default layout:
+		[uint maxChars] [uint count] { [uint length] [chunk data without 'next'] }
+
+	in-place layout:
+		[uint maxChars] [uint count] [uint blobSize] [blob]
+		blob contains chunks with alignment, 'next' is replaced by 'uint' offset from blob begin or 0,
+		remaining bytes of the pointer are zeroed.
 =================================================
 */
 	bool  FormattedText::Serialize (Serializing::Serializer &ser) C_NE___
 	{
 		bool	result;
-		uint	count  = 0;
+		uint	count		= 0;
+		Bytes	blob_size;
+
 		for (Chunk const* chunk = _first; chunk; chunk = chunk->next, ++count)
-		{}
+		{
+			blob_size += _ChunkSize( chunk->length );
+		}
 
 		result = ser.stream.Write( _maxChars ) and
 				 ser.stream.Write( count );
 
+		if ( ser.inPlaceLayout )
+		{
+			CHECK_ERR( blob_size <= MaxValue<uint>() );
+			result = result and ser.stream.Write( uint(blob_size) );
+
+			StaticAssert( offsetof(Chunk, color) == sizeof(usize) );
+			StaticAssert( sizeof(usize) >= sizeof(uint) );
+
+			const ubyte	zeros [alignof(Chunk)] = {};
+			Bytes		offset;
+
+			for (Chunk const* chunk = _first; result and (chunk != null); chunk = chunk->next)
+			{
+				const Bytes		chunk_size	= _ChunkSize( chunk->length );
+				const Bytes		data_size	{sizeof(Chunk) - offsetof(Chunk, color) + chunk->length};
+				const uint		next_off	= chunk->next != null ? uint(offset + chunk_size) : 0;
+
+				result = ser.stream.Write( next_off )									and
+						 ser.stream.Write( zeros, SizeOf<usize> - SizeOf<uint> )		and
+						 ser.stream.Write( &chunk->color, data_size )					and
+						 ser.stream.Write( zeros, chunk_size - SizeOf<usize> - data_size );
+
+				offset += chunk_size;
+			}
+			return result;
+		}
+
 		for (Chunk const* chunk = _first; result and (chunk != null); chunk = chunk->next)
 		{
 			const uint	str_length = chunk->length;
@@ -534,6 +573,50 @@ namespace {
 		result = des.stream.Read( OUT _maxChars ) and
 				 des.stream.Read( OUT count );
 
+		if ( des.inPlaceLayout )
+		{
+			uint	blob_size = 0;
+			result = result and des.stream.Read( OUT blob_size );
+
+			if ( (not result) or (count == 0) )
+				return result;
+
+			CHECK_ERR( blob_size >= count * SizeOf<Chunk> );
+
+			// single copy for all chunks, then convert offsets to pointers
+			void*	blob = _alloc.Allocate( SizeAndAlign{ Bytes{blob_size}, AlignOf<Chunk> });
+			CHECK_ERR( blob != null );
+			CHECK_ERR( des.stream.Read( OUT blob, Bytes{blob_size} ));
+
+			Chunk*	chunk	= Cast<Chunk>( blob );
+			uint	offset	= 0;
+
+			for (uint i = 0; i < count; ++i)
+			{
+				// chunk header is inside the blob: first is checked by 'blob_size', others on previous iteration
+				CHECK_ERR( ulong(offset) + sizeof(Chunk) + chunk->length <= blob_size );
+
+				uint	next_off = 0;
+				MemCopy( OUT &next_off, chunk, SizeOf<uint> );
+
+				if ( i+1 < count ) {
+					CHECK_ERR( next_off > offset and ulong(next_off) + sizeof(Chunk) <= blob_size );
+					CHECK_ERR( IsMultipleOf( next_off, alignof(Chunk) ));
+					chunk->next = Cast<Chunk>( blob + Bytes{next_off} );
+				}else{
+					CHECK_ERR( next_off == 0 );
+					chunk->next = null;
+				}
+
+				offset	= next_off;
+				chunk	= const_cast<Chunk*>( chunk->next );
+			}
+
+			_first = Cast<Chunk>( blob );
+			return true;
+		}
+
+		Chunk*	last_chunk = null;
 		for (uint i = 0; result and (i < count); ++i)
 		{
 			uint	str_length = 0;
@@ -545,6 +628,10 @@ namespace {
 			Chunk*	chunk	= PlacementNew<Chunk>( OUT ptr );
 
 			result = result and des.stream.Read( &chunk->color, Bytes{sizeof(Chunk) - offsetof(Chunk, color) + str_length} );
+
+			if ( not _first )	_first = chunk;
+			else				last_chunk->next = chunk;
+			last_chunk = chunk;
 		}
 		return result;
 	}
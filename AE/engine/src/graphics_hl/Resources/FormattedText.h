@@ -87,6 +87,8 @@ namespace AE::Graphics
 
 	private:
 		ND_ U8String		_ToString ()						C_Th___;
+
+		ND_ static Bytes	_ChunkSize (uint length)			__NE___	{ return AlignUp( SizeOf<Chunk> + length, AlignOf<Chunk> ); }
 	};
 
 
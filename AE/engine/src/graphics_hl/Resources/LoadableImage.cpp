@@ -113,6 +113,98 @@ namespace {
 		}
 		return true;
 	}
+//-----------------------------------------------------------------------------
+
+
+
+/*
+=================================================
+	UploadStream
+=================================================
+*/
+	LoadableImage::UploadStream::UploadStream (ImageID imageId, const Header_t &hdr, const void* data, Bytes dataSize, RC<> mem) __NE___ :
+		_imageId{ imageId },	_header{ hdr },
+		_mem{ RVRef(mem) },		_data{ data },
+		_dataSize{ dataSize }
+	{
+		ASSERT( ImagePacker_IsValid( _header ));
+	}
+
+/*
+=================================================
+	UploadStream::Upload
+----
+	'maxSize' limits amount of data which will be copied to the staging buffer,
+	it is used to spread upload of large image across several frames.
+=================================================
+*/
+	bool  LoadableImage::UploadStream::Upload (ITransferContext &ctx, Bytes maxSize) __NE___
+	{
+		if_unlikely( _complete )
+			return true;
+
+		CHECK_ERR( _imageId and _data != null );
+
+		if_unlikely( _mipmap.Get() == 0 and _layer.Get() == 0 and not _stream.IsInitialized() )
+		{
+			ctx.ImageBarrier( _imageId, EResourceState::Unknown, EResourceState::CopyDst );
+			ctx.CommitBarriers();
+		}
+
+		for (Bytes uploaded; uploaded < maxSize;)
+		{
+			uint3	dim;
+			Bytes	off, row_pitch, slice_pitch;
+			ImagePacker_GetOffset( _header, _layer, _mipmap, uint3{0}, OUT dim, OUT off, OUT row_pitch, OUT slice_pitch );
+
+			const Bytes	size = slice_pitch * dim.z;
+			CHECK_ERR( off + size <= _dataSize );
+
+			if_unlikely( not _stream.IsInitialized() )
+			{
+				UploadImageDesc	upload;
+				upload.imageDim			= dim;
+				upload.arrayLayer		= _layer;
+				upload.mipLevel			= _mipmap;
+				upload.dataRowPitch		= row_pitch;
+				upload.dataSlicePitch	= slice_pitch;
+				upload.heapType			= EStagingHeapType::Dynamic;
+				upload.aspectMask		= EImageAspect::Color;
+				_stream					= ImageStream{ _imageId, upload };
+			}
+
+			ImageMemView	dst_mem;
+			ctx.UploadImage( INOUT _stream, OUT dst_mem );
+
+			// staging buffer is full, continue in next frame
+			if ( dst_mem.Empty() )
+				break;
+
+			ImageMemView	src_mem { const_cast<void*>( _data + off ), size, uint3{}, dim, row_pitch, slice_pitch, _header.format, EImageAspect::Color };
+			CHECK_ERR( dst_mem.CopyFrom( uint3{}, dst_mem.Offset(), src_mem, dst_mem.Dimension() ));
+
+			uploaded += dst_mem.ContentSize();
+
+			if ( not _stream.IsCompleted() )
+				continue;
+
+			// next slice
+			_stream = Default;
+
+			if ( ++_layer < ImageLayer{_header.arrayLayers} )
+				continue;
+
+			_layer = Default;
+			if ( ++_mipmap < MipmapLevel{_header.mipmaps} )
+				continue;
+
+			_complete	= true;
+			_mem		= null;
+			_data		= null;
+			break;
+		}
+		return true;
+	}
 
 
 } // AE::Graphics
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "graphics_hl/GraphicsHL.pch.h"
+#include "Packer/ImagePacker.h"
 
 namespace AE::Graphics
 {
@@ -26,6 +27,42 @@ namespace AE::Graphics
 		};
 
 
+		//
+		// Upload Stream
+		//	Uploads image data which is stored in memory in 'ImagePacker' format.
+		//	Data is copied into the dynamic staging buffer by parts, so upload may take several frames.
+		//
+		class UploadStream
+		{
+		// types
+		public:
+			using Header_t	= AssetPacker::ImagePacker::Header;
+
+		// variables
+		private:
+			ImageID			_imageId;
+			Header_t		_header;
+			RC<>			_mem;			// keep alive '_data'
+			void const*		_data		= null;
+			Bytes			_dataSize;
+			ImageStream		_stream;
+			MipmapLevel		_mipmap;
+			ImageLayer		_layer;
+			bool			_complete	= false;
+
+		// methods
+		public:
+			UploadStream ()																	__NE___	{}
+			UploadStream (ImageID imageId, const Header_t &hdr, const void* data, Bytes dataSize, RC<> mem) __NE___;
+
+			// Returns 'false' on error.
+			// Image is transitioned to 'CopyDst' state on first call and stays in this state when upload is complete.
+			ND_ bool  Upload (ITransferContext &ctx, Bytes maxSize = UMax)					__NE___;
+
+			ND_ bool  IsCompleted ()														C_NE___	{ return _complete; }
+		};
+
+
 	// variables
 	private:
 		Strong<ImageID>		_imageId;
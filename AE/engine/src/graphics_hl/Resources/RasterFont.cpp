@@ -80,6 +80,35 @@ namespace {
 		return it != _glyphMap.end() ? &it->second : null;
 	}
 
+/*
+=================================================
+	GetGlyphs
+----
+	Text has many repeated symbols, so reuse result for the same symbol without hash map lookup.
+	'null' is written for missed glyphs.
+=================================================
+*/
+	void  RasterFont::GetGlyphs (ArrayView<CharUtf32> symbols, uint height, OUT Glyph const** glyphs) C_NE___
+	{
+		StaticArray< CharUtf32, 4 >		last_symb;
+		StaticArray< Glyph const*, 4 >	last_glyph	= {};
+
+		last_symb.fill( UMax );
+
+		for (usize i = 0; i < symbols.size(); ++i)
+		{
+			const CharUtf32	c	= symbols[i];
+			const usize		j	= usize{c} & (last_symb.size()-1);
+
+			if_unlikely( last_symb[j] != c )
+			{
+				last_symb[j]	= c;
+				last_glyph[j]	= GetGlyph( c, height );
+			}
+			glyphs[i] = last_glyph[j];
+		}
+	}
+
 /*
 =================================================
 	CalculateDimensions
@@ -154,6 +183,8 @@ namespace {
 		_glyphMap	= RVRef(rhs._glyphMap);
 		_fontHeight	= rhs._fontHeight;
 		_sdfConfig	= rhs._sdfConfig;
+		_placeholder	= rhs._placeholder;
+		_upload		= RVRef(rhs._upload);
 
 		return *this;
 	}
@@ -192,4 +223,69 @@ namespace {
 		return font;
 	}
 
+/*
+=================================================
+	AsyncLoader::Load
+----
+	File is read in IO thread, glyphs are deserialized and image is created in background thread.
+=================================================
+*/
+	Promise<RC<RasterFont>>  RasterFont::AsyncLoader::Load (RC<AsyncRDataSource> file, GfxMemAllocatorPtr alloc, ImageViewID placeholder) __NE___
+	{
+		CHECK_ERR( file and file->IsOpen() );
+
+		return file->ReadRemaining( 0_b )->AsPromise( ETaskQueue::Background ).Then(
+			[alloc = RVRef(alloc), placeholder] (const AsyncDSRequestResult &in) -> PromiseResult< RC<RasterFont> >
+			{
+				CHECK_PE( in.data != null );
+
+				auto				stream	= MakeRC<MemRefRStream>( in.data, in.dataSize );
+				RasterFontPacker	unpacker;
+				auto&				header	= unpacker.Header();
+				{
+					Serializing::Deserializer	des{ stream };
+					CHECK_PE( RasterFontPacker_Deserialize( unpacker, des ));
+				}
+
+				auto	font		= MakeRC<RasterFont>();
+				auto&	res_mngr	= GraphicsScheduler().GetResourceManager();
+
+				font->_imageId = res_mngr.CreateImage( header.ToDesc().SetUsage( EImageUsage::Sampled | EImageUsage::Transfer ), Default, alloc );
+				CHECK_PE( font->_imageId );
+
+				font->_viewId = res_mngr.CreateImageView( header.ToViewDesc(), font->_imageId, Default );
+				CHECK_PE( font->_viewId );
+
+				const Bytes	off = stream->Position();
+				font->_upload = MakeUnique<LoadableImage::UploadStream>( font->_imageId, header, in.data + off, in.dataSize - off, in.rc );
+
+				font->_placeholder	= placeholder;
+				font->_glyphMap		= RVRef(unpacker.glyphMap);
+				font->_fontHeight	= unpacker.fontHeight;
+				font->_sdfConfig	= unpacker.sdfConfig;
+
+				return font;
+			},
+			"RasterFont::AsyncLoad",
+			ETaskQueue::Background );
+	}
+
+/*
+=================================================
+	Upload
+=================================================
+*/
+	bool  RasterFont::Upload (ITransferContext &ctx, Bytes maxSize) __NE___
+	{
+		if_unlikely( IsLoaded() )
+			return true;
+
+		CHECK_ERR( _upload->Upload( ctx, maxSize ));
+
+		if ( _upload->IsCompleted() )
+			_upload.reset();
+
+		return true;
+	}
+
 } // AE::Graphics
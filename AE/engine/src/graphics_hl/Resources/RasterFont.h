@@ -3,6 +3,7 @@
 #pragma once
 
 #include "graphics_hl/Resources/FormattedText.h"
+#include "graphics_hl/Resources/LoadableImage.h"
 
 #include "AssetPackerImpl.h"
 
@@ -23,8 +24,10 @@ namespace AE::Graphics
 		using GlyphMap_t	= AssetPacker::RasterFontPacker::GlyphMap_t;
 		using SizeArr_t		= AssetPacker::RasterFontPacker::SizeArr_t;
 
+		// Glyphs are available when promise is complete, image data must be uploaded by 'Upload()',
+		// 'placeholder' view is returned by 'GetViewID()' until upload is complete.
 		struct AsyncLoader {
-		//	ND_ Promise<RC<RasterFont>>  Load (RC<AsyncRStream> stream) __NE___;
+			ND_ Promise<RC<RasterFont>>  Load (RC<AsyncRDataSource> file, GfxMemAllocatorPtr alloc, ImageViewID placeholder = Default) __NE___;
 		};
 
 		struct Loader {
@@ -40,6 +43,9 @@ namespace AE::Graphics
 		GlyphMap_t				_glyphMap;
 		SizeArr_t				_fontHeight;
 
+		ImageViewID				_placeholder;
+		Unique<LoadableImage::UploadStream>	_upload;	// non-null until async upload is complete
+
 
 	// methods
 	public:
@@ -49,6 +55,7 @@ namespace AE::Graphics
 			RasterFont&		operator = (RasterFont &&)													__NE___;
 
 		ND_ Glyph const*	GetGlyph (CharUtf32 symbol, uint height)									C_NE___;
+			void			GetGlyphs (ArrayView<CharUtf32> symbols, uint height, OUT Glyph const** glyphs) C_NE___;
 
 		ND_ uint  ValidateHeight (float heightInPx)														C_NE___;
 
@@ -56,9 +63,14 @@ namespace AE::Graphics
 
 		ND_ float  ScreenPixRange (float heightInPx)													C_NE___;	// 2D SDF only
 
+		// Async loader only.
+		// Returns 'false' on error. Image stays in 'CopyDst' state when upload is complete.
+		ND_ bool  Upload (ITransferContext &ctx, Bytes maxSize = UMax)									__NE___;
+		ND_ bool  IsLoaded ()																			C_NE___	{ return _upload == null; }
+
 		ND_ bool				IsSDF ()																C_NE___	{ return _sdfConfig.scale != 0.f; }
 		ND_ ImageID				GetImageID ()															C_NE___	{ return _imageId; }
-		ND_ ImageViewID			GetViewID ()															C_NE___	{ return _viewId; }
+		ND_ ImageViewID			GetViewID ()															C_NE___	{ return IsLoaded() ? _viewId.Get() : _placeholder; }
 		ND_ SDFConfig const&	GetSDFConfig ()															C_NE___	{ return _sdfConfig; }
 	};
 
@@ -85,5 +85,69 @@ namespace {
 		return atlas;
 	}
 
+/*
+=================================================
+	AsyncLoader::Load
+----
+	File is read in IO thread, header is deserialized and image is created in background thread.
+=================================================
+*/
+	Promise<RC<StaticImageAtlas>>  StaticImageAtlas::AsyncLoader::Load (RC<AsyncRDataSource> file, GfxMemAllocatorPtr alloc, ImageViewID placeholder) __NE___
+	{
+		CHECK_ERR( file and file->IsOpen() );
+
+		return file->ReadRemaining( 0_b )->AsPromise( ETaskQueue::Background ).Then(
+			[alloc = RVRef(alloc), placeholder] (const AsyncDSRequestResult &in) -> PromiseResult< RC<StaticImageAtlas> >
+			{
+				CHECK_PE( in.data != null );
+
+				auto				stream = MakeRC<MemRefRStream>( in.data, in.dataSize );
+				ImageAtlasPacker	unpacker;
+				{
+					Serializing::Deserializer	des{ stream };
+					CHECK_PE( ImageAtlasPacker_Deserialize( unpacker, des ));
+				}
+
+				auto	atlas		= MakeRC<StaticImageAtlas>();
+				auto&	res_mngr	= GraphicsScheduler().GetResourceManager();
+
+				atlas->_imageId = res_mngr.CreateImage( unpacker.Header().ToDesc().SetUsage( EImageUsage::Sampled | EImageUsage::Transfer ), Default, alloc );
+				CHECK_PE( atlas->_imageId );
+
+				atlas->_viewId = res_mngr.CreateImageView( unpacker.Header().ToViewDesc(), atlas->_imageId, Default );
+				CHECK_PE( atlas->_viewId );
+
+				const Bytes	off = stream->Position();
+				atlas->_upload = MakeUnique<LoadableImage::UploadStream>( atlas->_imageId, unpacker.Header(), in.data + off, in.dataSize - off, in.rc );
+
+				atlas->_placeholder	 = placeholder;
+				atlas->_invImgSize	 = 1.0f / float2{unpacker.Header().dimension};
+				atlas->_nameToIdx	 = RVRef(unpacker.map);
+				atlas->_imageRects	 = RVRef(unpacker.rects);
+
+				return atlas;
+			},
+			"StaticImageAtlas::AsyncLoad",
+			ETaskQueue::Background );
+	}
+
+/*
+=================================================
+	Upload
+=================================================
+*/
+	bool  StaticImageAtlas::Upload (ITransferContext &ctx, Bytes maxSize) __NE___
+	{
+		if_unlikely( IsLoaded() )
+			return true;
+
+		CHECK_ERR( _upload->Upload( ctx, maxSize ));
+
+		if ( _upload->IsCompleted() )
+			_upload.reset();
+
+		return true;
+	}
+
 
 } // AE::Graphics
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "graphics/Public/CommandBuffer.h"
+#include "graphics_hl/Resources/LoadableImage.h"
 
 #include "AssetPackerImpl.h"
 
@@ -23,8 +24,10 @@ namespace AE::Graphics
 		using ImageMap_t	= AssetPacker::ImageAtlasPacker::ImageMap_t;
 		using ImageRects_t	= AssetPacker::ImageAtlasPacker::ImageRects_t;
 
+		// Image is created in background thread, data must be uploaded by 'Upload()',
+		// 'placeholder' view is returned by 'GetViewID()' until upload is complete.
 		struct AsyncLoader {
-		//	ND_ Promise<RC<StaticImageAtlas>>  Load (RC<AsyncRStream> stream) __NE___;
+			ND_ Promise<RC<StaticImageAtlas>>  Load (RC<AsyncRDataSource> file, GfxMemAllocatorPtr alloc, ImageViewID placeholder = Default) __NE___;
 		};
 
 		struct Loader {
@@ -40,6 +43,9 @@ namespace AE::Graphics
 		ImageMap_t				_nameToIdx;
 		ImageRects_t			_imageRects;
 
+		ImageViewID				_placeholder;
+		Unique<LoadableImage::UploadStream>	_upload;	// non-null until async upload is complete
+
 
 	// methods
 	public:
@@ -49,8 +55,13 @@ namespace AE::Graphics
 			bool  Get (ImageInAtlasName::Ref name, OUT RectI &region)	C_NE___;
 			bool  Get (ImageInAtlasName::Ref name, OUT RectF &region)	C_NE___;
 
+		// Async loader only.
+		// Returns 'false' on error. Image stays in 'CopyDst' state when upload is complete.
+		ND_ bool  Upload (ITransferContext &ctx, Bytes maxSize = UMax)	__NE___;
+		ND_ bool  IsLoaded ()											C_NE___	{ return _upload == null; }
+
 		ND_ ImageID			GetImageID ()								C_NE___	{ return _imageId; }
-		ND_ ImageViewID		GetViewID ()								C_NE___	{ return _viewId; }
+		ND_ ImageViewID		GetViewID ()								C_NE___	{ return IsLoaded() ? _viewId.Get() : _placeholder; }
 	};
 
 
@@ -92,7 +92,8 @@ namespace AE::UI
 */
 	void  ILayout::LayoutState::SetStyle (EStyleState value) __NE___
 	{
-		_style = value;
+		_dirty |= (_style != value);
+		_style  = value;
 	}
 //-----------------------------------------------------------------------------
 
@@ -109,6 +110,7 @@ namespace AE::UI
 									EType* types,
 									LayoutState* states,
 									Index_t* parentIdx,
+									DataOffset_t* dataOffsets,
 									usize count) __NE___
 	{
 		_ptr		= ptr;
@@ -118,6 +120,7 @@ namespace AE::UI
 		_types		= Offset_t( (Bytes{types}		- Bytes{ptr}) / BaseAlign );
 		_states		= Offset_t( (Bytes{states}		- Bytes{ptr}) / BaseAlign );
 		_parentIdx	= Offset_t( (Bytes{parentIdx}	- Bytes{ptr}) / BaseAlign );
+		_dataOffs	= Offset_t( (Bytes{dataOffsets}	- Bytes{ptr}) / BaseAlign );
 		_count		= Index_t(count);
 
 		ASSERT( _count == count );
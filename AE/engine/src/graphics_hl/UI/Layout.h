@@ -3,6 +3,7 @@
 	UI Layouts with data oriented design (DOD).
 	- Layout data stored sequentially for cache friendly access.
 	- Layout updated using pointer to static function - it is faster than virtual function call (2 cache misses vs 1).
+	- Only invalidated layouts and their childs are recalculated, layout is invalidated when data or style is changed.
 */
 
 #pragma once
@@ -129,6 +130,13 @@ namespace AE::UI
 
 			virtual void  AddChild (ChildPtr ptr)									__NE___;
 
+		// Layout and its childs will be recalculated in the next 'Widget::Update()'.
+		// Must be called when layout data or animation is changed.
+			void  Invalidate ()														__NE___	{ if ( _statePtr ) _statePtr->MarkDirty(); }
+
+		// Layout and its childs will be recalculated in each 'Widget::Update()' while animation is active.
+			void  SetAnimated (bool value)											__NE___	{ if ( _statePtr ) _statePtr->SetAnimated( value ); }
+
 
 		// helpers
 		ND_ RectF const&	LocalRect ()											C_NE___;
@@ -180,6 +188,8 @@ namespace AE::UI
 		float2			_globalPos;
 		RectF			_local;			// TODO: local size, pos
 		EStyleState		_style		= Default;
+		mutable bool	_dirty		= true;		// layout must be recalculated with all childs
+		mutable bool	_animated	= false;	// layout is recalculated in each update
 
 
 	// methods
@@ -190,6 +200,12 @@ namespace AE::UI
 		ND_ RectF const		GlobalRect ()											C_NE___	{ return RectF{ _local.Size() } + _globalPos; }
 		ND_ RectF const&	LocalRect ()											C_NE___	{ return _local; }
 		ND_ EStyleState		StyleFlags ()											C_NE___	{ return _style; }
+		ND_ bool			IsDirty ()												C_NE___	{ return _dirty; }
+		ND_ bool			IsAnimated ()											C_NE___	{ return _animated; }
+
+		void  MarkDirty ()															C_NE___	{ _dirty = true; }
+		void  SetAnimated (bool value)												C_NE___	{ _animated = value;  _dirty = true; }
+		void  ClearDirty ()															__NE___	{ _dirty = false; }
 
 		void  Update (const LayoutState &parentState, const RectF &localRect)		__NE___;
 		void  UpdateAndFitParent (const LayoutState &parentState, RectF localRect)	__NE___;
@@ -209,8 +225,9 @@ namespace AE::UI
 	{
 	// types
 	public:
-		using Offset_t	= ushort;
-		using Index_t	= ushort;
+		using Offset_t		= ushort;
+		using Index_t		= ushort;
+		using DataOffset_t	= uint;		// offset of layout data from 'DataBegin()'
 
 		static constexpr Bytes	BaseAlign {AE_CACHE_LINE};
 
@@ -218,6 +235,7 @@ namespace AE::UI
 		StaticAssert( BaseAlign >= AlignOf<EType> );
 		StaticAssert( BaseAlign >= AlignOf<LayoutState> );
 		StaticAssert( BaseAlign >= AlignOf<Index_t> );
+		StaticAssert( BaseAlign >= AlignOf<DataOffset_t> );
 
 	// variables
 	private:
@@ -228,6 +246,7 @@ namespace AE::UI
 		Offset_t	_types			= UMax;
 		Offset_t	_states			= UMax;
 		Offset_t	_parentIdx		= UMax;
+		Offset_t	_dataOffs		= UMax;
 		Index_t		_count			= UMax;
 
 
@@ -248,6 +267,7 @@ namespace AE::UI
 		ND_ LayoutState *		States ()							C_NE___	{ return Cast<LayoutState>( _ptr + _StatesOffset() ); }
 		ND_ LayoutState &		State (usize idx)					C_NE___	{ ASSERT( idx < _count );  return States()[ idx ]; }
 		ND_ uint				Count ()							C_NE___	{ return _count; }
+		ND_ void *				NodeData (usize idx)				C_NE___	{ ASSERT( idx < _count );  return DataBegin() + Bytes{Cast<DataOffset_t>( _ptr + _DataOffsetsOffset() )[idx]}; }
 
 		ND_ LayoutState const&	ParentState (usize idx)				C_NE___	{ ASSERT( idx < _count );  return State( _ParentIndex( idx )); }
 		ND_ RectF const&		ParentClipRect (usize idx)			C_NE___	{ ASSERT( idx < _count );  return ClipRect( _ParentIndex( idx )); }
@@ -259,6 +279,7 @@ namespace AE::UI
 					EType*			types,
 					LayoutState*	states,
 					Index_t*		parentIdx,
+					DataOffset_t*	dataOffsets,
 					usize			count)							__NE___;
 
 	private:
@@ -270,6 +291,7 @@ namespace AE::UI
 		ND_ Bytes	_TypesOffset ()									C_NE___	{ return _types		* BaseAlign; }
 		ND_ Bytes	_StatesOffset ()								C_NE___	{ return _states	* BaseAlign; }
 		ND_ Bytes	_ParentIndexOffset ()							C_NE___	{ return _parentIdx	* BaseAlign; }
+		ND_ Bytes	_DataOffsetsOffset ()							C_NE___	{ return _dataOffs	* BaseAlign; }
 	};
 
 
@@ -300,8 +322,8 @@ namespace AE::UI
 		explicit FixedLayoutTmpl (Ptr<IAllocator> alloc)			__NE___ : ILayout{alloc} {}
 
 		ND_ RectF const&	GetRegion ()							C_NE___	{ return _data->region; }
-			void			SetRegion (const RectF &value)			__NE___	{ _data->region = value; }
-			void			Move (const float2 &delta)				__NE___	{ _data->region += delta; }
+			void			SetRegion (const RectF &value)			__NE___	{ _data->region = value;  Invalidate(); }
+			void			Move (const float2 &delta)				__NE___	{ _data->region += delta;  Invalidate(); }
 
 		// ILayout //
 		bool	PreInit (const PreInitParams &)						C_NE_OV;
@@ -344,8 +366,8 @@ namespace AE::UI
 		explicit PaddingLayoutTmpl (Ptr<IAllocator> alloc)			__NE___ : ILayout{alloc} {}
 
 			void			SetPadding (float value)				__NE___	{ SetPaddingX( value, value );  SetPaddingY( value, value ); }
-			void			SetPaddingX (float left, float right)	__NE___	{ _data->x = float2{left, right}; }
-			void			SetPaddingY (float bottom, float top)	__NE___	{ _data->y = float2{bottom, top}; }
+			void			SetPaddingX (float left, float right)	__NE___	{ _data->x = float2{left, right};  Invalidate(); }
+			void			SetPaddingY (float bottom, float top)	__NE___	{ _data->y = float2{bottom, top};  Invalidate(); }
 		ND_ float2 const&	GetPaddingX ()							C_NE___	{ return _data->x; }
 		ND_ float2 const&	GetPaddingY ()							C_NE___	{ return _data->y; }
 
@@ -390,8 +412,8 @@ namespace AE::UI
 	public:
 		explicit AlignedLayoutTmpl (Ptr<IAllocator> alloc)			__NE___ : ILayout{alloc} {}
 
-			void			SetSize (const float2 &value)			__NE___	{ _data->size  = value; }
-			void			SetAlign (ELayoutAlign value)			__NE___	{ _data->align = value; }
+			void			SetSize (const float2 &value)			__NE___	{ _data->size  = value;  Invalidate(); }
+			void			SetAlign (ELayoutAlign value)			__NE___	{ _data->align = value;  Invalidate(); }
 		ND_ float2 const&	GetSize ()								C_NE___	{ return _data->size; }
 		ND_ ELayoutAlign	GetAlign ()								C_NE___	{ return _data->align; }
 
@@ -456,7 +478,7 @@ namespace AE::UI
 	public:
 		explicit FillStackLayout (Ptr<IAllocator> alloc)			__NE___	: ILayout{ alloc, UMax } {}
 
-			void			SetOrigin (EStackOrigin value)			__NE___	{ _data->origin = value; }
+			void			SetOrigin (EStackOrigin value)			__NE___	{ _data->origin = value;  _data->arranged = false;  Invalidate(); }
 		ND_ EStackOrigin	GetOrigin ()							C_NE___	{ return _data->origin; }
 
 		// ILayout //
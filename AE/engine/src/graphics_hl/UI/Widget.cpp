@@ -86,6 +86,7 @@ namespace AE::UI
 			Unused( mem.Reserve( SizeOf<LayoutType_t>			* view_count, LayoutData_t::BaseAlign ));	// _types
 			Unused( mem.Reserve( SizeOf<LayoutState_t>			* view_count, LayoutData_t::BaseAlign ));	// _states
 			Unused( mem.Reserve( SizeOf<LayoutData_t::Index_t>	* view_count, LayoutData_t::BaseAlign ));	// _parentIdx
+			Unused( mem.Reserve( SizeOf<LayoutData_t::DataOffset_t>	* view_count, LayoutData_t::BaseAlign ));	// _dataOffs
 			mem.AlignTo( LayoutData_t::BaseAlign );
 
 			req_size = mem.AllocatedSize();
@@ -101,7 +102,9 @@ namespace AE::UI
 		auto*		type_ptr	= Cast<LayoutType_t>(			mem2.Reserve( SizeOf<LayoutType_t>			* view_count, LayoutData_t::BaseAlign ));
 		auto*		state_ptr	= Cast<LayoutState_t>(			mem2.Reserve( SizeOf<LayoutState_t>			* view_count, LayoutData_t::BaseAlign ));
 		auto*		parent_ptr	= Cast<LayoutData_t::Index_t>(	mem2.Reserve( SizeOf<LayoutData_t::Index_t>	* view_count, LayoutData_t::BaseAlign ));
+		auto*		doff_ptr	= Cast<LayoutData_t::DataOffset_t>(	mem2.Reserve( SizeOf<LayoutData_t::DataOffset_t>	* view_count, LayoutData_t::BaseAlign ));
 		void*		data_ptr	= mem2.Reserve( 0_b, LayoutData_t::BaseAlign );
+		const Bytes	data_begin	= mem2.AllocatedSize();
 
 		CHECK_ERR( mem2.AllocatedSize() < mem2.MaxSize() );
 
@@ -127,6 +130,8 @@ namespace AE::UI
 				const auto	parent_info	= view_idx_map[parent];
 				auto&		view_info	= view_idx_map[layout];
 
+				doff_ptr[view_idx] = LayoutData_t::DataOffset_t( mem2.AllocatedSize() - data_begin );
+
 				layout->Init( params );
 				ILayout::LayoutStateAccess::Set( *layout, &state_ptr[view_idx] );
 
@@ -171,7 +176,7 @@ namespace AE::UI
 		_layoutData.Set(
 			mem2.Data(),
 			data_ptr, mem2.Data() + mem2.AllocatedSize(),
-			rect_ptr, type_ptr, state_ptr, parent_ptr,
+			rect_ptr, type_ptr, state_ptr, parent_ptr, doff_ptr,
 			view_count );
 
 		_requireUpdate = true;
@@ -303,35 +308,69 @@ namespace AE::UI
 			}
 		}
 
-	//	if ( not _requireUpdate )
-	//		return;
+		// resize all
+		if ( _requireUpdate or Any( _surfSize != surfSize ) or _mmToPx != mmToPx )
+		{
+			_requireUpdate	= false;
+			_surfSize		= surfSize;
+			_mmToPx			= mmToPx;
+			ldata.State(0).MarkDirty();
+		}
 
-		_requireUpdate = false;
+		_layoutChanged = false;
 
 		// update layouts
 		{
-			void*	data_ptr = ldata.DataBegin();
+			// animated layouts are invalidated in each frame
+			if ( ldata.State(0).IsAnimated() )
+				ldata.State(0).MarkDirty();
+
+			if ( ldata.State(0).IsDirty() )
 			{
+				void*			data_ptr = ldata.NodeData(0);
 				LayoutState_t	parent_state{ RectF{surfSize}, EStyleState::Unknown };
 				ILayout::CallUpdateFn( ldata.Type(0), INOUT data_ptr, parent_state, mmToPx, INOUT ldata.State(0) );
 			}
 
 			for (uint idx = 1; idx < cnt; ++idx)
 			{
-				// TODO: animation
+				auto&			state			= ldata.State(idx);
+				auto const&		parent_state	= ldata.ParentState(idx);
+
+				if_unlikely( state.IsAnimated() )
+					state.MarkDirty();
+
+				if_likely( not (state.IsDirty() or parent_state.IsDirty()) )
+					continue;
 
-				ASSERT( data_ptr < ldata.DataEnd() );
-				ILayout::CallUpdateFn( ldata.Type(idx), INOUT data_ptr, ldata.ParentState(idx), mmToPx, INOUT ldata.State(idx) );
+				void*	data_ptr = ldata.NodeData(idx);
+				ILayout::CallUpdateFn( ldata.Type(idx), INOUT data_ptr, parent_state, mmToPx, INOUT state );
+				ASSERT( data_ptr <= ldata.DataEnd() );
+
+				// childs will be updated too
+				state.MarkDirty();
 			}
 		}
 
 		// update clip rects
 		{
-			ldata.ClipRect(0) = ldata.State(0).GlobalRect();
+			if ( auto& state = ldata.State(0);  state.IsDirty() )
+			{
+				ldata.ClipRect(0) = state.GlobalRect();
+				state.ClearDirty();
+				_layoutChanged = true;
+			}
 
+			// parent state is already cleared, but dirty flag is propagated to childs in previous pass
 			for (uint idx = 1; idx < cnt; ++idx)
 			{
-				ldata.ClipRect(idx) = Crop( ldata.ParentClipRect(idx), ldata.State(idx).GlobalRect() );
+				auto&	state = ldata.State(idx);
+				if ( state.IsDirty() )
+				{
+					ldata.ClipRect(idx) = Crop( ldata.ParentClipRect(idx), state.GlobalRect() );
+					state.ClearDirty();
+					_layoutChanged = true;
+				}
 			}
 		}
 	}
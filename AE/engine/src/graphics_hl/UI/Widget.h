@@ -2,6 +2,9 @@
 /*
 	Widget contains collection of Views.
 	Layouts are sorted for best performance when updated (calculated location and size).
+	Layouts are sorted in breadth-first order, so parent is always updated before childs,
+	only invalidated layouts and their childs are updated (see 'ILayout::Invalidate()'),
+	animated layouts are updated in each frame (see 'ILayout::SetAnimated()').
 	Drawables are sorted for correct draw order and low state changes.
 	Controllers are sorted for correct input processing order.
 */
@@ -70,7 +73,10 @@ namespace AE::UI
 
 	// variables
 	private:
-		bool					_requireUpdate	= false;
+		bool					_requireUpdate	= false;		// update all layouts
+		bool					_layoutChanged	= false;
+		float2					_surfSize;
+		float					_mmToPx			= 0.f;
 		LayoutData_t			_layoutData;
 		DrawableArray_t			_drawables;
 		ControllerArray_t		_controllers;
@@ -109,6 +115,9 @@ namespace AE::UI
 		ND_ RectF const			GlobalRect ()														C_NE___;
 		ND_ bool				IsOpaque ()															C_NE___	{ return true; }	// TODO
 
+		// Returns 'true' if at least one layout was recalculated in the last 'Update()' call.
+		ND_ bool				IsLayoutChanged ()													C_NE___	{ return _layoutChanged; }
+
 		ND_ Allocator_t&		GetAllocator ()														__NE___	{ return _allocator; }
 		ND_ TempAllocator_t*	GetTempAllocator ()													__NE___	{ return _tempAllocator.get(); }
 
@@ -7,6 +7,7 @@
 namespace AE::Networking
 {
 	using namespace AE::Base;
+	using AE::Threading::ETaskQueue;
 
 
 	//
@@ -32,7 +33,8 @@ namespace AE::Networking
 		static constexpr uint		MaxMsgGroupsPerFrame	{8};
 		static constexpr uint		CSMessageUID_Bits		{14};
 
-		static constexpr uint		TCP_Reliable_MaxClients	{16};
+		static constexpr uint		TCP_Reliable_MaxClients	{16};	// per shard
+		static constexpr uint		MaxServerShards			{8};
 	};
 
 
@@ -41,11 +41,16 @@ namespace AE::Networking
 =================================================
 */
 	bool  BaseClient::_AddChannelReliableTCP (StringView dbgName) __NE___
+	{
+		return _AddChannelReliableTCP( Default, dbgName );
+	}
+
+	bool  BaseClient::_AddChannelReliableTCP (EChannelEncoding encoding, StringView dbgName) __NE___
 	{
 		auto&	dst = _channels[ uint(EChannel::Reliable) ];
 		CHECK_ERR( not dst );
 
-		auto	channel = TcpClientChannel::ClientAPI::Create( _msgFactory, _allocator, _serverProvider, True{"reliable"}, dbgName );
+		auto	channel = TcpClientChannel::ClientAPI::Create( _msgFactory, _allocator, _serverProvider, True{"reliable"}, encoding, dbgName );
 		CHECK_ERR( channel );
 
 		dst = RVRef(channel);
@@ -62,7 +67,7 @@ namespace AE::Networking
 		auto&	dst = _channels[ uint(EChannel::Unreliable) ];
 		CHECK_ERR( not dst );
 
-		auto	channel = TcpClientChannel::ClientAPI::Create( _msgFactory, _allocator, _serverProvider, False{"unreliable"}, dbgName );
+		auto	channel = TcpClientChannel::ClientAPI::Create( _msgFactory, _allocator, _serverProvider, False{"unreliable"}, Default, dbgName );
 		CHECK_ERR( channel );
 
 		dst = RVRef(channel);
@@ -30,6 +30,7 @@ namespace AE::Networking
 			void  _Deinitialize ()														__NE___;
 
 		ND_ bool  _AddChannelReliableTCP (StringView dbgName = Default)					__NE___;
+		ND_ bool  _AddChannelReliableTCP (EChannelEncoding, StringView dbgName = Default)	__NE___;
 		ND_ bool  _AddChannelUnreliableTCP (StringView dbgName = Default)				__NE___;
 	//	ND_ bool  _AddChannelUnreliableUDP (ushort port, StringView dbgName = Default)	__NE___;
 
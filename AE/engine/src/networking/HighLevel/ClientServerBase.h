@@ -1,6 +1,9 @@
 // Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
 /*
 	thread-safe: no
+
+	Channels may process clients in parallel (see TcpShardedServerChannel),
+	but producers and consumers are always called in the thread which calls 'Update()'.
 */
 
 #pragma once
@@ -15,6 +15,20 @@ namespace AE::Networking
 	class IClientListener;
 
 
+	//
+	// Channel Encoding
+	//
+	enum class EChannelEncoding : ubyte
+	{
+		None		= 0,
+		LZ4			= 1 << 0,	// compress message payload
+		Delta		= 1 << 1,	// XOR with previous message with the same UID and compress, requires ordered channel and LZ4
+		All			= LZ4 | Delta,
+		Unknown		= None,
+	};
+	AE_BIT_OPERATORS( EChannelEncoding );
+
+
 
 	//
 	// Channel interface
@@ -32,6 +46,12 @@ namespace AE::Networking
 		{
 			uint	incompleteOutput	= 0;
 
+			// includes message headers
+			Bytes	rawOutput;			// size of messages before compression
+			Bytes	packedOutput;		// size of data which is written to the stream
+			Bytes	rawInput;			// size of messages after decompression
+			Bytes	packedInput;		// size of data which is read from the stream
+
 			MsgQueueStatistic ()			__NE___ {}
 
 			ND_ explicit operator bool ()	C_NE___	{ return incompleteOutput == 0; }
@@ -12,7 +12,8 @@ namespace AE::Networking
 */
 	MessageFactory::MessageFactory () __NE___
 	{
-		for (auto& alloc : _dbAlloc) {
+		for (auto& shard : _dbAlloc)
+		for (auto& alloc : shard) {
 			alloc = MakeRC< Allocator_t >();
 		}
 	}
@@ -59,7 +60,7 @@ namespace AE::Networking
 	DeserializeMsg
 =================================================
 */
-	bool  MessageFactory::DeserializeMsg (const FrameUID frameId, const CSMessageUID uid, EClientLocalID cid, OUT MsgPtr_t &msg, DataDecoder &des) __NE___
+	bool  MessageFactory::DeserializeMsg (const FrameUID frameId, const CSMessageUID uid, EClientLocalID cid, OUT MsgPtr_t &msg, DataDecoder &des, const uint shard) __NE___
 	{
 		auto [group_id, msg_id] = CSMessage::_UnpackUID( uid );
 
@@ -76,7 +77,7 @@ namespace AE::Networking
 			fn = it->second;
 		}
 
-		return fn( OUT msg, GetAllocator( frameId ), cid, des );
+		return fn( OUT msg, GetAllocator( frameId, shard ), cid, des );
 	}
 
 /*
@@ -88,7 +89,9 @@ namespace AE::Networking
 	{
 		const uint	id = frameId.Remap2();
 
-		_dbAlloc[id]->Discard();
+		for (auto& shard : _dbAlloc) {
+			shard[id]->Discard();
+		}
 
 		DEBUG_ONLY(
 			_dbFrameId[id].store( frameId );
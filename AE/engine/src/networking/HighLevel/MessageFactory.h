@@ -170,6 +170,7 @@ namespace AE::Networking
 		using Allocator_t			= Threading::LfLinearAllocator< usize{4_Mb}, usize{16_b}, 16 >;
 
 		using DoubleBufAlloc_t		= StaticArray< RC<Allocator_t>, 2 >;
+		using ShardAlloc_t			= StaticArray< DoubleBufAlloc_t, NetConfig::MaxServerShards >;
 		using DoubleBufFrameId_t	= StaticArray< AtomicFrameUID, 2 >;
 
 		struct MsgGroup
@@ -185,7 +186,7 @@ namespace AE::Networking
 
 	// variables
 	private:
-		DoubleBufAlloc_t		_dbAlloc;
+		ShardAlloc_t			_dbAlloc;		// separate arena per server shard to avoid contention
 
 		MsgTypes_t				_msgTypes;
 
@@ -212,14 +213,14 @@ namespace AE::Networking
 
 		// message constructors //
 		ND_ bool	DeserializeMsg (FrameUID, CSMessageUID, EClientLocalID,
-									OUT MsgPtr_t &, DataDecoder &)						__NE___;
+									OUT MsgPtr_t &, DataDecoder &, uint shard = 0)		__NE___;
 
 
 		// client/server api //
 			void	NextFrame (FrameUID frameId)										__NE___;
 
 		// utils //
-		ND_ IAllocator&  GetAllocator (FrameUID frameId)								__NE___;
+		ND_ IAllocator&  GetAllocator (FrameUID frameId, uint shard = 0)				__NE___;
 	};
 //-----------------------------------------------------------------------------
 
@@ -486,10 +487,11 @@ namespace AE::Networking
 	GetAllocator
 =================================================
 */
-	inline IAllocator&  MessageFactory::GetAllocator (const FrameUID frameId) __NE___
+	inline IAllocator&  MessageFactory::GetAllocator (const FrameUID frameId, const uint shard) __NE___
 	{
+		ASSERT( shard < _dbAlloc.size() );
 		const uint	id = frameId.Remap2();
-		return *_dbAlloc[id];
+		return *_dbAlloc[shard][id];
 	}
 
 
@@ -2,6 +2,7 @@
 
 #include "networking/HighLevel/Server.h"
 #include "networking/HighLevel/TcpChannel.h"
+#include "networking/HighLevel/TcpShardedChannel.h"
 #include "networking/HighLevel/UdpUnreliable.h"
 
 namespace AE::Networking
@@ -41,11 +42,16 @@ namespace AE::Networking
 =================================================
 */
 	bool  BaseServer::_AddChannelReliableTCP (ushort port, StringView dbgName) __NE___
+	{
+		return _AddChannelReliableTCP( port, Default, dbgName );
+	}
+
+	bool  BaseServer::_AddChannelReliableTCP (ushort port, EChannelEncoding encoding, StringView dbgName) __NE___
 	{
 		auto&	dst = _channels[ uint(EChannel::Reliable) ];
 		CHECK_ERR( not dst );
 
-		auto	channel = TcpServerChannel::ServerAPI::Create( _msgFactory, _allocator, _clientListener, port, UMax, True{"reliable"}, dbgName );
+		auto	channel = TcpServerChannel::ServerAPI::Create( _msgFactory, _allocator, _clientListener, port, UMax, True{"reliable"}, encoding, dbgName );
 		CHECK_ERR( channel );
 
 		dst = RVRef(channel);
@@ -62,7 +68,24 @@ namespace AE::Networking
 		auto&	dst = _channels[ uint(EChannel::Unreliable) ];
 		CHECK_ERR( not dst );
 
-		auto	channel = TcpServerChannel::ServerAPI::Create( _msgFactory, _allocator, _clientListener, port, UMax, False{"unreliable"}, dbgName );
+		auto	channel = TcpServerChannel::ServerAPI::Create( _msgFactory, _allocator, _clientListener, port, UMax, False{"unreliable"}, Default, dbgName );
+		CHECK_ERR( channel );
+
+		dst = RVRef(channel);
+		return true;
+	}
+
+/*
+=================================================
+	_AddShardedChannelReliableTCP
+=================================================
+*/
+	bool  BaseServer::_AddShardedChannelReliableTCP (ushort port, uint shardCount, ETaskQueue queue, EChannelEncoding encoding, StringView dbgName) __NE___
+	{
+		auto&	dst = _channels[ uint(EChannel::Reliable) ];
+		CHECK_ERR( not dst );
+
+		auto	channel = TcpShardedServerChannel::ServerAPI::Create( _msgFactory, _allocator, _clientListener, port, shardCount, queue, True{"reliable"}, encoding, dbgName );
 		CHECK_ERR( channel );
 
 		dst = RVRef(channel);
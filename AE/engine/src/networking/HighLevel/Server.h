@@ -30,7 +30,13 @@ namespace AE::Networking
 			void  _Deinitialize ()														__NE___;
 
 		ND_ bool  _AddChannelReliableTCP (ushort port, StringView dbgName = Default)	__NE___;
+		ND_ bool  _AddChannelReliableTCP (ushort port, EChannelEncoding,
+										  StringView dbgName = Default)					__NE___;
 		ND_ bool  _AddChannelUnreliableTCP (ushort port, StringView dbgName = Default)	__NE___;
+
+		// Clients are distributed across 'shardCount' shards which are processed in parallel in 'queue' tasks.
+		ND_ bool  _AddShardedChannelReliableTCP (ushort port, uint shardCount, ETaskQueue queue,
+												 EChannelEncoding = Default, StringView dbgName = Default)	__NE___;
 	//	ND_ bool  _AddChannelUnreliableUDP (ushort port, StringView dbgName = Default)	__NE___;
 
 		ND_ bool  _DisconnectClient (EClientLocalID)									__NE___;
@@ -52,6 +58,7 @@ namespace AE::Networking
 		//
 		// Thread-safe:
 		//	Can be used in multiple threads but not in concurrent when used in single client/server.
+		//	Sharded server channel calls 'OnClientDisconnected()' concurrently from shard tasks.
 		//
 		ND_ virtual EClientLocalID  OnClientConnected (EChannel, const IpAddress &)		__NE___ = 0;
 		ND_ virtual EClientLocalID  OnClientConnected (EChannel, const IpAddress6 &)	__NE___ = 0;
@@ -3,6 +3,7 @@
 #include "networking/HighLevel/TcpChannel.h"
 #include "networking/HighLevel/Client.h"
 #include "networking/HighLevel/Server.h"
+#include "base/DataSource/Lz4Stream.h"
 
 namespace AE::Networking
 {
@@ -23,11 +24,12 @@ namespace {
 
 		_MsgHeader () __NE___ = default;
 
-		_MsgHeader (Bytes size, CSMessageUID msgId) __NE___ :
-			_magic{ uint(_magicByte) },
+		_MsgHeader (char magic, Bytes size, CSMessageUID msgId) __NE___ :
+			_magic{ uint(magic) },
 			_size{ uint(size) },
 			_msgId{ uint(msgId) }
 		{
+			ASSERT( Magic() == magic );
 			ASSERT( Size() == size );
 			ASSERT( Id() == msgId );
 		}
@@ -35,6 +37,8 @@ namespace {
 		ND_ Bytes			Size ()		C_NE___	{ return Bytes{_size}; }
 		ND_ CSMessageUID	Id ()		C_NE___	{ return CSMessageUID(_msgId); }
 		ND_ char			Magic ()	C_NE___	{ return char(_magic); }
+
+		ND_ bool			IsValid ()	C_NE___	{ return Magic() >= _magicByte and Magic() <= _magicHandshake; }
 	};
 
 /*
@@ -59,6 +63,20 @@ namespace {
 		queue.clear();
 	}
 
+/*
+=================================================
+	EncodingState::Reset
+=================================================
+*/
+	void  TcpChannel::EncodingState::Reset (EChannelEncoding req) __NE___
+	{
+		requested	= req;
+		active		= Default;
+		handshake	= NullOptional;
+		sent.clear();
+		received.clear();
+	}
+
 /*
 =================================================
 	constructor
@@ -84,16 +102,148 @@ namespace {
 
 /*
 =================================================
-	_SendMessages
+	_SupportedEncoding
 =================================================
 */
-	void  TcpChannel::_SendMessages (TcpSocket &socket, MsgListIter_t &lastSendMsg, const EClientLocalID clientId, INOUT bool &isDisconnected) __NE___
+	EChannelEncoding  TcpChannel::_SupportedEncoding (EChannelEncoding encoding) __NE___
 	{
-		if_unlikely( _toSend.queue.empty() )
-			return;
+	#ifdef AE_ENABLE_LZ4
+		// delta encoding is useless without compression
+		if ( AllBits( encoding, EChannelEncoding::Delta ))
+			encoding |= EChannelEncoding::LZ4;
+
+		return encoding & EChannelEncoding::All;
+	#else
+		Unused( encoding );
+		return EChannelEncoding::None;
+	#endif
+	}
+
+/*
+=================================================
+	_PackMsg
+----
+	returns header magic
+=================================================
+*/
+	char  TcpChannel::_PackMsg (EncodingState &state, const CSMessageUID msgId, INOUT void* data, INOUT Bytes &size) __NE___
+	{
+	#ifdef AE_ENABLE_LZ4
+		if_likely( state.active == Default )
+			return _magicByte;
+
+		const void*	src		= data;
+		char		magic	= _magicLz4;
+
+		if ( AllBits( state.active, EChannelEncoding::Delta ))
+		{
+			auto&	prev = state.sent[ msgId ];
+
+			if ( prev.size() == usize(size) )
+			{
+				const ubyte*	curr = Cast<ubyte>( data );
+				for (usize i = 0; i < prev.size(); ++i) {
+					_unpackedBuf[i] = prev[i] ^ curr[i];
+				}
+				src		= _unpackedBuf.data();
+				magic	= _magicDelta;
+			}
+			prev.assign( Cast<ubyte>(data), Cast<ubyte>(data) + usize(size) );
+		}
+
+		if ( magic == _magicLz4 and size < _minSizeToCompress )
+			return _magicByte;
+
+		Bytes	packed_size = Sizeof(_packedBuf);
+		if_unlikely( not Lz4Utils::Compress( OUT _packedBuf.data(), INOUT packed_size, src, size ))
+			return _magicByte;
+
+		// use compressed data only if it is smaller
+		if ( packed_size >= size )
+			return _magicByte;
+
+		MemCopy( OUT data, _packedBuf.data(), packed_size );
+		size = packed_size;
+		return magic;
+
+	#else
+		Unused( state, msgId, data, size );
+		return _magicByte;
+	#endif
+	}
+
+/*
+=================================================
+	_UnpackMsg
+=================================================
+*/
+	bool  TcpChannel::_UnpackMsg (EncodingState &state, const char magic, const CSMessageUID msgId, INOUT const void* &data, INOUT Bytes &size) __NE___
+	{
+		switch ( magic )
+		{
+			case _magicByte :
+				break;
+
+		  #ifdef AE_ENABLE_LZ4
+			case _magicLz4 :
+			case _magicDelta :
+			{
+				Bytes	unpacked_size = _maxMsgSize;
+				CHECK_ERR( Lz4Utils::Decompress( OUT _unpackedBuf.data(), INOUT unpacked_size, data, size ));
+
+				if ( magic == _magicDelta )
+				{
+					auto	it = state.received.find( msgId );
+					CHECK_ERR( it != state.received.end() );
+					CHECK_ERR( it->second.size() == usize(unpacked_size) );
+
+					const auto&	prev = it->second;
+					for (usize i = 0; i < prev.size(); ++i) {
+						_unpackedBuf[i] ^= prev[i];
+					}
+				}
+
+				data	= _unpackedBuf.data();
+				size	= unpacked_size;
+				break;
+			}
+		  #endif
+
+			default :
+				RETURN_ERR( "unsupported message encoding" );
+		}
+
+		if ( AllBits( state.active, EChannelEncoding::Delta ))
+			state.received[ msgId ].assign( Cast<ubyte>(data), Cast<ubyte>(data) + usize(size) );
 
+		return true;
+	}
+
+/*
+=================================================
+	_SendMessages
+=================================================
+*/
+	void  TcpChannel::_SendMessages (TcpSocket &socket, MsgListIter_t &lastSendMsg, const EClientLocalID clientId,
+									 EncodingState &state, INOUT MsgQueueStatistic &stat, INOUT bool &isDisconnected) __NE___
+	{
 		auto&		storage			= _toSend.storage;
 		Bytes		encoded			= _toSend.encoded;		// offset in 'storage' to the end of encoded messages
+
+		// handshake must be sent before any encoded messages
+		if_unlikely( state.handshake.has_value() and encoded + SizeOf<_MsgHeader> <= storage.Size() )
+		{
+			_MsgHeader	header { _magicHandshake, 0_b, CSMessageUID(*state.handshake) };
+			MemCopy( OUT storage.Ptr( encoded ), &header, Sizeof(header) );
+
+			encoded			+= SizeOf<_MsgHeader>;
+			_toSend.encoded	 = encoded;
+			state.handshake	 = NullOptional;
+		}
+
+		if_unlikely( _toSend.queue.empty() and encoded == 0 )
+			return;
+
 		Bytes		pending;								// offset in 'storage' to begin of data which can be sent
 		const auto	end_it			= _toSend.queue.end();
 		auto		last_failed_it	= end_it;
@@ -184,12 +334,17 @@ namespace {
 				{
 					ASSERT_LE( enc.RemainingSize(), _maxMsgSize );
 
-					_MsgHeader	header { _maxMsgSize - enc.RemainingSize(), (*it)->UniqueId() };
+					const Bytes	raw_size	= _maxMsgSize - enc.RemainingSize();
+					Bytes		msg_size	= raw_size;
+					const char	magic		= _PackMsg( state, (*it)->UniqueId(), INOUT storage.Ptr( msg_off ), INOUT msg_size );
+					_MsgHeader	header		{ magic, msg_size, (*it)->UniqueId() };
 
 					ASSERT( header.Size() <= _maxMsgSize );	// should never happens
 					MemCopy( OUT hdr_ptr, &header, Sizeof(header) );
 
-					encoded += SizeOf<_MsgHeader> + header.Size();
+					encoded				+= SizeOf<_MsgHeader> + header.Size();
+					stat.rawOutput		+= SizeOf<_MsgHeader> + raw_size;
+					stat.packedOutput	+= SizeOf<_MsgHeader> + header.Size();
 					++it;
 					break;
 				}
@@ -232,12 +387,13 @@ namespace {
 	_ReceiveMessages
 =================================================
 */
-	void  TcpChannel::_ReceiveMessages (TcpSocket &socket, const FrameUID frameId, const EClientLocalID clientId, INOUT bool &isDisconnected) __NE___
+	void  TcpChannel::_ReceiveMessages (TcpSocket &socket, const FrameUID frameId, const EClientLocalID clientId,
+										EncodingState &state, INOUT MsgQueueStatistic &stat, INOUT bool &isDisconnected) __NE___
 	{
 		auto&	storage		= _received.storage;
 		Bytes	received	= _received.received;	// offset in 'storage' to the end of received data
 		Bytes	decoded;							// offset in 'storage' to the begin of data which can be decoded, if enough size
-		auto&	allocator	= _msgFactory->GetAllocator( frameId );
+		auto&	allocator	= _msgFactory->GetAllocator( frameId, _shard );
 		bool	retry		= true;
 
 		//                |<---------->|- available for Receive()
@@ -271,21 +427,33 @@ namespace {
 						{
 							ASSERT( (received - decoded) < Sizeof(header)	or
 									header.Size() <= _maxMsgSize			or
-									header.Magic() == _magicByte );
+									header.IsValid() );
 
 							retry = true;
 							break;  // not enough data
 						}
 
-						DataDecoder		des{ storage.Ptr( decoded + sizeof(header) ), header.Size(), allocator };
+						const void*		msg_data	= storage.Ptr( decoded + sizeof(header) );
+						Bytes			msg_size	= header.Size();
 
 						ASSERT( header.Size() <= _maxMsgSize );
-						ASSERT( header.Magic() == _magicByte );
+						ASSERT( header.IsValid() );
 
 						decoded += sizeof(header) + header.Size();
 
-						if_unlikely( header.Magic() != _magicByte )
-							continue;  // invalid header - skip
+						if_unlikely( header.Magic() == _magicHandshake )
+						{
+							_OnHandshake( state, EChannelEncoding(header.Id()) );
+							continue;
+						}
+
+						if_unlikely( not _UnpackMsg( state, header.Magic(), header.Id(), INOUT msg_data, INOUT msg_size ))
+							continue;  // invalid header or corrupted data - skip
+
+						stat.packedInput	+= SizeOf<_MsgHeader> + header.Size();
+						stat.rawInput		+= SizeOf<_MsgHeader> + msg_size;
+
+						DataDecoder		des{ msg_data, msg_size, allocator };
 
 
 						// cache optimization:
@@ -309,7 +477,7 @@ namespace {
 
 						// create & decode message
 						CSMessagePtr	msg;
-						if_likely( _msgFactory->DeserializeMsg( frameId, header.Id(), clientId, OUT msg, des ))
+						if_likely( _msgFactory->DeserializeMsg( frameId, header.Id(), clientId, OUT msg, des, _shard ))
 						{
 							ASSERT( des.IsComplete() );
 							dst.last->emplace_back( msg );
@@ -415,7 +583,7 @@ namespace {
 
 			MemCopy( OUT &header, ptr + offset, Sizeof(header) );
 
-			ASSERT( header.Magic() == _magicByte );
+			ASSERT( header.IsValid() );
 			ASSERT( header.Size() <= _maxMsgSize );
 
 			if ( offset + Sizeof(header) + header.Size() > size )
@@ -470,6 +638,9 @@ namespace {
 					case TcpSocket::EStatus::Connected :
 						AE_LOG_DBG( "Connected client to TCP server: "s << _serverAddress.ToString() );
 						_status = EStatus::Connected;
+
+						if ( _encoding.requested != Default )
+							_encoding.handshake = _encoding.requested;
 						break;
 
 					case TcpSocket::EStatus::Connecting :
@@ -489,8 +660,8 @@ namespace {
 			{
 				bool	disconnected = false;
 
-				_ReceiveMessages( _socket, frameId, Default, INOUT disconnected );
-				_SendMessages( _socket, INOUT _lastSentMsg, Default, INOUT disconnected );
+				_ReceiveMessages( _socket, frameId, Default, _encoding, INOUT stat, INOUT disconnected );
+				_SendMessages( _socket, INOUT _lastSentMsg, Default, _encoding, INOUT stat, INOUT disconnected );
 
 				stat.incompleteOutput += uint(_lastSentMsg != Default);
 
@@ -526,6 +697,7 @@ namespace {
 		_status				= EStatus::Disconnected;
 		_toSend.encoded		= 0_b;
 		_received.received	= 0_b;
+		_encoding.Reset( _encoding.requested );
 
 		_serverProvider->GetAddress( c_TcpChannelType, _serverIndex, True{"TCP"}, OUT _serverAddress );
 
@@ -541,19 +713,32 @@ namespace {
 		}
 	}
 
+/*
+=================================================
+	_OnHandshake
+=================================================
+*/
+	void  TcpClientChannel::_OnHandshake (EncodingState &state, const EChannelEncoding accepted) __NE___
+	{
+		// server reply, all next messages from server may be encoded
+		state.active = accepted & state.requested;
+
+		AE_LOG_DBG( "TCP channel encoding: "s << ToString<16>(uint(state.active)) );
+	}
+
 /*
 =================================================
 	ClientAPI::Create
 =================================================
 */
 	RC<IChannel>  TcpClientChannel::ClientAPI::Create (RC<MessageFactory> mf, RC<IAllocator> alloc, RC<IServerProvider> serverProvider,
-													   Bool reliable, StringView dbgName) __NE___
+													   Bool reliable, EChannelEncoding encoding, StringView dbgName) __NE___
 	{
 		CHECK_ERR( mf );
 		CHECK_ERR( alloc );
 		CHECK_ERR( serverProvider );
 
-		RC<TcpClientChannel>	result{new TcpClientChannel{ RVRef(mf), RVRef(serverProvider), RVRef(alloc), reliable }};
+		RC<TcpClientChannel>	result{new TcpClientChannel{ RVRef(mf), RVRef(serverProvider), RVRef(alloc), reliable, encoding }};
 
 		CHECK_ERR( result->_IsValid() );
 
@@ -576,11 +761,14 @@ namespace {
 	TcpClientChannel::TcpClientChannel (RC<MessageFactory>	mf,
 										RC<IServerProvider>	serverProvider,
 										RC<IAllocator>		alloc,
-										Bool				reliable) __NE___ :
+										Bool				reliable,
+										EChannelEncoding	encoding) __NE___ :
 		TcpChannel{ RVRef(mf), RVRef(alloc) },
 		_reliable{ reliable },
 		_serverProvider{ RVRef(serverProvider) }
 	{
+		_encoding.Reset( _SupportedEncoding( encoding ));
+
 		_allocator->Reserve( NetConfig::ChannelStorageSize*2 );
 
 		_toSend  .storage.Alloc( NetConfig::ChannelStorageSize, DefaultAllocatorAlign, _allocator.get() );
@@ -645,11 +833,11 @@ namespace {
 
 		_received.ResetQueue();
 
+		// shard of 'TcpShardedServerChannel' has no listening socket
 		if_likely( _socket.IsOpen() )
-		{
 			_CheckNewConnections();
-			_UpdateClients( frameId, INOUT stat );
-		}
+
+		_UpdateClients( frameId, INOUT stat );
 	}
 
 /*
@@ -667,33 +855,49 @@ namespace {
 			if_likely( not client.Accept( _socket, OUT addr ))
 				break;
 
-			const int	idx = BitScanForward( ~_poolBits.to_ullong() );
-
-			if_unlikely( idx < 0 or idx >= int(_maxClients) )
+			if_unlikely( not _AddClient( client, addr ))
 				break;	// client pool overflow
+		}
+	}
 
-			if ( auto client_id = _listener->OnClientConnected( c_TcpChannelType, addr );  client_id != Default )
-			{
-				// save client
-				_poolBits.set( idx );
+/*
+=================================================
+	_AddClient
+----
+	Returns 'false' if client pool is full.
+	If client is rejected by listener then socket will be closed.
+=================================================
+*/
+	bool  TcpServerChannel::_AddClient (TcpSocket &client, const IpAddress &addr) __NE___
+	{
+		const int	idx = BitScanForward( ~_poolBits.to_ullong() );
 
-				auto&	dst		= _clientPool[idx];
-				dst.id			= client_id;
-				dst.lastSentMsg = _toSend.queue.begin();
+		if_unlikely( idx < 0 or idx >= int(_maxClients) )
+			return false;
 
-				DEBUG_ONLY( client.SetDebugName( String{_socket.GetDebugName()} << " client " << ToString<16>(uint(client_id)) );)
+		if ( auto client_id = _listener->OnClientConnected( c_TcpChannelType, addr );  client_id != Default )
+		{
+			// save client
+			_poolBits.set( idx );
 
-				Reconstruct( OUT dst.socket, RVRef(client) );
-				dst.socket.KeepAlive();
+			auto&	dst		= _clientPool[idx];
+			dst.id			= client_id;
+			dst.lastSentMsg = _toSend.queue.begin();
+			dst.encoding.Reset( _allowedEncoding );
 
-				CHECK( _clientAddrMap.insert_or_assign( addr, ClientIdx_t(idx) ).first );
+			DEBUG_ONLY( client.SetDebugName( String{_socket.GetDebugName()} << " client " << ToString<16>(uint(client_id)) );)
 
-				ASSERT( _uniqueClientId.insert( client_id ).second );
-				ASSERT( _uniqueClientId.size() == _clientAddrMap.size() );
+			Reconstruct( OUT dst.socket, RVRef(client) );
+			dst.socket.KeepAlive();
 
-				AE_LOG_DBG( "client ("s << ToString<16>(uint(client_id)) << ") connected, addr: " << addr.ToString() );
-			}
+			CHECK( _clientAddrMap.insert_or_assign( addr, ClientIdx_t(idx) ).first );
+
+			ASSERT( _uniqueClientId.insert( client_id ).second );
+			ASSERT( _uniqueClientId.size() == _clientAddrMap.size() );
+
+			AE_LOG_DBG( "client ("s << ToString<16>(uint(client_id)) << ") connected, addr: " << addr.ToString() );
 		}
+		return true;
 	}
 
 /*
@@ -719,7 +923,7 @@ namespace {
 					client.received		= 0_b;
 				}
 
-				_ReceiveMessages( client.socket, frameId, client.id, INOUT disconnected );
+				_ReceiveMessages( client.socket, frameId, client.id, client.encoding, INOUT stat, INOUT disconnected );
 
 				// Too much data, disconnect client to avoid message stream corruption.
 				if_unlikely( _received.received > _maxMsgSize )
@@ -744,7 +948,7 @@ namespace {
 				_toSend.encoded = client.encoded;
 				_toSend.storage	= RVRef(client.encodedStorage);
 
-				_SendMessages( client.socket, INOUT client.lastSentMsg, client.id, INOUT disconnected );
+				_SendMessages( client.socket, INOUT client.lastSentMsg, client.id, client.encoding, INOUT stat, INOUT disconnected );
 
 				stat.incompleteOutput += uint(client.lastSentMsg != Default);
 
@@ -757,6 +961,20 @@ namespace {
 		}
 	}
 
+/*
+=================================================
+	_OnHandshake
+=================================================
+*/
+	void  TcpServerChannel::_OnHandshake (EncodingState &state, const EChannelEncoding requested) __NE___
+	{
+		// all next messages from client may be encoded
+		state.active	= _SupportedEncoding( requested ) & state.requested;
+		state.handshake	= state.active;
+		state.sent.clear();
+		state.received.clear();
+	}
+
 /*
 =================================================
 	ServerAPI::Create
@@ -764,13 +982,14 @@ namespace {
 */
 	RC<IChannel>  TcpServerChannel::ServerAPI::Create (RC<MessageFactory> mf, RC<IAllocator> alloc,
 													   RC<IClientListener> listener,
-													   ushort port, uint maxConnections, Bool reliable, StringView dbgName) __NE___
+													   ushort port, uint maxConnections, Bool reliable,
+													   EChannelEncoding encoding, StringView dbgName) __NE___
 	{
 		CHECK_ERR( mf );
 		CHECK_ERR( alloc );
 		CHECK_ERR( listener );
 
-		RC<TcpServerChannel>	result	{new TcpServerChannel{ RVRef(mf), RVRef(listener), RVRef(alloc), reliable }};
+		RC<TcpServerChannel>	result	{new TcpServerChannel{ RVRef(mf), RVRef(listener), RVRef(alloc), reliable, encoding }};
 		TcpSocket::Config		cfg;	cfg.maxConnections = maxConnections;
 
 		CHECK_ERR( result->_IsValid() );
@@ -795,9 +1014,11 @@ namespace {
 	TcpServerChannel::TcpServerChannel (RC<MessageFactory>	mf,
 										RC<IClientListener>	listener,
 										RC<IAllocator>		alloc,
-										Bool				reliable) __NE___ :
+										Bool				reliable,
+										EChannelEncoding	encoding) __NE___ :
 		TcpChannel{ RVRef(mf), RVRef(alloc) },
 		_reliable{ reliable },
+		_allowedEncoding{ _SupportedEncoding( encoding )},
 		_listener{ RVRef(listener) }
 	{
 		_allocator->Reserve( NetConfig::ChannelStorageSize * (1 + _maxClients) + _maxMsgSize * _maxClients );
@@ -893,6 +1114,7 @@ namespace {
 		client.id		= Default;
 		client.received	= 0_b;
 		client.socket.FastClose();
+		client.encoding.Reset( _allowedEncoding );
 
 		_poolBits.reset( idx );
 
@@ -22,6 +22,15 @@
 
 		- Not an all messages will be decoded in 'ProcessMessages()'.
 			- Used the allocator from 'MessageFactory', if it runs out of memory, then decoding will stop.
+
+	Encoding:
+		- Client requests 'EChannelEncoding' in handshake header which is sent first after connection,
+		  server replies with intersection of requested and allowed encodings.
+		- Before handshake is completed messages are sent without encoding.
+		- LZ4:   message payload is compressed if result is smaller.
+		- Delta: payload is XOR'ed with the last sent payload with the same message UID and then compressed,
+				 TCP is ordered so the last sent message is always received before the current.
+				 Both sides keep copy of the last payload per message UID.
 */
 
 #pragma once
@@ -42,11 +51,17 @@ namespace AE::Networking
 		static constexpr Bytes		_maxMsgSize				= NetConfig::TCP_MaxMsgSize;
 	private:
 		static constexpr char		_magicByte				= '\x1A';
+		static constexpr char		_magicLz4				= '\x1B';
+		static constexpr char		_magicDelta				= '\x1C';
+		static constexpr char		_magicHandshake			= '\x1D';
 		static constexpr uint		_maxAttemptsToReceive	= 4;
 		static constexpr uint		_maxAttemptsToSend		= 4;
+		static constexpr Bytes		_minSizeToCompress		{64};
 
 		struct _MsgHeader;
 
+		using TempBuffer_t	= StaticArray< ubyte, usize(_maxMsgSize) * 2 >;	// enough for LZ4 worst case
+
 		struct SendQueue
 		{
 			MsgList_t				queue;
@@ -67,6 +82,20 @@ namespace AE::Networking
 			void  ResetQueue ()			__NE___;
 		};
 
+	protected:
+		struct EncodingState
+		{
+			using History_t = FlatHashMap< CSMessageUID, Array<ubyte> >;
+
+			EChannelEncoding			requested	= Default;	// client: requested, server: allowed
+			EChannelEncoding			active		= Default;	// negotiated
+			Optional<EChannelEncoding>	handshake;				// must be sent before messages
+			History_t					sent;					// last payload per message UID, for delta encoding
+			History_t					received;
+
+			void  Reset (EChannelEncoding req)	__NE___;
+		};
+
 
 	// variables
 	protected:
@@ -78,6 +107,11 @@ namespace AE::Networking
 		FrameUID				_lastFrameId;
 
 		RC<IAllocator>			_allocator;
+		uint					_shard			= 0;	// index of message arena in 'MessageFactory'
+
+	private:
+		TempBuffer_t			_packedBuf;
+		TempBuffer_t			_unpackedBuf;
 
 
 	// methods
@@ -92,8 +126,14 @@ namespace AE::Networking
 		TcpChannel (RC<MessageFactory>	mf,
 					RC<IAllocator>		alloc)										__NE___;
 
-		void  _SendMessages (TcpSocket &, MsgListIter_t&, EClientLocalID, bool &)	__NE___;
-		void  _ReceiveMessages (TcpSocket &, FrameUID, EClientLocalID, bool &)		__NE___;
+		void  _SendMessages (TcpSocket &, MsgListIter_t&, EClientLocalID,
+							 EncodingState &, MsgQueueStatistic &, bool &)			__NE___;
+		void  _ReceiveMessages (TcpSocket &, FrameUID, EClientLocalID,
+								EncodingState &, MsgQueueStatistic &, bool &)		__NE___;
+
+		virtual void  _OnHandshake (EncodingState &, EChannelEncoding)				__NE___ = 0;
+
+		ND_ static EChannelEncoding  _SupportedEncoding (EChannelEncoding)			__NE___;
 
 		void  _OnEncodingError (CSMessagePtr)										C_NE___;
 		void  _OnDecodingError (CSMessageUID)										C_NE___;
@@ -101,6 +141,10 @@ namespace AE::Networking
 		ND_ bool  _IsValid ()														C_NE___;
 
 		static void  _ValidateMsgStream (const void* ptr, Bytes size)				__NE___;
+
+	private:
+		ND_ char  _PackMsg (EncodingState &, CSMessageUID, INOUT void* data, INOUT Bytes &size)						__NE___;
+		ND_ bool  _UnpackMsg (EncodingState &, char magic, CSMessageUID, INOUT const void* &data, INOUT Bytes &size)	__NE___;
 	};
 //-----------------------------------------------------------------------------
 
@@ -116,7 +160,8 @@ namespace AE::Networking
 		class ClientAPI
 		{
 			friend class BaseClient;
-			ND_ static RC<IChannel>  Create (RC<MessageFactory> mf, RC<IAllocator>, RC<IServerProvider>, Bool, StringView dbgName) __NE___;
+			ND_ static RC<IChannel>  Create (RC<MessageFactory> mf, RC<IAllocator>, RC<IServerProvider>, Bool,
+											 EChannelEncoding, StringView dbgName) __NE___;
 		};
 
 	private:
@@ -140,6 +185,8 @@ namespace AE::Networking
 		IpAddress				_serverAddress;
 		RC<IServerProvider>		_serverProvider;
 
+		EncodingState			_encoding;
+
 
 	// methods
 	public:
@@ -155,9 +202,11 @@ namespace AE::Networking
 		TcpClientChannel (RC<MessageFactory>	mf,
 								  RC<IServerProvider>	serverProvider,
 								  RC<IAllocator>		alloc,
-								  Bool					reliable)	__NE___;
+								  Bool					reliable,
+								  EChannelEncoding		encoding)	__NE___;
 		void  _Reconnect ()											__NE___;
 		void  _ProcessMessages (FrameUID, MsgQueueStatistic &)		__NE___;
+		void  _OnHandshake (EncodingState &, EChannelEncoding)		__NE_OV;
 
 		ND_ bool  _IsValid ()										C_NE___;
 	};
@@ -169,13 +218,15 @@ namespace AE::Networking
 	//
 	class TcpServerChannel final : public TcpChannel
 	{
+		friend class TcpShardedServerChannel;
+
 	// types
 	public:
 		class ServerAPI
 		{
 			friend class BaseServer;
 			ND_ static RC<IChannel>  Create (RC<MessageFactory> mf, RC<IAllocator>, RC<IClientListener>,
-											 ushort port, uint maxConnections, Bool, StringView dbgName) __NE___;
+											 ushort port, uint maxConnections, Bool, EChannelEncoding, StringView dbgName) __NE___;
 		};
 
 	private:
@@ -189,6 +240,7 @@ namespace AE::Networking
 			MsgListIter_t		lastSentMsg;	// encoded but not sent
 			DynUntypedStorage	encodedStorage;
 			Bytes				encoded;
+			EncodingState		encoding;
 		};
 
 		using ClientIdx_t		= ubyte;
@@ -201,6 +253,7 @@ namespace AE::Networking
 	// variables
 	private:
 		const bool				_reliable;
+		const EChannelEncoding	_allowedEncoding;
 
 		ClientPool_t			_clientPool;
 		ClientPoolBits_t		_poolBits;
@@ -228,12 +281,19 @@ namespace AE::Networking
 		TcpServerChannel (RC<MessageFactory>	mf,
 								  RC<IClientListener>	listener,
 								  RC<IAllocator>		alloc,
-								  Bool					reliable)	__NE___;
+								  Bool					reliable,
+								  EChannelEncoding		encoding)	__NE___;
 
 		ND_ bool  _IsValid ()										C_NE___;
 			void  _Disconnect (uint idx)							__NE___;
 			void  _CheckNewConnections ()							__NE___;
+		ND_ bool  _AddClient (TcpSocket &, const IpAddress &)		__NE___;
 			void  _UpdateClients (FrameUID, MsgQueueStatistic &)	__NE___;
+			void  _OnHandshake (EncodingState &, EChannelEncoding)	__NE_OV;
+
+		// used by sharded channel
+		ND_ uint  _ClientCount ()									C_NE___	{ return uint(_poolBits.count()); }
+			void  _SetPendingQueue (MsgList_t first, MsgList_t last)__NE___	{ _toSend.pendingFirst = first;  _toSend.pendingLast = last; }
 	};
 
 
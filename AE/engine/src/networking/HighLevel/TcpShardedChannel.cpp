@@ -0,0 +1,288 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "networking/HighLevel/TcpShardedChannel.h"
+#include "networking/HighLevel/Server.h"
+
+namespace AE::Networking
+{
+	using namespace AE::Threading;
+
+	//
+	// Shard Task
+	//
+	class TcpShardedServerChannel::ShardTask final : public IAsyncTask
+	{
+	private:
+		TcpShardedServerChannel*	_channel;
+		const uint					_index;
+		const FrameUID				_frameId;
+
+	public:
+		ShardTask (TcpShardedServerChannel* channel, uint index, FrameUID frameId, ETaskQueue queue) __NE___ :
+			IAsyncTask{ queue },
+			_channel{channel}, _index{index}, _frameId{frameId}
+		{}
+
+		void		Run ()		__Th_OV	{ _channel->_ProcessShard( _index, _frameId ); }
+		StringView	DbgName ()	C_NE_OV	{ return "TcpShardedServerChannel"; }
+	};
+//-----------------------------------------------------------------------------
+
+
+/*
+=================================================
+	ServerAPI::Create
+=================================================
+*/
+	RC<IChannel>  TcpShardedServerChannel::ServerAPI::Create (RC<MessageFactory> mf, RC<IAllocator> alloc,
+															  RC<IClientListener> listener,
+															  ushort port, uint shardCount, ETaskQueue queue, Bool reliable,
+															  EChannelEncoding encoding, StringView dbgName) __NE___
+	{
+		CHECK_ERR( mf );
+		CHECK_ERR( alloc );
+		CHECK_ERR( listener );
+		CHECK_ERR( shardCount > 0 and shardCount <= _maxShards );
+
+		RC<TcpShardedServerChannel>	result	{new TcpShardedServerChannel{ queue }};
+		TcpSocket::Config			cfg;	cfg.maxConnections = TcpServerChannel::_maxClients * shardCount;
+
+		DEBUG_ONLY( if ( dbgName.empty() ) dbgName = "TCP sharded server"; )
+
+		for (uint i = 0; i < shardCount; ++i)
+		{
+			RC<TcpServerChannel>	shard {new TcpServerChannel{ mf, listener, alloc, reliable, encoding }};
+			CHECK_ERR( shard->_IsValid() );
+
+			shard->_shard = i;
+			DEBUG_ONLY( shard->_socket.SetDebugName( String{dbgName} << " shard " << ToString(i) );)
+
+			result->_shards.push_back( RVRef(shard) );
+		}
+
+		DEBUG_ONLY( result->_socket.SetDebugName( String{dbgName} );)
+		Unused( dbgName );
+
+		CHECK_ERR( result->_socket.Listen( IpAddress::FromLocalPortTCP(port), cfg ));
+
+		AE_LOG_DBG( "Started TCP server with "s << ToString(shardCount) << " shards on port: " << ToString(port) );
+		return result;
+	}
+
+/*
+=================================================
+	destructor
+=================================================
+*/
+	TcpShardedServerChannel::~TcpShardedServerChannel () __NE___
+	{
+		DRC_EXLOCK( _drCheck );
+
+		_shards.clear();
+		_receivedQueue.Release();
+	}
+
+/*
+=================================================
+	Send
+----
+	Messages are linked into single list which is shared between shards.
+	'ChunkList::Append()' modifies the last chunk, so it must be called once per list,
+	shards will get a copy of list head and tail in 'ProcessMessages()'.
+=================================================
+*/
+	void  TcpShardedServerChannel::Send (MsgList_t msgList) __NE___
+	{
+		DRC_EXLOCK( _drCheck );
+
+		if_unlikely( _pendingFirst.empty() )
+			_pendingFirst = msgList;
+
+		_pendingLast.Append( msgList );
+		_pendingLast.MoveToLast();
+	}
+
+/*
+=================================================
+	ProcessMessages
+=================================================
+*/
+	void  TcpShardedServerChannel::ProcessMessages (const FrameUID frameId, INOUT MsgQueueStatistic &stat) __NE___
+	{
+		DRC_EXLOCK( _drCheck );
+
+		_received.clear();
+
+		if_likely( _socket.IsOpen() )
+			_CheckNewConnections();
+
+		// shards will flush pending queue if frame is changed
+		for (auto& shard : _shards) {
+			shard->_SetPendingQueue( _pendingFirst, _pendingLast );
+		}
+		if ( _lastFrameId != frameId )
+		{
+			_pendingFirst	= Default;
+			_pendingLast	= Default;
+			_lastFrameId	= frameId;
+		}
+
+		// process shards in parallel
+		FixedArray< AsyncTask, _maxShards >		tasks;
+
+		for (uint i = 1; i < _shards.size(); ++i)
+		{
+			if ( _shards[i]->_ClientCount() == 0 )
+			{
+				_ProcessShard( i, frameId );
+				continue;
+			}
+
+			auto	task = Scheduler().Run< ShardTask >( Tuple{ this, i, frameId, _taskQueue });
+
+			if_likely( task )
+				tasks.push_back( RVRef(task) );
+			else
+				_ProcessShard( i, frameId );
+		}
+
+		_ProcessShard( 0, frameId );
+
+		// merge received messages while waiting for other shards,
+		// tasks use this channel, so wait for all of them
+		for (;;)
+		{
+			_MergeReceived();
+
+			if ( Scheduler().Wait( tasks, EThreadArray{ EThread(_taskQueue) }, microseconds{100} ))
+				break;
+		}
+		_MergeReceived();
+
+		for (uint i = 0; i < _shards.size(); ++i)
+		{
+			const auto&	src = _shardStat[i];
+
+			stat.incompleteOutput	+= src.incompleteOutput;
+			stat.rawOutput			+= src.rawOutput;
+			stat.packedOutput		+= src.packedOutput;
+			stat.rawInput			+= src.rawInput;
+			stat.packedInput		+= src.packedInput;
+		}
+	}
+
+/*
+=================================================
+	_ProcessShard
+=================================================
+*/
+	void  TcpShardedServerChannel::_ProcessShard (const uint idx, const FrameUID frameId) __NE___
+	{
+		auto&	shard	= *_shards[idx];
+		auto&	stat	= _shardStat[idx];
+
+		stat = MsgQueueStatistic{};
+		shard.ProcessMessages( frameId, INOUT stat );
+
+		for (auto [id, list] : shard.Receive())
+		{
+			if_unlikely( list.first.empty() or list.first.FirstChunk()->IsEmpty() )
+				continue;
+
+			// queue capacity is enough for all groups from all shards
+			CHECK( _receivedQueue.Push( ReceivedGroup{ id, list.first, list.last }));
+		}
+	}
+
+/*
+=================================================
+	_MergeReceived
+=================================================
+*/
+	void  TcpShardedServerChannel::_MergeReceived () __NE___
+	{
+		ReceivedGroup	src;
+		for (; _receivedQueue.Pop( OUT src );)
+		{
+			auto&	dst = _received( src.id );
+
+			if ( dst.first.empty() )
+			{
+				dst.first	= src.first;
+				dst.last	= src.last;
+			}
+			else
+			{
+				dst.last.Append( src.first );
+				dst.last = src.last;
+			}
+		}
+	}
+
+/*
+=================================================
+	_CheckNewConnections
+=================================================
+*/
+	void  TcpShardedServerChannel::_CheckNewConnections () __NE___
+	{
+		for (uint i = 0, cnt = TcpServerChannel::_maxClients * ShardCount(); i < cnt; ++i)
+		{
+			IpAddress	addr;
+			TcpSocket	client;
+
+			if_likely( not client.Accept( _socket, OUT addr ))
+				break;
+
+			// find shard with minimal number of clients
+			TcpServerChannel*	dst			= null;
+			uint				min_count	= UMax;
+
+			for (auto& shard : _shards)
+			{
+				const uint	count = shard->_ClientCount();
+				if ( count < min_count )
+				{
+					min_count	= count;
+					dst			= shard.get();
+				}
+			}
+
+			if_unlikely( dst == null or not dst->_AddClient( client, addr ))
+				break;	// all shards are full
+		}
+	}
+
+/*
+=================================================
+	DisconnectClient
+=================================================
+*/
+	bool  TcpShardedServerChannel::DisconnectClient (EClientLocalID id) __NE___
+	{
+		DRC_EXLOCK( _drCheck );
+
+		for (auto& shard : _shards)
+		{
+			if ( shard->DisconnectClient( id ))
+				return true;
+		}
+		return false;
+	}
+
+/*
+=================================================
+	DisconnectClientsWithIncompleteMsgQueue
+=================================================
+*/
+	void  TcpShardedServerChannel::DisconnectClientsWithIncompleteMsgQueue () __NE___
+	{
+		DRC_EXLOCK( _drCheck );
+
+		for (auto& shard : _shards) {
+			shard->DisconnectClientsWithIncompleteMsgQueue();
+		}
+	}
+
+
+} // AE::Networking
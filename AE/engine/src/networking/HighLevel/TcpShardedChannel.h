@@ -0,0 +1,102 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+/*
+	thread-safe: no
+
+	Server channel which partitions clients across multiple 'TcpServerChannel' shards,
+	each shard is processed in separate task, so send, receive and message decoding run in parallel.
+
+	Connections:
+		- Only this channel has listening socket, new clients are accepted in 'ProcessMessages()'
+		  and attached to the shard with minimal number of clients.
+		- Each shard can handle up to 'NetConfig::TCP_Reliable_MaxClients' clients.
+
+	Input:
+		- Each shard decodes messages to its own arena in 'MessageFactory', so shards don't contend on allocator.
+		- Decoded message lists are passed through lock-free queue, caller thread merges them while other shards are in progress.
+		- Message consumers are called in the caller thread as usual.
+
+	Output:
+		- All shards share the same message queue, messages are filtered by client ID in each shard.
+*/
+
+#pragma once
+
+#include "networking/HighLevel/TcpChannel.h"
+
+namespace AE::Networking
+{
+
+	//
+	// TCP Sharded Server Channel
+	//
+	class TcpShardedServerChannel final : public IChannel
+	{
+	// types
+	public:
+		class ServerAPI
+		{
+			friend class BaseServer;
+			ND_ static RC<IChannel>  Create (RC<MessageFactory> mf, RC<IAllocator>, RC<IClientListener>,
+											 ushort port, uint shardCount, ETaskQueue, Bool, EChannelEncoding, StringView dbgName) __NE___;
+		};
+
+	private:
+		static constexpr uint	_maxShards	= NetConfig::MaxServerShards;
+
+		struct ReceivedGroup
+		{
+			CSMessageGroupID	id;
+			MsgList_t			first;
+			MsgList_t			last;
+		};
+
+		using Shards_t			= FixedArray< RC<TcpServerChannel>, _maxShards >;
+		using ShardStat_t		= StaticArray< MsgQueueStatistic, _maxShards >;
+		using ReceivedQueue_t	= Threading::LfStaticQueue< ReceivedGroup, _maxShards * NetConfig::MaxMsgGroupsPerFrame >;
+
+		class ShardTask;
+
+
+	// variables
+	private:
+		TcpSocket				_socket;			// listener
+		Shards_t				_shards;
+		ShardStat_t				_shardStat;
+
+		ReceivedQueue_t			_receivedQueue;
+		MsgQueueMap_t			_received;
+
+		MsgList_t				_pendingFirst;
+		MsgList_t				_pendingLast;
+		FrameUID				_lastFrameId;
+
+		const ETaskQueue		_taskQueue;
+
+		DRC_ONLY( Threading::DataRaceCheck	_drCheck;)
+
+
+	// methods
+	public:
+		~TcpShardedServerChannel ()									__NE_OV;
+
+	  // IChannel //
+		void			Send (MsgList_t)							__NE_OV;
+		MsgQueueMap_t&	Receive ()									__NE_OV { return _received; }
+
+		void  ProcessMessages (FrameUID, INOUT MsgQueueStatistic &)	__NE_OV;
+		bool  DisconnectClient (EClientLocalID)						__NE_OV;
+		void  DisconnectClientsWithIncompleteMsgQueue ()			__NE_OV;
+		bool  IsConnected ()										C_NE_OV	{ return true; }
+
+		ND_ uint  ShardCount ()										C_NE___	{ return uint(_shards.size()); }
+
+	private:
+		explicit TcpShardedServerChannel (ETaskQueue queue)			__NE___ : _taskQueue{queue} {}
+
+		void  _CheckNewConnections ()								__NE___;
+		void  _ProcessShard (uint idx, FrameUID)					__NE___;
+		void  _MergeReceived ()										__NE___;
+	};
+
+
+} // AE::Networking
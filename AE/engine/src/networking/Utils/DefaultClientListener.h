@@ -47,7 +47,8 @@ namespace AE::Networking
 
 		using ClientMap_t	= FlatHashMap< EClientLocalID, ClientInfo >;
 
-		static constexpr uint	c_MaxClients = Max( NetConfig::TCP_Reliable_MaxClients, 0u );	// TODO: other channels
+		// 'TCP_Reliable_MaxClients' is per shard, sharded channel can accept up to 'MaxServerShards' times more clients
+		static constexpr uint	c_MaxClients = Max( NetConfig::TCP_Reliable_MaxClients * NetConfig::MaxServerShards, 0u );	// TODO: other channels
 
 
 	// variables
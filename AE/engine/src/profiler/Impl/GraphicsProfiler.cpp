@@ -101,6 +101,13 @@ namespace AE::Profiler
 				ImGui::TextUnformatted( str.c_str() );
 			}
 
+			// resource pool occupancy and churn
+			{
+				str.clear();
+				str << "res: " << ToString( _resPool.alive ) << "  new: " << ToString( _resPool.avgCreated, 1 ) << "  del: " << ToString( _resPool.avgReleased, 1 );
+				ImGui::TextUnformatted( str.c_str() );
+			}
+
 			const ImVec2	wnd_size	= ImGui::GetContentRegionAvail();
 			const ImVec2	wnd_pos		= ImGui::GetCursorScreenPos();
 			const RectF		max_region	= RectF{float2{ wnd_size.x, Abs(wnd_size.y) }} + float2{wnd_pos.x, wnd_pos.y};
@@ -153,6 +160,16 @@ namespace AE::Profiler
 			_memTraffic.avgWrite	= Bytes{ulong(double(ulong{write}) / double(frame_count))};
 			_memTraffic.avgRead		= Bytes{ulong(double(ulong{read}) / double(frame_count))};
 		}
+
+		// resource pool
+		{
+			const auto	stat = rts.GetResourceManager().GetResourcePoolStat();
+
+			_resPool.alive			= stat.Alive();
+			_resPool.avgCreated		= float(double(stat.created  - _resPool.last.created)  / double(frame_count));
+			_resPool.avgReleased	= float(double(stat.released - _resPool.last.released) / double(frame_count));
+			_resPool.last			= stat;
+		}
 	}
 
 /*
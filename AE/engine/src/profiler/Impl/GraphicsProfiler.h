@@ -31,6 +31,7 @@ namespace AE::Profiler
 	private:
 		using BatchNameMap_t	= FlatHashMap< const void*, String >;
 		using PipelineStatistic	= Graphics::IQueryManager::GraphicsPipelineStatistic;
+		using ResourcePoolStat	= Graphics::IResourceManager::ResourcePoolStat;
 
 	  #if defined(AE_ENABLE_VULKAN)
 		using Query = Graphics::VQueryManager::Query;
@@ -149,6 +150,13 @@ namespace AE::Profiler
 			Bytes					avgRead;
 		}						_memTraffic;
 
+		struct {
+			ResourcePoolStat		last;
+			ulong					alive			= 0;
+			float					avgCreated		= 0.f;	// per frame
+			float					avgReleased		= 0.f;	// per frame
+		}						_resPool;
+
 		MemoryUsage_t			_memUsage;
 
 		PerFrame_t				_perFrame;
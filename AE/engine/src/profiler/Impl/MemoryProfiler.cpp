@@ -7,14 +7,601 @@
 
 namespace AE::Profiler
 {
+namespace
+{
+	struct MemProfThreadState
+	{
+		ulong	bytesUntilSample	= 0;	// accumulated since last sample
+		bool	inProfiler			= false;
+	};
+	static thread_local MemProfThreadState	t_MemProfState;
+
+	// prevent recursion if profiler containers use profiled allocator
+	struct MemProfRecursionGuard
+	{
+		const bool	locked;
+
+		MemProfRecursionGuard () __NE___ : locked{ not t_MemProfState.inProfiler }	{ t_MemProfState.inProfiler = true; }
+		~MemProfRecursionGuard () __NE___	{ if ( locked ) t_MemProfState.inProfiler = false; }
+	};
+
+	ND_ static StringView  AllocatorTypeName (IMemoryProfiler::EAllocator type)
+	{
+		switch_enum( type )
+		{
+			case IMemoryProfiler::EAllocator::General :		return "General";
+			case IMemoryProfiler::EAllocator::Linear :		return "Linear";
+			case IMemoryProfiler::EAllocator::FixedBlock :	return "FixedBlock";
+			case IMemoryProfiler::EAllocator::Frame :		return "Frame";
+			case IMemoryProfiler::EAllocator::GpuMemory :	return "GpuMemory";
+			case IMemoryProfiler::EAllocator::Unknown :
+			case IMemoryProfiler::EAllocator::_Count :		break;
+		}
+		switch_end
+		return "Unknown";
+	}
+
+	ND_ static String  SignedBytesToString (slong value)
+	{
+		return (value < 0 ? "-"s : "+"s) << ToString( Bytes{ulong(Abs( value ))});
+	}
+}
 
 /*
 =================================================
 	constructor
 =================================================
 */
-	MemoryProfiler::MemoryProfiler (TimePoint_t startTime) __NE___ :
-		ProfilerUtils{ startTime }
+	MemoryProfiler::MemoryProfiler (TimePoint_t startTime, Bytes sampleInterval) __NE___ :
+		ProfilerUtils{ startTime },
+		_sampleInterval{ Max( sampleInterval, 1_b )}
 	{}
 
+/*
+=================================================
+	destructor
+=================================================
+*/
+	MemoryProfiler::~MemoryProfiler () __NE___
+	{}
+
+/*
+=================================================
+	_GetAllocator
+=================================================
+*/
+	MemoryProfiler::AllocatorInfo*  MemoryProfiler::_GetAllocator (const void* allocator, EAllocator type) __NE___
+	{
+		{
+			SHAREDLOCK( _allocGuard );
+			auto	it = _allocators.find( allocator );
+			if_likely( it != _allocators.end() )
+				return it->second.get();
+		}
+
+		EXLOCK( _allocGuard );
+		TRY{
+			auto&	info = _allocators[ allocator ];	// throw
+			if ( not info )
+			{
+				info		= MakeUnique<AllocatorInfo>();	// throw
+				info->type	= type;
+				info->name	= "0x"s << ToString<16>( usize(allocator) );
+			}
+			return info.get();
+		}
+		CATCH_ALL(
+			// remove empty entry which may be added before exception
+			_allocators.erase( allocator );
+			return null;
+		)
+	}
+
+/*
+=================================================
+	_GetShard
+=================================================
+*/
+	MemoryProfiler::SampleShard&  MemoryProfiler::_GetShard (const void* ptr) __NE___
+	{
+		// low bits are used for alignment
+		return _samples[ (usize(ptr) >> 6) % _ShardCount ];
+	}
+
+/*
+=================================================
+	RegisterAllocator
+=================================================
+*/
+	void  MemoryProfiler::RegisterAllocator (const void* allocator, EAllocator type, StringView name) __NE___
+	{
+		MemProfRecursionGuard	guard;
+		if ( not guard.locked )
+			return;
+
+		auto*	info = _GetAllocator( allocator, type );
+		if_unlikely( info == null )
+			return;
+
+		EXLOCK( _allocGuard );
+		info->type = type;
+		info->name = name;
+	}
+
+/*
+=================================================
+	UnregisterAllocator
+=================================================
+*/
+	void  MemoryProfiler::UnregisterAllocator (const void* allocator) __NE___
+	{
+		MemProfRecursionGuard	guard;
+		if ( not guard.locked )
+			return;
+
+		_RemoveSamples( allocator );
+
+		EXLOCK( _allocGuard );
+		_allocators.erase( allocator );
+	}
+
+/*
+=================================================
+	OnAllocate
+=================================================
+*/
+	void  MemoryProfiler::OnAllocate (const void* allocator, EAllocator type, const void* ptr, const Bytes size) __NE___
+	{
+		MemProfRecursionGuard	guard;
+		if ( not guard.locked )
+			return;
+
+		auto*	info = _GetAllocator( allocator, type );
+		if_unlikely( info == null )
+			return;
+
+		if ( _TrackSize( info->type ))
+		{
+			EXLOCK( info->sizeMapGuard );
+			NOTHROW_ERR( info->sizeMap.insert_or_assign( ptr, size ));
+		}
+
+		const ulong	live = info->live.Add( ulong{size} );
+		info->peak.fetch_max( live );
+		info->allocated.fetch_add( ulong{size} );
+		info->allocCount.fetch_add( 1 );
+
+		// sampling
+		auto&	state = t_MemProfState;
+		state.bytesUntilSample += ulong{size};
+
+		if_unlikely( state.bytesUntilSample >= ulong{_sampleInterval} )
+		{
+			const Bytes	weight {state.bytesUntilSample};
+			state.bytesUntilSample = 0;
+
+			_AddSample( allocator, ptr, weight );
+		}
+	}
+
+/*
+=================================================
+	OnDeallocate
+=================================================
+*/
+	void  MemoryProfiler::OnDeallocate (const void* allocator, const void* ptr, Bytes size) __NE___
+	{
+		MemProfRecursionGuard	guard;
+		if ( not guard.locked )
+			return;
+
+		auto*	info = _GetAllocator( allocator, Default );
+		if_unlikely( info == null )
+			return;
+
+		if ( _TrackSize( info->type ))
+		{
+			EXLOCK( info->sizeMapGuard );
+			auto	it = info->sizeMap.find( ptr );
+
+			// allocated before profiler was attached
+			if ( it == info->sizeMap.end() )
+				return;
+
+			ASSERT( size == 0 or size == it->second );
+			size = it->second;
+			info->sizeMap.erase( it );
+		}
+
+		// live size may be less than 'size' if memory was allocated before profiler was attached
+		ulong	live = info->live.load();
+		for (;;)
+		{
+			if ( info->live.CAS( INOUT live, live - Min( live, ulong{size} )))
+				break;
+		}
+		info->deallocCount.fetch_add( 1 );
+
+		_RemoveSample( ptr );
+	}
+
+/*
+=================================================
+	OnDiscard
+=================================================
+*/
+	void  MemoryProfiler::OnDiscard (const void* allocator) __NE___
+	{
+		MemProfRecursionGuard	guard;
+		if ( not guard.locked )
+			return;
+
+		auto*	info = _GetAllocator( allocator, Default );
+		if_unlikely( info == null )
+			return;
+
+		info->live.store( 0 );
+
+		if ( _TrackSize( info->type ))
+		{
+			EXLOCK( info->sizeMapGuard );
+			info->sizeMap.clear();
+		}
+
+		_RemoveSamples( allocator );
+	}
+
+/*
+=================================================
+	_AddSample
+----
+	skip 'MemoryProfilerApi::_Allocate()', 'OnAllocate()', '_AddSample()'
+=================================================
+*/
+	void  MemoryProfiler::_AddSample (const void* allocator, const void* ptr, const Bytes weight) __NE___
+	{
+		void*	frames [MaxStackDepth];
+		uint	count	= PlatformUtils::CaptureCallStack( OUT frames, MaxStackDepth, 3 );
+		HashVal	site	= HashOf( frames, count * sizeof(*frames) );
+
+		{
+			EXLOCK( _sitesGuard );
+			SiteStat*	st = null;
+			NOTHROW_ERRV( st = &_sites[ site ] );	// skip sample if out of memory
+
+			if ( st->totalSamples == 0 )
+			{
+				st->key = site;
+				for (uint i = 0; i < count; ++i) {
+					st->stack.push_back( frames[i] );
+				}
+			}
+			st->live += weight;
+			++st->liveSamples;
+			++st->totalSamples;
+		}
+
+		auto&	shard	= _GetShard( ptr );
+		Sample	old;
+		bool	added	= false;
+		{
+			EXLOCK( shard.guard );
+			TRY{
+				auto&	smp = shard.map[ ptr ];		// throw
+
+				// linear allocator may reuse memory without 'OnDeallocate()'
+				old		= smp;
+				smp		= Sample{ allocator, site, weight };
+				added	= true;
+			}
+			CATCH_ALL()
+		}
+
+		// sample is not stored, so it will never be released by '_RemoveSample()'
+		if_unlikely( not added )
+			_ReleaseSite( site, weight );
+
+		if ( old.allocator != null )
+			_ReleaseSite( old.site, old.weight );
+	}
+
+/*
+=================================================
+	_RemoveSample
+=================================================
+*/
+	void  MemoryProfiler::_RemoveSample (const void* ptr) __NE___
+	{
+		auto&	shard = _GetShard( ptr );
+		Sample	smp;
+		{
+			EXLOCK( shard.guard );
+			auto	it = shard.map.find( ptr );
+			if_likely( it == shard.map.end() )
+				return;
+
+			smp = it->second;
+			shard.map.erase( it );
+		}
+		_ReleaseSite( smp.site, smp.weight );
+	}
+
+/*
+=================================================
+	_RemoveSamples
+=================================================
+*/
+	void  MemoryProfiler::_RemoveSamples (const void* allocator) __NE___
+	{
+		for (auto& shard : _samples)
+		{
+			EXLOCK( shard.guard );
+			for (auto it = shard.map.begin(); it != shard.map.end();)
+			{
+				if ( it->second.allocator == allocator )
+				{
+					_ReleaseSite( it->second.site, it->second.weight );
+					shard.map.erase( it++ );
+				}
+				else
+					++it;
+			}
+		}
+	}
+
+/*
+=================================================
+	_ReleaseSite
+=================================================
+*/
+	void  MemoryProfiler::_ReleaseSite (HashVal site, Bytes weight) __NE___
+	{
+		EXLOCK( _sitesGuard );
+		auto	it = _sites.find( site );
+		if ( it == _sites.end() )
+			return;
+
+		ASSERT( it->second.liveSamples > 0 );
+		it->second.live -= Min( it->second.live, weight );
+		it->second.liveSamples --;
+	}
+
+/*
+=================================================
+	Update
+=================================================
+*/
+	void  MemoryProfiler::Update (secondsf dt)
+	{
+		const float	inv_dt = 1.f / Max( dt.count(), 1.0e-3f );
+
+		SHAREDLOCK( _allocGuard );
+		for (auto& [key, info] : _allocators)
+		{
+			info->churn.store( float(info->allocated.exchange( 0 )) * inv_dt );
+		}
+	}
+
+/*
+=================================================
+	GetAllocatorStats
+=================================================
+*/
+	Array<MemoryProfiler::AllocatorStat>  MemoryProfiler::GetAllocatorStats () C_Th___
+	{
+		Array<AllocatorStat>	result;
+		SHAREDLOCK( _allocGuard );
+
+		result.reserve( _allocators.size() );	// throw
+		for (auto& [key, info] : _allocators)
+		{
+			auto&	dst = result.emplace_back();
+			dst.name			= info->name;
+			dst.type			= info->type;
+			dst.live			= Bytes{info->live.load()};
+			dst.peak			= Bytes{info->peak.load()};
+			dst.allocCount		= info->allocCount.load();
+			dst.deallocCount	= info->deallocCount.load();
+			dst.churn			= info->churn.load();
+		}
+
+		std::sort( result.begin(), result.end(), [](auto& lhs, auto& rhs) { return lhs.live > rhs.live; });
+		return result;
+	}
+
+/*
+=================================================
+	GetTopSites
+=================================================
+*/
+	Array<MemoryProfiler::SiteStat>  MemoryProfiler::GetTopSites (const usize maxCount) C_Th___
+	{
+		Array<SiteStat>		result;
+		{
+			EXLOCK( _sitesGuard );
+			result.reserve( _sites.size() );	// throw
+
+			for (auto& [key, st] : _sites) {
+				if ( st.liveSamples > 0 )
+					result.push_back( st );		// throw
+			}
+		}
+
+		std::sort( result.begin(), result.end(), [](auto& lhs, auto& rhs) { return lhs.live > rhs.live; });
+
+		if ( result.size() > maxCount )
+			result.resize( maxCount );
+		return result;
+	}
+
+/*
+=================================================
+	TakeSnapshot
+=================================================
+*/
+	MemoryProfiler::Snapshot  MemoryProfiler::TakeSnapshot () C_Th___
+	{
+		Snapshot	result;
+		result.time = CurrentTime();
+		{
+			SHAREDLOCK( _allocGuard );
+			for (auto& [key, info] : _allocators) {
+				result.allocators[ info->name ] += Bytes{info->live.load()};	// throw
+			}
+		}{
+			EXLOCK( _sitesGuard );
+			for (auto& [key, st] : _sites) {
+				if ( st.liveSamples > 0 )
+					result.sites.emplace( key, st );	// throw
+			}
+		}
+		return result;
+	}
+
+/*
+=================================================
+	SnapshotDiff
+=================================================
+*/
+	String  MemoryProfiler::SnapshotDiff (const Snapshot &prev, const Snapshot &cur) __Th___
+	{
+		String	str;
+		str << "Memory snapshot diff: " << ToString( prev.time ) << " -> " << ToString( cur.time ) << "\n";
+
+		// allocators
+		{
+			Array<Pair< slong, StringView >>	diff;
+			for (auto& [name, live] : cur.allocators)
+			{
+				auto	it		= prev.allocators.find( name );
+				slong	delta	= slong(ulong{live}) - (it != prev.allocators.end() ? slong(ulong{it->second}) : 0);
+				diff.emplace_back( delta, name );
+			}
+			for (auto& [name, live] : prev.allocators)
+			{
+				if ( not cur.allocators.contains( name ))
+					diff.emplace_back( -slong(ulong{live}), name );
+			}
+			std::sort( diff.begin(), diff.end(), [](auto& lhs, auto& rhs) { return Abs(lhs.first) > Abs(rhs.first); });
+
+			str << "\nAllocators:\n";
+			for (auto& [delta, name] : diff)
+			{
+				if ( delta != 0 )
+					str << "  " << name << ": " << SignedBytesToString( delta ) << "\n";
+			}
+		}
+
+		// sites
+		{
+			Array<Pair< slong, SiteStat const* >>	diff;
+			for (auto& [key, st] : cur.sites)
+			{
+				auto	it		= prev.sites.find( key );
+				slong	delta	= slong(ulong{st.live}) - (it != prev.sites.end() ? slong(ulong{it->second.live}) : 0);
+				diff.emplace_back( delta, &st );
+			}
+			for (auto& [key, st] : prev.sites)
+			{
+				if ( not cur.sites.contains( key ))
+					diff.emplace_back( -slong(ulong{st.live}), &st );
+			}
+			std::sort( diff.begin(), diff.end(), [](auto& lhs, auto& rhs) { return Abs(lhs.first) > Abs(rhs.first); });
+
+			str << "\nSampled call stacks:\n";
+			for (auto& [delta, st] : diff)
+			{
+				if ( delta == 0 )
+					continue;
+
+				str << "  " << SignedBytesToString( delta ) << " (~" << ToString( st->live ) << " live)\n";
+				for (auto* addr : st->stack) {
+					str << "    0x" << ToString<16>( usize(addr) ) << "\n";
+				}
+			}
+		}
+		return str;
+	}
+
+/*
+=================================================
+	ExportSnapshotDiff
+=================================================
+*/
+	bool  MemoryProfiler::ExportSnapshotDiff (const Path &filename) __NE___
+	{
+		try {
+			Snapshot	cur		= TakeSnapshot();
+			String		diff;
+			{
+				EXLOCK( _snapshotGuard );
+				diff		= SnapshotDiff( _snapshot, cur );
+				_snapshot	= RVRef(cur);
+			}
+
+			FileWStream		file {filename};
+			CHECK_ERR( file.IsOpen() );
+			CHECK_ERR( file.Write( diff ));
+
+			AE_LOGI( "Memory snapshot diff saved to '"s << ToString( filename ) << "'" );
+			return true;
+		}
+		catch (...) {
+			return false;
+		}
+	}
+
+/*
+=================================================
+	DrawImGUI
+=================================================
+*/
+#ifdef AE_ENABLE_IMGUI
+	void  MemoryProfiler::DrawImGUI ()
+	{
+		if ( not ImGui::Begin( "MemoryProfiler" ))
+		{
+			ImGui::End();
+			return;
+		}
+
+		if ( ImGui::Button( "Take snapshot" ))
+		{
+			auto	cur = TakeSnapshot();
+			EXLOCK( _snapshotGuard );
+			_snapshot = RVRef(cur);
+		}
+		ImGui::SameLine();
+		if ( ImGui::Button( "Export diff" ))
+			Unused( ExportSnapshotDiff( "memory_snapshot_diff.txt" ));
+
+		String	str;
+		ImGui::Separator();
+		for (auto& st : GetAllocatorStats())
+		{
+			str.clear();
+			str << st.name << " [" << AllocatorTypeName( st.type ) << "]  live: " << ToString( st.live )
+				<< "  peak: " << ToString( st.peak ) << "  churn: " << ToString( Bytes{ulong(st.churn)} ) << "/s"
+				<< "  alloc: " << ToString( st.allocCount ) << "  dealloc: " << ToString( st.deallocCount );
+
+			ImGui::TextUnformatted( str.c_str(), str.c_str() + str.size() );
+		}
+
+		ImGui::Separator();
+		ImGui::TextUnformatted( "Top allocation sites (sampled):" );
+		for (auto& st : GetTopSites( 10 ))
+		{
+			str.clear();
+			str << "~" << ToString( st.live ) << "  samples: " << ToString( st.liveSamples ) << " / " << ToString( st.totalSamples ) << "  at";
+
+			for (usize i = 0; i < Min( st.stack.size(), usize{3} ); ++i) {
+				str << "  0x" << ToString<16>( usize(st.stack[i]) );
+			}
+			ImGui::TextUnformatted( str.c_str(), str.c_str() + str.size() );
+		}
+
+		ImGui::End();
+	}
+#endif
+
 } // AE::Profiler
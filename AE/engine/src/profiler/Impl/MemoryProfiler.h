@@ -1,4 +1,14 @@
 // Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+/*
+	Per-allocator statistics are exact: live, peak, allocation count and churn (allocated bytes per second).
+
+	Call stacks are sampled: each thread captures call stack once per 'sampleInterval' allocated bytes,
+	sampled allocation has weight of all bytes allocated by this thread since previous sample,
+	so per-site live bytes are estimation.
+	Call stacks are stored as return addresses without symbolization.
+
+	Snapshot contains per-allocator and per-site live bytes, diff between two snapshots shows memory growth.
+*/
 
 #pragma once
 
@@ -14,13 +24,127 @@ namespace AE::Profiler
 
 	class MemoryProfiler final : public Threading::IMemoryProfiler, public ProfilerUtils
 	{
+	// types
+	public:
+		static constexpr uint	MaxStackDepth	= 16;
+		static constexpr Bytes	DefaultSampleInterval {64_Kb};
+
+		using Caption_t		= FixedString<64>;
+		using CallStack_t	= FixedArray< const void*, MaxStackDepth >;
+
+		struct AllocatorStat
+		{
+			Caption_t		name;
+			EAllocator		type			= Default;
+			Bytes			live;
+			Bytes			peak;
+			ulong			allocCount		= 0;
+			ulong			deallocCount	= 0;
+			float			churn			= 0.f;		// bytes per second
+		};
+
+		struct SiteStat
+		{
+			HashVal			key;
+			CallStack_t		stack;
+			Bytes			live;			// estimated
+			uint			liveSamples		= 0;
+			uint			totalSamples	= 0;
+		};
+
+		struct Snapshot
+		{
+			secondsf						time;
+			FlatHashMap< Caption_t, Bytes >	allocators;		// key is allocator name
+			FlatHashMap< HashVal, SiteStat >sites;
+		};
+
+	private:
+		struct AllocatorInfo
+		{
+			Caption_t		name;
+			EAllocator		type			= Default;
+			Atomic<ulong>	live			{0};
+			Atomic<ulong>	peak			{0};
+			Atomic<ulong>	allocated		{0};		// since last 'Update()'
+			Atomic<ulong>	allocCount		{0};
+			Atomic<ulong>	deallocCount	{0};
+			FAtomic<float>	churn			{0.f};
+
+			// used only if allocator may not pass size to 'Deallocate()'
+			Mutex								sizeMapGuard;
+			FlatHashMap< const void*, Bytes >	sizeMap;
+		};
+		using AllocatorMap_t	= FlatHashMap< const void*, Unique<AllocatorInfo> >;
+
+		struct Sample
+		{
+			const void*		allocator	= null;
+			HashVal			site;
+			Bytes			weight;
+		};
+		struct SampleShard
+		{
+			Mutex								guard;
+			FlatHashMap< const void*, Sample >	map;		// key is pointer to allocated memory
+		};
+		static constexpr uint	_ShardCount	= 16;
+
+		using SiteMap_t			= FlatHashMap< HashVal, SiteStat >;
+
+
+	// variables
+	private:
+		const Bytes			_sampleInterval;
+
+		mutable SharedMutex	_allocGuard;
+		AllocatorMap_t		_allocators;
+
+		StaticArray< SampleShard, _ShardCount >	_samples;
+
+		mutable Mutex		_sitesGuard;
+		SiteMap_t			_sites;
+
+		Mutex				_snapshotGuard;
+		Snapshot			_snapshot;		// previous snapshot
+
+
 	// methods
 	public:
-		explicit MemoryProfiler (TimePoint_t startTime)		__NE___;
+		explicit MemoryProfiler (TimePoint_t startTime, Bytes sampleInterval = DefaultSampleInterval) __NE___;
+		~MemoryProfiler ()												__NE___;
 
-		void  DrawImGUI () {}
+		void  DrawImGUI ();
 		void  Draw (Canvas &) {}
-		void  Update (secondsf) {}
+		void  Update (secondsf dt);
+
+		ND_ Array<AllocatorStat>	GetAllocatorStats ()				C_Th___;
+		ND_ Array<SiteStat>			GetTopSites (usize maxCount)		C_Th___;
+
+		ND_ Snapshot		TakeSnapshot ()								C_Th___;
+		ND_ static String	SnapshotDiff (const Snapshot &prev, const Snapshot &cur) __Th___;
+
+		// Compare with previous snapshot and save current snapshot as previous.
+			bool			ExportSnapshotDiff (const Path &filename)	__NE___;
+
+
+	  // IMemoryProfiler //
+		void  RegisterAllocator (const void* allocator, EAllocator type, StringView name)		__NE_OV;
+		void  UnregisterAllocator (const void* allocator)										__NE_OV;
+		void  OnAllocate (const void* allocator, EAllocator type, const void* ptr, Bytes size)	__NE_OV;
+		void  OnDeallocate (const void* allocator, const void* ptr, Bytes size)					__NE_OV;
+		void  OnDiscard (const void* allocator)													__NE_OV;
+
+	private:
+		ND_ AllocatorInfo*	_GetAllocator (const void* allocator, EAllocator type)	__NE___;
+		ND_ SampleShard&	_GetShard (const void* ptr)								__NE___;
+
+			void	_AddSample (const void* allocator, const void* ptr, Bytes size)	__NE___;
+			void	_RemoveSample (const void* ptr)										__NE___;
+			void	_RemoveSamples (const void* allocator)								__NE___;
+			void	_ReleaseSite (HashVal site, Bytes weight)							__NE___;
+
+		ND_ static bool  _TrackSize (EAllocator type)								__NE___	{ return type == EAllocator::General or type == EAllocator::GpuMemory; }
 	};
 
 
@@ -139,9 +139,11 @@ namespace AE::Profiler
 =================================================
 */
 	TaskProfiler::TaskProfiler (TimePoint_t startTime) __NE___ :
-		ProfilerUtils{ startTime }
+		ProfilerUtils{ startTime },
+		_hwCounters{ PerformanceStat::HWCounters_IsSupported() }
 	{
 		NOTHROW( _tmpTaskMap.reserve( 1024 );)
+		NOTHROW( _taskStats.reserve( 128 );)
 	}
 
 /*
@@ -182,12 +184,15 @@ namespace AE::Profiler
 			return;	// failed to allocate
 
 		cmd->task		= id;
-		cmd->time		= CurrentTimeNano();
 		cmd->threadId	= ThreadID(this->CurrentThreadID());
 		cmd->frameIdx	= idx;
 
 		MemCopy( OUT cmd_txt, name.data(), Bytes{name.length()} );
 		cmd_txt[ name.length() ] = '\0';
+
+		// sample counters at the end to exclude profiler overhead
+		Unused( PerformanceStat::HWCounters_Get( OUT cmd->counters ));
+		cmd->time		= CurrentTimeNano();
 	}
 
 /*
@@ -201,6 +206,11 @@ namespace AE::Profiler
 		if_likely( idx < _FirstFrameIdx or idx >= _LastFrameIdx+2 )
 			return;
 
+		// sample counters at the beginning to exclude profiler overhead
+		const auto	time	= CurrentTimeNano();
+		HWCounters	counters;
+		Unused( PerformanceStat::HWCounters_Get( OUT counters ));
+
 		auto		cmd		= _taskCmds.Insert< TaskEndCmd, char >( name.length()+1 );
 		char*		cmd_txt	= Cast<char>(cmd.DynamicData());
 
@@ -208,7 +218,8 @@ namespace AE::Profiler
 			return;	// failed to allocate
 
 		cmd->task		= id;
-		cmd->time		= CurrentTimeNano();
+		cmd->time		= time;
+		cmd->counters	= counters;
 		cmd->threadId	= ThreadID(this->CurrentThreadID());
 		cmd->frameIdx	= idx;
 
@@ -277,9 +288,80 @@ namespace AE::Profiler
 			_imTaskGraph.Draw( INOUT region1 );
 		}
 		ImGui::End();
+
+		_DrawTaskStats();
+	}
+
+/*
+=================================================
+	_DrawTaskStats
+=================================================
+*/
+	void  TaskProfiler::_DrawTaskStats ()
+	{
+		if ( _taskStats.empty() )
+			return;
+
+		if ( not ImGui::Begin( "TaskStatistics" ))
+		{
+			ImGui::End();
+			return;
+		}
+
+		Array< TaskStat const* >	sorted;
+		sorted.reserve( _taskStats.size() );
+
+		for (auto& [key, st] : _taskStats) {
+			sorted.push_back( &st );
+		}
+		std::sort( sorted.begin(), sorted.end(), [](auto* lhs, auto* rhs) { return lhs->totalTime > rhs->totalTime; });
+
+		String	str;
+		for (auto* st : sorted)
+		{
+			const auto&		c		= st->counters;
+			const double	cnt		= double(Max( st->count, 1u ));
+
+			str.clear();
+			str << st->name << " [" << ToString( st->count ) << "]  avg: " << ToString( st->totalTime / cnt );
+
+			if ( c.hwAvailable )
+			{
+				str << "  IPC: " << ToString( c.IPC(), 2 )
+					<< "  L1d MPKI: " << ToString( c.L1dMPKI(), 1 )
+					<< "  LLC MPKI: " << ToString( c.LLCMPKI(), 1 )
+					<< "  branch MPKI: " << ToString( c.BranchMPKI(), 1 );
+			}
+			str << "  ctx switch: " << ToString( double(c.contextSwitches) / cnt, 1 );
+
+			ImGui::TextUnformatted( str.c_str(), str.c_str() + str.size() );
+		}
+
+		if ( not _hwCounters )
+			ImGui::TextUnformatted( "hardware counters are not supported" );
+
+		ImGui::End();
 	}
 #endif
 
+/*
+=================================================
+	_AddTaskStat
+=================================================
+*/
+	void  TaskProfiler::_AddTaskStat (StringView name, nanosecondsd begin, nanosecondsd end, const HWCounters &counters)
+	{
+		auto	[it, inserted] = _taskStats.emplace( HashOf( name ), TaskStat{} );
+		auto&	st = it->second;
+
+		if ( inserted )
+			st.name = name;
+
+		++st.count;
+		st.totalTime += (end - begin);
+		st.counters  += counters;
+	}
+
 /*
 =================================================
 	Update
@@ -312,6 +394,7 @@ namespace AE::Profiler
 					info.begin		= begin.time;
 					info.threadId	= begin.threadId;
 					info.frameIdx	= begin.frameIdx;
+					info.counters	= begin.counters;
 
 					bool	inserted = _tmpTaskMap.emplace( begin.task, info ).second;
 					ASSERT( inserted );
@@ -334,6 +417,8 @@ namespace AE::Profiler
 
 						ASSERT( info.threadId == end.threadId );
 						ASSERT( info.frameIdx <= end.frameIdx );
+
+						_AddTaskStat( info.name, info.begin, end.time, end.counters - info.counters );
 					}
 					else
 					{
@@ -406,6 +491,9 @@ namespace AE::Profiler
 			str.clear();
 			str << info.threadName << " (" << ToString( uint(info.coreId) ) << ')';
 
+			if ( info.wakeupLatency > 0.f )
+				str << " wakeup: " << ToString( info.wakeupLatency, 1 ) << "us, spin: " << ToString( info.idleSpinning ) << '%';
+
 			t.caption = StringView{str};
 		}
 	}
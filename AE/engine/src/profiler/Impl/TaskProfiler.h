@@ -18,6 +18,7 @@ namespace AE::Profiler
 		using ThreadPtr		= RC<Threading::IThread>;
 		using Allocator_t	= UntypedAllocator;
 		enum class ThreadID : usize {};
+		using HWCounters	= PerformanceStat::HWCounters;
 
 		struct BaseCmd
 		{
@@ -35,6 +36,7 @@ namespace AE::Profiler
 			nanosecondsd	time;
 			ThreadID		threadId;
 			uint			frameIdx;
+			HWCounters		counters;
 			//char			name []
 		};
 
@@ -44,6 +46,7 @@ namespace AE::Profiler
 			nanosecondsd	time;
 			ThreadID		threadId;
 			uint			frameIdx;
+			HWCounters		counters;
 			//char			name []
 		};
 
@@ -119,11 +122,24 @@ namespace AE::Profiler
 			nanosecondsd	begin;
 			ThreadID		threadId;
 			uint			frameIdx;
+			HWCounters		counters;
 		};
 
 		using TaskMap_t		= FlatHashMap< const void*, TaskInfo >;
 		using Caption_t		= FixedString<64>;
 
+	public:
+		// Aggregated statistics for task type or named scope.
+		struct TaskStat
+		{
+			Caption_t		name;
+			uint			count		= 0;
+			nanosecondsd	totalTime	{0.0};
+			HWCounters		counters;		// sum of differences between 'End()' and 'Begin()'
+		};
+		using TaskStatMap_t	= FlatHashMap< HashVal, TaskStat >;		// key is hash of name
+
+	private:
 		struct ThreadInfo
 		{
 			Caption_t		caption;
@@ -143,6 +159,9 @@ namespace AE::Profiler
 
 		TaskMap_t		_tmpTaskMap;
 
+		TaskStatMap_t	_taskStats;
+		const bool		_hwCounters;	// hardware counters are supported
+
 	  #ifdef AE_ENABLE_IMGUI
 		ImTaskRangeHorDiagram	_imTaskGraph;
 	  #endif
@@ -156,6 +175,9 @@ namespace AE::Profiler
 		void  Draw (Canvas &) {}
 		void  Update (secondsf dt);
 
+		ND_ TaskStatMap_t const&  GetTaskStats ()				C_NE___	{ return _taskStats; }
+			void  ResetTaskStats ()								__NE___	{ _taskStats.clear(); }
+
 
 	  // ITaskProfiler //
 		void  Begin (const Threading::IAsyncTask &)				__NE_OV;
@@ -168,6 +190,11 @@ namespace AE::Profiler
 
 	private:
 		void  _UpdateThreadFreq ();
+		void  _AddTaskStat (StringView name, nanosecondsd begin, nanosecondsd end, const HWCounters &counters);
+
+	  #ifdef AE_ENABLE_IMGUI
+		void  _DrawTaskStats ();
+	  #endif
 	};
 
 
@@ -37,6 +37,18 @@ namespace
 	{
 		return Base::EndsWithIC( str, substr );
 	}
+
+  #ifdef AE_ENABLE_UTF8PROC
+	static bool  String_Utf8IsValid (const String &str)
+	{
+		return Base::Utf8Validate( Cast<CharUtf8>(str.data()), str.size() );
+	}
+
+	static uint  String_Utf8Length (const String &str)
+	{
+		return uint(Base::Utf8CharCount( Cast<CharUtf8>(str.data()), str.size() ));
+	}
+  #endif
 }
 
 /*
@@ -55,6 +67,11 @@ namespace
 		se->AddFunction( &String_StartsWithIC,		"StartsWithIC"		);
 		se->AddFunction( &String_EndsWith,			"EndsWith"			);
 		se->AddFunction( &String_EndsWithIC,		"EndsWithIC"		);
+
+	  #ifdef AE_ENABLE_UTF8PROC
+		se->AddFunction( &String_Utf8IsValid,		"Utf8IsValid"		);
+		se->AddFunction( &String_Utf8Length,		"Utf8Length"		);
+	  #endif
 	}
 
 } // AE::Scripting
@@ -149,7 +149,8 @@ namespace AE::Scripting
 	CreateModule
 =================================================
 */
-	ScriptModulePtr  ScriptEngine::CreateModule (ArrayView<ModuleSource> sources, ArrayView<StringView> defines, ArrayView<Path> includeDirs) __NE___
+	ScriptModulePtr  ScriptEngine::CreateModule (ArrayView<ModuleSource> sources, ArrayView<StringView> defines,
+												 ArrayView<Path> includeDirs, OUT Array<Path>* includedFiles) __NE___
 	{
 		using namespace AngelScript;
 		using ModulePtr = Unique< asIScriptModule, void (*)(asIScriptModule*) >;
@@ -170,7 +171,7 @@ namespace AE::Scripting
 
 			if ( src.usePreprocessor )
 			{
-				CHECK_ERR( _Preprocessor2( script, OUT temp, defines, includeDirs ));
+				CHECK_ERR( _Preprocessor2( script, OUT temp, defines, includeDirs, includedFiles ));
 				script = temp;
 			}
 
@@ -534,9 +535,10 @@ namespace
 	_Preprocessor2
 =================================================
 */
-	bool  ScriptEngine::_Preprocessor2 (StringView str, OUT String &dst, ArrayView<StringView> defines, ArrayView<Path> includeDirs) __NE___
+	bool  ScriptEngine::_Preprocessor2 (StringView str, OUT String &dst, ArrayView<StringView> defines,
+										ArrayView<Path> includeDirs, OUT Array<Path>* includedFiles) __NE___
 	{
-		const auto	ReadFile = [&includeDirs] (StringView fname, OUT String &s) -> bool
+		const auto	ReadFile = [&includeDirs, includedFiles] (StringView fname, OUT String &s) -> bool
 		{{
 			Path	path;
 			for (auto& dir : includeDirs)
@@ -544,6 +546,9 @@ namespace
 				path = dir / fname;
 				if ( FileSystem::IsFile( path ))
 				{
+					if ( includedFiles != null )
+						includedFiles->push_back( FileSystem::ToAbsolute( path ));	// throw
+
 					FileRStream  file {path};
 					return file.IsOpen() and file.Read( file.RemainingSize(), OUT s );
 				}
@@ -563,7 +568,7 @@ namespace
 			{
 				String	in, out;
 				CHECK_ERR( ReadFile( fname, OUT in ));
-				CHECK_ERR( _Preprocessor2( in, OUT out, defines, includeDirs ));
+				CHECK_ERR( _Preprocessor2( in, OUT out, defines, includeDirs, includedFiles ));
 
 				dst.insert( dst.begin() + pos + offset, out.begin(), out.end() );
 				offset += out.size();
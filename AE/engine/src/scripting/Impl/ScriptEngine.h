@@ -157,9 +157,11 @@ namespace AE::Scripting
 		ND_ bool  Create (Bool genCppHeader = False{})												__NE___;
 		ND_ bool  Create (AngelScript::asIScriptEngine* se, Bool genCppHeader = False{})			__NE___;
 
+		// 'includedFiles' - optional, returns absolute paths of all files which are included by preprocessor.
 		ND_ ScriptModulePtr  CreateModule (ArrayView<ModuleSource>	src,
-										   ArrayView<StringView>	defines		= Default,
-										   ArrayView<Path>			includeDirs	= Default)			__NE___;
+										   ArrayView<StringView>	defines			= Default,
+										   ArrayView<Path>			includeDirs		= Default,
+										   OUT Array<Path>*			includedFiles	= null)			__NE___;
 
 		template <typename Fn>
 		ND_ ScriptFnPtr<Fn>  CreateScript (StringView entry, const ScriptModulePtr &module)			__NE___;
@@ -208,7 +210,8 @@ namespace AE::Scripting
 		ND_ static bool  _Preprocessor2 (StringView str,
 										 OUT String &,
 										 ArrayView<StringView> defines,
-										 ArrayView<Path> includeDirs)								__NE___;
+										 ArrayView<Path> includeDirs,
+										 OUT Array<Path>* includedFiles = null)						__NE___;
 
 	private:
 		ND_ bool  _CreateContext (const String &signature, const ScriptModulePtr &module, OUT AngelScript::asIScriptContext* &ctx);
@@ -7,6 +7,22 @@
 namespace AE::Serializing
 {
 
+	inline bool  Deserializer::_SkipInPlacePadding () __NE___
+	{
+		ubyte	pad = 0;
+		return	stream.Read( OUT pad ) and
+				((pad == 0) or stream.Skip( Bytes{pad} ));
+	}
+
+
+	template <typename T>
+	const T*  Deserializer::_ReadInPlace (const usize count) __NE___
+	{
+		StaticAssert( IsTriviallySerializable<T> );
+		return Cast<T>( stream.ReadInPlace( SizeOf<T> * count, AlignOf<T> ));
+	}
+
+
 	template <typename T>
 	bool  Deserializer::_DeserializeObj (INOUT T &obj) __NE___
 	{
@@ -108,7 +124,8 @@ namespace AE::Serializing
 		NOTHROW_ERR( arr.resize( count ));
 
 		if constexpr( IsTriviallySerializable<T> )
-			return (count == 0) or stream.Read( OUT arr.data(), ArraySizeOf(arr) );
+			return	(count == 0) or
+					((not inPlaceLayout or _SkipInPlacePadding()) and stream.Read( OUT arr.data(), ArraySizeOf(arr) ));
 		else{
 			for (usize i = 0; res and (i < arr.size()); ++i) {
 				res = _Deserialize( INOUT arr[i] );
@@ -129,7 +146,8 @@ namespace AE::Serializing
 			return false;
 
 		if constexpr( IsTriviallySerializable<T> )
-			return (count == 0) or stream.Read( OUT arr.data(), SizeOf<T> * count );
+			return	(count == 0) or
+					((not inPlaceLayout or _SkipInPlacePadding()) and stream.Read( OUT arr.data(), SizeOf<T> * count ));
 		else{
 			for (uint i = 0; res and (i < count); ++i) {
 				res = _Deserialize( INOUT arr[i] );
@@ -152,7 +170,8 @@ namespace AE::Serializing
 		arr.resize( count );
 
 		if constexpr( IsTriviallySerializable<T> )
-			return (count == 0) or stream.Read( OUT arr.data(), ArraySizeOf(arr) );
+			return	(count == 0) or
+					((not inPlaceLayout or _SkipInPlacePadding()) and stream.Read( OUT arr.data(), ArraySizeOf(arr) ));
 		else{
 			for (usize i = 0; res and (i < arr.size()); ++i) {
 				res = _Deserialize( INOUT arr[i] );
@@ -174,6 +193,12 @@ namespace AE::Serializing
 
 		NOTHROW_ERR( str.resize( len ));
 
+		if ( (len > 0) and inPlaceLayout )
+		{
+			return	_SkipInPlacePadding()							and
+					stream.Read( OUT str.data(), StringSizeOf(str) )	and
+					stream.Skip( SizeOf<T> );	// null terminator
+		}
 		return (len == 0) or stream.Read( OUT str.data(), StringSizeOf(str) );
 	}
 
@@ -189,6 +214,13 @@ namespace AE::Serializing
 			return false;
 
 		str.resize( len );
+
+		if ( (len > 0) and inPlaceLayout )
+		{
+			return	_SkipInPlacePadding()						and
+					stream.Read( OUT str.data(), SizeOf<T> * len )	and
+					stream.Skip( SizeOf<T> );	// null terminator
+		}
 		return (len == 0) or stream.Read( OUT str.data(), SizeOf<T> * len );
 	}
 
@@ -435,7 +467,6 @@ namespace AE::Serializing
 	bool  Deserializer::_Deserialize (INOUT ArrayView<T> &arr) __NE___
 	{
 		StaticAssert( IsTriviallyDestructible<T> );	// non-trivial destructors require 'Array<>' type
-		CHECK_ERR( allocator );
 
 		uint	count	= 0;
 		bool	res		= stream.Read( OUT count );
@@ -449,6 +480,26 @@ namespace AE::Serializing
 			return true;
 		}
 
+		if constexpr( IsTriviallySerializable<T> )
+		{
+			if ( inPlaceLayout )
+			{
+				if_unlikely( not _SkipInPlacePadding() )
+					return false;
+
+				if ( inPlaceViews )
+				{
+					if ( const T* src = _ReadInPlace<T>( count ))
+					{
+						arr = ArrayView<T>{ src, count };
+						return true;
+					}
+				}
+			}
+		}
+
+		CHECK_ERR( allocator );
+
 		T*	dst = Cast<T>( allocator->Allocate( SizeAndAlign{ SizeOf<T> * count, AlignOf<T> }));
 		if_unlikely( dst == null )
 			return false;
@@ -472,7 +523,6 @@ namespace AE::Serializing
 	bool  Deserializer::_Deserialize (INOUT BasicStringView<T> &str) __NE___
 	{
 		StaticAssert( IsTriviallyDestructible<T> );
-		CHECK_ERR( allocator );
 
 		uint	len		= 0;
 		bool	res		= stream.Read( OUT len );
@@ -487,6 +537,25 @@ namespace AE::Serializing
 			return true;
 		}
 
+		if ( inPlaceLayout )
+		{
+			if_unlikely( not _SkipInPlacePadding() )
+				return false;
+
+			if ( inPlaceViews )
+			{
+				// with null terminator
+				if ( const T* src = _ReadInPlace<T>( len+1 ))
+				{
+					CHECK_ERR( src[len] == T(0) );
+					str = BasicStringView<T>{ src, len };
+					return true;
+				}
+			}
+		}
+
+		CHECK_ERR( allocator );
+
 		T*	dst = Cast<T>( allocator->Allocate( SizeAndAlign{ SizeOf<T> * (len+1), AlignOf<T> }));
 		if_unlikely( dst == null )
 			return false;
@@ -494,6 +563,9 @@ namespace AE::Serializing
 		str = BasicStringView<T>{ dst, len };
 		res = stream.Read( OUT dst, SizeOf<T> * len );
 
+		if ( inPlaceLayout )
+			res = res and stream.Skip( SizeOf<T> );	// null terminator
+
 		dst[len] = T(0);
 		return res;
 	}
@@ -7,6 +7,20 @@
 namespace AE::Serializing
 {
 
+	template <typename T>
+	bool  Serializer::_WriteInPlacePadding () __NE___
+	{
+		// [ubyte padding] [padding bytes] [aligned data]
+		const Bytes		pad		= stream.AlignmentPadding( AlignOf<T>, SizeOf<ubyte> );
+		const ubyte		zeros	[alignof(T)] = {};
+
+		CHECK_ERR( pad < Sizeof(zeros) );
+
+		return	stream.Write( ubyte(pad) ) and
+				((pad == 0) or stream.Write( zeros, pad ));
+	}
+
+
 	template <typename T>
 	bool  Serializer::_SerializeObj (const T &obj) __NE___
 	{
@@ -89,7 +103,15 @@ namespace AE::Serializing
 		bool	res = stream.Write( CheckCast<uint>(arr.size()) );
 
 		if constexpr( IsTriviallySerializable<T> )
-			return res and (arr.empty() or stream.Write( arr.data(), SizeOf<T> * arr.size() ));
+		{
+			if ( arr.empty() )
+				return res;
+
+			if ( inPlaceLayout )
+				res = res and _WriteInPlacePadding<T>();
+
+			return res and stream.Write( arr.data(), SizeOf<T> * arr.size() );
+		}
 		else
 		{
 			for (usize i = 0; (i < arr.size()) and res; ++i) {
@@ -104,8 +126,20 @@ namespace AE::Serializing
 	bool  Serializer::_Serialize (BasicStringView<T> str) __NE___
 	{
 		CHECK_ERR( str.length() <= MaxStringLength );
-		return	stream.Write( CheckCast<uint>(str.length()) )	and
-				(str.empty() or stream.Write( str.data(), StringSizeOf(str) ));
+
+		bool	res = stream.Write( CheckCast<uint>(str.length()) );
+
+		if ( str.empty() )
+			return res;
+
+		if ( inPlaceLayout )
+		{
+			// null terminated to allow 'NtStringView' on in-place data
+			return	res and _WriteInPlacePadding<T>()				and
+					stream.Write( str.data(), StringSizeOf(str) )	and
+					stream.Write( T(0) );
+		}
+		return res and stream.Write( str.data(), StringSizeOf(str) );
 	}
 
 
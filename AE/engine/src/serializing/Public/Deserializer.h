@@ -1,6 +1,12 @@
 // Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
 /*
 	Thread-safe:  no
+
+	In-place layout:
+		'inPlaceLayout' must match with 'Serializer::inPlaceLayout'.
+		If 'inPlaceViews' is 'true' then 'ArrayView' and 'StringView' will point to the source memory
+		instead of copying into 'allocator', source memory must outlive deserialized objects.
+		Allocator is used as a fallback if data is not contiguous or not aligned.
 */
 
 #pragma once
@@ -27,6 +33,8 @@ namespace AE::Serializing
 		FastRStream					stream;
 		Ptr<const ObjectFactory>	factory;		// optional
 		Ptr<IAllocator>				allocator;		// optional
+		bool						inPlaceLayout	= false;
+		bool						inPlaceViews	= false;
 
 	private:
 		#if AE_DEBUG_SERIALIZER
@@ -48,6 +56,9 @@ namespace AE::Serializing
 		template <typename Arg0, typename ...Args>
 		ND_ bool  _RecursiveDeserialize (INOUT Arg0 &arg0, INOUT Args& ...args)					__NE___;
 
+											ND_ bool  _SkipInPlacePadding ()					__NE___;
+		template <typename T>				ND_ const T*  _ReadInPlace (usize count)			__NE___;
+
 		template <typename T>				ND_ bool  _DeserializeObj (INOUT T &)				__NE___;
 		template <typename T>				ND_ bool  _Deserialize (INOUT T &)					__NE___;
 		template <typename F, typename S>	ND_ bool  _Deserialize (INOUT Pair<F,S> &)			__NE___;
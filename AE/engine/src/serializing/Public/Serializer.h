@@ -1,6 +1,12 @@
 // Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
 /*
 	Thread-safe:  no
+
+	In-place layout:
+		Trivially serializable arrays and strings are aligned to the natural alignment of the element type
+		and strings are stored with null terminator.
+		Data can be used without copying if the source memory is persistent, see 'Deserializer::inPlaceViews'.
+		Layout is not compatible with default layout, use version in the file header to distinguish them.
 */
 
 #pragma once
@@ -28,6 +34,7 @@ namespace AE::Serializing
 	public:
 		FastWStream					stream;
 		Ptr<const ObjectFactory>	factory;
+		bool						inPlaceLayout	= false;
 
 	private:
 		#if AE_DEBUG_SERIALIZER
@@ -50,6 +57,8 @@ namespace AE::Serializing
 		template <typename Arg0, typename ...Args>
 		ND_ bool  _RecursiveSerialize (const Arg0 &arg0, const Args& ...args)					__NE___;
 
+		template <typename T>				ND_ bool  _WriteInPlacePadding ()					__NE___;
+
 		template <typename T>				ND_ bool  _SerializeObj (const T &)					__NE___;
 		template <typename T>				ND_ bool  _Serialize (const T &)					__NE___;
 		template <typename F, typename S>	ND_ bool  _Serialize (const Pair<F,S> &)			__NE___;
@@ -23,8 +23,9 @@
 #	define AE_ENABLE_DATA_RACE_CHECK	0
 #endif
 
-// TODO: ThreadWakeup is slow
-#define AE_USE_THREAD_WAKEUP	0
+// 1 - idle worker threads spin and then park on futex until task is added
+// 0 - idle worker threads sleep with progressively increasing interval
+#define AE_USE_THREAD_WAKEUP	1
 
 
 namespace AE::Threading
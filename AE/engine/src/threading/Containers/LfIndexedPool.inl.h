@@ -240,8 +240,7 @@ namespace AE::Threading
 		LowLvlChunkArray_t*	low_chunks		= highChunk.chunksPtr.load();
 		HighLvlBits_t		hi_available	= ~highChunk.available.load();		// 1 - unassigned
 		int					chunk_idx		= BitScanForward( hi_available );	// first 1 bit
-
-		// TODO: offset 'chunk_idx' by thread id
+		int					thread_chunk	= -1;
 
 		NonNull( low_chunks );
 
@@ -250,6 +249,7 @@ namespace AE::Threading
 			LowLevelChunk&	low_chunk		= (*low_chunks)[ chunk_idx ];
 			LowLvlBits_t	low_available	= low_chunk.assigned.load();		// 0 - unassigned
 			int				idx				= BitScanForward( ~low_available );	// first 0 bit
+			int				next_chunk		= -1;
 
 			for (; idx >= 0;)
 			{
@@ -272,10 +272,30 @@ namespace AE::Threading
 					return true;
 				}
 
+				// Another thread acquired this index.
+				// Switch to the chunk which depends on thread ID, so threads will not compete for the same bits.
+				// Single-threaded allocation still returns sequential indices.
+				if_unlikely( thread_chunk < 0 )
+				{
+					thread_chunk = int(ThreadUtils::GetIntID() & (HighLvlCount-1));
+
+					if ( thread_chunk != chunk_idx and HasBit( hi_available, thread_chunk ))
+					{
+						next_chunk = thread_chunk;
+						break;
+					}
+				}
+
 				idx = BitScanForward( ~low_available );	// first 0 bit
 				ThreadUtils::Pause();
 			}
 
+			if_unlikely( next_chunk >= 0 )
+			{
+				chunk_idx = next_chunk;
+				continue;
+			}
+
 			hi_available &= ~(HighLvlBits_t{1} << chunk_idx);	// 1 -> 0
 			chunk_idx	 = BitScanForward( hi_available );		// first 1 bit
 		}
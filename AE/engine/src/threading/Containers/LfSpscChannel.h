@@ -0,0 +1,112 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+/*
+	Bounded single-producer single-consumer FIFO channel.
+	'Push', 'PushBatch' must be used only in one thread at a time (producer).
+	'Pop', 'PopBatch' must be used only in one thread at a time (consumer).
+	Producer and consumer are wait-free.
+	'Release' method must be synchronized with all other methods.
+
+	Producer and consumer keep local copy of the opposite position to reduce cache line transfers,
+	opposite position is reloaded only when local copy indicates that channel is full / empty.
+*/
+
+#pragma once
+
+#ifndef AE_LFAS_ENABLED
+# include "threading/Common.h"
+# include "threading/Primitives/DataRaceCheck.h"
+#endif
+
+namespace AE::Threading
+{
+
+	//
+	// Lock-free Single Producer Single Consumer Channel
+	//
+
+	template <typename ValueType,
+			  usize Count,
+			  typename AllocatorType = UntypedAllocator
+			 >
+	class LfSpscChannel final : public Noncopyable
+	{
+		StaticAssert( Count > 1 and IsPowerOfTwo( Count ));
+
+	// types
+	public:
+		using Self			= LfSpscChannel< ValueType, Count, AllocatorType >;
+		using Value_t		= ValueType;
+		using Allocator_t	= AllocatorType;
+
+	private:
+		static constexpr usize	_IndexMask	= Count - 1;
+
+		union Slot
+		{
+			Value_t		value;
+			ubyte		data [ sizeof(Value_t) ];	// to avoid ctor for 'Value_t'
+
+			Slot ()		__NE___ { DEBUG_ONLY( DbgInitMem( data, Sizeof(data) )); }
+			~Slot ()	__NE___ {}
+		};
+		using SlotArray_t	= StaticArray< Slot, Count >;
+
+
+	// variables
+	private:
+		// producer
+		alignas(AE_CACHE_LINE) Atomic<usize>	_tail			{0};
+		usize									_cachedHead		= 0;
+
+		// consumer
+		alignas(AE_CACHE_LINE) Atomic<usize>	_head			{0};
+		usize									_cachedTail		= 0;
+
+		alignas(AE_CACHE_LINE) SlotArray_t*		_slots			= null;
+
+		NO_UNIQUE_ADDRESS
+		 Allocator_t		_allocator;
+
+		DRC_ONLY( RWDataRaceCheck	_drCheck;)
+
+
+	// methods
+	public:
+		explicit LfSpscChannel (const Allocator_t &alloc = Allocator_t{}) __NE___;
+		~LfSpscChannel ()							__NE___	{ Release(); }
+
+		ND_ static constexpr usize  Capacity ()		__NE___	{ return Count; }
+		ND_ static constexpr Bytes  DynamicSize ()	__NE___	{ return SizeOf<SlotArray_t>; }
+
+			void  Release ()						__NE___	{ return Release( [](Value_t &value) __NE___ { value.~Value_t(); }); }
+
+			template <typename FN>
+			void  Release (FN &&fn)					__NE___;
+
+		// producer //
+		// returns 'false' if channel is full
+		template <typename T>
+		ND_ bool  Push (T &&value)					__NE___;
+
+		// copy values, returns number of pushed elements
+			usize  PushBatch (ArrayView<Value_t> values) __NE___;
+
+		// consumer //
+		// returns 'false' if channel is empty
+			bool  Pop (OUT Value_t &outValue)		__NE___;
+
+		// move up to 'maxCount' values to 'dst', returns number of extracted elements
+			usize  PopBatch (OUT Value_t* dst, usize maxCount) __NE___;
+
+		// approximate number of elements
+		ND_ usize  Size ()							C_NE___;
+		ND_ bool   Empty ()							C_NE___	{ return Size() == 0; }
+
+	private:
+		ND_ usize  _FreeSpace (usize tail, usize required) __NE___;
+		ND_ usize  _Available (usize head, usize required) __NE___;
+	};
+
+} // AE::Threading
+
+#include "threading/Containers/LfSpscChannel.inl.h"
@@ -0,0 +1,239 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+namespace AE::Threading
+{
+/*
+=================================================
+	constructor
+=================================================
+*/
+	template <typename V, usize C, typename A>
+	LfSpscChannel<V,C,A>::LfSpscChannel (const Allocator_t &alloc) __NE___ :
+		_allocator{ alloc }
+	{
+		DRC_EXLOCK( _drCheck );
+
+		_slots = Cast<SlotArray_t>( _allocator.Allocate( SizeAndAlignOf<SlotArray_t> ));
+		CHECK( _slots != null );
+
+		if ( _slots != null )
+			PlacementNew<SlotArray_t>( OUT _slots );
+
+		// flush changes in '_slots'
+		MemoryBarrier( EMemoryOrder::Release );
+	}
+
+/*
+=================================================
+	Release
+----
+	Must be synchronized with producer and consumer.
+	Can not use after release!
+=================================================
+*/
+	template <typename V, usize C, typename A>
+	template <typename FN>
+	void  LfSpscChannel<V,C,A>::Release (FN &&fn) __NE___
+	{
+		DRC_EXLOCK( _drCheck );
+
+		if_unlikely( _slots == null )
+			return;
+
+		// invalidate cache to load changes in 'Slot::value'
+		MemoryBarrier( EMemoryOrder::Acquire );
+
+		const usize	head	= _head.load( EMemoryOrder::Relaxed );
+		const usize	tail	= _tail.load( EMemoryOrder::Relaxed );
+
+		for (usize pos = head; pos != tail; ++pos)
+		{
+			auto&	slot = (*_slots)[ pos & _IndexMask ];
+
+			CheckNothrow( IsNoExcept( fn( slot.value )));
+			fn( INOUT slot.value );
+		}
+
+		PlacementDelete( INOUT *_slots );
+
+		_allocator.Deallocate( _slots, SizeAndAlign{ SizeOf<SlotArray_t>, AlignOf<SlotArray_t> });
+		_slots = null;
+
+		_head.store( 0, EMemoryOrder::Relaxed );
+		_tail.store( 0, EMemoryOrder::Relaxed );
+		_cachedHead	= 0;
+		_cachedTail	= 0;
+	}
+
+/*
+=================================================
+	_FreeSpace
+----
+	Returns number of elements which can be written,
+	'_head' is reloaded only if cached value is not enough.
+=================================================
+*/
+	template <typename V, usize C, typename A>
+	usize  LfSpscChannel<V,C,A>::_FreeSpace (const usize tail, const usize required) __NE___
+	{
+		usize	free = C - (tail - _cachedHead);
+
+		if ( free < required )
+		{
+			// invalidate cache to make visible that consumer has finished with slots
+			_cachedHead	= _head.load( EMemoryOrder::Acquire );
+			free		= C - (tail - _cachedHead);
+		}
+		ASSERT( free <= C );
+		return free;
+	}
+
+/*
+=================================================
+	_Available
+----
+	Returns number of elements which can be read,
+	'_tail' is reloaded only if cached value is not enough.
+=================================================
+*/
+	template <typename V, usize C, typename A>
+	usize  LfSpscChannel<V,C,A>::_Available (const usize head, const usize required) __NE___
+	{
+		usize	avail = _cachedTail - head;
+
+		if ( avail < required )
+		{
+			// invalidate cache to load changes in 'Slot::value'
+			_cachedTail	= _tail.load( EMemoryOrder::Acquire );
+			avail		= _cachedTail - head;
+		}
+		ASSERT( avail <= C );
+		return avail;
+	}
+
+/*
+=================================================
+	Push
+=================================================
+*/
+	template <typename V, usize C, typename A>
+	template <typename T>
+	bool  LfSpscChannel<V,C,A>::Push (T &&value) __NE___
+	{
+		DRC_SHAREDLOCK( _drCheck );
+
+		CHECK_ERR( _slots != null );
+
+		const usize	tail = _tail.load( EMemoryOrder::Relaxed );
+
+		if_unlikely( _FreeSpace( tail, 1 ) == 0 )
+			return false;	// full
+
+		PlacementNew<Value_t>( OUT std::addressof( (*_slots)[ tail & _IndexMask ].value ), FwdArg<T>(value) );
+
+		// flush cache to make visible changes in 'Slot::value' for consumer
+		_tail.store( tail + 1, EMemoryOrder::Release );
+		return true;
+	}
+
+/*
+=================================================
+	PushBatch
+=================================================
+*/
+	template <typename V, usize C, typename A>
+	usize  LfSpscChannel<V,C,A>::PushBatch (ArrayView<Value_t> values) __NE___
+	{
+		DRC_SHAREDLOCK( _drCheck );
+
+		CHECK_ERR( _slots != null );
+
+		const usize	tail	= _tail.load( EMemoryOrder::Relaxed );
+		const usize	count	= Min( _FreeSpace( tail, values.size() ), values.size() );
+
+		for (usize i = 0; i < count; ++i)
+		{
+			PlacementNew<Value_t>( OUT std::addressof( (*_slots)[ (tail + i) & _IndexMask ].value ), values[i] );
+		}
+
+		// flush cache to make visible changes in 'Slot::value' for consumer
+		if_likely( count > 0 )
+			_tail.store( tail + count, EMemoryOrder::Release );
+
+		return count;
+	}
+
+/*
+=================================================
+	Pop
+=================================================
+*/
+	template <typename V, usize C, typename A>
+	bool  LfSpscChannel<V,C,A>::Pop (OUT Value_t &outValue) __NE___
+	{
+		DRC_SHAREDLOCK( _drCheck );
+
+		CHECK_ERR( _slots != null );
+
+		const usize	head = _head.load( EMemoryOrder::Relaxed );
+
+		if_unlikely( _Available( head, 1 ) == 0 )
+			return false;	// empty
+
+		auto&	slot = (*_slots)[ head & _IndexMask ];
+
+		outValue = RVRef( slot.value );
+		PlacementDelete( INOUT slot.value );
+
+		// slot can be reused by producer
+		_head.store( head + 1, EMemoryOrder::Release );
+		return true;
+	}
+
+/*
+=================================================
+	PopBatch
+=================================================
+*/
+	template <typename V, usize C, typename A>
+	usize  LfSpscChannel<V,C,A>::PopBatch (OUT Value_t* dst, const usize maxCount) __NE___
+	{
+		DRC_SHAREDLOCK( _drCheck );
+
+		CHECK_ERR( _slots != null );
+		CHECK_ERR( dst != null or maxCount == 0 );
+
+		const usize	head	= _head.load( EMemoryOrder::Relaxed );
+		const usize	count	= Min( _Available( head, maxCount ), maxCount );
+
+		for (usize i = 0; i < count; ++i)
+		{
+			auto&	slot = (*_slots)[ (head + i) & _IndexMask ];
+
+			dst[i] = RVRef( slot.value );
+			PlacementDelete( INOUT slot.value );
+		}
+
+		// slots can be reused by producer
+		if_likely( count > 0 )
+			_head.store( head + count, EMemoryOrder::Release );
+
+		return count;
+	}
+
+/*
+=================================================
+	Size
+=================================================
+*/
+	template <typename V, usize C, typename A>
+	usize  LfSpscChannel<V,C,A>::Size () C_NE___
+	{
+		const usize	head	= _head.load( EMemoryOrder::Relaxed );
+		const usize	tail	= _tail.load( EMemoryOrder::Relaxed );
+
+		return tail > head ? Min( tail - head, C ) : 0;
+	}
+
+
+} // AE::Threading
@@ -0,0 +1,101 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+/*
+	Bounded multi-producer multi-consumer FIFO queue.
+	Based on Dmitry Vyukov's bounded MPMC queue: each cell has a sequence number which is used
+	to detect whether the cell is ready for writing or reading, so producers and consumers
+	synchronize only on a single cell and on enqueue/dequeue position.
+
+	You can use 'Push', 'Pop' methods without any syncs.
+	'Release' method must be synchronized with 'Push' and 'Pop' methods.
+
+	Enqueue and dequeue positions are placed in separate cache lines to avoid false sharing
+	between producers and consumers.
+*/
+
+#pragma once
+
+#ifndef AE_LFAS_ENABLED
+# include "threading/Common.h"
+# include "threading/Primitives/DataRaceCheck.h"
+#endif
+
+namespace AE::Threading
+{
+
+	//
+	// Lock-free Static Queue
+	//
+
+	template <typename ValueType,
+			  usize Count,
+			  typename AllocatorType = UntypedAllocator
+			 >
+	class LfStaticQueue final : public Noncopyable
+	{
+		StaticAssert( Count > 1 and IsPowerOfTwo( Count ));
+
+	// types
+	public:
+		using Self			= LfStaticQueue< ValueType, Count, AllocatorType >;
+		using Value_t		= ValueType;
+		using Allocator_t	= AllocatorType;
+
+	private:
+		static constexpr usize	_IndexMask	= Count - 1;
+
+		struct Cell
+		{
+			Atomic<usize>		seq		{0};	// == pos		- ready for writing
+												// == pos + 1	- ready for reading
+			union {
+				Value_t			value;
+				ubyte			data [ sizeof(Value_t) ];	// to avoid ctor for 'Value_t'
+			};
+
+			Cell ()		__NE___ { DEBUG_ONLY( DbgInitMem( data, Sizeof(data) )); }
+			~Cell ()	__NE___ {}
+		};
+		using CellArray_t	= StaticArray< Cell, Count >;
+
+
+	// variables
+	private:
+		alignas(AE_CACHE_LINE) Atomic<usize>	_enqueuePos		{0};
+		alignas(AE_CACHE_LINE) Atomic<usize>	_dequeuePos		{0};
+
+		alignas(AE_CACHE_LINE) CellArray_t*		_cells			= null;
+
+		NO_UNIQUE_ADDRESS
+		 Allocator_t		_allocator;
+
+		DRC_ONLY( RWDataRaceCheck	_drCheck;)
+
+
+	// methods
+	public:
+		explicit LfStaticQueue (const Allocator_t &alloc = Allocator_t{}) __NE___;
+		~LfStaticQueue ()							__NE___	{ Release(); }
+
+		ND_ static constexpr usize  Capacity ()		__NE___	{ return Count; }
+		ND_ static constexpr Bytes  DynamicSize ()	__NE___	{ return SizeOf<CellArray_t>; }
+
+			void  Release ()						__NE___	{ return Release( [](Value_t &value) __NE___ { value.~Value_t(); }); }
+
+			template <typename FN>
+			void  Release (FN &&fn)					__NE___;
+
+		// returns 'false' if queue is full
+		template <typename T>
+		ND_ bool  Push (T &&value)					__NE___;
+
+		// returns 'false' if queue is empty
+			bool  Pop (OUT Value_t &outValue)		__NE___;
+
+		// approximate number of elements
+		ND_ usize  Size ()							C_NE___;
+		ND_ bool   Empty ()							C_NE___	{ return Size() == 0; }
+	};
+
+} // AE::Threading
+
+#include "threading/Containers/LfStaticQueue.inl.h"
@@ -0,0 +1,190 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+namespace AE::Threading
+{
+/*
+=================================================
+	constructor
+=================================================
+*/
+	template <typename V, usize C, typename A>
+	LfStaticQueue<V,C,A>::LfStaticQueue (const Allocator_t &alloc) __NE___ :
+		_allocator{ alloc }
+	{
+		DRC_EXLOCK( _drCheck );
+
+		_cells = Cast<CellArray_t>( _allocator.Allocate( SizeAndAlignOf<CellArray_t> ));
+		CHECK( _cells != null );
+
+		if ( _cells != null )
+		{
+			PlacementNew<CellArray_t>( OUT _cells );
+
+			for (usize i = 0; i < C; ++i) {
+				(*_cells)[i].seq.store( i, EMemoryOrder::Relaxed );
+			}
+		}
+
+		// flush changes in '_cells'
+		MemoryBarrier( EMemoryOrder::Release );
+	}
+
+/*
+=================================================
+	Release
+----
+	Must be synchronized with 'Push()' and 'Pop()'
+	Can not use after release!
+=================================================
+*/
+	template <typename V, usize C, typename A>
+	template <typename FN>
+	void  LfStaticQueue<V,C,A>::Release (FN &&fn) __NE___
+	{
+		DRC_EXLOCK( _drCheck );
+
+		if_unlikely( _cells == null )
+			return;
+
+		// invalidate cache to load changes in 'Cell::value'
+		MemoryBarrier( EMemoryOrder::Acquire );
+
+		const usize	first	= _dequeuePos.load( EMemoryOrder::Relaxed );
+		const usize	last	= _enqueuePos.load( EMemoryOrder::Relaxed );
+
+		for (usize pos = first; pos != last; ++pos)
+		{
+			auto&	cell = (*_cells)[ pos & _IndexMask ];
+
+			ASSERT( cell.seq.load( EMemoryOrder::Relaxed ) == pos + 1 );
+
+			CheckNothrow( IsNoExcept( fn( cell.value )));
+			fn( INOUT cell.value );
+		}
+
+		PlacementDelete( INOUT *_cells );
+
+		_allocator.Deallocate( _cells, SizeAndAlign{ SizeOf<CellArray_t>, AlignOf<CellArray_t> });
+		_cells = null;
+
+		_enqueuePos.store( 0, EMemoryOrder::Relaxed );
+		_dequeuePos.store( 0, EMemoryOrder::Relaxed );
+	}
+
+/*
+=================================================
+	Push
+=================================================
+*/
+	template <typename V, usize C, typename A>
+	template <typename T>
+	bool  LfStaticQueue<V,C,A>::Push (T &&value) __NE___
+	{
+		DRC_SHAREDLOCK( _drCheck );
+
+		CHECK_ERR( _cells != null );
+
+		usize	pos = _enqueuePos.load( EMemoryOrder::Relaxed );
+
+		for (;;)
+		{
+			auto&		cell	= (*_cells)[ pos & _IndexMask ];
+			const usize	seq		= cell.seq.load( EMemoryOrder::Acquire );
+			const ssize	diff	= ssize(seq) - ssize(pos);
+
+			if_likely( diff == 0 )
+			{
+				// try to acquire cell
+				if_likely( _enqueuePos.CAS( INOUT pos, pos + 1, EMemoryOrder::Relaxed, EMemoryOrder::Relaxed ))
+				{
+					PlacementNew<Value_t>( OUT std::addressof(cell.value), FwdArg<T>(value) );
+
+					// flush cache to make visible changes in 'cell.value' for all threads
+					// and mark cell as ready for reading
+					cell.seq.store( pos + 1, EMemoryOrder::Release );
+					return true;
+				}
+			}
+			else
+			if ( diff < 0 )
+			{
+				// cell is not yet read by consumer - queue is full
+				return false;
+			}
+			else
+			{
+				// another producer acquired this cell
+				pos = _enqueuePos.load( EMemoryOrder::Relaxed );
+			}
+
+			ThreadUtils::Pause();
+		}
+	}
+
+/*
+=================================================
+	Pop
+=================================================
+*/
+	template <typename V, usize C, typename A>
+	bool  LfStaticQueue<V,C,A>::Pop (OUT Value_t &outValue) __NE___
+	{
+		DRC_SHAREDLOCK( _drCheck );
+
+		CHECK_ERR( _cells != null );
+
+		usize	pos = _dequeuePos.load( EMemoryOrder::Relaxed );
+
+		for (;;)
+		{
+			auto&		cell	= (*_cells)[ pos & _IndexMask ];
+			const usize	seq		= cell.seq.load( EMemoryOrder::Acquire );
+			const ssize	diff	= ssize(seq) - ssize(pos + 1);
+
+			if_likely( diff == 0 )
+			{
+				// try to acquire cell
+				if_likely( _dequeuePos.CAS( INOUT pos, pos + 1, EMemoryOrder::Relaxed, EMemoryOrder::Relaxed ))
+				{
+					outValue = RVRef( cell.value );
+
+					PlacementDelete( INOUT cell.value );
+
+					// flush cache to make visible changes in 'cell.value' for all threads
+					// and mark cell as ready for writing in the next round
+					cell.seq.store( pos + C, EMemoryOrder::Release );
+					return true;
+				}
+			}
+			else
+			if ( diff < 0 )
+			{
+				// cell is not yet written by producer - queue is empty
+				return false;
+			}
+			else
+			{
+				// another consumer acquired this cell
+				pos = _dequeuePos.load( EMemoryOrder::Relaxed );
+			}
+
+			ThreadUtils::Pause();
+		}
+	}
+
+/*
+=================================================
+	Size
+=================================================
+*/
+	template <typename V, usize C, typename A>
+	usize  LfStaticQueue<V,C,A>::Size () C_NE___
+	{
+		const usize	first	= _dequeuePos.load( EMemoryOrder::Relaxed );
+		const usize	last	= _enqueuePos.load( EMemoryOrder::Relaxed );
+
+		return last > first ? Min( last - first, C ) : 0;
+	}
+
+
+} // AE::Threading
@@ -222,15 +222,24 @@ namespace AE::Threading
 	constructor
 =================================================
 */
-	UnixAsyncRDataSource::UnixAsyncRDataSource (Handle_t file, EMode mode DEBUG_ONLY(, Path filename)) __NE___ :
+	UnixAsyncRDataSource::UnixAsyncRDataSource (Handle_t file, EMode mode, const char* filename) __NE___ :
 		_file{ file },
 		_fileSize{ GetFileSize( _file )},
-		_mode{ mode }
+		_mode{ ValidateReadMode( _file, mode )}
 		DEBUG_ONLY(, _filename{ FileSystem::ToAbsolute( filename )})
-	{}
+	{
+		// unaligned requests can not be processed with O_DIRECT, so they use another file descriptor with page cache
+		if ( IsOpen() and AllBits( _mode, EMode::Direct ))
+		{
+			_bufferedFile = OpenFileForRead( filename, (_mode & ~EMode::Direct) | EMode::NoReuse );
+
+			if_unlikely( _bufferedFile < 0 )
+				UNIX_CHECK_DEV( "Can't open file: \""s << filename << "\": " );
+		}
+	}
 
 	UnixAsyncRDataSource::UnixAsyncRDataSource (const char* filename, EMode mode)	__NE___ :
-		UnixAsyncRDataSource{ Handle_t{OpenFileForRead( filename, mode )}, mode DEBUG_ONLY(, filename )}
+		UnixAsyncRDataSource{ Handle_t{OpenFileForRead( filename, mode )}, mode, filename }
 	{
 		if_unlikely( not IsOpen() )
 			UNIX_CHECK_DEV( "Can't open file: \""s << filename << "\": " );
@@ -247,10 +256,35 @@ namespace AE::Threading
 */
 	UnixAsyncRDataSource::~UnixAsyncRDataSource () __NE___
 	{
+		if ( _bufferedFile >= 0 )
+			::close( _bufferedFile );
+
 		if ( IsOpen() )
 			::close( _file );
 	}
 
+/*
+=================================================
+	Handle
+=================================================
+*/
+	UnixAsyncRDataSource::Handle_t  UnixAsyncRDataSource::Handle (const Bytes pos, const void* data, const Bytes dataSize) C_NE___
+	{
+		if ( _bufferedFile < 0 )
+			return _file;
+
+		constexpr Bytes	align = UnixFileRStream::DirectIOAlign;
+
+		// O_DIRECT requires aligned size even for the last block (EINVAL otherwise),
+		// buffer capacity is unknown here, so 'ReadBlock()' must extend size of the last block.
+		if ( IsMultipleOf( pos, align )			and
+			 IsMultipleOf( dataSize, align )	and
+			 CheckPointerAlignment( data, usize{align} ))
+			return _file;
+
+		return _bufferedFile;
+	}
+
 /*
 =================================================
 	GetSourceType
@@ -280,7 +314,18 @@ namespace AE::Threading
 
 	AsyncDSRequest  UnixAsyncRDataSource::ReadBlock (Bytes pos, Bytes size) __NE___
 	{
-		RC<SharedMem>	mem		= SharedMem::Create( AE::GetDefaultAllocator(), size );	// TODO: optimize
+		Bytes	align = DefaultAllocatorAlign;
+
+		// In 'Direct' mode memory is aligned and the last block is extended to aligned size,
+		// so request which ends at the end of file can be processed with O_DIRECT.
+		if ( _bufferedFile >= 0 )
+		{
+			align = UnixFileRStream::DirectIOAlign;
+			if ( IsMultipleOf( pos, align ) and pos + size >= _fileSize )
+				size = AlignUp( size, align );
+		}
+
+		RC<SharedMem>	mem		= SharedMem::Create( AE::GetDefaultAllocator(), size, align );	// TODO: optimize
 		void*			data	= mem ? mem->Data() : null;
 		return ReadBlock( pos, data, size, RVRef(mem) );
 	}
@@ -270,7 +270,8 @@ namespace AE::Threading
 
 	// variables
 	private:
-		Handle_t		_file		= -1;
+		Handle_t		_file			= -1;
+		Handle_t		_bufferedFile	= -1;	// for unaligned requests in 'Direct' mode
 		const Bytes		_fileSize;
 		const EMode		_mode;
 
@@ -279,7 +280,7 @@ namespace AE::Threading
 
 	// methods
 	private:
-		UnixAsyncRDataSource (Handle_t file, EMode mode DEBUG_ONLY(, Path filename))		__NE___;
+		UnixAsyncRDataSource (Handle_t file, EMode mode, const char* filename)				__NE___;
 
 	public:
 		explicit UnixAsyncRDataSource (const char* filename, EMode mode = c_DefaultMode)	__NE___;
@@ -291,6 +292,12 @@ namespace AE::Threading
 
 		ND_ Handle_t	Handle ()															__NE___	{ return _file; }
 
+		// In 'Direct' mode returns handle with O_DIRECT flag only if 'pos', 'data' and 'dataSize' are aligned to 'DirectIOAlign',
+		// otherwise returns handle which uses page cache.
+		ND_ Handle_t	Handle (Bytes pos, const void* data, Bytes dataSize)				C_NE___;
+
+		ND_ EMode		Mode ()																C_NE___	{ return _mode; }
+
 
 		// AsyncRDataSource //
 		bool			IsOpen ()															C_NE_OV	{ return _file >= 0; }
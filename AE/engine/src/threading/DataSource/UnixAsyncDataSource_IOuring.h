@@ -71,7 +71,7 @@ namespace AE::Threading
 		io_uring_sqe*	sqe = ::io_uring_get_sqe( &ring );
 		CHECK_ERR( sqe != null );
 
-		::io_uring_prep_read( sqe, _dataSource->Handle(), data, unsigned{dataSize}, ulong{pos} );
+		::io_uring_prep_read( sqe, _dataSource->Handle( pos, data, dataSize ), data, unsigned{dataSize}, ulong{pos} );
 		::io_uring_sqe_set_data( sqe, this );
 		int		cnt = ::io_uring_submit( &ring );
 
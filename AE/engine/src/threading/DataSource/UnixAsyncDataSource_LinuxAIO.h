@@ -188,7 +188,7 @@ namespace AE::Threading
 		auto&		cb		= _aioCb.Ref< iocb >();
 		ZeroMem( OUT cb );
 
-		cb.aio_fildes		= _dataSource->Handle();
+		cb.aio_fildes		= _dataSource->Handle( pos, data, dataSize );
 		cb.aio_lio_opcode	= IOCB_CMD_PREAD;
 		cb.aio_buf			= PtrToInt<__u64>( data );
 		cb.aio_offset		= slong{pos};		// TODO: may be mutable?
@@ -77,7 +77,7 @@ namespace AE::Threading
 		auto&	cb = _aioCb.Ref< aiocb >();
 		ZeroMem( OUT cb );
 
-		cb.aio_fildes	= _dataSource->Handle();
+		cb.aio_fildes	= _dataSource->Handle( pos, data, dataSize );
 		cb.aio_offset	= slong{pos};	// mutable
 		cb.aio_buf		= data;
 		cb.aio_nbytes	= ulong{dataSize};
@@ -237,6 +237,10 @@ namespace AE::Threading
 		ASSERT( IsOpen() );
 		if ( IsOpen() )
 		{
+			// unaligned requests in 'Direct' mode
+			if ( _bufferedFile >= 0 )
+				Unused( ::aio_cancel( _bufferedFile, null ));
+
 			int ret = ::aio_cancel( Handle(), null );
 			switch ( ret )
 			{
@@ -6,6 +6,10 @@
 # include "threading/Primitives/SpinLock.h"
 # include "threading/Primitives/SyncEvent.h"
 # include "threading/Primitives/DataRaceCheck.h"
+# include "threading/Memory/MemoryProfiler.h"
+#endif
+#ifndef MEMPROF_ONLY
+#	define MEMPROF_ONLY( /* code */... )
 #endif
 
 #ifdef AE_DEBUG
@@ -111,7 +115,7 @@ namespace AE::Threading
 								const BlockAllocator_t&	blockAlloc	= Default,
 								const GenAllocator_t&	genAlloc	= Default) __NE___;
 
-		~LfFixedBlockAllocator ()							__NE___	{ Release( True{"checkMemLeak"} ); }
+		~LfFixedBlockAllocator ()							__NE___;
 
 			void	Release (Bool checkMemLeak)				__NE___;
 
@@ -52,6 +52,18 @@ namespace AE::Threading
 		}
 	}
 
+/*
+=================================================
+	destructor
+=================================================
+*/
+	template <usize CS, usize MC, typename BA, typename GA>
+	LfFixedBlockAllocator<CS,MC,BA,GA>::~LfFixedBlockAllocator () __NE___
+	{
+		Release( True{"checkMemLeak"} );
+		MEMPROF_ONLY( MemoryProfilerApi::Unregister( this );)
+	}
+
 /*
 =================================================
 	Release
@@ -129,6 +141,8 @@ namespace AE::Threading
 		if ( atom_cnt and lock_cnt )
 			AE_LOGI( "atomic iteration count: "s << ToString( atom_cnt ) << ",  lock count: " << ToString( lock_cnt ));
 	  #endif
+
+		MEMPROF_ONLY( MemoryProfilerApi::Discard( this );)
 	}
 
 /*
@@ -171,7 +185,10 @@ namespace AE::Threading
 				Ptr_t	ptr = _Alloc( uint(idx + i * CT_SizeOfInBits<TopLevelBits_t>), loc, INOUT dbg.counter, INOUT dbg.locks );
 
 				if_likely( ptr != null )
+				{
+					MEMPROF_ONLY( MemoryProfilerApi::Allocate( this, MemoryProfilerApi::EAllocator::FixedBlock, ptr, BlockSize() );)
 					return ptr;
+				}
 
 				idx = available.ExtractBitIndex();
 			}
@@ -380,6 +397,8 @@ namespace AE::Threading
 				return false;
 			}
 
+			MEMPROF_ONLY( MemoryProfilerApi::Deallocate( this, ptr, BlockSize() );)
+
 			// update high level bits
 			if_unlikely( old_bits.All() )
 			{
@@ -1,10 +1,101 @@
 // Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+/*
+	Lock-free linear allocator.
+	Each allocation is an atomic CAS on the shared block offset.
+
+	If 'ThreadRegion_v' is not zero then each thread reserves a region of this size
+	and allocates small objects inside it without atomics, region is refilled from the shared blocks.
+	'Discard()' and 'Release()' invalidate all thread regions.
+	Unused space at the end of the region is lost until 'Discard()'.
+	Thread cache has limited number of slots, if all slots are used by other allocators
+	then shared blocks are used instead.
+*/
 
 #pragma once
 
 #ifndef AE_LFAS_ENABLED
 # include "threading/Primitives/DataRaceCheck.h"
+# include "threading/Memory/MemoryProfiler.h"
 #endif
+#ifndef MEMPROF_ONLY
+#	define MEMPROF_ONLY( /* code */... )
+#endif
+
+namespace AE::Threading::_hidden_
+{
+	//
+	// Linear Allocator Thread Cache
+	//
+	struct LfLinearAllocatorThreadCache
+	{
+		struct Region
+		{
+			const void*		owner	= null;
+			ulong			epoch	= 0;
+			void*			mem		= null;
+			Bytes			offset;
+		};
+
+		static constexpr uint	Ways		= 4;
+		static constexpr uint	SetsLog2	= 3;
+		static constexpr uint	Sets		= 1u << SetsLog2;
+
+		StaticArray< Region, Sets * Ways >	regions;
+
+		// Set associative, returns region of 'owner' or free region.
+		// Returns null if all ways are occupied by other allocators,
+		// their regions are not evicted because unused space can not be returned to the allocator.
+		ND_ static Region*  Find (const void* owner) __NE___
+		{
+			auto&		cache	= _Instance();
+			const usize	first	= _SetIndex( owner ) * Ways;
+			Region*		free	= null;
+
+			for (usize i = first; i < first + Ways; ++i)
+			{
+				Region&	r = cache.regions[i];
+
+				if ( r.owner == owner )
+					return &r;
+
+				if ( r.owner == null and free == null )
+					free = &r;
+			}
+			return free;
+		}
+
+		// Frees region of 'owner' in current thread.
+		static void  Remove (const void* owner) __NE___
+		{
+			Region*	r = Find( owner );
+			if ( r != null and r->owner == owner )
+				*r = Region{};
+		}
+
+		// unique for each allocator and each 'Discard()', so stale region will never be reused
+		ND_ static ulong  NextEpoch () __NE___
+		{
+			static std::atomic<ulong>	s_epoch {1};
+			return s_epoch.fetch_add( 1, std::memory_order_relaxed );
+		}
+
+	private:
+		ND_ static LfLinearAllocatorThreadCache&  _Instance () __NE___
+		{
+			static thread_local LfLinearAllocatorThreadCache	t_cache;
+			return t_cache;
+		}
+
+		// Fibonacci hashing, high bits of the product are used
+		ND_ static usize  _SetIndex (const void* owner) __NE___
+		{
+			const ulong	h = ulong(usize(owner) / AE_CACHE_LINE) * 0x9E3779B97F4A7C15ull;
+			return usize( h >> (64 - SetsLog2) );
+		}
+	};
+
+} // AE::Threading::_hidden_
+
 
 namespace AE::Threading
 {
@@ -17,17 +108,19 @@ namespace AE::Threading
 	template <usize BlockSize_v		= usize(SmallAllocationSize),	// in bytes
 			  usize MemAlign		= AE_CACHE_LINE,				// in bytes
 			  usize MaxBlocks_v		= 16,
-			  typename AllocatorType = UntypedAllocator
+			  typename AllocatorType = UntypedAllocator,
+			  usize ThreadRegion_v	= 0								// in bytes, 0 - disabled
 			 >
 	class LfLinearAllocator final : public IAllocatorTS
 	{
 		StaticAssert( BlockSize_v > 0 and IsMultipleOf( BlockSize_v, MemAlign ));
 		StaticAssert( MaxBlocks_v > 0 and MaxBlocks_v < 64 );
 		StaticAssert( MemAlign > 0 and IsPowerOfTwo( MemAlign ));
+		StaticAssert( ThreadRegion_v <= BlockSize_v and IsMultipleOf( ThreadRegion_v, MemAlign ));
 
 	// types
 	public:
-		using Self			= LfLinearAllocator< BlockSize_v, MemAlign, MaxBlocks_v, AllocatorType >;
+		using Self			= LfLinearAllocator< BlockSize_v, MemAlign, MaxBlocks_v, AllocatorType, ThreadRegion_v >;
 		using Index_t		= uint;
 		using Allocator_t	= AllocatorType;
 
@@ -39,8 +132,12 @@ namespace AE::Threading
 		};
 		using MemBlocks_t = StaticArray< MemBlock, MaxBlocks_v >;
 
-		static constexpr Bytes	_Capacity {BlockSize_v};
-		static constexpr Bytes	_MemAlign {MemAlign};	// TODO: min align as cache line size?
+		using ThreadCache_t	= _hidden_::LfLinearAllocatorThreadCache;
+
+		static constexpr Bytes	_Capacity		{BlockSize_v};
+		static constexpr Bytes	_MemAlign		{MemAlign};	// TODO: min align as cache line size?
+		static constexpr Bytes	_ThreadRegion	{ThreadRegion_v};
+		static constexpr Bytes	_MaxRegionAlloc	{ThreadRegion_v / 4};	// larger allocations use shared blocks
 
 
 	// variables
@@ -49,6 +146,8 @@ namespace AE::Threading
 
 		Mutex				_allocGuard;
 
+		Atomic< ulong >		_epoch	{ThreadCache_t::NextEpoch()};	// for thread regions
+
 		NO_UNIQUE_ADDRESS
 		 Allocator_t		_allocator;
 
@@ -58,7 +157,7 @@ namespace AE::Threading
 	// methods
 	public:
 		explicit LfLinearAllocator (const Allocator_t &alloc = Allocator_t{}) __NE___;
-		~LfLinearAllocator ()												__NE___	{ Release(); }
+		~LfLinearAllocator ()												__NE___;
 
 
 		// must be externally synchronized
@@ -69,6 +168,7 @@ namespace AE::Threading
 		ND_ static constexpr Bytes  BlockSize ()							__NE___	{ return _Capacity; }
 		ND_ static constexpr Bytes  MaxSize ()								__NE___	{ return MaxBlocks_v * _Capacity; }
 		ND_ static constexpr usize	MaxBlocks ()							__NE___	{ return MaxBlocks_v; }
+		ND_ static constexpr Bytes  ThreadRegionSize ()						__NE___	{ return _ThreadRegion; }
 
 
 		// IAllocator //
@@ -81,6 +181,10 @@ namespace AE::Threading
 			void	Deallocate (void* ptr)									__NE_OV	{ Deallocate( ptr, 1_b ); }
 
 			void	Discard ()												__NE_OV;
+
+	private:
+		ND_ void*	_AllocateInBlocks (const SizeAndAlign sizeAndAlign)		__NE___;
+		ND_ void*	_AllocateInRegion (const SizeAndAlign sizeAndAlign)		__NE___;
 	};
 
 
@@ -8,18 +8,30 @@ namespace AE::Threading
 	constructor
 =================================================
 */
-	template <usize BS, usize MA, usize MB, typename A>
-	LfLinearAllocator<BS,MA,MB,A>::LfLinearAllocator (const Allocator_t &alloc) __NE___ :
+	template <usize BS, usize MA, usize MB, typename A, usize TR>
+	LfLinearAllocator<BS,MA,MB,A,TR>::LfLinearAllocator (const Allocator_t &alloc) __NE___ :
 		_allocator{ alloc }
 	{}
 
+/*
+=================================================
+	destructor
+=================================================
+*/
+	template <usize BS, usize MA, usize MB, typename A, usize TR>
+	LfLinearAllocator<BS,MA,MB,A,TR>::~LfLinearAllocator () __NE___
+	{
+		Release();
+		MEMPROF_ONLY( MemoryProfilerApi::Unregister( this );)
+	}
+
 /*
 =================================================
 	CurrentSize
 =================================================
 */
-	template <usize BS, usize MA, usize MB, typename A>
-	Bytes  LfLinearAllocator<BS,MA,MB,A>::CurrentSize () C_NE___
+	template <usize BS, usize MA, usize MB, typename A, usize TR>
+	Bytes  LfLinearAllocator<BS,MA,MB,A,TR>::CurrentSize () C_NE___
 	{
 		DRC_SHAREDLOCK( _drCheck );
 
@@ -39,12 +51,18 @@ namespace AE::Threading
 	Must be externally synchronized
 =================================================
 */
-	template <usize BS, usize MA, usize MB, typename A>
-	void  LfLinearAllocator<BS,MA,MB,A>::Release () __NE___
+	template <usize BS, usize MA, usize MB, typename A, usize TR>
+	void  LfLinearAllocator<BS,MA,MB,A,TR>::Release () __NE___
 	{
 		DRC_EXLOCK( _drCheck );
 		EXLOCK( _allocGuard );
 
+		_epoch.store( ThreadCache_t::NextEpoch() );
+
+		// other threads keep the slot until it is reused by allocator with the same address
+		if constexpr( TR > 0 )
+			ThreadCache_t::Remove( this );
+
 		Bytes	allocated;
 		Bytes	used;
 
@@ -59,6 +77,8 @@ namespace AE::Threading
 			}
 		}
 
+		MEMPROF_ONLY( MemoryProfilerApi::Discard( this );)
+
 		//AE_LOG_DBG( "Linear allocator usage: "s << ToString(used) << " / " << ToString(allocated) << ",  "
 		//			<< ToString( double(usize(used)) / double(usize(allocated)) * 100.0, 1 ) << " %" );
 	}
@@ -70,8 +90,8 @@ namespace AE::Threading
 	Must be externally synchronized
 =================================================
 */
-	template <usize BS, usize MA, usize MB, typename A>
-	void  LfLinearAllocator<BS,MA,MB,A>::Discard () __NE___
+	template <usize BS, usize MA, usize MB, typename A, usize TR>
+	void  LfLinearAllocator<BS,MA,MB,A,TR>::Discard () __NE___
 	{
 		DRC_EXLOCK( _drCheck );
 
@@ -89,6 +109,11 @@ namespace AE::Threading
 		{
 			block.size.store( 0 );
 		}
+
+		// all thread regions become invalid
+		_epoch.store( ThreadCache_t::NextEpoch() );
+
+		MEMPROF_ONLY( MemoryProfilerApi::Discard( this );)
 	}
 
 /*
@@ -96,13 +121,83 @@ namespace AE::Threading
 	Allocate
 =================================================
 */
-	template <usize BS, usize MA, usize MB, typename A>
-	void*  LfLinearAllocator<BS,MA,MB,A>::Allocate (const SizeAndAlign sizeAndAlign) __NE___
+	template <usize BS, usize MA, usize MB, typename A, usize TR>
+	void*  LfLinearAllocator<BS,MA,MB,A,TR>::Allocate (const SizeAndAlign sizeAndAlign) __NE___
 	{
 		DRC_SHAREDLOCK( _drCheck );
 
 		ASSERT_LE( sizeAndAlign.size, BlockSize() );
 
+		void*	ptr = null;
+
+		if constexpr( TR > 0 )
+		{
+			if_likely( sizeAndAlign.size <= _MaxRegionAlloc and sizeAndAlign.align <= _MemAlign )
+				ptr = _AllocateInRegion( sizeAndAlign );
+		}
+
+		if_unlikely( ptr == null )
+			ptr = _AllocateInBlocks( sizeAndAlign );
+
+		MEMPROF_ONLY(
+			if_likely( ptr != null )
+				MemoryProfilerApi::Allocate( this, MemoryProfilerApi::EAllocator::Linear, ptr, sizeAndAlign.size );
+		)
+		return ptr;
+	}
+
+/*
+=================================================
+	_AllocateInRegion
+----
+	Region is accessed only by the current thread, so atomics are not needed.
+	Returns 'null' if shared blocks have not enough space for a new region,
+	in this case allocation will be done in shared blocks.
+=================================================
+*/
+	template <usize BS, usize MA, usize MB, typename A, usize TR>
+	void*  LfLinearAllocator<BS,MA,MB,A,TR>::_AllocateInRegion (const SizeAndAlign sizeAndAlign) __NE___
+	{
+		auto*		region	= ThreadCache_t::Find( this );
+		const ulong	epoch	= _epoch.load();
+
+		// all ways are used by other allocators
+		if_unlikely( region == null )
+			return null;
+
+		if_likely( region->owner == this and region->epoch == epoch )
+		{
+			const Bytes	aligned_off = AlignUp( usize(region->mem) + region->offset, sizeAndAlign.align ) - usize(region->mem);
+
+			if_likely( aligned_off + sizeAndAlign.size <= _ThreadRegion )
+			{
+				region->offset = aligned_off + sizeAndAlign.size;
+				return region->mem + aligned_off;
+			}
+		}
+
+		// refill, if region of this allocator is full then rest of it is lost
+		void*	mem = _AllocateInBlocks( SizeAndAlign{ _ThreadRegion, _MemAlign });
+		if_unlikely( mem == null )
+			return null;
+
+		region->owner	= this;
+		region->epoch	= epoch;
+		region->mem		= mem;
+
+		// region is aligned to '_MemAlign'
+		region->offset = sizeAndAlign.size;
+		return mem;
+	}
+
+/*
+=================================================
+	_AllocateInBlocks
+=================================================
+*/
+	template <usize BS, usize MA, usize MB, typename A, usize TR>
+	void*  LfLinearAllocator<BS,MA,MB,A,TR>::_AllocateInBlocks (const SizeAndAlign sizeAndAlign) __NE___
+	{
 		for (auto block_it = _blocks.begin(); block_it != _blocks.end();)
 		{
 			void*	ptr = block_it->mem.load();
@@ -151,8 +246,8 @@ namespace AE::Threading
 	Deallocate
 =================================================
 */
-	template <usize BS, usize MA, usize MB, typename A>
-	void  LfLinearAllocator<BS,MA,MB,A>::Deallocate (void* ptr, Bytes size) __NE___
+	template <usize BS, usize MA, usize MB, typename A, usize TR>
+	void  LfLinearAllocator<BS,MA,MB,A,TR>::Deallocate (void* ptr, Bytes size) __NE___
 	{
 	#ifdef AE_DEBUG
 		DRC_SHAREDLOCK( _drCheck );
@@ -31,6 +31,18 @@ namespace AE::Threading
 		DEBUG_ONLY( _dbgFrameId.store( Default );)
 		Unused( frameId );
 	}
+
+/*
+=================================================
+	FrameAlloc::Register
+=================================================
+*/
+	void  MemoryManagerImpl::FrameAlloc::Register (IMemoryProfiler &profiler, StringView name) __NE___
+	{
+		for (auto& alloc : _alloc) {
+			profiler.RegisterAllocator( &alloc, IMemoryProfiler::EAllocator::Frame, name );
+		}
+	}
 //-----------------------------------------------------------------------------
 
 
@@ -51,6 +63,7 @@ namespace AE::Threading
 */
 	MemoryManagerImpl::~MemoryManagerImpl () __NE___
 	{
+		SetProfiler( null );
 	}
 
 /*
@@ -87,10 +100,81 @@ namespace AE::Threading
 */
 	void  MemoryManagerImpl::SetProfiler (RC<IMemoryProfiler> profiler) __NE___
 	{
-		PROFILE_ONLY(
-			_profiler.store( RVRef(profiler) );
-		)
+	  #if AE_ENABLE_MEMORY_PROFILER
+		if ( profiler )
+			_RegisterAllocators( *profiler );
+
+		MemoryProfilerApi::_enabled.store( profiler != null );
+		_profiler.store( RVRef(profiler) );
+	  #else
 		Unused( profiler );
+	  #endif
+	}
+
+/*
+=================================================
+	GetProfiler
+=================================================
+*/
+	RC<IMemoryProfiler>  MemoryManagerImpl::GetProfiler () __NE___
+	{
+		MEMPROF_ONLY( return _profiler.load(); )
+		return null;
+	}
+
+/*
+=================================================
+	_RegisterAllocators
+=================================================
+*/
+	void  MemoryManagerImpl::_RegisterAllocators (IMemoryProfiler &profiler) __NE___
+	{
+		using EAllocator = IMemoryProfiler::EAllocator;
+
+		profiler.RegisterAllocator( &_globalLinear, EAllocator::Linear, "GlobalLinear" );
+
+		_graphicsFrameAlloc.Register( profiler, "GraphicsFrame" );
+		_simulationFrameAlloc.Register( profiler, "SimulationFrame" );
+	}
+//-----------------------------------------------------------------------------
+
+
+
+/*
+=================================================
+	MemoryProfilerApi
+=================================================
+*/
+	Atomic<bool>	MemoryProfilerApi::_enabled {false};
+
+	void  MemoryProfilerApi::_Register (const void* alloc, EAllocator type, StringView name) __NE___
+	{
+		if ( auto prof = MemoryManager().GetProfiler() )
+			prof->RegisterAllocator( alloc, type, name );
+	}
+
+	void  MemoryProfilerApi::_Unregister (const void* alloc) __NE___
+	{
+		if ( auto prof = MemoryManager().GetProfiler() )
+			prof->UnregisterAllocator( alloc );
+	}
+
+	void  MemoryProfilerApi::_Allocate (const void* alloc, EAllocator type, const void* ptr, Bytes size) __NE___
+	{
+		if ( auto prof = MemoryManager().GetProfiler() )
+			prof->OnAllocate( alloc, type, ptr, size );
+	}
+
+	void  MemoryProfilerApi::_Deallocate (const void* alloc, const void* ptr, Bytes size) __NE___
+	{
+		if ( auto prof = MemoryManager().GetProfiler() )
+			prof->OnDeallocate( alloc, ptr, size );
+	}
+
+	void  MemoryProfilerApi::_Discard (const void* alloc) __NE___
+	{
+		if ( auto prof = MemoryManager().GetProfiler() )
+			prof->OnDiscard( alloc );
 	}
 //-----------------------------------------------------------------------------
 
@@ -23,8 +23,9 @@ namespace AE::Threading
 
 	// types
 	public:
-		using GlobalLinearAllocator_t	= LfLinearAllocator< usize{16_Mb}, AE_CACHE_LINE, 32 >;
-		using FrameAllocator_t			= LfLinearAllocator< usize{ 4_Mb}, AE_CACHE_LINE,  8 >;
+		// allocations are done from many threads, so each thread uses its own region
+		using GlobalLinearAllocator_t	= LfLinearAllocator< usize{16_Mb}, AE_CACHE_LINE, 32, UntypedAllocator, usize{64_Kb} >;
+		using FrameAllocator_t			= LfLinearAllocator< usize{ 4_Mb}, AE_CACHE_LINE,  8, UntypedAllocator, usize{64_Kb} >;
 
 		class InstanceCtor {
 			friend class TaskScheduler;
@@ -58,6 +59,8 @@ namespace AE::Threading
 				void  BeginFrame (FrameUID frameId)			__NE___;
 				void  EndFrame (FrameUID frameId)			__NE___;
 
+				void  Register (IMemoryProfiler &, StringView name)	__NE___;
+
 			ND_ FrameAllocator_t&  Get ()					__NE___	{ return _alloc[ _idx.load() ]; }
 			ND_ FrameAllocator_t&  Get (FrameUID frameId)	__NE___	{ ASSERT( _dbgFrameId.load() == frameId );  return _alloc[ frameId.Index() ]; }
 		};
@@ -70,7 +73,7 @@ namespace AE::Threading
 		FrameAlloc						_graphicsFrameAlloc;
 		FrameAlloc						_simulationFrameAlloc;
 
-		PROFILE_ONLY(
+		MEMPROF_ONLY(
 			AtomicRC<IMemoryProfiler>	_profiler;
 		)
 
@@ -78,6 +81,7 @@ namespace AE::Threading
 	// methods
 	public:
 		void  SetProfiler (RC<IMemoryProfiler> profiler)				__NE___;
+		ND_ RC<IMemoryProfiler>  GetProfiler ()							__NE___;
 
 		ND_ GlobalLinearAllocator_t&	GetGlobalLinearAllocator ()		__NE___	{ return _globalLinear; }
 
@@ -87,6 +91,8 @@ namespace AE::Threading
 
 	private:
 		MemoryManagerImpl ()											__NE___;
+
+		void  _RegisterAllocators (IMemoryProfiler &)					__NE___;
 		~MemoryManagerImpl ()											__NE___;
 
 		friend MemoryManagerImpl&		AE::MemoryManager ()			__NE___;
@@ -1,12 +1,30 @@
 // Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
 /*
 	thread-safe: yes
+
+	Allocators report events through 'MemoryProfilerApi', events are forwarded to the profiler
+	which is set by 'MemoryManager().SetProfiler()'.
+	If profiler is not set then only single relaxed atomic load is added to the allocation.
 */
 
 #pragma once
 
 #include "threading/Common.h"
 
+#if defined(AE_LFAS_ENABLED)
+#	define AE_ENABLE_MEMORY_PROFILER	0
+#elif defined(AE_CFG_DEBUG) or defined(AE_CFG_DEVELOP) or defined(AE_CFG_PROFILE)
+#	define AE_ENABLE_MEMORY_PROFILER	1
+#else
+#	define AE_ENABLE_MEMORY_PROFILER	0
+#endif
+
+#if AE_ENABLE_MEMORY_PROFILER
+#	define MEMPROF_ONLY( /* code */... )	__VA_ARGS__
+#else
+#	define MEMPROF_ONLY( /* code */... )
+#endif
+
 namespace AE::Threading
 {
 
@@ -16,6 +34,65 @@ namespace AE::Threading
 
 	class IMemoryProfiler : public EnableRC<IMemoryProfiler>
 	{
+	// types
+	public:
+		enum class EAllocator : ubyte
+		{
+			Unknown,
+			General,		// IAllocator
+			Linear,			// LfLinearAllocator
+			FixedBlock,		// LfFixedBlockAllocator
+			Frame,			// frame allocator in MemoryManager
+			GpuMemory,		// device memory
+			_Count
+		};
+
+
+	// interface
+	public:
+		// Optional, used to show allocator name instead of address.
+		virtual void  RegisterAllocator (const void* allocator, EAllocator type, StringView name)		__NE___ = 0;
+
+		// All allocations are released, allocator can not be used anymore.
+		virtual void  UnregisterAllocator (const void* allocator)										__NE___ = 0;
+
+		virtual void  OnAllocate (const void* allocator, EAllocator type, const void* ptr, Bytes size)	__NE___ = 0;
+
+		// 'size' is zero if unknown.
+		virtual void  OnDeallocate (const void* allocator, const void* ptr, Bytes size)					__NE___ = 0;
+
+		// All allocations are released without 'OnDeallocate()', used in linear allocators.
+		virtual void  OnDiscard (const void* allocator)													__NE___ = 0;
+	};
+
+
+
+	//
+	// Memory Profiler API
+	//
+
+	struct MemoryProfilerApi final : Noninstanceable
+	{
+		using EAllocator = IMemoryProfiler::EAllocator;
+
+		ND_ static bool  IsEnabled ()																	__NE___	{ return _enabled.load( EMemoryOrder::Relaxed ); }
+
+		static void  Register (const void* alloc, EAllocator type, StringView name)						__NE___	{ if_unlikely( IsEnabled() ) _Register( alloc, type, name ); }
+		static void  Unregister (const void* alloc)														__NE___	{ if_unlikely( IsEnabled() ) _Unregister( alloc ); }
+		static void  Allocate (const void* alloc, EAllocator type, const void* ptr, Bytes size)			__NE___	{ if_unlikely( IsEnabled() ) _Allocate( alloc, type, ptr, size ); }
+		static void  Deallocate (const void* alloc, const void* ptr, Bytes size)						__NE___	{ if_unlikely( IsEnabled() ) _Deallocate( alloc, ptr, size ); }
+		static void  Discard (const void* alloc)														__NE___	{ if_unlikely( IsEnabled() ) _Discard( alloc ); }
+
+	private:
+		friend class MemoryManagerImpl;
+
+		static void  _Register (const void*, EAllocator, StringView)									__NE___;
+		static void  _Unregister (const void*)															__NE___;
+		static void  _Allocate (const void*, EAllocator, const void*, Bytes)							__NE___;
+		static void  _Deallocate (const void*, const void*, Bytes)										__NE___;
+		static void  _Discard (const void*)																__NE___;
+
+		static Atomic<bool>		_enabled;
 	};
 
 
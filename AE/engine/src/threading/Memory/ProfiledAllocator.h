@@ -0,0 +1,107 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+/*
+	Reports all allocations of the wrapped allocator to the memory profiler.
+	Without profiler it only forwards calls to the wrapped allocator.
+
+	thread-safe: same as wrapped allocator
+*/
+
+#pragma once
+
+#include "threading/Memory/MemoryProfiler.h"
+
+namespace AE::Threading
+{
+
+	//
+	// Profiled Allocator
+	//
+
+	template <typename BaseType>
+	class TProfiledAllocator final : public BaseType
+	{
+		StaticAssert( IsBaseOf< IAllocator, BaseType >);
+
+	// types
+	private:
+		using EAllocator = MemoryProfilerApi::EAllocator;
+
+
+	// variables
+	private:
+		RC<BaseType>	_impl;
+
+
+	// methods
+	public:
+		TProfiledAllocator (RC<BaseType> alloc, StringView name)		__NE___;
+		~TProfiledAllocator ()											__NE_OV;
+
+	// IAllocator //
+		void*	Allocate (Bytes size)									__NE_OV;
+		void	Deallocate (void* ptr, Bytes size)						__NE_OV;
+		void	Deallocate (void* ptr)									__NE_OV;
+
+		void*	Allocate (const SizeAndAlign sizeAndAlign)				__NE_OV;
+		void	Deallocate (void* ptr, const SizeAndAlign sizeAndAlign)	__NE_OV;
+	};
+
+	using ProfiledAllocator		= TProfiledAllocator< IAllocator >;
+	using ProfiledAllocatorTS	= TProfiledAllocator< IAllocatorTS >;
+
+
+
+	template <typename B>
+	TProfiledAllocator<B>::TProfiledAllocator (RC<B> alloc, StringView name) __NE___ :
+		_impl{ RVRef(alloc) }
+	{
+		ASSERT( _impl );
+		MEMPROF_ONLY( MemoryProfilerApi::Register( this, EAllocator::General, name );)
+		Unused( name );
+	}
+
+	template <typename B>
+	TProfiledAllocator<B>::~TProfiledAllocator () __NE___
+	{
+		MEMPROF_ONLY( MemoryProfilerApi::Unregister( this );)
+	}
+
+	template <typename B>
+	void*  TProfiledAllocator<B>::Allocate (Bytes size) __NE___
+	{
+		void*	ptr = _impl->Allocate( size );
+		MEMPROF_ONLY( if_likely( ptr != null ) MemoryProfilerApi::Allocate( this, EAllocator::General, ptr, size );)
+		return ptr;
+	}
+
+	template <typename B>
+	void  TProfiledAllocator<B>::Deallocate (void* ptr, Bytes size) __NE___
+	{
+		MEMPROF_ONLY( MemoryProfilerApi::Deallocate( this, ptr, size );)
+		return _impl->Deallocate( ptr, size );
+	}
+
+	template <typename B>
+	void  TProfiledAllocator<B>::Deallocate (void* ptr) __NE___
+	{
+		MEMPROF_ONLY( MemoryProfilerApi::Deallocate( this, ptr, 0_b );)
+		return _impl->Deallocate( ptr );
+	}
+
+	template <typename B>
+	void*  TProfiledAllocator<B>::Allocate (const SizeAndAlign sizeAndAlign) __NE___
+	{
+		void*	ptr = _impl->Allocate( sizeAndAlign );
+		MEMPROF_ONLY( if_likely( ptr != null ) MemoryProfilerApi::Allocate( this, EAllocator::General, ptr, sizeAndAlign.size );)
+		return ptr;
+	}
+
+	template <typename B>
+	void  TProfiledAllocator<B>::Deallocate (void* ptr, const SizeAndAlign sizeAndAlign) __NE___
+	{
+		MEMPROF_ONLY( MemoryProfilerApi::Deallocate( this, ptr, sizeAndAlign.size );)
+		return _impl->Deallocate( ptr, sizeAndAlign );
+	}
+
+
+} // AE::Threading
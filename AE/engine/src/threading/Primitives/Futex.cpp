@@ -0,0 +1,143 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "base/Defines/StdInclude.h"
+
+#ifdef AE_PLATFORM_WINDOWS
+# include "base/Platforms/WindowsHeader.cpp.h"
+#endif
+
+#if defined(AE_PLATFORM_LINUX) or defined(AE_PLATFORM_ANDROID)
+# include <linux/futex.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+# include <time.h>
+#endif
+
+#include "threading/Primitives/Futex.h"
+
+namespace AE::Threading
+{
+#if AE_FUTEX_MODE == 0
+/*
+=================================================
+	Wait
+=================================================
+*/
+	bool  Futex::Wait (const uint expected, const nanoseconds timeout) __NE___
+	{
+		const slong		ns		= Max( slong(timeout.count()), slong{0} );
+		struct timespec	tim;
+		tim.tv_sec	= time_t(ns / 1'000'000'000);
+		tim.tv_nsec	= long(ns % 1'000'000'000);
+
+		// returns immediately with EAGAIN if value is not equal to 'expected'
+		long	res = ::syscall( SYS_futex, &_value, FUTEX_WAIT_PRIVATE, expected, &tim, null, 0 );
+
+		return not (res != 0 and errno == ETIMEDOUT);
+	}
+
+/*
+=================================================
+	Wake
+=================================================
+*/
+	void  Futex::Wake (const uint count) __NE___
+	{
+		ASSERT( count > 0 );
+		::syscall( SYS_futex, &_value, FUTEX_WAKE_PRIVATE, int(Min( count, uint(MaxValue<int>()) )), null, null, 0 );
+	}
+
+	void  Futex::WakeAll () __NE___
+	{
+		::syscall( SYS_futex, &_value, FUTEX_WAKE_PRIVATE, MaxValue<int>(), null, null, 0 );
+	}
+//-----------------------------------------------------------------------------
+
+
+#elif AE_FUTEX_MODE == 1
+/*
+=================================================
+	Wait
+=================================================
+*/
+	bool  Futex::Wait (uint expected, const nanoseconds timeout) __NE___
+	{
+		const slong	ms = (Max( slong(timeout.count()), slong{0} ) + 999'999) / 1'000'000;
+
+		// returns immediately if value is not equal to 'expected'
+		if ( ::WaitOnAddress( &_value, &expected, sizeof(expected), DWORD(Min( ms, slong(INFINITE-1) ))) != FALSE )
+			return true;
+
+		return ::GetLastError() != ERROR_TIMEOUT;
+	}
+
+/*
+=================================================
+	Wake
+=================================================
+*/
+	void  Futex::Wake (const uint count) __NE___
+	{
+		ASSERT( count > 0 );
+		for (uint i = 0; i < count; ++i) {
+			::WakeByAddressSingle( &_value );
+		}
+	}
+
+	void  Futex::WakeAll () __NE___
+	{
+		::WakeByAddressAll( &_value );
+	}
+//-----------------------------------------------------------------------------
+
+
+#elif AE_FUTEX_MODE == 2
+/*
+=================================================
+	Wait
+=================================================
+*/
+	bool  Futex::Wait (const uint expected, const nanoseconds timeout) __NE___
+	{
+		std::unique_lock	lock {_mutex};
+
+		if ( _value.load() != expected )
+			return true;
+
+		return _cv.wait_for( lock, timeout ) == std::cv_status::no_timeout;
+	}
+
+/*
+=================================================
+	Wake
+----
+	lock is required, otherwise notification can be sent between
+	value check and wait in 'Wait()' and will be lost
+=================================================
+*/
+	void  Futex::Wake (const uint count) __NE___
+	{
+		ASSERT( count > 0 );
+		{
+			std::unique_lock	lock {_mutex};
+		}
+		if ( count == 1 )
+			_cv.notify_one();
+		else
+			_cv.notify_all();
+	}
+
+	void  Futex::WakeAll () __NE___
+	{
+		{
+			std::unique_lock	lock {_mutex};
+		}
+		_cv.notify_all();
+	}
+//-----------------------------------------------------------------------------
+
+#else
+#	error unsupported value in AE_FUTEX_MODE
+#endif
+
+} // AE::Threading
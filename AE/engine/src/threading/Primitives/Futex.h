@@ -0,0 +1,85 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+/*
+	Minimal wait-on-address primitive.
+	'Wait( expected )' blocks only if value is still equal to 'expected',
+	so 'Wake()' which is called after value is changed can not be lost.
+
+	AE_FUTEX_MODE:
+		0 - Linux futex syscall
+		1 - WinAPI WaitOnAddress, requires Windows 8 desktop.
+		2 - emulation with mutex and condition variable.
+*/
+
+#pragma once
+
+#include "threading/Common.h"
+
+#if not defined(AE_FUTEX_MODE) and (defined(AE_PLATFORM_LINUX) or defined(AE_PLATFORM_ANDROID))
+#	define AE_FUTEX_MODE	0
+#endif
+
+#if not defined(AE_FUTEX_MODE) and defined(AE_PLATFORM_WINDOWS) and (AE_PLATFORM_TARGET_VERSION_MAJOR >= 8)
+#	define AE_FUTEX_MODE	1
+#endif
+
+#ifndef AE_FUTEX_MODE
+#	define AE_FUTEX_MODE	2
+#endif
+
+
+namespace AE::Threading
+{
+
+	//
+	// Futex
+	//
+
+	class Futex final : public Noncopyable
+	{
+	// variables
+	private:
+		std::atomic<uint>		_value	{0};
+
+	  #if AE_FUTEX_MODE == 2
+		Mutex					_mutex;
+		ConditionVariable		_cv;
+	  #endif
+
+		StaticAssert( sizeof(_value) == sizeof(uint) );
+
+
+	// methods
+	public:
+		Futex ()												__NE___	{}
+
+		ND_ uint  Load ()										C_NE___	{ return _value.load(); }
+
+		// Returns new value.
+			uint  Increment ()									__NE___	{ return _value.fetch_add( 1 ) + 1; }
+
+		// Returns 'false' on timeout,
+		// returns 'true' if value is not equal to 'expected' or on wakeup (may be spurious).
+			bool  Wait (uint expected, nanoseconds timeout)		__NE___;
+
+			void  Wake (uint count = 1)							__NE___;
+			void  WakeAll ()									__NE___;
+	};
+
+
+} // AE::Threading
+
+
+// check definitions
+#ifdef AE_CPP_DETECT_MISMATCH
+
+#  if AE_FUTEX_MODE == 0
+#	pragma detect_mismatch( "AE_FUTEX_MODE", "0" )
+#  elif AE_FUTEX_MODE == 1
+#	pragma detect_mismatch( "AE_FUTEX_MODE", "1" )
+#  elif AE_FUTEX_MODE == 2
+#	pragma detect_mismatch( "AE_FUTEX_MODE", "2" )
+#  else
+#	error fix me!
+#  endif
+
+#endif // AE_CPP_DETECT_MISMATCH
@@ -394,6 +394,24 @@ namespace AE::Threading
 		}
 	}
 
+/*
+=================================================
+	IsEmpty
+=================================================
+*/
+	bool  LfTaskQueue::IsEmpty () C_NE___
+	{
+		for (Chunk* chunk_ptr : _chunks)
+		{
+			for (; chunk_ptr != null; chunk_ptr = chunk_ptr->next.load())
+			{
+				if ( chunk_ptr->packed.load().pack.count > 0 )
+					return false;
+			}
+		}
+		return true;
+	}
+
 /*
 =================================================
 	CancelAll
@@ -81,6 +81,9 @@ namespace AE::Threading
 			bool		Process (EThreadSeed seed)							__NE___;
 			void		Add (AsyncTask task, EThreadSeed seed)				__NE___;
 
+		// Approximate, tasks which are waiting for input dependencies are counted too.
+		ND_ bool		IsEmpty ()											C_NE___;
+
 			void		WriteProfilerStat ()								__NE___;
 
 		ND_ Bytes		MaxAllocationSize ()								C_NE___;
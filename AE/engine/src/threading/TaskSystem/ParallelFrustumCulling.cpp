@@ -0,0 +1,100 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "threading/TaskSystem/ParallelFrustumCulling.h"
+
+namespace AE::Threading
+{
+
+	//
+	// Job
+	//
+	struct ParallelFrustumCulling::Job
+	{
+		const Frustum_t&	frustum;
+		const AABBs*		boxes		= null;
+		const float4x4*		transforms	= null;
+		const Spheres*		spheres		= null;
+
+		ND_ usize  Cull (usize first, usize count, OUT uint* visible) C_NE___
+		{
+			if ( spheres != null )
+				return Culling_t::CullSpheres( frustum, *spheres, first, count, OUT visible );
+
+			if ( transforms != null )
+				return Culling_t::CullAABBs( frustum, *boxes, transforms, first, count, OUT visible );
+
+			return Culling_t::CullAABBs( frustum, *boxes, first, count, OUT visible );
+		}
+	};
+//-----------------------------------------------------------------------------
+
+
+
+/*
+=================================================
+	CullAABBs
+=================================================
+*/
+	usize  ParallelFrustumCulling::CullAABBs (const Frustum_t &frustum, const AABBs &boxes, const float4x4* transforms, OUT uint* visible,
+											  ETaskQueue queue, usize minPerTask) __NE___
+	{
+		const Job	job{ frustum, &boxes, transforms, null };
+		return _Run( job, boxes.count, OUT visible, queue, minPerTask );
+	}
+
+/*
+=================================================
+	CullSpheres
+=================================================
+*/
+	usize  ParallelFrustumCulling::CullSpheres (const Frustum_t &frustum, const Spheres &spheres, OUT uint* visible,
+												ETaskQueue queue, usize minPerTask) __NE___
+	{
+		const Job	job{ frustum, null, null, &spheres };
+		return _Run( job, spheres.count, OUT visible, queue, minPerTask );
+	}
+
+/*
+=================================================
+	_Run
+----
+	Each part writes visible indices into its own range of 'visible' array
+	starting from 'part.first', then ranges are compacted.
+=================================================
+*/
+	usize  ParallelFrustumCulling::_Run (const Job &job, const usize count, OUT uint* visible, const ETaskQueue queue, const usize minPerTask) __NE___
+	{
+		NonNull( visible );
+
+		const usize		part_count = Clamp( count / Max( minPerTask, usize{1} ), usize{1}, usize{MaxParts} );
+
+		if ( part_count <= 1 )
+			return job.Cull( 0, count, OUT visible );
+
+		// part size is aligned to batch size, so only the last part has scalar tail
+		const usize		part_size = AlignUp( DivCeil( count, part_count ), usize{Culling_t::BatchSize} );
+
+		// number of visible objects in each part
+		StaticArray< usize, MaxParts >	parts_result	= {};
+
+		const usize		num_parts = ParallelParts::Run( count, part_size, queue,
+										[&job, &parts_result, visible] (usize idx, usize first, usize cnt) __NE___
+										{
+											parts_result[idx] = job.Cull( first, cnt, OUT visible + first );
+										});
+		CHECK_ERR( num_parts > 0 );
+
+		usize	result = parts_result[0];
+		for (usize i = 1; i < num_parts; ++i)
+		{
+			const usize	first = i * part_size;
+			ASSERT( result <= first );
+
+			MemMove( OUT visible + result, visible + first, SizeOf<uint> * parts_result[i] );
+			result += parts_result[i];
+		}
+		return result;
+	}
+
+
+} // AE::Threading
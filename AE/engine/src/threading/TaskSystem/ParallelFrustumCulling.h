@@ -0,0 +1,52 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+/*
+	Splits large batch of bounding volumes into parts and culls them in parallel using 'FrustumCulling',
+	see 'ParallelParts' for details.
+	Result is the same as in single threaded version.
+*/
+
+#pragma once
+
+#include "base/Math/FrustumCulling.h"
+#include "threading/TaskSystem/ParallelParts.h"
+
+namespace AE::Threading
+{
+
+	//
+	// Parallel Frustum Culling
+	//
+
+	class ParallelFrustumCulling final : public Noninstanceable
+	{
+	// types
+	public:
+		using Culling_t		= Math::FrustumCulling;
+		using Frustum_t		= Culling_t::Frustum_t;
+		using AABBs			= Culling_t::AABBs;
+		using Spheres		= Culling_t::Spheres;
+
+		static constexpr usize	DefaultMinPerTask	= 16 << 10;
+		static constexpr uint	MaxParts			= ParallelParts::MaxParts;
+
+	private:
+		struct Job;
+
+
+	// methods
+	public:
+		// 'visible' must have space for 'boxes.count' elements.
+		// 'transforms' is optional.
+		ND_ static usize  CullAABBs (const Frustum_t &frustum, const AABBs &boxes, const float4x4* transforms, OUT uint* visible,
+									 ETaskQueue queue = ETaskQueue::PerFrame, usize minPerTask = DefaultMinPerTask)	__NE___;
+
+		// 'visible' must have space for 'spheres.count' elements.
+		ND_ static usize  CullSpheres (const Frustum_t &frustum, const Spheres &spheres, OUT uint* visible,
+									   ETaskQueue queue = ETaskQueue::PerFrame, usize minPerTask = DefaultMinPerTask)	__NE___;
+
+	private:
+		ND_ static usize  _Run (const Job &job, usize count, OUT uint* visible, ETaskQueue queue, usize minPerTask)		__NE___;
+	};
+
+
+} // AE::Threading
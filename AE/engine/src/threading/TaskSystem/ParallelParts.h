@@ -0,0 +1,128 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+/*
+	Splits range into parts and processes them in parallel.
+	Current thread processes the first part and waits for other parts,
+	if task can not be created or was not completed (canceled) then part will be processed in current thread.
+	Each part is processed exactly once.
+*/
+
+#pragma once
+
+#include "threading/TaskSystem/TaskScheduler.h"
+
+namespace AE::Threading
+{
+
+	//
+	// Parallel Parts
+	//
+
+	class ParallelParts final : public Noninstanceable
+	{
+	// types
+	public:
+		static constexpr uint	MaxParts	= 16;
+
+	private:
+		template <typename Fn>
+		class PartTask;
+
+
+	// methods
+	public:
+		// Calls 'fn( usize partIndex, usize first, usize count )' for each part of '[0, count)'.
+		// All parts except the last have 'partSize' elements.
+		// Returns number of parts or 0 if 'partSize' is too small.
+		template <typename Fn>
+		ND_ static usize  Run (usize count, usize partSize, ETaskQueue queue, Fn &&fn)	__NE___;
+	};
+
+
+
+	//
+	// Part Task
+	//
+	template <typename Fn>
+	class ParallelParts::PartTask final : public IAsyncTask
+	{
+	private:
+		Fn &			_fn;
+		const usize		_index;
+		const usize		_first;
+		const usize		_count;
+
+	public:
+		PartTask (Fn* fn, usize index, usize first, usize count, ETaskQueue queue) __NE___ :
+			IAsyncTask{ queue },
+			_fn{*fn}, _index{index}, _first{first}, _count{count}
+		{}
+
+		void		Run ()		__Th_OV	{ _fn( _index, _first, _count ); }
+		StringView	DbgName ()	C_NE_OV	{ return "ParallelParts"; }
+	};
+
+
+/*
+=================================================
+	Run
+=================================================
+*/
+	template <typename Fn>
+	usize  ParallelParts::Run (const usize count, const usize partSize, const ETaskQueue queue, Fn &&fn) __NE___
+	{
+		using Fn_t = RemoveReference< Fn >;
+		StaticAssert( IsNothrowInvocable< Fn_t, usize, usize, usize >);
+
+		if_unlikely( count == 0 )
+			return 0;
+
+		CHECK_ERR( partSize > 0 );
+
+		const usize		num_parts = DivCeil( count, partSize );
+		CHECK_ERR( num_parts <= MaxParts );
+
+		if ( num_parts == 1 )
+		{
+			fn( 0, 0, count );
+			return 1;
+		}
+
+		StaticArray< AsyncTask, MaxParts >		part_tasks;
+		FixedArray< AsyncTask, MaxParts-1 >		tasks;
+
+		for (usize i = 1; i < num_parts; ++i)
+		{
+			const usize	first	= i * partSize;
+			const usize	cnt		= Min( partSize, count - first );
+
+			part_tasks[i] = Scheduler().Run< PartTask<Fn_t> >( Tuple{ &fn, i, first, cnt, queue });
+
+			if_likely( part_tasks[i] )
+				tasks.push_back( part_tasks[i] );
+			else
+				fn( i, first, cnt );
+		}
+
+		fn( 0, 0, partSize );
+
+		// tasks use 'fn' from the caller stack, so wait for all of them
+		for (;;)
+		{
+			if ( Scheduler().Wait( tasks, EThreadArray{ EThread(queue) }, microseconds{100} ))
+				break;
+		}
+
+		// canceled tasks are not executed, process them in current thread
+		for (usize i = 1; i < num_parts; ++i)
+		{
+			if_unlikely( part_tasks[i] and part_tasks[i]->Status() != IAsyncTask::EStatus::Completed )
+			{
+				const usize	first = i * partSize;
+				fn( i, first, Min( partSize, count - first ));
+			}
+		}
+		return num_parts;
+	}
+
+
+} // AE::Threading
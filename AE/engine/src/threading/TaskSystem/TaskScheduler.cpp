@@ -355,29 +355,105 @@ DEBUG_ONLY(
 
 
 
+/*
+=================================================
+	constants
+=================================================
+*/
+namespace {
+	static constexpr nanoseconds	c_MinSpinTime			= microseconds{2};
+	static constexpr nanoseconds	c_MaxSpinTime			= microseconds{100};	// parked thread wakeup takes ~5..50us
+	static constexpr nanoseconds	c_PollingParkTime		= microseconds{500};
+	static constexpr nanoseconds	c_MaxPollingParkTime	= milliseconds{16};
+	static constexpr nanoseconds	c_MaxParkTime			= milliseconds{100};	// 'Wakeup()' can not be lost, just in case
+	static constexpr uint			c_SpinBatch				= 16;
+
+	ND_ inline slong  ThreadWakeup_Now () __NE___
+	{
+		return slong(TimeCast<nanoseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count());
+	}
+}
+
 /*
 =================================================
 	Wakeup
 ----
-	Windows: 5..20us to wakeup thread
+	Windows: 5..20us to wakeup thread.
+	Must be called after task is added to the queue,
+	otherwise parked thread may be woken before task is visible.
 =================================================
 */
-	void  TaskScheduler::ThreadWakeup::Wakeup (EThreadBits bits) __NE___
+	void  TaskScheduler::ThreadWakeup::Wakeup (const ETaskQueueBits queues, uint taskCount) __NE___
+	{
+		if_unlikely( taskCount == 0 )
+			return;
+
+		// 'release' - make tasks visible for thread which will observe new 'enqueued' value in 'EndPark()'
+		for (ETaskQueue q : queues) {
+			_perType[ uint(q) ].enqueued.fetch_add( taskCount, EMemoryOrder::Release );
+		}
+
+		// pairs with barrier in 'BeginPark()':
+		// either parked bit is visible here or thread will see new 'enqueued' value
+		std::atomic_thread_fence( std::memory_order_seq_cst );
+
+		for (ETaskQueue q : queues)
+		{
+			auto&	parked = _perType[ uint(q) ].parked;
+
+			for (ParkedBits_t bits = parked.load(); (bits != 0) and (taskCount > 0); bits = parked.load())
+			{
+				const uint			idx	= uint(BitScanForward( bits ));
+				const ParkedBits_t	bit	= ParkedBits_t{1} << idx;
+
+				// only one thread can acquire the bit
+				if ( AllBits( parked.fetch_and( ~bit, EMemoryOrder::AcquireRelease ), bit ))
+				{
+					_WakeSlot( idx );
+					--taskCount;
+				}
+			}
+
+			if ( taskCount == 0 )
+				break;
+		}
+	}
+
+	void  TaskScheduler::ThreadWakeup::Wakeup (const EThreadBits threads) __NE___
 	{
+		std::atomic_thread_fence( std::memory_order_seq_cst );
+
+		for (EThread t : threads)
 		{
-			std::unique_lock	lock {_mutex};
-			_activeThreads = bits;
+			for (ParkedBits_t bits = _perType[ uint(t) ].parked.exchange( 0, EMemoryOrder::AcquireRelease ); bits != 0;)
+			{
+				_WakeSlot( uint(ExtractBitIndex( INOUT bits )));
+			}
 		}
-		_cv.notify_all();
 	}
 
-	void  TaskScheduler::ThreadWakeup::Wakeup (ETaskQueueBits bits) __NE___
+/*
+=================================================
+	_WakeSlot
+----
+	Parked bit must be acquired by the caller.
+=================================================
+*/
+	void  TaskScheduler::ThreadWakeup::_WakeSlot (const uint slotIdx) __NE___
 	{
-		EThreadBits		threads;
-		for (ETaskQueue q : bits) {
-			threads.insert( EThread(q) );
+		auto&				slot	= _slots[ slotIdx ];
+		const ParkedBits_t	bit		= ParkedBits_t{1} << slotIdx;
+
+		// thread may be parked on multiple queues, remove it from others to avoid redundant wakeup
+		for (EThread t : slot.threads) {
+			_perType[ uint(t) ].parked.fetch_and( ~bit );
 		}
-		return Wakeup( threads );
+
+		slot.wakeupTime.store( ThreadWakeup_Now() );
+
+		// 'Park()' will return immediately if value is changed after 'BeginPark()'
+		slot.futex.Increment();
+		slot.futex.Wake();
 	}
 
 /*
@@ -387,50 +463,179 @@ DEBUG_ONLY(
 */
 	void  TaskScheduler::ThreadWakeup::WakeupAndDetach (LoopingFlag_t &looping) __NE___
 	{
-		{
-			std::unique_lock	lock {_mutex};	// TODO: not needed?
-			looping.store( 0 );
+		looping.store( 0 );
+
+		// pairs with barrier in 'BeginPark()':
+		// either parked bit is visible here or thread will see that 'looping' is zero
+		std::atomic_thread_fence( std::memory_order_seq_cst );
+
+		ParkedBits_t	bits = 0;
+		for (auto& pt : _perType) {
+			bits |= pt.parked.exchange( 0, EMemoryOrder::AcquireRelease );
+		}
+
+		for (; bits != 0;) {
+			_WakeSlot( uint(ExtractBitIndex( INOUT bits )));
 		}
-		_cv.notify_all();
 	}
 
 /*
 =================================================
-	Suspend
+	Spin
+----
+	Spin time is adapted to the recent idle periods:
+	if tasks arrive soon after thread becomes idle then spinning is preferred,
+	if thread is parked for a long time then spinning only wastes CPU time.
 =================================================
 */
-	void  TaskScheduler::ThreadWakeup::Suspend (EThreadBits waitThreads, LoopingFlag_t &looping) __NE___
+	bool  TaskScheduler::ThreadWakeup::Spin (const uint slotIdx, const EThreadArray &threads, const uint iteration) __NE___
 	{
-		std::unique_lock	lock {_mutex};
+		ASSERT( slotIdx < MaxThreads );
+		auto&	slot = _slots[ slotIdx ];
 
-		for (;;)
+		if ( iteration == 0 )
 		{
-			if ( (waitThreads & _activeThreads).Any() )
+			const EThreadBits	mask = threads.ToThreadMask();
+
+			if_unlikely( slot.threads != mask )
 			{
-				_activeThreads &= waitThreads;
-				return;
+				// slot is used by new thread
+				slot.threads	= mask;
+				slot.avgIdle	= c_MaxSpinTime / 4;
+				slot.spinTime	= c_MaxSpinTime / 2;
 			}
+			else
+			// previous idle period is complete
+			if ( slot.lastActive > slot.idleStart )
+			{
+				const bool			parked	= slot.parkCount > 0;
+				const nanoseconds	idle	= TimeCast<nanoseconds>( slot.lastActive - slot.idleStart );
+				const nanoseconds	spin	= parked ? Min( TimeCast<nanoseconds>( slot.parkStart - slot.idleStart ), idle ) : idle;
+				const nanoseconds	sample	= (parked and idle > c_MaxSpinTime) ? nanoseconds{0} : idle;
 
-			// wakeup if thread will be terminated (joined)
-			if ( looping.load() == 0 )
-				return;
+				slot.avgIdle	+= (sample - slot.avgIdle) / 8;
+				slot.spinTime	 = Clamp( slot.avgIdle * 2, c_MinSpinTime, c_MaxSpinTime );
+
+				slot.idleSpinning.store( (slot.idleSpinning.load() * 7 + uint(spin * 100 / idle)) / 8 );
+			}
+
+			slot.idleStart	= Clock_t::now();
+			slot.parkCount	= 0;
+		}
+
+		if ( Clock_t::now() - slot.idleStart >= slot.spinTime )
+			return false;
+
+		for (uint i = 0; i < c_SpinBatch; ++i) {
+			ThreadUtils::Pause();
+		}
+
+		slot.enqueued = _EnqueuedCount( slot );
+		MemoryBarrier( EMemoryOrder::Acquire );
+
+		slot.lastActive = Clock_t::now();
+		return true;
+	}
+
+/*
+=================================================
+	BeginPark
+=================================================
+*/
+	bool  TaskScheduler::ThreadWakeup::BeginPark (const uint slotIdx, OUT uint &key) __NE___
+	{
+		ASSERT( slotIdx < MaxThreads );
+		auto&				slot	= _slots[ slotIdx ];
+		const ParkedBits_t	bit		= ParkedBits_t{1} << slotIdx;
+
+		// must be read before thread is published as parked
+		key = slot.futex.Load();
+
+		for (EThread t : slot.threads) {
+			_perType[ uint(t) ].parked.fetch_or( bit, EMemoryOrder::AcquireRelease );
+		}
+
+		// pairs with barrier in 'Wakeup()'
+		std::atomic_thread_fence( std::memory_order_seq_cst );
+
+		return _EnqueuedCount( slot ) == slot.enqueued;
+	}
+
+/*
+=================================================
+	Park
+=================================================
+*/
+	void  TaskScheduler::ThreadWakeup::Park (const uint slotIdx, const uint key, const Bool polling) __NE___
+	{
+		ASSERT( slotIdx < MaxThreads );
+		auto&	slot = _slots[ slotIdx ];
+
+		const nanoseconds	timeout = polling ?
+										Min( c_PollingParkTime * (1u << Min( slot.parkCount, 5u )), c_MaxPollingParkTime ) :
+										c_MaxParkTime;
+		if ( slot.parkCount++ == 0 )
+			slot.parkStart = Clock_t::now();
+
+		const bool	woken	= slot.futex.Wait( key, timeout );
+		const slong	time	= slot.wakeupTime.exchange( 0 );
+
+		if ( woken and time != 0 )
+		{
+			const slong	latency = Max( ThreadWakeup_Now() - time, slong{0} );
+			slot.wakeupLatency.store( (slot.wakeupLatency.load() * 7 + latency) / 8 );
+		}
+	}
+
+/*
+=================================================
+	EndPark
+=================================================
+*/
+	void  TaskScheduler::ThreadWakeup::EndPark (const uint slotIdx) __NE___
+	{
+		ASSERT( slotIdx < MaxThreads );
+		auto&				slot	= _slots[ slotIdx ];
+		const ParkedBits_t	bit		= ParkedBits_t{1} << slotIdx;
 
-			_cv.wait( lock );
+		for (EThread t : slot.threads) {
+			_perType[ uint(t) ].parked.fetch_and( ~bit );
 		}
+
+		slot.enqueued = _EnqueuedCount( slot );
+		MemoryBarrier( EMemoryOrder::Acquire );
+
+		slot.lastActive = Clock_t::now();
 	}
 
-	void  TaskScheduler::ThreadWakeup::Suspend (ETaskQueueBits waitQueues, LoopingFlag_t &looping) __NE___
+/*
+=================================================
+	_EnqueuedCount
+=================================================
+*/
+	uint  TaskScheduler::ThreadWakeup::_EnqueuedCount (const Slot &slot) C_NE___
 	{
-		EThreadBits		wait_threads;
-		for (ETaskQueue q : waitQueues) {
-			wait_threads.insert( EThread(q) );
+		uint	count = 0;
+		for (EThread t : slot.threads) {
+			count += _perType[ uint(t) ].enqueued.load();
 		}
-		return Suspend( wait_threads, looping );
+		return count;
 	}
 
-	void  TaskScheduler::ThreadWakeup::Suspend (const EThreadArray &waitThreads, LoopingFlag_t &looping) __NE___
+/*
+=================================================
+	GetStat
+=================================================
+*/
+	TaskScheduler::ThreadWakeup::Stat  TaskScheduler::ThreadWakeup::GetStat (const uint slotIdx) C_NE___
 	{
-		return Suspend( waitThreads.ToThreadMask(), looping );
+		Stat	result;
+		if_likely( slotIdx < MaxThreads )
+		{
+			result.wakeupLatency	= nanoseconds{ _slots[ slotIdx ].wakeupLatency.load() };
+			result.idleSpinning		= _slots[ slotIdx ].idleSpinning.load();
+		}
+		return result;
 	}
 //-----------------------------------------------------------------------------
 
@@ -1023,33 +1228,52 @@ DEBUG_ONLY(
 				prof->Enqueue( *task );
 			})
 
-	  #if AE_USE_THREAD_WAKEUP
-		_wakeup.Wakeup( task->QueueType() );
-	  #endif
-
 		const uint	tid = uint(task->QueueType());
 
 		_queues[tid].ptr->Add( RVRef(task), SeedFromThreadID() );
+
+	  #if AE_USE_THREAD_WAKEUP
+		_wakeup.Wakeup( ETaskQueue(tid) );
+	  #endif
 		return true;
 	}
 
 /*
 =================================================
 	SuspendThread
+----
+	'threadIdx' must be unique for each thread which calls this method.
 =================================================
 */
-	void  TaskScheduler::SuspendThread (const EThreadArray &threads, LoopingFlag_t &looping, uint iteration) __NE___
+	void  TaskScheduler::SuspendThread (const EThreadArray &threads, LoopingFlag_t &looping, const uint iteration, const uint threadIdx) __NE___
 	{
 	  #if AE_USE_THREAD_WAKEUP
 
-		if_likely( iteration < 4 )
-			ThreadUtils::Sleep_500us();
-		else
-			_wakeup.Suspend( threads, looping );
+		if_unlikely( threadIdx >= ThreadWakeup::MaxThreads )
+		{
+			ThreadUtils::ProgressiveSleepInf( iteration );
+			return;
+		}
+
+		if_likely( _wakeup.Spin( threadIdx, threads, iteration ))
+			return;
+
+		uint	key;
+		if ( _wakeup.BeginPark( threadIdx, OUT key ) and looping.load() != 0 )
+		{
+			// tasks which are waiting for input dependencies and async IO are not signaled by 'Wakeup()'
+			bool	polling = false;
+			for (EThread t : threads) {
+				polling |= (t < EThread::_Last ? not _queues[ uint(t) ].ptr->IsEmpty() : true);
+			}
+
+			_wakeup.Park( threadIdx, key, Bool{polling} );
+		}
+		_wakeup.EndPark( threadIdx );
 
 	  #else
 
-		Unused( threads, looping );
+		Unused( threads, looping, threadIdx );
 		ThreadUtils::ProgressiveSleepInf( iteration );
 
 	  #endif
@@ -1057,7 +1281,7 @@ DEBUG_ONLY(
 
 /*
 =================================================
-	SuspendThread
+	WakeupAndDetach
 =================================================
 */
 	void  TaskScheduler::WakeupAndDetach (LoopingFlag_t &looping) __NE___
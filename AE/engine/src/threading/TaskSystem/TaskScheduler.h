@@ -57,6 +57,7 @@
 #include "threading/TaskSystem/Coroutine.h"
 #include "threading/Containers/LfIndexedPool.h"
 #include "threading/Memory/GlobalLinearAllocator.h"
+#include "threading/Primitives/Futex.h"
 
 namespace AE::Threading { class TaskScheduler; }
 namespace AE
@@ -92,6 +93,8 @@ namespace AE::Threading
 			uint			curFreq		= 0;	// MHz
 			uint			minFreq		= 0;	// MHz
 			uint			maxFreq		= 0;	// MHz
+			float			wakeupLatency	= 0.f;	// us, average time between 'Wakeup()' and thread resuming
+			uint			idleSpinning	= 0;	// %, part of idle time which is spent on spinning instead of sleeping
 		};
 
 
@@ -186,29 +189,97 @@ namespace AE::Threading
 		using TimePoint_t	= std::chrono::high_resolution_clock::time_point;
 
 
-		struct ThreadWakeup : Noncopyable
+		//
+		// Thread Wakeup
+		//
+		// Idle thread spins for a short time which is adapted to the recent idle periods,
+		// then parks on its own futex. 'Wakeup()' wakes only as many parked threads as there are new tasks.
+		//
+		class ThreadWakeup : Noncopyable
 		{
+		// types
+		public:
+			static constexpr uint	MaxThreads	= 64;	// other threads use 'ProgressiveSleep()'
+
+			struct Stat
+			{
+				nanoseconds		wakeupLatency	{0};	// average
+				uint			idleSpinning	= 0;	// %
+			};
+
+		private:
+			using Clock_t		= std::chrono::steady_clock;
+			using ParkedBits_t	= ulong;
+			StaticAssert( CT_SizeOfInBits<ParkedBits_t> == MaxThreads );
+
+			struct alignas(AE_CACHE_LINE) PerThreadType
+			{
+				Atomic<ParkedBits_t>	parked		{0};	// bit per slot
+				Atomic<uint>			enqueued	{0};	// incremented on 'Wakeup()', used to detect new tasks
+			};
+			using PerThreadType_t	= StaticArray< PerThreadType, uint(EThread::_Count) >;
+
+			struct alignas(AE_CACHE_LINE) Slot
+			{
+				Futex				futex;
+				Atomic<slong>		wakeupTime		{0};	// nanoseconds, 'Clock_t' time of last 'Wakeup()'
+
+				// statistic
+				Atomic<slong>		wakeupLatency	{0};	// nanoseconds
+				Atomic<uint>		idleSpinning	{0};	// %
+
+				// accessed only by owner thread, other threads read 'threads' after acquiring 'parked' bit
+				EThreadBits			threads;
+				uint				enqueued		= 0;
+				uint				parkCount		= 0;
+				nanoseconds			spinTime		{0};
+				nanoseconds			avgIdle			{0};
+				Clock_t::time_point	idleStart;
+				Clock_t::time_point	parkStart;
+				Clock_t::time_point	lastActive;
+			};
+			using Slots_t	= StaticArray< Slot, MaxThreads >;
+
+
 		// variables
 		private:
-			ConditionVariable	_cv;
-			Mutex				_mutex;
-			EThreadBits			_activeThreads;
+			PerThreadType_t		_perType;
+			Slots_t				_slots;
+
 
 		// methods
 		public:
-			ThreadWakeup ()											__NE___	{}
+			ThreadWakeup ()															__NE___	{}
 
-			void  Wakeup (ETaskQueueBits)							__NE___;
-			void  Wakeup (EThreadBits)								__NE___;
+			// Wake up to 'taskCount' threads which are parked on any of the queues.
+			void  Wakeup (ETaskQueueBits, uint taskCount)							__NE___;
+			void  Wakeup (ETaskQueue type, uint taskCount = 1)						__NE___	{ Wakeup( ETaskQueueBits{ type }, taskCount ); }
 
-			void  Wakeup (ETaskQueue type)							__NE___	{ Wakeup( ETaskQueueBits{ type }); }
-			void  Wakeup (EThread type)								__NE___	{ Wakeup( EThreadBits{ type }); }
+			// Wake up all threads which are parked on any of 'threads'.
+			void  Wakeup (EThreadBits threads)										__NE___;
+			void  Wakeup (EThread type)												__NE___	{ Wakeup( EThreadBits{ type }); }
+
+			void  WakeupAndDetach (LoopingFlag_t &)									__NE___;
 
-			void  WakeupAndDetach (LoopingFlag_t &)					__NE___;
+			// Returns 'true' if thread should continue spinning.
+			// 'iteration' is a number of previous unsuccessful attempts to find a task, zero starts new idle period.
+			ND_ bool  Spin (uint slotIdx, const EThreadArray &, uint iteration)		__NE___;
 
-			void  Suspend (ETaskQueueBits, LoopingFlag_t &)			__NE___;
-			void  Suspend (EThreadBits, LoopingFlag_t &)			__NE___;
-			void  Suspend (const EThreadArray &, LoopingFlag_t &)	__NE___;
+			// Publishes thread as parked, so 'Wakeup()' after 'BeginPark()' can not be lost.
+			// Returns 'false' if new tasks are enqueued since last 'Spin()' or 'EndPark()'.
+			// 'EndPark()' must be called in any case.
+			ND_ bool  BeginPark (uint slotIdx, OUT uint &key)						__NE___;
+
+			// 'polling' - thread has tasks which are waiting for input dependencies or for async IO,
+			// they are not signaled by 'Wakeup()' and must be checked periodically.
+				void  Park (uint slotIdx, uint key, Bool polling)					__NE___;
+				void  EndPark (uint slotIdx)										__NE___;
+
+			ND_ Stat  GetStat (uint slotIdx)										C_NE___;
+
+		private:
+			void  _WakeSlot (uint slotIdx)											__NE___;
+			ND_ uint  _EnqueuedCount (const Slot &)									C_NE___;
 		};
 
 	private:
@@ -291,7 +362,8 @@ namespace AE::Threading
 
 			void  SuspendThread (const EThreadArray	&,
 								 LoopingFlag_t		&,
-								 uint				iteration)						__NE___;
+								 uint				iteration,
+								 uint				threadIdx)						__NE___;
 			void  WakeupAndDetach (LoopingFlag_t &)									__NE___;
 
 	  #if AE_USE_THREAD_WAKEUP
@@ -39,7 +39,7 @@ namespace
 		ProfilingInfo	GetProfilingInfo ()							C_NE_OV	{ SHAREDLOCK( _profInfoGuard );  return _profInfo; }
 
 	private:
-		void  _UpdateProfilingInfo ();
+		void  _UpdateProfilingInfo (uint uid);
 	};
 
 /*
@@ -88,9 +88,9 @@ namespace
 				if_likely( processed )
 					p = 0;
 				else
-					scheduler.SuspendThread( _cfg.threads, _looping, p++ );
+					scheduler.SuspendThread( _cfg.threads, _looping, p++, uid );
 
-				_UpdateProfilingInfo();
+				_UpdateProfilingInfo( uid );
 			}
 
 			// TODO: objc: print objects in autorelease pool
@@ -107,7 +107,7 @@ namespace
 	_UpdateProfilingInfo
 =================================================
 */
-	void  WorkerThread::_UpdateProfilingInfo ()
+	void  WorkerThread::_UpdateProfilingInfo (const uint uid)
 	{
 	#ifdef AE_DBG_OR_DEV_OR_PROF
 		const uint		core_id		= ThreadUtils::GetCoreIndex();
@@ -129,8 +129,18 @@ namespace
 			info.maxFreq	= core->maxClock;
 		}
 
+	  #if AE_USE_THREAD_WAKEUP
+		{
+			const auto	stat = Scheduler().GetThreadWakeup()->GetStat( uid );
+			info.wakeupLatency	= float(stat.wakeupLatency.count()) * 1.0e-3f;
+			info.idleSpinning	= stat.idleSpinning;
+		}
+	  #endif
+
 		EXLOCK( _profInfoGuard );
 		_profInfo = info;
+	#else
+		Unused( uid );
 	#endif
 	}
 
@@ -225,6 +235,8 @@ namespace
 			info.minFreq	= core->baseClock;
 			info.maxFreq	= core->maxClock;
 		}
+
+		// main thread does not use 'SuspendThread()', so wakeup stats are not available
 	  #endif
 		return info;
 	}
@@ -112,16 +112,19 @@ namespace AE::VFS
 		CHECK_ERR( not _hashCollisionCheck.HasCollisions() );
 
 		const Bytes	fhdr_size {_map.size() * sizeof(FileHeader)};
+		const Bytes	dhdr_size {_dicts.size() * sizeof(DictHeader)};
 		CHECK_ERR( fhdr_size == uint(fhdr_size) );
+		CHECK_ERR( dhdr_size == uint(dhdr_size) );
 
 		ArchiveHeader	hdr;
 		hdr.name			= Name;
 		hdr.version			= Version;
 		hdr.fileHeadersSize	= uint(fhdr_size);
+		hdr.dictHeadersSize	= uint(dhdr_size);
 
 		CHECK_ERR( dstStream.Write( hdr ));
 
-		const Bytes	base_offset {sizeof(hdr) + hdr.fileHeadersSize};
+		const Bytes	base_offset {sizeof(hdr) + hdr.fileHeadersSize + hdr.dictHeadersSize};
 		archiveSize += base_offset;
 
 		for (auto& [name, info] : _map)
@@ -137,6 +140,17 @@ namespace AE::VFS
 			CHECK_ERR( dstStream.Write( name ) and dstStream.Write( temp ));
 		}
 
+		for (auto& [id, dict] : _dicts)
+		{
+			auto	temp	= dict;
+			Bytes	offset	= dict.Offset() + base_offset;
+
+			temp.offset	= ulong{offset};
+
+			CHECK_ERR( temp.Offset() + temp.size <= archiveSize );
+			CHECK_ERR( dstStream.Write( temp ));
+		}
+
 		CHECK_ERR( DataSourceUtils::BufferedCopy( dstStream, src_file ) == src_file.Size() );
 
 		return true;
@@ -273,6 +287,13 @@ namespace AE::VFS
 	#ifdef AE_ENABLE_ZSTD
 		ZStdWStream::Config	cfg;
 		cfg.level	= 1.0f;
+		cfg.dict	= _zstdDict;
+
+		if ( size >= _ZStdMultithreadedSize )
+			cfg.threadCount = _zstdThreadCount;
+
+		if ( size >= _ZStdLongDistSize )
+			cfg.longDistMatching = true;
 
 		ASSERT( AllBits( info.type, EFileType::ZStd ));
 		return _Compression<ZStdWStream>( stream, name, info, startPos, size, cfg );
@@ -339,6 +360,55 @@ namespace AE::VFS
 		return true;
 	}
 
+/*
+=================================================
+	_AddDict
+=================================================
+*/
+	bool  ArchivePacker::_AddDict (const uint id, ArrayView<ubyte> data)
+	{
+		CHECK_ERR( id != 0 );
+		CHECK_ERR( not data.empty() );
+
+		if ( _dicts.contains( id ))
+			return true;
+
+		DictHeader	dict;
+		dict.id		= id;
+		dict.size	= uint(data.size());
+		dict.offset	= ulong{_archive->Position()};
+
+		CHECK_ERR( _archive->Write( data ));
+
+		_dicts.emplace( id, dict );
+		return true;
+	}
+
+/*
+=================================================
+	SetZStdDictionary
+=================================================
+*/
+#ifdef AE_ENABLE_ZSTD
+	bool  ArchivePacker::SetZStdDictionary (RC<ZStdDictionary> dict)
+	{
+		DRC_EXLOCK( _drCheck );
+		CHECK_ERR( _archive );
+
+		_zstdDict = null;
+
+		if ( dict )
+		{
+			CHECK_ERR( dict->IsValid() );
+			CHECK_ERR_MSG( dict->ID() != 0, "raw content dictionary is not supported, dictionary must be trained" );
+			CHECK_ERR( _AddDict( dict->ID(), dict->Data() ));
+
+			_zstdDict = RVRef(dict);
+		}
+		return true;
+	}
+#endif
+
 /*
 =================================================
 	AddArchive
@@ -365,6 +435,13 @@ namespace AE::VFS
 		DRC_EXLOCK( _drCheck );
 		CHECK_ERR( _archive );
 
+	  #ifdef AE_ENABLE_ZSTD
+		for (auto& [id, dict] : storage._dicts)
+		{
+			CHECK_ERR( _AddDict( id, dict->Data() ));
+		}
+	  #endif
+
 		for (auto& [name, src_info] : storage._map)
 		{
 			CHECK_ERR( not _map.contains( name ));
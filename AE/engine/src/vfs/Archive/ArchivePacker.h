@@ -22,19 +22,29 @@ namespace AE::VFS
 		using FileInfo			= ArchiveStaticStorage::FileInfo;
 		using FileHeader		= ArchiveStaticStorage::FileHeader;
 		using FileMap_t			= ArchiveStaticStorage::FileMap_t;
+		using DictHeader		= ArchiveStaticStorage::DictHeader;
+		using DictMap_t			= FlatHashMap< uint, DictHeader >;
 
 		static constexpr uint	Name	= ArchiveStaticStorage::Name;
 		static constexpr uint	Version	= ArchiveStaticStorage::Version;
 
-		static constexpr Bytes	_MaxInMemoryFileSize {1_Mb};
+		static constexpr Bytes	_MaxInMemoryFileSize	{1_Mb};
+		static constexpr Bytes	_ZStdMultithreadedSize	{4_Mb};		// use worker threads for files with greater size
+		static constexpr Bytes	_ZStdLongDistSize		{64_Mb};	// use long distance matching for files with greater size
 
 
 	// variables
 	private:
 		FileMap_t		_map;
+		DictMap_t		_dicts;
 		Path			_tempFile;
 		RC<WStream>		_archive;
 
+	  #ifdef AE_ENABLE_ZSTD
+		RC<ZStdDictionary>	_zstdDict;
+	  #endif
+		uint			_zstdThreadCount	= 0;
+
 		NamedID_HashCollisionCheck	_hashCollisionCheck;
 		DRC_ONLY( DataRaceCheck		_drCheck;)
 
@@ -56,12 +66,22 @@ namespace AE::VFS
 		ND_ bool  AddArchive (const Path &filename);
 		ND_ bool  AddArchive (RC<RDataSource> archive);
 
+	  #ifdef AE_ENABLE_ZSTD
+		// Dictionary is stored in archive and used for all next files with ZStd compression.
+		// Set 'null' to disable dictionary.
+		ND_ bool  SetZStdDictionary (RC<ZStdDictionary> dict);
+	  #endif
+
+		// Number of worker threads for ZStd compression of big files.
+			void  SetZStdThreadCount (uint count)		{ _zstdThreadCount = count; }
+
 		ND_ bool  Exists (FileName::Ref	name)	const;
 		ND_ bool  IsCreated ()					const;
 		ND_ Path  TempFilePath ()				const;
 
 	private:
 		ND_ bool  _AddFile (FileName::Optimized_t name, const FileInfo &info);
+		ND_ bool  _AddDict (uint id, ArrayView<ubyte> data);
 		ND_ bool  _Store (WStream &dstStream, Bytes archiveSize);
 
 		template <typename StreamType, typename CfgType>
@@ -55,7 +55,8 @@ namespace AE::VFS
 			CHECK_ERR(	hdr.name == Name			and
 						hdr.version == Version		and
 						hdr.fileHeadersSize > 0		and
-						IsMultipleOf( hdr.fileHeadersSize, sizeof(FileHeader) ));
+						IsMultipleOf( hdr.fileHeadersSize, sizeof(FileHeader) ) and
+						IsMultipleOf( hdr.dictHeadersSize, sizeof(DictHeader) ));
 
 			const uint	file_count = hdr.fileHeadersSize / sizeof(FileHeader);
 			_map.reserve( file_count );  // throw
@@ -75,6 +76,55 @@ namespace AE::VFS
 				ASSERT( fhdr.info.Offset() < ds_size );
 				ASSERT( (fhdr.info.Offset() + fhdr.info.size) <= ds_size );
 			}
+
+			const uint	dict_count = hdr.dictHeadersSize / sizeof(DictHeader);
+			if ( dict_count > 0 )
+			{
+			  #ifdef AE_ENABLE_ZSTD
+				CHECK_ERR( _ReadDictionaries( inDS, Sizeof(hdr) + Bytes{hdr.fileHeadersSize}, dict_count ));
+			  #else
+				AE_LOGI( "Archive contains ZStd dictionaries, but ZStd is not supported" );
+			  #endif
+			}
+			return true;
+		}
+		CATCH_ALL(
+			return false;
+		)
+	}
+
+#ifdef AE_ENABLE_ZSTD
+/*
+=================================================
+	_ReadDictionaries
+----
+	Dictionaries are small, so all of them are loaded when archive is opened.
+=================================================
+*/
+	bool  ArchiveStaticStorage::_ReadDictionaries (RDataSource &inDS, const Bytes offset, const uint count) __NE___
+	{
+		TRY{
+			_dicts.reserve( count );  // throw
+
+			auto	mem = MakeRC<ArrayRStream>();
+			CHECK_ERR( mem->LoadFrom( inDS, offset, Bytes{count * sizeof(DictHeader)} ));
+
+			FastRStream	stream {mem};
+			for (uint i = 0; i < count; ++i)
+			{
+				DictHeader	dhdr;
+				CHECK_ERR( stream.Read( OUT dhdr ));
+				CHECK_ERR( dhdr.id != 0 and dhdr.size > 0 );
+
+				Array<ubyte>	data;
+				data.resize( dhdr.size );  // throw
+				CHECK_ERR( inDS.ReadBlock( dhdr.Offset(), OUT data.data(), dhdr.Size() ) == dhdr.Size() );
+
+				auto	dict = MakeRC<ZStdDictionary>( RVRef(data) );
+				CHECK_ERR( dict->IsValid() and dict->ID() == dhdr.id );
+
+				CHECK_ERR( _dicts.emplace( dhdr.id, RVRef(dict) ).second );  // throw
+			}
 			return true;
 		}
 		CATCH_ALL(
@@ -82,6 +132,27 @@ namespace AE::VFS
 		)
 	}
 
+/*
+=================================================
+	_GetZStdConfig
+----
+	Dictionary is referenced by ID which is stored in the frame header.
+=================================================
+*/
+	bool  ArchiveStaticStorage::_GetZStdConfig (RStream &stream, OUT ZStdRStream::Config &cfg) C_NE___
+	{
+		const uint	dict_id = ZStdUtils::ReadDictID( stream );
+		if ( dict_id == 0 )
+			return true;
+
+		auto	iter = _dicts.find( dict_id );
+		CHECK_ERR_MSG( iter != _dicts.end(), "ZStd dictionary with ID ("s << ToString(dict_id) << ") is not found" );
+
+		cfg.dict = iter->second;
+		return true;
+	}
+#endif
+
 /*
 =================================================
 	Open (RStream)
@@ -147,13 +218,19 @@ namespace AE::VFS
 		  #ifdef AE_ENABLE_ZSTD
 			case EFileType::ZStd :
 			{
-				outStream = MakeRC<ZStdRStream>( substream );
+				ZStdRStream::Config	cfg;
+				CHECK_ERR( _GetZStdConfig( *substream, OUT cfg ));
+
+				outStream = MakeRC<ZStdRStream>( substream, cfg );
 				return true;
 			}
 
 			case EFileType::ZStdInMemory :
 			{
-				ZStdRStream		zstd	{ substream };
+				ZStdRStream::Config	cfg;
+				CHECK_ERR( _GetZStdConfig( *substream, OUT cfg ));
+
+				ZStdRStream		zstd	{ substream, cfg };
 				auto			result	= MakeRC<ArrayRStream>();
 
 				CHECK_ERR( result->DecompressFrom( zstd ));
@@ -243,8 +320,11 @@ namespace AE::VFS
 
 			case EFileType::ZStdInMemory :
 			{
-				auto			stream	= MakeRC<ArchiveStream_t>( _archive, info.Offset(), info.Size() );
-				ZStdRStream		zstd	{ stream };
+				auto				stream	= MakeRC<ArchiveStream_t>( _archive, info.Offset(), info.Size() );
+				ZStdRStream::Config	cfg;
+				CHECK_ERR( _GetZStdConfig( *stream, OUT cfg ));
+
+				ZStdRStream		zstd	{ stream, cfg };
 				auto			result	= MakeRC<ArrayRDataSource>();
 
 				CHECK_ERR( result->DecompressFrom( zstd ));
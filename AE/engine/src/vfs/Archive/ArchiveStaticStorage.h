@@ -22,7 +22,8 @@ namespace AE::VFS
 		{
 			uint	name;
 			uint	version;
-			uint	fileHeadersSize;	// array of FileInfo
+			uint	fileHeadersSize;	// array of FileHeader
+			uint	dictHeadersSize;	// array of DictHeader, stored after file headers
 		};
 
 		enum class EFileType : uint
@@ -61,10 +62,26 @@ namespace AE::VFS
 		};
 		StaticAssert( sizeof(FileHeader) == 20 );
 
+		// ZStd dictionary, compressed frame contains dictionary ID
+		struct DictHeader
+		{
+			uint			id			= 0;
+			uint			size		= 0;
+			packed_ulong	offset;
+
+			ND_ Bytes  Size ()		C_NE___	{ return Bytes{size}; }
+			ND_ Bytes  Offset ()	C_NE___	{ return Bytes{ulong{offset}}; }
+		};
+		StaticAssert( sizeof(DictHeader) == 16 );
+
 		using FileMap_t = FlatHashMap< FileName::Optimized_t, FileInfo >;
 
+	  #ifdef AE_ENABLE_ZSTD
+		using DictMap_t	= FlatHashMap< uint, RC<ZStdDictionary> >;
+	  #endif
+
 		static constexpr uint	Name	= "VfsArch"_Hash;
-		static constexpr uint	Version = (1 << 12) | (sizeof(FileHeader) & 0xFFF);
+		static constexpr uint	Version = (2 << 12) | (sizeof(FileHeader) & 0xFFF);
 
 
 	// variables
@@ -72,6 +89,10 @@ namespace AE::VFS
 		FileMap_t			_map;
 		RC<RDataSource>		_archive;
 
+	  #ifdef AE_ENABLE_ZSTD
+		DictMap_t			_dicts;
+	  #endif
+
 		DRC_ONLY(
 			RWDataRaceCheck	_drCheck;
 		)
@@ -106,6 +127,11 @@ namespace AE::VFS
 
 		ND_ bool  _ReadHeader (RDataSource &ds)												__NE___;
 
+	  #ifdef AE_ENABLE_ZSTD
+		ND_ bool  _ReadDictionaries (RDataSource &ds, Bytes offset, uint count)				__NE___;
+		ND_ bool  _GetZStdConfig (RStream &stream, OUT ZStdRStream::Config &cfg)			C_NE___;
+	  #endif
+
 
 	private:
 		ArchiveStaticStorage ()																__NE___	{}
@@ -38,7 +38,7 @@ namespace AE::VFS
 	Init
 =================================================
 */
-	bool  NetworkStorageClient::NetReadRequest::Init (Bytes pos, Bytes size, void* data, RC<> mem) __NE___
+	bool  NetworkStorageClient::NetReadRequest::Init (Bytes pos, Bytes size, void* data, RC<> mem, Bool prefetch) __NE___
 	{
 		ASSERT( _guard.is_locked() );
 
@@ -47,12 +47,38 @@ namespace AE::VFS
 		_memRC		= RVRef(mem);
 		_data		= data;
 		_partCount	= 0;
+		_prefetch	= prefetch;
 		_actualSize.store( 0_b );
 
 		CHECK( _status.exchange( EStatus::InProgress ) == EStatus::Destroyed );
 		return true;
 	}
 
+/*
+=================================================
+	InitCompleted
+----
+	'data' is already filled from the cache
+=================================================
+*/
+	bool  NetworkStorageClient::NetReadRequest::InitCompleted (Bytes pos, Bytes size, void* data, RC<> mem) __NE___
+	{
+		ASSERT( _guard.is_locked() );
+
+		_pos		= pos;
+		_dataSize	= size;
+		_memRC		= RVRef(mem);
+		_data		= data;
+		_partCount	= 0;
+		_prefetch	= false;
+		_actualSize.store( size );
+
+		CHECK( _status.exchange( EStatus::Completed ) == EStatus::Destroyed );
+
+		_SetDependencyCompleteStatus( true );
+		return true;
+	}
+
 /*
 =================================================
 	Complete
@@ -419,6 +445,24 @@ namespace AE::VFS
 	{
 		CHECK_ERR( IsOpen() );
 
+		// try to read from cache
+		if ( s_NetVFS_Client->_ReadFromCache( ID(), pos, OUT data, dataSize ))
+		{
+			Index_t		idx;
+			CHECK_ERR( s_NetVFS_Client->_readResultPool.Assign( OUT idx ));
+
+			RC<NetReadRequest>  req{ &s_NetVFS_Client->_readResultPool[ idx ]};
+			{
+				EXLOCK( req->Guard() );
+				CHECK_ERR( req->InitCompleted( pos, dataSize, data, RVRef(mem) ));
+			}
+			s_NetVFS_Client->_cacheHits.fetch_add( 1 );
+			s_NetVFS_Client->_ReadAhead( *this, pos, dataSize );
+
+			outReq = RVRef(req);
+			return true;
+		}
+
 		auto	msg = s_NetVFS_Client->_CreateMsg< CSMsg_VFS_ReadRequest >();
 		CHECK_ERR( msg );
 
@@ -448,6 +492,9 @@ namespace AE::VFS
 		}
 
 		outReq = RVRef(req);
+
+		s_NetVFS_Client->_cacheMisses.fetch_add( 1 );
+		s_NetVFS_Client->_ReadAhead( *this, pos, dataSize );
 		return true;
 	}
 
@@ -494,18 +541,27 @@ namespace AE::VFS
 */
 	void  NetworkStorageClient::NetRDataSource::_ReleaseObject () __NE___
 	{
+		const auto	id = ID();
+
 		// close
 		{
 			auto	msg = s_NetVFS_Client->_CreateMsg< CSMsg_VFS_CloseReadFile >();
 			if ( msg ) {
-				msg->fileId = ID();
+				msg->fileId = id;
 				Unused( s_NetVFS_Client->_AddMessage( msg ));
 			}
 		}
 
+		// generation must be changed before removing from the cache,
+		// so '_OnPrefetchComplete()' can not add block for this file after that
 		_generation.fetch_add( 1 );
+
+		s_NetVFS_Client->_RemoveFromCache( id );
+
 		_open.store( EStatus::Initial );
 		_fileSize.store( 0_b );
+		_seqEnd.store( 0_b );
+		_readAhead.store( 0 );
 
 		s_NetVFS_Client->_readDSPool.Unassign( _index.load() );
 	}
@@ -752,10 +808,18 @@ namespace AE::VFS
 */
 	inline void  NetworkStorageClient::_ReadComplete (CSMsg_VFS_ReadComplete const& msg) __NE___
 	{
-		Exclusive<NetReadRequest>	req {_GetReadReq( msg.reqId )};
-		CHECK_ERRV( req );
+		bool	prefetch;
+		{
+			Exclusive<NetReadRequest>	req {_GetReadReq( msg.reqId )};
+			CHECK_ERRV( req );
 
-		req->Complete( msg.size, msg.hash );
+			req->Complete( msg.size, msg.hash );
+			prefetch = req->IsPrefetch();
+		}
+
+		// request must be unlocked
+		if ( prefetch )
+			_OnPrefetchComplete( msg.reqId );
 	}
 
 /*
@@ -883,6 +947,304 @@ namespace AE::VFS
 		return null;
 	}
 
+/*
+=================================================
+	BlockCache::Find / InFlight / FindPrefetch
+----
+	'guard' must be locked
+=================================================
+*/
+	NetworkStorageClient::BlockCache::Block*  NetworkStorageClient::BlockCache::Find (NetDataSourceID id, ulong index) __NE___
+	{
+		for (auto& block : blocks)
+		{
+			if ( block.index == index and block.fileId == id )
+				return &block;
+		}
+		return null;
+	}
+
+	bool  NetworkStorageClient::BlockCache::InFlight (NetDataSourceID id, ulong index) C_NE___
+	{
+		return FindPrefetch( id, index ) < prefetch.size();
+	}
+
+	usize  NetworkStorageClient::BlockCache::FindPrefetch (NetDataSourceID id, ulong index) C_NE___
+	{
+		for (usize i = 0; i < prefetch.size(); ++i)
+		{
+			if ( prefetch[i].index == index and prefetch[i].fileId == id )
+				return i;
+		}
+		return UMax;
+	}
+
+/*
+=================================================
+	GetCacheStatistic
+=================================================
+*/
+	NetworkStorageClient::CacheStatistic  NetworkStorageClient::GetCacheStatistic () __NE___
+	{
+		CacheStatistic	result;
+		result.hits		= _cacheHits.load();
+		result.misses	= _cacheMisses.load();
+		{
+			EXLOCK( _blockCache.guard );
+			result.prefetchInFlight = uint(_blockCache.prefetch.size());
+		}
+		return result;
+	}
+
+/*
+=================================================
+	_ReadFromCache
+----
+	returns 'true' only if all data is in the cache
+=================================================
+*/
+	bool  NetworkStorageClient::_ReadFromCache (NetDataSourceID id, const Bytes pos, OUT void* data, const Bytes size) __NE___
+	{
+		if_unlikely( size == 0 or data == null )
+			return false;
+
+		const ulong		first	= ulong(pos / _cacheBlockSize);
+		const ulong		last	= ulong((pos + size - 1) / _cacheBlockSize);
+
+		if ( last - first >= _cacheBlockCount )
+			return false;
+
+		EXLOCK( _blockCache.guard );
+
+		// check that all blocks are exists
+		for (ulong i = first; i <= last; ++i)
+		{
+			auto*	block = _blockCache.Find( id, i );
+			if ( block == null or block->size < Min( _cacheBlockSize, pos + size - _cacheBlockSize * i ))
+				return false;
+		}
+
+		// copy
+		const ulong	use		= ++_blockCache.useCounter;
+		Bytes		dst_off;
+
+		for (ulong i = first; i <= last; ++i)
+		{
+			auto*		block		= _blockCache.Find( id, i );
+			const Bytes	block_pos	= _cacheBlockSize * i;
+			const Bytes	src_off		= Max( pos, block_pos ) - block_pos;
+			const Bytes	part_size	= Min( pos + size, block_pos + block->size ) - (block_pos + src_off);
+
+			MemCopy( OUT data + dst_off, block->mem->Data() + src_off, part_size );
+
+			dst_off			+= part_size;
+			block->lastUse	 = use;
+		}
+		ASSERT( dst_off == size );
+		return true;
+	}
+
+/*
+=================================================
+	_ReadAhead
+=================================================
+*/
+	void  NetworkStorageClient::_ReadAhead (NetRDataSource &ds, const Bytes pos, const Bytes size) __NE___
+	{
+		const Bytes	end		= pos + size;
+		uint		ahead	= 0;
+
+		// sequential access doubles read-ahead window, random access resets it
+		if ( ds._seqEnd.exchange( end ) == pos )
+			ahead = Min( Max( ds._readAhead.load() * 2, 1u ), _maxReadAhead );
+
+		ds._readAhead.store( ahead );
+
+		if ( ahead == 0 or ds._open.load() != EStatus::Open )
+			return;
+
+		const ulong							first		= ulong(end / _cacheBlockSize);
+		const ulong							file_blocks	= ulong(DivCeil( ds.Size(), _cacheBlockSize ));
+		const NetDataSourceID				id			= ds.ID();
+		FixedArray< ulong, _maxReadAhead >	blocks;
+
+		// reserve slots, requests are created outside of the lock
+		{
+			EXLOCK( _blockCache.guard );
+
+			for (ulong i = first, cnt = Min( first + ahead, file_blocks ); i < cnt; ++i)
+			{
+				if ( _blockCache.Find( id, i ) != null or _blockCache.InFlight( id, i ))
+					continue;
+
+				if ( _blockCache.prefetch.IsFull() )
+					break;
+
+				auto&	dst	= _blockCache.prefetch.emplace_back();
+				dst.fileId	= id;
+				dst.index	= i;
+				blocks.push_back( i );
+			}
+		}
+
+		for (usize i = 0; i < blocks.size(); ++i)
+		{
+			if ( _StartPrefetch( ds, blocks[i] ))
+				continue;
+
+			// release remaining slots
+			EXLOCK( _blockCache.guard );
+			for (usize j = i; j < blocks.size(); ++j)
+			{
+				usize	idx = _blockCache.FindPrefetch( id, blocks[j] );
+				if ( idx < _blockCache.prefetch.size() )
+					_blockCache.prefetch.fast_erase( idx );
+			}
+			break;
+		}
+	}
+
+/*
+=================================================
+	_StartPrefetch
+----
+	slot in '_blockCache.prefetch' must be reserved,
+	'_blockCache.guard' must be unlocked
+=================================================
+*/
+	bool  NetworkStorageClient::_StartPrefetch (NetRDataSource &ds, const ulong blockIdx) __NE___
+	{
+		const Bytes		pos		= _cacheBlockSize * blockIdx;
+		const Bytes		size	= Min( _cacheBlockSize, ds.Size() - pos );
+		RC<SharedMem>	mem		= SharedMem::Create( AE::GetDefaultAllocator(), size );
+		CHECK_ERR( mem );
+
+		auto	msg = _CreateMsgOpt< CSMsg_VFS_ReadRequest >();
+		if_unlikely( not msg )
+			return false;
+
+		Index_t		idx;
+		if_unlikely( not _readResultPool.Assign( OUT idx ))
+			return false;
+
+		RC<NetReadRequest>	req	{ &_readResultPool[ idx ]};
+		NDSRequestID		req_id;
+		{
+			EXLOCK( req->Guard() );
+			Unused( req->Init( pos, size, mem->Data(), mem, True{"prefetch"} ));
+			req_id = NDSRequestID{ idx, req->Generation() };
+		}
+
+		const NetDataSourceID	id = ds.ID();
+
+		msg->fileId	= id;
+		msg->reqId	= req_id;
+		msg->pos	= pos;
+		msg->size	= size;
+
+		// request ID must be known before response is received
+		{
+			EXLOCK( _blockCache.guard );
+
+			usize	i = _blockCache.FindPrefetch( id, blockIdx );
+			CHECK_ERR( i < _blockCache.prefetch.size() );
+
+			auto&	dst	= _blockCache.prefetch[i];
+			dst.reqId	= req_id;
+			dst.req		= RVRef(req);
+			dst.mem		= RVRef(mem);
+		}
+
+		if_likely( _AddMessage( msg ))
+			return true;
+
+		// release slot, request is released outside of the lock
+		BlockCache::Prefetch	item;
+		{
+			EXLOCK( _blockCache.guard );
+
+			usize	i = _blockCache.FindPrefetch( id, blockIdx );
+			if ( i < _blockCache.prefetch.size() )
+			{
+				item = RVRef(_blockCache.prefetch[i]);
+				_blockCache.prefetch.fast_erase( i );
+			}
+		}
+		return false;
+	}
+
+/*
+=================================================
+	_OnPrefetchComplete
+=================================================
+*/
+	void  NetworkStorageClient::_OnPrefetchComplete (const NDSRequestID reqId) __NE___
+	{
+		BlockCache::Prefetch	item;
+
+		// remove from in flight list
+		{
+			EXLOCK( _blockCache.guard );
+
+			for (usize i = 0; i < _blockCache.prefetch.size(); ++i)
+			{
+				if ( _blockCache.prefetch[i].reqId == reqId )
+				{
+					item = RVRef(_blockCache.prefetch[i]);
+					_blockCache.prefetch.fast_erase( i );
+					break;
+				}
+			}
+		}
+		CHECK_ERRV( item.req );
+
+		if ( item.req->IsCompleted() )
+		{
+			const Bytes	size = item.req->GetResult().dataSize;
+
+			EXLOCK( _blockCache.guard );
+
+			// File may be closed or ID may be reused while request is in flight.
+			// Generation is changed before '_RemoveFromCache()' which locks the same mutex,
+			// so stale block is dropped here or removed later in '_RemoveFromCache()'.
+			auto*	ds = _GetReadDS( item.fileId );
+			if ( ds == null or ds->_open.load() != EStatus::Open )
+				return;
+
+			// replace least recently used block
+			auto*	dst = &_blockCache.blocks[0];
+			for (auto& block : _blockCache.blocks)
+			{
+				if ( block.lastUse < dst->lastUse )
+					dst = &block;
+			}
+
+			dst->fileId		= item.fileId;
+			dst->index		= item.index;
+			dst->size		= size;
+			dst->lastUse	= ++_blockCache.useCounter;
+			dst->mem		= RVRef(item.mem);
+		}
+
+		// 'item.req' released here
+	}
+
+/*
+=================================================
+	_RemoveFromCache
+=================================================
+*/
+	void  NetworkStorageClient::_RemoveFromCache (NetDataSourceID id) __NE___
+	{
+		EXLOCK( _blockCache.guard );
+
+		for (auto& block : _blockCache.blocks)
+		{
+			if ( block.fileId == id )
+				block = BlockCache::Block{};
+		}
+	}
+
 /*
 =================================================
 	MsgConsumer::Consume
@@ -1,4 +1,13 @@
 // Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+/*
+	Read cache:
+		- Data is cached in blocks of '_cacheBlockSize', least recently used block is evicted.
+		- 'ReadBlock()' is completed immediately if all blocks are in the cache.
+		- Sequential reads increase read-ahead window up to '_maxReadAhead' blocks,
+		  random read resets the window.
+		- Read-ahead blocks are requested as separate requests, up to '_maxPrefetch' requests are in flight,
+		  server coalesces adjacent requests into single read.
+*/
 
 #pragma once
 
@@ -14,6 +23,14 @@ namespace AE::VFS
 	class NetworkStorageClient final : public NetworkStorageBase
 	{
 	// types
+	public:
+		struct CacheStatistic
+		{
+			ulong	hits				= 0;	// 'ReadBlock()' calls which are completed from the cache
+			ulong	misses				= 0;	// 'ReadBlock()' calls which are sent to the server
+			uint	prefetchInFlight	= 0;
+		};
+
 	private:
 		enum class EStatus : ubyte
 		{
@@ -24,6 +41,11 @@ namespace AE::VFS
 			Closed,
 		};
 
+		static constexpr Bytes	_cacheBlockSize		= 64_Kb;
+		static constexpr uint	_cacheBlockCount	= 64;		// 4 Mb
+		static constexpr uint	_maxReadAhead		= 8;		// blocks
+		static constexpr uint	_maxPrefetch		= 16;		// requests in flight
+
 
 		//
 		// Async Write Block Task
@@ -122,13 +144,17 @@ namespace AE::VFS
 			void*		_data		= null;
 			uint		_partCount	= 0;
 			RC<>		_memRC;				// keep memory alive
+			bool		_prefetch	= false;	// result will be moved to the block cache
 
 
 		// methods
 		public:
-			ND_ bool	Init (Bytes pos, Bytes size, void* data, RC<> mem)		__NE___;
-				void	Complete (Bytes size, HashVal64 hash)					__NE___;
-				void	Update (ushort partIdx, const void* data, Bytes size)	__NE___;
+			ND_ bool	Init (Bytes pos, Bytes size, void* data, RC<> mem, Bool prefetch = False{})	__NE___;
+			ND_ bool	InitCompleted (Bytes pos, Bytes size, void* data, RC<> mem)				__NE___;
+				void	Complete (Bytes size, HashVal64 hash)										__NE___;
+				void	Update (ushort partIdx, const void* data, Bytes size)						__NE___;
+
+			ND_ bool	IsPrefetch ()																C_NE___	{ ASSERT( not _guard.is_unlocked() );  return _prefetch; }
 
 			// IAsyncDataSourceRequest //
 			Result		GetResult ()						C_NE_OV;
@@ -182,6 +208,9 @@ namespace AE::VFS
 			AtomicByte<Bytes>		_fileSize;
 			Atomic<Index_t>			_index			{~Index_t{0}};
 
+			AtomicByte<Bytes>		_seqEnd;						// end of the last read, to detect sequential access
+			Atomic<uint>			_readAhead		{0};			// blocks
+
 
 		// methods
 		public:
@@ -254,6 +283,43 @@ namespace AE::VFS
 		};
 
 
+		//
+		// Block Cache
+		//
+		struct BlockCache
+		{
+			struct Block
+			{
+				NetDataSourceID		fileId;
+				ulong				index		= UMax;
+				Bytes				size;				// less than '_cacheBlockSize' for the last block in the file
+				ulong				lastUse		= 0;
+				RC<SharedMem>		mem;
+			};
+
+			struct Prefetch
+			{
+				NetDataSourceID		fileId;
+				ulong				index		= UMax;
+				NDSRequestID		reqId;
+				RC<NetReadRequest>	req;
+				RC<SharedMem>		mem;
+			};
+
+			using Blocks_t		= StaticArray< Block, _cacheBlockCount >;
+			using Prefetch_t	= FixedArray< Prefetch, _maxPrefetch >;
+
+			Mutex			guard;
+			ulong			useCounter	= 0;
+			Blocks_t		blocks;
+			Prefetch_t		prefetch;
+
+			ND_ Block*  Find (NetDataSourceID id, ulong index)	__NE___;
+			ND_ bool    InFlight (NetDataSourceID id, ulong index)	C_NE___;
+			ND_ usize   FindPrefetch (NetDataSourceID id, ulong index)	C_NE___;
+		};
+
+
 		class MsgConsumer final : public ICSMessageConsumer
 		{
 		private:
@@ -279,6 +345,10 @@ namespace AE::VFS
 		RDataSourcePool_t		_readDSPool;
 		WDataSourcePool_t		_writeDSPool;
 
+		BlockCache				_blockCache;
+		Atomic<ulong>			_cacheHits		{0};
+		Atomic<ulong>			_cacheMisses	{0};
+
 
 	// methods
 	public:
@@ -293,6 +363,8 @@ namespace AE::VFS
 		ND_ ICSMessageProducer&  GetMessageProducer ()					__NE___ { return *_msgProducer; }
 		ND_ ICSMessageConsumer&  GetMessageConsumer ()					__NE___ { return *_msgConsumer; }
 
+		ND_ CacheStatistic  GetCacheStatistic ()						__NE___;
+
 
 	private:
 		ND_ auto  _GetReadReq (NDSRequestID id)							__NE___ -> Shared<NetReadRequest>;
@@ -310,6 +382,12 @@ namespace AE::VFS
 		template <typename T>
 		ND_ bool  _AddMessage (T &msg)									__NE___	{ return _msgProducer->AddMessage( msg ); }
 
+		ND_ bool  _ReadFromCache (NetDataSourceID, Bytes pos, OUT void* data, Bytes size)	__NE___;
+			void  _ReadAhead (NetRDataSource &, Bytes pos, Bytes size)						__NE___;
+		ND_ bool  _StartPrefetch (NetRDataSource &, ulong blockIdx)						__NE___;
+			void  _OnPrefetchComplete (NDSRequestID)										__NE___;
+			void  _RemoveFromCache (NetDataSourceID)										__NE___;
+
 
 	private:
 		void  _OpenForReadResult (CSMsg_VFS_OpenForReadResult const&)	__NE___;
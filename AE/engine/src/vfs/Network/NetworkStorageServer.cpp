@@ -18,51 +18,57 @@ namespace AE::VFS
 */
 	void  NetworkStorageServer::SendReadResultTask::Run () __Th___
 	{
-		auto	res = _req->GetResult();
+		const auto	res		= _req->GetResult();
+		uint		sent	= 0;
 
-		for (uint i = 0; (i < _maxParts) and (res.dataSize > _sent); ++i)
+		for (; _curPart < _parts.size(); ++_curPart)
 		{
-			const Bytes	size	= Min( res.dataSize - _sent, _partSize );
-			auto		msg		= s_NetVFS_Server->_CreateMsgOpt< CSMsg_VFS_ReadResult >( _clientId, size-1 );
+			const auto&	part		= _parts[_curPart];
+			const Bytes	part_size	= res.dataSize > part.offset ? Min( res.dataSize - part.offset, part.size ) : 0_b;
+			const void*	part_data	= res.data + part.offset;
 
-			if_likely( msg )
+			for (; (sent < _maxParts) and (part_size > _sent); ++sent)
 			{
-				msg->reqId	= _id;
+				const Bytes	size	= Min( part_size - _sent, _partSize );
+				auto		msg		= s_NetVFS_Server->_CreateMsgOpt< CSMsg_VFS_ReadResult >( _clientId, size-1 );
+
+				if_unlikely( not msg )
+					break;
+
+				msg->reqId	= part.id;
 				msg->size	= size;
 				msg->index	= ushort(_partIdx);
-				MemCopy( OUT msg->data, res.data + _sent, size );
+				MemCopy( OUT msg->data, part_data + _sent, size );
 
-				if_likely( s_NetVFS_Server->_AddMessage( msg ))
-				{
-					_sent += size;
-					_partIdx ++;
-					continue;
-				}
+				if_unlikely( not s_NetVFS_Server->_AddMessage( msg ))
+					break;
+
+				_sent += size;
+				_partIdx ++;
 			}
-			break;
-		}
 
-		if ( res.dataSize > _sent )
-			return Continue();  // try again
+			if ( part_size > _sent )
+				return Continue();  // try again
 
-		ASSERT( res.dataSize == _sent );
+			ASSERT( part_size == _sent );
 
-		// complete
-		auto	msg = s_NetVFS_Server->_CreateMsgOpt< CSMsg_VFS_ReadComplete >( _clientId );
-		if_likely( msg )
-		{
-			msg->reqId	= _id;
-			msg->size	= res.dataSize;
-			msg->hash	= XXHash64( res.data, usize(res.dataSize) );
+			// complete
+			auto	msg = s_NetVFS_Server->_CreateMsgOpt< CSMsg_VFS_ReadComplete >( _clientId );
+			if_unlikely( not msg )
+				return Continue();  // try again
 
-			if_likely( s_NetVFS_Server->_AddMessage( msg ))
-			{
-				_req = null;
-				return;  // complete
-			}
+			msg->reqId	= part.id;
+			msg->size	= part_size;
+			msg->hash	= XXHash64( part_data, usize(part_size) );
+
+			if_unlikely( not s_NetVFS_Server->_AddMessage( msg ))
+				return Continue();  // try again
+
+			_sent		= 0_b;
+			_partIdx	= 0;
 		}
 
-		return Continue();  // try again
+		_req = null;  // complete
 	}
 
 /*
@@ -77,14 +83,10 @@ namespace AE::VFS
 
 		_req = null;
 
-		auto	msg = s_NetVFS_Server->_CreateMsg< CSMsg_VFS_ReadComplete >( _clientId );
-		CHECK_ERRV( msg );
-
-		msg->reqId	= _id;
-		msg->size	= 0_b;  // error
-		msg->hash	= HashVal64{0};
-
-		CHECK( s_NetVFS_Server->_AddMessage( msg ));
+		for (; _curPart < _parts.size(); ++_curPart)
+		{
+			s_NetVFS_Server->_ReadRequestFailed( _parts[_curPart].id, _clientId );
+		}
 	}
 //-----------------------------------------------------------------------------
 
@@ -478,30 +480,78 @@ namespace AE::VFS
 /*
 =================================================
 	_ReadRequest
+----
+	'reqs' are adjacent requests for the same file,
+	they are read by single request and then result is splitted.
 =================================================
 */
-	inline void  NetworkStorageServer::_ReadRequest (CSMsg_VFS_ReadRequest const& inMsg) __NE___
+	inline void  NetworkStorageServer::_ReadRequest (const ReadReqMsgs_t &reqs) __NE___
 	{
-		auto*	dst = _GetReadDS( inMsg.ClientId(), inMsg.fileId );
+		ASSERT( not reqs.empty() );
+
+		const auto&	first	= *reqs.front();
+		const auto&	last	= *reqs.back();
+		auto*		dst		= _GetReadDS( first.ClientId(), first.fileId );
 
 		if_unlikely( dst == null )
 		{
 			AE_LOGI( "failed to find file" );
 
-			auto	msg = s_NetVFS_Server->_CreateMsg< CSMsg_VFS_ReadComplete >( inMsg.ClientId() );
-			CHECK_ERRV( msg );
-
-			msg->reqId	= inMsg.reqId;
-			msg->size	= 0_b;  // error
-			msg->hash	= HashVal64{0};
-
-			CHECK( s_NetVFS_Server->_AddMessage( msg ));
+			for (auto* msg : reqs) {
+				_ReadRequestFailed( msg->reqId, msg->ClientId() );
+			}
 			return;
 		}
 
-		auto	req = dst->ds->ReadBlock( inMsg.pos, inMsg.size );
+		ReadParts_t		parts;
+		for (auto* msg : reqs)
+		{
+			auto&	part	= parts.emplace_back();
+			part.id			= msg->reqId;
+			part.offset		= msg->pos - first.pos;
+			part.size		= msg->size;
+		}
+
+		auto	req = dst->ds->ReadBlock( first.pos, last.pos + last.size - first.pos );
 
-		Scheduler().Run<SendReadResultTask>( Tuple{ inMsg.reqId, inMsg.ClientId(), req }, Tuple{req} );
+		Scheduler().Run<SendReadResultTask>( Tuple{ parts, first.ClientId(), req }, Tuple{req} );
+	}
+
+/*
+=================================================
+	_ReadRequestFailed
+=================================================
+*/
+	void  NetworkStorageServer::_ReadRequestFailed (NDSRequestID reqId, EClientLocalID clientId) __NE___
+	{
+		auto	msg = _CreateMsg< CSMsg_VFS_ReadComplete >( clientId );
+		CHECK_ERRV( msg );
+
+		msg->reqId	= reqId;
+		msg->size	= 0_b;  // error
+		msg->hash	= HashVal64{0};
+
+		CHECK( _AddMessage( msg ));
+	}
+
+/*
+=================================================
+	_CanCoalesce
+=================================================
+*/
+	bool  NetworkStorageServer::_CanCoalesce (const ReadReqMsgs_t &reqs, CSMsg_VFS_ReadRequest const& msg) __NE___
+	{
+		if ( reqs.empty() )
+			return true;
+
+		const auto&	first	= *reqs.front();
+		const auto&	last	= *reqs.back();
+
+		return	not reqs.IsFull()							and
+				msg.ClientId()	== first.ClientId()			and
+				msg.fileId		== first.fileId				and
+				msg.pos			== last.pos + last.size		and
+				(msg.pos + msg.size - first.pos) <= _maxCoalescedSize;
 	}
 
 /*
@@ -619,9 +669,32 @@ namespace AE::VFS
 */
 	void  NetworkStorageServer::MsgConsumer::Consume (ChunkList<const CSMessagePtr> msgList) __NE___
 	{
+		ReadReqMsgs_t	reads;
+
 		for (auto& msg : msgList)
 		{
 			ASSERT( msg->GroupId() == CSMessageGroup::NetVFS );
+
+			if ( msg->UniqueId() == CSMsg_VFS_ReadRequest::UID )
+			{
+				auto*	rd = msg->As< CSMsg_VFS_ReadRequest >();
+
+				if ( not _CanCoalesce( reads, *rd ))
+				{
+					_server._ReadRequest( reads );
+					reads.clear();
+				}
+				reads.push_back( rd );
+				continue;
+			}
+
+			// keep messages order
+			if ( not reads.empty() )
+			{
+				_server._ReadRequest( reads );
+				reads.clear();
+			}
+
 			switch ( msg->UniqueId() )
 			{
 				#define CASE( _name_ )		case CSMsg_VFS_ ## _name_::UID :	_server._ ## _name_( *msg->As< CSMsg_VFS_ ## _name_ >() );	break;
@@ -632,7 +705,6 @@ namespace AE::VFS
 				CASE( CloseWriteFile )
 				CASE( CancelAllReadRequests )
 				CASE( CancelAllWriteRequests )
-				CASE( ReadRequest )
 				CASE( WriteBegin )
 				CASE( WritePart )
 				CASE( WriteEnd )
@@ -640,6 +712,9 @@ namespace AE::VFS
 				#undef CASE
 			}
 		}
+
+		if ( not reads.empty() )
+			_server._ReadRequest( reads );
 	}
 
 /*
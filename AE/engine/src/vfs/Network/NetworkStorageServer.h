@@ -63,21 +63,36 @@ namespace AE::VFS
 		};
 
 
+		// Adjacent read requests are coalesced into single read.
+		static constexpr uint	_maxCoalescedReads	= 8;
+		static constexpr Bytes	_maxCoalescedSize	= 1_Mb;
+
+		struct ReadPart
+		{
+			NDSRequestID			id;
+			Bytes					offset;		// in coalesced read
+			Bytes					size;
+		};
+		using ReadParts_t	= FixedArray< ReadPart, _maxCoalescedReads >;
+		using ReadReqMsgs_t	= FixedArray< CSMsg_VFS_ReadRequest const*, _maxCoalescedReads >;
+
+
 		class SendReadResultTask final : public IAsyncTask
 		{
 		// variables
 		private:
-			const NDSRequestID		_id;
+			const ReadParts_t		_parts;
 			const EClientLocalID	_clientId;
 			AsyncDSRequest			_req;
-			Bytes					_sent;
+			Bytes					_sent;			// in current part
 			uint					_partIdx	= 0;
+			uint					_curPart	= 0;
 
 		// methods
 		public:
-			SendReadResultTask (NDSRequestID id, EClientLocalID cid, AsyncDSRequest req) __NE___ :
+			SendReadResultTask (const ReadParts_t &parts, EClientLocalID cid, AsyncDSRequest req) __NE___ :
 				IAsyncTask{ ETaskQueue::Background },
-				_id{id}, _clientId{cid}, _req{ RVRef(req) }
+				_parts{parts}, _clientId{cid}, _req{ RVRef(req) }
 			{}
 
 			void  Run ()			__Th_OV;
@@ -184,7 +199,10 @@ namespace AE::VFS
 		void  _CancelAllReadRequests (CSMsg_VFS_CancelAllReadRequests const&)	__NE___;
 		void  _CancelAllWriteRequests (CSMsg_VFS_CancelAllWriteRequests const&)	__NE___;
 
-		void  _ReadRequest (CSMsg_VFS_ReadRequest const&)						__NE___;
+		void  _ReadRequest (const ReadReqMsgs_t &)								__NE___;
+		void  _ReadRequestFailed (NDSRequestID, EClientLocalID)					__NE___;
+
+		ND_ static bool  _CanCoalesce (const ReadReqMsgs_t &, CSMsg_VFS_ReadRequest const&)	__NE___;
 
 		void  _WriteBegin (CSMsg_VFS_WriteBegin const&)							__NE___;
 		void  _WritePart (CSMsg_VFS_WritePart const&)							__NE___;
@@ -6,6 +6,30 @@ namespace AE::VFS
 {
 	using namespace AE::Threading;
 
+namespace
+{
+	//
+	// Open Batch Task
+	//
+	template <typename Fn>
+	class OpenBatchTask final : public IAsyncTask
+	{
+	private:
+		Fn				_fn;
+		const usize		_first;
+		const usize		_last;
+
+	public:
+		OpenBatchTask (const Fn &fn, usize first, usize last) __NE___ :
+			IAsyncTask{ ETaskQueue::Background },
+			_fn{fn}, _first{first}, _last{last}
+		{}
+
+		void		Run ()		__Th_OV	{ _fn( _first, _last ); }
+		StringView	DbgName ()	C_NE_OV	{ return "VFS::OpenBatch"; }
+	};
+}
+
 /*
 =================================================
 	_Instance
@@ -172,19 +196,173 @@ namespace AE::VFS
 			}
 		}
 
+		return _OpenInDynamicStorage( OUT result, name );
+	}
+
+/*
+=================================================
+	_OpenInDynamicStorage
+=================================================
+*/
+	template <typename ResultType>
+	bool  VirtualFileSystem::_OpenInDynamicStorage (OUT ResultType &result, FileName::Ref name) C_NE___
+	{
+		const FileName::Optimized_t		key		{name};
+		IVirtualFileStorage const*		cached	= null;
+
+		// find in lookup cache
+		{
+			SHAREDLOCK( _lookupGuard );
+
+			auto	iter = _lookupCache.find( key );
+			if ( iter != _lookupCache.end() )
+				cached = iter->second;
+		}
+
+		if_likely( cached != null and cached->Open( OUT result, name ))
+			return true;
+
 		// search in all storages
 		for (auto& st : _storageMap.GetValueArray())
 		{
-			if_unlikely( st->Open( OUT result, name ))
+			if_unlikely( st.get() != cached and st->Open( OUT result, name ))
+			{
+				_UpdateLookupCache( key, st.get() );
 				return true;
+			}
 		}
 
+		// negative result is not cached because file may be added to the dynamic storage later,
+		// remove entry if file was removed from cached storage
+		if ( cached != null )
+			_UpdateLookupCache( key, null );
+
 		#if not AE_OPTIMIZE_IDS
 		DBG_WARNING( "Failed to open VFS file '"s << name.GetName() << "'" );
 		#endif
 		return false;
 	}
 
+/*
+=================================================
+	_UpdateLookupCache
+=================================================
+*/
+	void  VirtualFileSystem::_UpdateLookupCache (const FileName::Optimized_t &key, IVirtualFileStorage const* storage) C_NE___
+	{
+		EXLOCK( _lookupGuard );
+
+		if_unlikely( _lookupCache.size() >= _maxLookupCacheSize )
+			_lookupCache.clear();
+
+		if ( storage == null )
+		{
+			_lookupCache.erase( key );
+			return;
+		}
+
+		NOTHROW( _lookupCache.insert_or_assign( key, storage ));
+	}
+
+/*
+=================================================
+	ResetLookupCache
+=================================================
+*/
+	void  VirtualFileSystem::ResetLookupCache () C_NE___
+	{
+		EXLOCK( _lookupGuard );
+		_lookupCache.clear();
+	}
+
+/*
+=================================================
+	OpenBatch
+=================================================
+*/
+	usize  VirtualFileSystem::OpenBatch (ArrayView<FileName> names, OUT Array<RC<RStream>> &result) C_NE___
+	{
+		return _OpenBatch( names, OUT result );
+	}
+
+	usize  VirtualFileSystem::OpenBatch (ArrayView<FileName> names, OUT Array<RC<RDataSource>> &result) C_NE___
+	{
+		return _OpenBatch( names, OUT result );
+	}
+
+	usize  VirtualFileSystem::OpenBatch (ArrayView<FileName> names, OUT Array<RC<AsyncRDataSource>> &result) C_NE___
+	{
+		return _OpenBatch( names, OUT result );
+	}
+
+/*
+=================================================
+	_OpenBatch
+=================================================
+*/
+	template <typename ResultType>
+	usize  VirtualFileSystem::_OpenBatch (ArrayView<FileName> names, OUT Array<ResultType> &result) C_NE___
+	{
+		CHECK_ERR( _isImmutable.load() );
+
+		struct Item
+		{
+			IVirtualFileStorage const*	storage	= null;
+			void const*					ref		= null;		// only for file in global map
+		};
+
+		Array<Item>			items;
+		Array<AsyncTask>	tasks;
+		Atomic<usize>		opened	{0};
+
+		result.clear();
+		NOTHROW_ERR( result.resize( names.size() ));
+		NOTHROW_ERR( items.resize( names.size() ));
+		NOTHROW_ERR( tasks.reserve( names.size() / _batchChunkSize ));
+
+		// lookup pass
+		for (usize i = 0; i < names.size(); ++i)
+		{
+			auto	iter = _globalMap.find( FileName::Optimized_t{names[i]} );
+			if_likely( iter != _globalMap.end() )
+				items[i] = Item{ iter->second.storage, iter->second.ref };
+		}
+
+		const auto	OpenRange = [this, names, &items, &result, &opened] (const usize first, const usize last)
+		{{
+			usize	count = 0;
+			for (usize i = first; i < last; ++i)
+			{
+				const auto&	item = items[i];
+
+				if_likely( item.ref != null )
+					count += usize(item.storage->_OpenByIter( OUT result[i], names[i], item.ref ));
+				else
+					count += usize(_OpenInDynamicStorage( OUT result[i], names[i] ));
+			}
+			opened.fetch_add( count );
+		}};
+
+		// create file descriptors in parallel
+		for (usize i = _batchChunkSize; i < names.size(); i += _batchChunkSize)
+		{
+			const usize	last = Min( i + _batchChunkSize, names.size() );
+			auto		task = Scheduler().Run< OpenBatchTask< decltype(OpenRange) >>( Tuple{ OpenRange, i, last });
+
+			if_likely( task )
+				tasks.push_back( RVRef(task) );
+			else
+				OpenRange( i, last );
+		}
+
+		OpenRange( 0, Min( _batchChunkSize, names.size() ));
+
+		// tasks use local variables, so wait for all of them
+		for (; not Scheduler().Wait( tasks, EThreadArray{ EThread::Background }, seconds{1} );) {}
+
+		return opened.load();
+	}
+
 /*
 =================================================
 	_OpenForWrite
@@ -219,7 +397,11 @@ namespace AE::VFS
 		for (auto& st : _storageMap.GetValueArray())
 		{
 			if_unlikely( st->Open( OUT result, name ))
+			{
+				// file may be created
+				_UpdateLookupCache( FileName::Optimized_t{name}, st.get() );
 				return true;
+			}
 		}
 
 		#if not AE_OPTIMIZE_IDS
@@ -237,20 +419,41 @@ namespace AE::VFS
 	{
 		CHECK_ERR( _isImmutable.load() );
 
+		const FileName::Optimized_t		key {name};
+
 		// find in global map
 		{
-			auto	iter = _globalMap.find( FileName::Optimized_t{name} );
+			auto	iter = _globalMap.find( key );
 			if_likely( iter != _globalMap.end() )
 				return true;
 		}
 
+		// find in lookup cache
+		IVirtualFileStorage const*	cached = null;
+		{
+			SHAREDLOCK( _lookupGuard );
+
+			auto	iter = _lookupCache.find( key );
+			if ( iter != _lookupCache.end() )
+				cached = iter->second;
+		}
+
+		if_likely( cached != null and cached->Exists( name ))
+			return true;
+
 		// search in all storages
 		for (auto& st : _storageMap.GetValueArray())
 		{
-			if_unlikely( st->Exists( name ))
+			if_unlikely( st.get() != cached and st->Exists( name ))
+			{
+				_UpdateLookupCache( key, st.get() );
 				return true;
+			}
 		}
 
+		if ( cached != null )
+			_UpdateLookupCache( key, null );
+
 		return false;
 	}
 
@@ -284,7 +487,12 @@ namespace AE::VFS
 		auto	it = _storageMap.find( stName );
 		CHECK_ERR( it != _storageMap.end() );
 
-		return it->second->CreateFile( OUT name, path );
+		if ( it->second->CreateFile( OUT name, path ))
+		{
+			_UpdateLookupCache( FileName::Optimized_t{name}, it->second.get() );
+			return true;
+		}
+		return false;
 	}
 
 /*
@@ -299,7 +507,12 @@ namespace AE::VFS
 		auto	it = _storageMap.find( stName );
 		CHECK_ERR( it != _storageMap.end() );
 
-		return it->second->CreateUniqueFile( OUT name, INOUT path );
+		if ( it->second->CreateUniqueFile( OUT name, INOUT path ))
+		{
+			_UpdateLookupCache( FileName::Optimized_t{name}, it->second.get() );
+			return true;
+		}
+		return false;
 	}
 
 
@@ -18,6 +18,13 @@
 
 	VirtualFileSystem
 		Thread-safe:	yes (const methods only)
+
+	Lookup:
+		- Static files are added to the global map, it is immutable after 'MakeImmutable()'.
+		- Files from dynamic storages are searched in all storages,
+		  storage where file is found is saved in lookup cache, negative result is not cached.
+		- Lookup cache is updated in 'CreateFile()', 'CreateUniqueFile()', 'Open()' for writing and cleared in 'ResetLookupCache()',
+		  if file is not found in cached storage then entry is updated or removed.
 ----
 
 	[docs](https://github.com/azhirnov/as-en/blob/dev/AE/docs/engine/VirtualFileSystem-ru.md)
@@ -90,6 +97,10 @@ namespace AE::VFS
 	private:
 		using GlobalFileMap_t	= IVirtualFileStorage::GlobalFileMap_t;
 		using StorageArray_t	= FixedMap< StorageName::Optimized_t, RC<IVirtualFileStorage>, 8 >;
+		using LookupCache_t		= FlatHashMap< FileName::Optimized_t, IVirtualFileStorage const* >;
+
+		static constexpr usize	_maxLookupCacheSize	= 1u << 16;
+		static constexpr usize	_batchChunkSize		= 256;		// files per task in 'OpenBatch()'
 
 	public:
 		class InstanceCtor {
@@ -106,6 +117,9 @@ namespace AE::VFS
 		GlobalFileMap_t				_globalMap;		// \__ immutable if '_isImmutable' is 'true'.
 		StorageArray_t				_storageMap;	// /
 
+		mutable Threading::RWSpinLock	_lookupGuard;
+		mutable LookupCache_t			_lookupCache;
+
 		DRC_ONLY( RWDataRaceCheck	_drCheck;)
 
 
@@ -143,6 +157,16 @@ namespace AE::VFS
 		ND_ RC<T>  Open (FileName::Ref name)													C_NE___;
 
 
+		// Open many files with single lookup pass, files are opened in parallel using 'ETaskQueue::Background'.
+		// 'result' will have the same size as 'names', null is written for file which is not found.
+		// Returns number of opened files.
+		//	Thread-safe:  yes
+		//
+		ND_ usize  OpenBatch (ArrayView<FileName> names, OUT Array<RC<RStream>> &result)		C_NE___;
+		ND_ usize  OpenBatch (ArrayView<FileName> names, OUT Array<RC<RDataSource>> &result)	C_NE___;
+		ND_ usize  OpenBatch (ArrayView<FileName> names, OUT Array<RC<AsyncRDataSource>> &result) C_NE___;
+
+
 		// Create or reuse file with specified 'path' in VFS Storage with name 'storage' and write hash of file name to the 'name'.
 		// Returns 'true' if file created or already exists.
 		//
@@ -164,6 +188,13 @@ namespace AE::VFS
 		ND_ bool  Exists (FileGroupName::Ref name)												C_NE___;
 
 
+		// Clear cached results of file search in dynamic storages.
+		// Can be used to change storage priority, when file exists in more than one dynamic storage.
+		//	Thread-safe:  yes
+		//
+			void  ResetLookupCache ()															C_NE___;
+
+
 	private:
 		VirtualFileSystem ()																	__NE___	{}
 		~VirtualFileSystem ()																	__NE___	{}
@@ -176,6 +207,14 @@ namespace AE::VFS
 		template <typename ResultType>
 		ND_ bool  _OpenForWrite (OUT ResultType &, FileName::Ref name)							C_NE___;
 
+		template <typename ResultType>
+		ND_ usize  _OpenBatch (ArrayView<FileName> names, OUT Array<ResultType> &)				C_NE___;
+
+		template <typename ResultType>
+		ND_ bool  _OpenInDynamicStorage (OUT ResultType &, FileName::Ref name)					C_NE___;
+
+			void  _UpdateLookupCache (const FileName::Optimized_t &, IVirtualFileStorage const*)	C_NE___;
+
 		friend VirtualFileSystem&		AE::GetVFS ()											__NE___;
 		ND_ static VirtualFileSystem&	_Instance ()											__NE___;
 	};
@@ -105,6 +105,7 @@ namespace
 
 			EMarker						marker;
 			Serializing::Deserializer	des{ mem_stream->ToSubStream( base_off ), alloc.get() };
+			des.inPlaceLayout = true;
 
 			TEST( des( OUT marker ));
 			TEST_Eq( usize(marker), i );
@@ -387,6 +388,93 @@ namespace
 		PipelinePack_Test( false, "test2_ref.txt" );
 	#endif
 	}
+
+
+	static void  PipelinePack_Test3 ()
+	{
+		// incremental build: second compilation must use shader cache and produce the same pack,
+		// modified include file must invalidate cache entries of shaders which include it
+		TEST( FileSystem::SetCurrentPath( Path{AE_CURRENT_DIR} / "pipeline_test" ));
+
+		const PathParams	pipelines[]			= { {TXT("config_vk.as"), 1},
+													{TXT("../sampler_test/samplers.as"), 2},
+													{TXT("../rp_test/rpass.as"), 3},
+													{TXT("pipelines"), 10, EPathParamsFlags::Folder},
+												    {TXT( AE_SHARED_DATA "/feature_set" ), 0, EPathParamsFlags::RecursiveFolder},
+													{TXT("rtech"), 5, EPathParamsFlags::Folder},
+												    {TXT("layouts"), 4, EPathParamsFlags::Folder} };
+		const CharType *	shader_folder[]		= { TXT("shaders_glsl"), TXT("shaders_msl") };
+		const CharType *	include_dir[]		= { TXT("_output_inc/include"), TXT("shaders_msl/include") };
+		const Path			output_folder		= TXT("_output_inc");
+		const Path			include_file		= output_folder / "include" / "common.glsl";
+
+		FileSystem::DeleteDirectory( output_folder );
+		TEST( FileSystem::CreateDirectories( output_folder / "include" ));
+
+		// copy of include file which will be modified
+		TEST( FileSystem::CopyFile( Path{"shaders_glsl/include/common.glsl"}, include_file ));
+
+		const Path	output1		= FileSystem::ToAbsolute( output_folder / "pipelines1.bin" );
+		const Path	output2		= FileSystem::ToAbsolute( output_folder / "pipelines2.bin" );
+		const Path	dep_file	= FileSystem::ToAbsolute( output_folder / "pipelines.d" );
+		const Path	cache		= FileSystem::ToAbsolute( output_folder / "cache" );
+
+		PipelinesInfo	info		= {};
+		info.inPipelines			= pipelines;
+		info.inPipelineCount		= CountOf( pipelines );
+		info.shaderIncludeDirs		= include_dir;
+		info.shaderIncludeDirCount	= CountOf( include_dir );
+		info.shaderFolders			= shader_folder;
+		info.shaderFolderCount		= CountOf( shader_folder );
+		info.shaderCacheFolder		= Cast<CharType>(cache.c_str());
+		info.outputDepFile			= Cast<CharType>(dep_file.c_str());
+
+		ShaderCacheStatistic	stat1, stat2, stat3;
+
+		// empty cache
+		info.outShaderCacheStat		= &stat1;
+		info.outputPackName			= Cast<CharType>(output1.c_str());
+		TEST( compile_pipelines( &info ));
+		TEST( FileSystem::IsDirectory( cache ));
+		TEST( stat1.hits == 0 );
+		TEST( stat1.misses > 0 );
+
+		// all shaders are in the cache
+		info.outShaderCacheStat		= &stat2;
+		info.outputPackName			= Cast<CharType>(output2.c_str());
+		TEST( compile_pipelines( &info ));
+		TEST_Eq( stat2.hits, stat1.misses );
+		TEST( stat2.misses == 0 );
+
+		const auto	ReadFile = [] (const Path &path)
+		{{
+			String			data;
+			FileRStream		file{ path };
+			TEST( file.IsOpen() );
+			TEST( file.Read( file.RemainingSize(), OUT data ));
+			return data;
+		}};
+
+		TEST( ReadFile( output1 ) == ReadFile( output2 ));
+
+		const String	deps = ReadFile( dep_file );
+		TEST( HasSubString( deps, ToString( output2 )));
+		TEST( HasSubString( deps, "config_vk.as" ));
+		TEST( HasSubString( deps, ".glsl" ));
+		TEST( HasSubString( deps, "common.glsl" ));
+
+		// modify include file, only shaders which include it must be recompiled
+		{
+			FileWStream		file{ include_file, FileWStream::EMode::OpenAppend };
+			TEST( file.IsOpen() );
+			TEST( file.Write( StringView{"\n// modified\n"} ));
+		}
+		info.outShaderCacheStat		= &stat3;
+		TEST( compile_pipelines( &info ));
+		TEST( stat3.misses > 0 );
+		TEST( stat3.hits > 0 );
+		TEST_Eq( stat3.hits + stat3.misses, stat1.misses );
+	}
 }
 
 
@@ -400,6 +488,7 @@ extern void Test_PipelinePack ()
 
 		PipelinePack_Test1();
 		PipelinePack_Test2();
+		PipelinePack_Test3();
 	}
 	TEST_PASSED();
 #endif
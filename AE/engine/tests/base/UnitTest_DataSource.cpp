@@ -303,6 +303,150 @@ namespace
 			TEST( dst_mem.GetData() == uncompressed );
 		}
 	}
+
+
+	ND_ static Array<Array<ubyte>>  GenTextSamples (usize count)
+	{
+		Array<Array<ubyte>>	result;
+		Math::Random		rnd;
+
+		for (usize i = 0; i < count; ++i)
+		{
+			String	str;
+			str << "{ \"name\": \"object_" << ToString( rnd.Uniform( 0u, 10000u )) << "\", \"type\": \"StaticMesh\", "
+				<< "\"material\": \"materials/default_" << ToString( rnd.Uniform( 0u, 100u )) << ".mat\", "
+				<< "\"position\": [" << ToString( rnd.Uniform( -100.f, 100.f )) << ", " << ToString( rnd.Uniform( -100.f, 100.f )) << "], "
+				<< "\"flags\": [\"CastShadow\", \"ReceiveShadow\", \"Static\"], \"lod\": " << ToString( rnd.Uniform( 0u, 4u )) << " }";
+
+			result.emplace_back( str.begin(), str.end() );
+		}
+		return result;
+	}
+
+
+	static void  ZStdStream_Test5 ()
+	{
+		const auto			samples	= GenTextSamples( 1000 );
+		Array<ArrayView<ubyte>>	sample_views;
+
+		for (auto& smp : samples) {
+			sample_views.push_back( smp );
+		}
+
+		auto	dict = ZStdDictionary::Train( sample_views, 8_Kb );
+		TEST( dict );
+		TEST( dict->IsValid() );
+		TEST( dict->ID() != 0 );
+		TEST( Bytes{dict->Data().size()} <= 8_Kb );
+
+		const auto&		uncompressed	= samples[0];
+		Array<ubyte>	file_data;
+		Array<ubyte>	file_data2;
+
+		// compress with dictionary
+		{
+			ZStdWStream::Config	cfg;
+			cfg.dict = dict;
+
+			auto	stream = MakeRC<ArrayWStream>();
+			{
+				ZStdWStream		encoder{ stream, cfg };
+
+				TEST( encoder.IsOpen() );
+				TEST( encoder.Write( ArrayView<ubyte>{uncompressed} ));
+			}
+			file_data = stream->ReleaseData();
+		}
+		TEST_Eq( ZStdUtils::GetDictID( file_data.data(), ArraySizeOf(file_data) ), dict->ID() );
+
+		// compress without dictionary
+		{
+			file_data2.resize( usize{ZStdUtils::CompressBound( ArraySizeOf(uncompressed) )});
+
+			Bytes	size = ArraySizeOf(file_data2);
+			TEST( ZStdUtils::Compress( OUT file_data2.data(), INOUT size, uncompressed.data(), ArraySizeOf(uncompressed) ));
+
+			file_data2.resize( usize{size} );
+		}
+		TEST( file_data.size() < file_data2.size() );
+		TEST_Eq( ZStdUtils::GetDictID( file_data2.data(), ArraySizeOf(file_data2) ), 0u );
+
+		// uncompress stream
+		{
+			ZStdRStream::Config	cfg;
+			cfg.dict = dict;
+
+			auto	src = MakeRC<ArrayRStream>( file_data.data(), ArraySizeOf(file_data) );
+			TEST_Eq( ZStdUtils::ReadDictID( *src ), dict->ID() );
+			TEST_Eq( src->Position(), 0_b );
+
+			ZStdRStream		decoder{ src, cfg };
+			TEST( decoder.IsOpen() );
+
+			ArrayWStream	dst_mem;
+			const Bytes		size = DataSourceUtils::BufferedCopy( dst_mem, decoder );
+
+			TEST_Eq( size, ArraySizeOf(uncompressed) );
+			TEST( dst_mem.GetData() == uncompressed );
+		}
+
+		// uncompress in memory
+		{
+			Array<ubyte>	data;
+			data.resize( uncompressed.size() );
+
+			Bytes	size = ArraySizeOf(data);
+			TEST( ZStdUtils::Decompress( OUT data.data(), INOUT size, file_data.data(), ArraySizeOf(file_data), dict.get() ));
+			TEST_Eq( size, ArraySizeOf(uncompressed) );
+			TEST( data == uncompressed );
+		}
+	}
+
+
+	static void  ZStdStream_Test6 ()
+	{
+		const auto		uncompressed = GenRandomArray( 8_Mb );
+		Array<ubyte>	file_data;
+
+		// compress with worker threads and long distance matching,
+		// if zstd built without ZSTD_MULTITHREAD compression is performed in current thread
+		{
+			ZStdWStream::Config	cfg;
+			cfg.threadCount			= 2;
+			cfg.longDistMatching	= true;
+
+			auto	stream = MakeRC<ArrayWStream>();
+			{
+				ZStdWStream		encoder{ stream, cfg };
+				TEST( encoder.IsOpen() );
+
+				encoder.SetTotalSize( ArraySizeOf(uncompressed) );
+
+				for (Bytes pos, size = ArraySizeOf(uncompressed); pos < size;)
+				{
+					Bytes	wr_size	= Min( 64_Kb, size - pos );
+					Bytes	written = encoder.WriteSeq( uncompressed.data() + pos, wr_size );
+
+					TEST( written > 0 );
+					pos += written;
+				}
+			}
+			file_data = stream->ReleaseData();
+		}
+		TEST( file_data.size() < uncompressed.size() );
+
+		// uncompress
+		{
+			ZStdRStream		decoder{ MakeRC<ArrayRStream>( RVRef(file_data) )};
+			TEST( decoder.IsOpen() );
+
+			ArrayWStream	dst_mem;
+			const Bytes		size = DataSourceUtils::BufferedCopy( dst_mem, decoder );
+
+			TEST_Eq( size, ArraySizeOf(uncompressed) );
+			TEST( dst_mem.GetData() == uncompressed );
+		}
+	}
 #endif // AE_ENABLE_ZSTD
 
 
@@ -650,6 +794,84 @@ namespace
 			}
 		}
 	}
+
+
+#ifdef AE_PLATFORM_UNIX_BASED
+	static void  UnixFile_DirectTest1 ()
+	{
+		using EMode = UnixFileRStream::EMode;
+
+		const Bytes		align		= UnixFileRStream::DirectIOAlign;
+		const Bytes		file_size	= 2_Mb + align * 3 + 123_b;		// not aligned, larger than internal buffer
+		const Path		fname		{"direct_data.bin"};
+
+		Array<ubyte>	ref;
+		ref.resize( usize(file_size) );
+		for (usize i = 0; i < ref.size(); ++i) {
+			ref[i] = ubyte( (i * 31) ^ (i >> 9) );
+		}
+		{
+			UnixFileWStream		wfile {fname};
+			TEST( wfile.IsOpen() );
+			TEST( wfile.Write( ArrayView<ubyte>{ref} ));
+		}
+
+		const Bytes		offsets[]	= { 0_b, 1_b, align - 1_b, align, align * 3 + 7_b, 1_Mb - 5_b,
+										file_size - align - 5_b, file_size - 10_b, file_size - 1_b, file_size, file_size + 10_b };
+		const Bytes		sizes[]		= { 1_b, 7_b, align - 1_b, align, align + 1_b, align * 5 + 333_b, 1_Mb + align + 1_b };
+
+		Array<ubyte>	storage;
+		storage.resize( usize(1_Mb + align * 3) );
+
+		// 'buf_offset' = 0 - aligned memory, other data is read directly into user memory
+		for (usize buf_offset : {0, 1})
+		{
+			UnixFileRDataSource		file {fname, EMode::RandomAccess | EMode::Direct};
+			TEST( file.IsOpen() );
+			TEST_Eq( file.Size(), file_size );
+
+			ubyte*	buf = AlignUp( storage.data(), align ) + buf_offset;
+
+			for (Bytes off : offsets)
+			for (Bytes size : sizes)
+			{
+				const Bytes		expected = off < file_size ? Min( size, file_size - off ) : 0_b;
+
+				std::memset( buf, 0xCC, usize(size) );
+				TEST_Eq( file.ReadBlock( off, OUT buf, size ), expected );
+				TEST( MemEqual( buf, ref.data() + usize(Min( off, file_size )), expected ));
+				TEST( expected == size or buf[usize(expected)] == 0xCC );
+			}
+		}
+
+		// sequential read with unaligned sizes
+		{
+			UnixFileRStream		file {fname, EMode::SequentialScan | EMode::Direct};
+			TEST( file.IsOpen() );
+
+			ubyte*	buf	= AlignUp( storage.data(), align );
+			Bytes	pos;
+
+			for (usize i = 0; pos < file_size; ++i)
+			{
+				const Bytes		size	 = sizes[ i % CountOf(sizes) ];
+				const Bytes		expected = Min( size, file_size - pos );
+
+				TEST_Eq( file.ReadSeq( OUT buf, size ), expected );
+				TEST( MemEqual( buf, ref.data() + usize(pos), expected ));
+
+				pos += expected;
+				TEST_Eq( file.Position(), pos );
+			}
+			TEST_Eq( file.ReadSeq( OUT buf, 1_b ), 0_b );
+
+			// seek to unaligned position
+			TEST( file.SeekSet( align + 3_b ));
+			TEST_Eq( file.ReadSeq( OUT buf, align ), align );
+			TEST( MemEqual( buf, ref.data() + usize(align + 3_b), align ));
+		}
+	}
+#endif
 }
 
 
@@ -666,6 +888,8 @@ extern void UnitTest_DataSource (const Path &curr)
 	ZStdStream_Test2();
 	ZStdStream_Test3();
 	ZStdStream_Test4();
+	ZStdStream_Test5();
+	ZStdStream_Test6();
 	#endif
 
 	StdStream_Test1();
@@ -717,6 +941,8 @@ extern void UnitTest_DataSource (const Path &curr)
 	# ifndef AE_PLATFORM_ANDROID
 		File_Test1<   UnixFileRDataSource,	UnixFileWDataSource	>( true );
 	# endif
+
+		UnixFile_DirectTest1();
 	#endif
 
 	FileSystem::SetCurrentPath( curr );
@@ -117,6 +117,108 @@ namespace
 		// TODO
 		//TEST( not frustum1.IsVisible( frustum2 ));
 	}
+
+
+	static void  Frustum_Test4 ()
+	{
+		using FC = FrustumCulling;
+
+		Camera		camera;
+		Frustum		frustum;
+		Random		rnd;
+
+		camera.SetPerspective( 60.0_deg, 1.5f, float2{0.1f, 100.0f} ).Move( float3{ 10.0f, 0.0f, -5.0f });
+		frustum.Setup( camera );
+
+		const usize		count = 1003;	// not a multiple of batch size
+		Array<float>	min_x (count), min_y (count), min_z (count), max_x (count), max_y (count), max_z (count), radius (count);
+		Array<uint>		visible (count);
+		Array<uint>		ref_visible;
+
+		for (usize i = 0; i < count; ++i)
+		{
+			const float3	c = rnd.Uniform( float3{-120.f}, float3{120.f} );
+			const float3	e = rnd.Uniform( float3{0.1f}, float3{10.f} );
+			min_x[i] = c.x - e.x;	max_x[i] = c.x + e.x;
+			min_y[i] = c.y - e.y;	max_y[i] = c.y + e.y;
+			min_z[i] = c.z - e.z;	max_z[i] = c.z + e.z;
+			radius[i] = e.x;
+		}
+		const FC::AABBs		boxes	{ min_x.data(), min_y.data(), min_z.data(), max_x.data(), max_y.data(), max_z.data(), count };
+		const FC::Spheres	spheres	{ min_x.data(), min_y.data(), min_z.data(), radius.data(), count };
+
+		// AABB
+		{
+			for (uint i = 0; i < count; ++i)
+			{
+				AABB	bbox;
+				bbox.min = float3{ min_x[i], min_y[i], min_z[i] };
+				bbox.max = float3{ max_x[i], max_y[i], max_z[i] };
+
+				if ( frustum.IsVisible( bbox ))
+					ref_visible.push_back( i );
+			}
+			TEST( not ref_visible.empty() and ref_visible.size() < count );
+
+			const usize	num = FC::CullAABBs( frustum, boxes, OUT visible.data() );
+			TEST_Eq( num, ref_visible.size() );
+			TEST( ArrayView<uint>{ visible.data(), num } == ArrayView<uint>{ ref_visible });
+
+			// sub-range
+			const usize	num2	= FC::CullAABBs( frustum, boxes, 5, 500, OUT visible.data() );
+			usize		ref_num	= 0;
+			for (uint idx : ref_visible) {
+				ref_num += usize(idx >= 5 and idx < 505);
+			}
+			TEST_Eq( num2, ref_num );
+		}
+
+		// spheres
+		{
+			ref_visible.clear();
+			for (uint i = 0; i < count; ++i)
+			{
+				if ( frustum.IsVisible( Sphere{ float3{ min_x[i], min_y[i], min_z[i] }, radius[i] }))
+					ref_visible.push_back( i );
+			}
+			TEST( not ref_visible.empty() and ref_visible.size() < count );
+
+			const usize	num = FC::CullSpheres( frustum, spheres, OUT visible.data() );
+			TEST_Eq( num, ref_visible.size() );
+			TEST( ArrayView<uint>{ visible.data(), num } == ArrayView<uint>{ ref_visible });
+		}
+
+		// transformed AABB
+		{
+			Array<float4x4>		transforms (count);
+			for (auto& m : transforms) {
+				m = float4x4::Translated( rnd.Uniform( float3{-10.f}, float3{10.f} )) * float4x4::RotateY( Rad{rnd.Uniform( 0.f, 6.f )} );
+			}
+
+			Array<float>		world (count * 6);
+			const FC::MutableAABBs	world_boxes { &world[0], &world[count], &world[count*2], &world[count*3], &world[count*4], &world[count*5] };
+			FC::TransformAABBs( boxes, transforms.data(), 0, count, OUT world_boxes );
+
+			ref_visible.clear();
+			for (uint i = 0; i < count; ++i)
+			{
+				AABB	bbox;
+				bbox.min = float3{ world_boxes.minX[i], world_boxes.minY[i], world_boxes.minZ[i] };
+				bbox.max = float3{ world_boxes.maxX[i], world_boxes.maxY[i], world_boxes.maxZ[i] };
+
+				// world AABB must contain transformed corners of local AABB
+				const float3	corner	= float3{ transforms[i] * float4{ min_x[i], max_y[i], min_z[i], 1.f }};
+				TEST( All( corner >= bbox.min - 1.0e-4f ) and All( corner <= bbox.max + 1.0e-4f ));
+
+				if ( frustum.IsVisible( bbox ))
+					ref_visible.push_back( i );
+			}
+
+			const usize	num = FC::CullAABBs( frustum, boxes, transforms.data(), 0, count, OUT visible.data() );
+			TEST_Eq( num, ref_visible.size() );
+			TEST( ArrayView<uint>{ visible.data(), num } == ArrayView<uint>{ ref_visible });
+		}
+	}
 }
 
 
@@ -125,6 +227,7 @@ extern void UnitTest_Math_Frustum ()
 	Frustum_Test1();
 	Frustum_Test2();
 	Frustum_Test3();
+	Frustum_Test4();
 
 	TEST_PASSED();
 }
@@ -96,6 +96,170 @@ namespace
 		TEST( EndsWithIC( a0, a2 ));
 		TEST( not EndsWithIC( a0, a3 ));
 	}
+
+
+	static void  StringUtils_FindStringLong ()
+	{
+		// long strings to test SIMD path and scalar tail
+		String	str;
+		for (uint i = 0; i < 300; ++i) {
+			str << char('a' + (i * 7) % 26) << char('A' + (i * 3) % 26);
+		}
+
+		for (StringView sub : {"x"sv, "zB"sv, "uRbU"sv, "not-found"sv, "YeFh"sv})
+		{
+			for (usize first : {0u, 1u, 33u, 500u})
+			{
+				const usize	ref = Min( StringView{str}.find( sub, first ), str.size() );
+				TEST_Eq( FindString( str, sub, first ), ref );
+			}
+		}
+
+		String	lower = str;
+		for (auto& c : lower) { c = ToLowerCase( c ); }
+
+		for (StringView sub : {"x"sv, "ZB"sv, "Urbu"sv, "not-found"sv, "yefh"sv})
+		{
+			String	lsub {sub};
+			for (auto& c : lsub) { c = ToLowerCase( c ); }
+
+			for (usize first : {0u, 1u, 33u, 500u})
+			{
+				const usize	ref = Min( StringView{lower}.find( lsub, first ), str.size() );
+				TEST_Eq( FindStringIC( str, sub, first ), ref );
+			}
+		}
+
+		TEST( EqualIC( str, lower ));
+		TEST( StartsWithIC( str, SubString( lower, 0, 100 )));
+		TEST( EndsWithIC( str, SubString( lower, 350 )));
+
+		lower[400] = '#';
+		TEST( not EqualIC( str, lower ));
+
+		// non-ASCII characters must not be converted
+		TEST( not EqualIC( "\xC0\xC1\xC2\xC3\xC4\xC5\xC6\xC7\xC8\xC9\xCA\xCB\xCC\xCD\xCE\xCF\xD0",
+						   "\xE0\xE1\xE2\xE3\xE4\xE5\xE6\xE7\xE8\xE9\xEA\xEB\xEC\xED\xEE\xEF\xF0" ));
+	}
+
+
+	static void  StringUtils_StringBuilder ()
+	{
+		{
+			StringBuilder<16>	sb;
+			sb << "abc" << 12 << ' ' << -5 << true;
+			TEST( sb.View() == "abc12 -5true" );
+			TEST( not sb.IsOnHeap() );
+
+			sb << 1.5 << 0.1f;
+			TEST( sb.View() == "abc12 -5true1.50.1" );
+			TEST( sb.IsOnHeap() );
+
+			sb.clear();
+			TEST( sb.empty() );
+		}{
+			StringBuilder<>	sb;
+			sb.AppendInt<16>( 255u ).AppendAligned( 7, 4 ).AppendAligned<16>( 0xAu, 2 ).AppendFloat( 3.14159, 2 );
+			TEST( sb.View() == "ff00070a3.14" );
+			TEST( sb.ToString() == "ff"s << FormatAlignedI<10>( 7, 4, '0' ) << "0a" << ToString( 3.14159, 2 ));
+		}{
+			StringBuilder<>	sb;
+			for (uint i = 0; i < 100; ++i) {
+				sb << i;
+			}
+			TEST_Eq( sb.size(), 190 );
+			TEST( not sb.IsOnHeap() );
+		}
+	}
+
+
+  #ifdef AE_ENABLE_UTF8PROC
+	static void  StringUtils_Utf8Decode ()
+	{
+		const U8StringView	str = u8"ascii text 12345, \u0442\u0435\u043A\u0441\u0442, \u6587\u5B57 \U0001F600 end of text";
+
+		Array<CharUtf32>	ref;
+		for (usize pos = 0; pos < str.size();) {
+			ref.push_back( Utf8Decode( str, INOUT pos ));
+		}
+
+		// decode by blocks of different size
+		for (usize block : {1u, 3u, 8u, 9u, 64u})
+		{
+			Array<CharUtf32>	dst;
+			dst.resize( ref.size() + 8 );
+
+			usize	pos		= 0;
+			usize	count	= 0;
+			for (; pos < str.size();)
+			{
+				const usize	n = Utf8Decode( str, INOUT pos, OUT dst.data() + count, Min( block, dst.size() - count ));
+				TEST( n > 0 );
+				count += n;
+			}
+
+			TEST_Eq( pos, str.size() );
+			TEST_Eq( count, ref.size() );
+			TEST( ArrayView<CharUtf32>{ dst.data(), count } == ArrayView<CharUtf32>{ ref });
+		}
+	}
+
+
+	static void  StringUtils_Utf8Validate ()
+	{
+		const U8StringView	str = u8"ascii text 12345, \u0442\u0435\u043A\u0441\u0442, \u6587\u5B57 \U0001F600 end of text";
+
+		TEST( Utf8Validate( str ));
+		TEST( Utf8Validate( U8StringView{} ));
+
+		// any prefix which ends inside multibyte symbol is invalid
+		for (usize i = 0; i <= str.size(); ++i)
+		{
+			const U8StringView	sub		= str.substr( 0, i );
+			const bool			valid	= (i == str.size() or (uint(str[i]) & 0xC0) != 0x80);
+			TEST_Eq( Utf8Validate( sub ), valid );
+		}
+
+		const auto	Invalid = [] (std::initializer_list<uint> bytes)
+		{{
+			U8String	s = u8"0123456789abcdef";	// to test SIMD path
+			for (uint b : bytes) { s << CharUtf8(b); }
+			s << u8"0123456789abcdef";
+			return not Utf8Validate( s ) and not Base::_hidden_::Utf8Validate_Scalar( s.data(), s.size() );
+		}};
+
+		TEST( Invalid({ 0x80 }));						// orphan continuation byte
+		TEST( Invalid({ 0xC3 }));						// too short
+		TEST( Invalid({ 0xC0, 0x80 }));					// overlong 2 bytes
+		TEST( Invalid({ 0xE0, 0x80, 0x80 }));			// overlong 3 bytes
+		TEST( Invalid({ 0xF0, 0x80, 0x80, 0x80 }));		// overlong 4 bytes
+		TEST( Invalid({ 0xED, 0xA0, 0x80 }));			// surrogate
+		TEST( Invalid({ 0xF4, 0x90, 0x80, 0x80 }));		// > 0x10FFFF
+		TEST( Invalid({ 0xFF }));
+		TEST( not Invalid({ 0xF4, 0x8F, 0xBF, 0xBF }));	// 0x10FFFF
+
+		// char count and decoding
+		{
+			U8String	long_str;
+			for (uint i = 0; i < 10; ++i) { long_str << str; }
+
+			Array<CharUtf32>	dst;
+			dst.resize( long_str.size() );
+
+			usize		pos		= 0;
+			const usize	count	= Utf8Decode( long_str, INOUT pos, OUT dst.data(), dst.size() );
+
+			TEST_Eq( pos, long_str.size() );
+			TEST_Eq( count, Utf8CharCount( long_str ));
+
+			usize	ref_count = 0;
+			for (usize p = 0; p < long_str.size(); ++ref_count) {
+				TEST_Eq( Utf8Decode( long_str, INOUT p ), dst[ref_count] );
+			}
+			TEST_Eq( ref_count, count );
+		}
+	}
+  #endif
 }
 
 
@@ -108,6 +272,13 @@ extern void UnitTest_StringUtils ()
 	StringUtils_FindStringIC();
 	StringUtils_StartsWith();
 	StringUtils_EndsWith();
+	StringUtils_FindStringLong();
+	StringUtils_StringBuilder();
+
+  #ifdef AE_ENABLE_UTF8PROC
+	StringUtils_Utf8Decode();
+	StringUtils_Utf8Validate();
+  #endif
 
 	TEST_PASSED();
 }
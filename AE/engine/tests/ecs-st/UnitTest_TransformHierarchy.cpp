@@ -0,0 +1,219 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "UnitTest_Common.h"
+#include "ecs-st/Systems/TransformHierarchy.h"
+
+namespace
+{
+	using namespace AE::Threading;
+	using Systems::TransformHierarchy;
+	using NodeID = TransformHierarchy::NodeID;
+
+
+	struct LocalTaskScheduler
+	{
+		LocalTaskScheduler ()
+		{
+			TaskScheduler::Config	cfg;
+			cfg.maxPerFrameQueues = 2;
+
+			TaskScheduler::InstanceCtor::Create();
+			TEST( Scheduler().Setup( cfg ));
+
+			Scheduler().AddThread( ThreadMngr::CreateThread( ThreadMngr::ThreadConfig{} ));
+		}
+
+		~LocalTaskScheduler ()
+		{
+			Scheduler().Release();
+			TaskScheduler::InstanceCtor::Destroy();
+		}
+	};
+
+
+	ND_ static float4x4  RandomTransform (Random &rnd)
+	{
+		return float4x4::Translated( rnd.Uniform( float3{-10.f}, float3{10.f} )) * float4x4::RotateY( Rad{rnd.Uniform( 0.f, 6.f )} );
+	}
+
+	// scalar reference
+	ND_ static float4x4  CalcWorld (const TransformHierarchy &th, NodeID id)
+	{
+		float4x4	m = th.GetLocal( id );
+		for (NodeID p = th.GetParent( id ); p != UMax; p = th.GetParent( p )) {
+			m = th.GetLocal( p ) * m;
+		}
+		return m;
+	}
+
+	static void  TestWorld (const TransformHierarchy &th, ArrayView<NodeID> nodes)
+	{
+		for (NodeID id : nodes)
+		{
+			if ( th.IsValid( id ))
+				TEST( Equal( th.GetWorld( id ), CalcWorld( th, id ), 1.0e-3f ));
+		}
+	}
+
+
+	static void  TransformHierarchy_Test1 ()
+	{
+		TransformHierarchy	th;
+		Random				rnd;
+
+		const NodeID	a	= th.CreateNode( RandomTransform( rnd ));
+		const NodeID	b	= th.CreateNode( RandomTransform( rnd ), a );
+		const NodeID	c	= th.CreateNode( RandomTransform( rnd ), b );
+		const NodeID	d	= th.CreateNode( RandomTransform( rnd ));
+		const NodeID	e	= th.CreateNode( RandomTransform( rnd ), d );
+		const NodeID	nodes[] = { a, b, c, d, e };
+
+		TEST( th.CreateNode( float4x4::Identity(), 100 ) == UMax );
+
+		th.Update();
+		TEST( th.LevelCount() == 3 );
+		TEST( th.NodeCount() == 5 );
+		TestWorld( th, nodes );
+
+		// nothing is changed
+		th.Update();
+		for (NodeID id : nodes) {
+			TEST( not th.IsUpdated( id ));
+		}
+
+		// only dirty subtree is updated
+		TEST( th.SetLocal( b, RandomTransform( rnd )));
+		th.Update();
+		TEST( not th.IsUpdated( a ));
+		TEST( th.IsUpdated( b ));
+		TEST( th.IsUpdated( c ));
+		TEST( not th.IsUpdated( d ));
+		TEST( not th.IsUpdated( e ));
+		TestWorld( th, nodes );
+
+		// change parent
+		TEST( not th.SetParent( a, c ));	// cycle
+		TEST( th.SetParent( d, c ));
+		th.Update();
+		TEST( th.LevelCount() == 5 );
+		TEST( th.GetParent( d ) == c );
+		TEST( not th.IsUpdated( c ));
+		TEST( th.IsUpdated( d ));
+		TEST( th.IsUpdated( e ));
+		TestWorld( th, nodes );
+
+		// children of destroyed node become roots
+		TEST( th.DestroyNode( b ));
+		TEST( not th.IsValid( b ));
+		th.Update();
+		TEST( th.NodeCount() == 4 );
+		TEST( th.GetParent( c ) == UMax );
+		TEST( th.GetParent( d ) == c );
+		TEST( th.LevelCount() == 3 );
+		TestWorld( th, nodes );
+	}
+
+
+	static void  TransformHierarchy_Test2 ()
+	{
+		LocalTaskScheduler	scheduler;
+		TransformHierarchy	th;
+		Random				rnd;
+		Array<NodeID>		nodes;
+
+		for (uint i = 0; i < 1000; ++i)
+		{
+			NodeID	parent = UMax;
+			if ( i > 0 and rnd.Uniform( 0, 3 ) > 0 )
+				parent = nodes[ rnd.Uniform( 0u, i-1 )];
+
+			nodes.push_back( th.CreateNode( RandomTransform( rnd ), parent ));
+		}
+
+		// small 'minPerTask' to process levels in parallel
+		th.Update( ETaskQueue::PerFrame, 16 );
+		TestWorld( th, nodes );
+
+		for (uint i = 0; i < 100; ++i) {
+			TEST( th.SetLocal( nodes[ rnd.Uniform( 0u, 999u )], RandomTransform( rnd )));
+		}
+		th.Update( ETaskQueue::PerFrame, 16 );
+		TestWorld( th, nodes );
+
+		for (uint i = 0; i < 50; ++i)
+		{
+			const NodeID	id = nodes[ rnd.Uniform( 0u, 999u )];
+			if ( th.IsValid( id ))
+				TEST( th.DestroyNode( id ));
+		}
+		th.Update( ETaskQueue::PerFrame, 16 );
+		TestWorld( th, nodes );
+	}
+
+
+	static void  TransformHierarchy_Test3 ()
+	{
+		using namespace AE::ECS::Components;
+
+		Registry			reg;
+		TransformHierarchy	th;
+		Random				rnd;
+
+		th.Register( reg );
+
+		const NodeID	a	= th.CreateNode( RandomTransform( rnd ));
+		const NodeID	b	= th.CreateNode( RandomTransform( rnd ), a );
+		const EntityID	e1	= reg.CreateEntity( TransformNode{a}, WorldTransform{} );
+		const EntityID	e2	= reg.CreateEntity( TransformNode{b}, WorldTransform{} );
+
+		th.Update();
+		th.CopyToComponents( reg );
+
+		TEST( Equal( reg.GetComponent<WorldTransform>( e1 )->matrix, th.GetWorld( a )));
+		TEST( Equal( reg.GetComponent<WorldTransform>( e2 )->matrix, th.GetWorld( b )));
+	}
+
+
+	static void  TransformHierarchy_Test4 ()
+	{
+		LocalTaskScheduler	scheduler;
+		TransformHierarchy	th;
+		Random				rnd;
+		Array<NodeID>		nodes;
+		const uint			count	= 100'000;
+
+		// 'CreateNode()' must not reallocate arrays on each call, otherwise it takes too long
+		nodes.reserve( count );
+		for (uint i = 0; i < count; ++i)
+		{
+			NodeID	parent = UMax;
+			if ( i > 0 and rnd.Uniform( 0, 7 ) > 0 )
+				parent = nodes[ rnd.Uniform( 0u, i-1 )];
+
+			nodes.push_back( th.CreateNode( RandomTransform( rnd ), parent ));
+			TEST( nodes.back() != UMax );
+		}
+		TEST( th.NodeCount() == count );
+
+		// default 'minPerTask', large levels are processed in parallel
+		th.Update();
+		TestWorld( th, nodes );
+
+		for (uint i = 0; i < 1000; ++i) {
+			TEST( th.SetLocal( nodes[ rnd.Uniform( 0u, count-1 )], RandomTransform( rnd )));
+		}
+		th.Update();
+		TestWorld( th, nodes );
+	}
+}
+
+
+extern void UnitTest_TransformHierarchy ()
+{
+	TransformHierarchy_Test1();
+	TransformHierarchy_Test2();
+	TransformHierarchy_Test3();
+	TransformHierarchy_Test4();
+
+	TEST_PASSED();
+}
@@ -5,6 +5,7 @@
 extern void UnitTest_Archetype ();
 extern void UnitTest_EntityPool ();
 extern void UnitTest_Registry ();
+extern void UnitTest_TransformHierarchy ();
 
 
 #ifdef AE_PLATFORM_ANDROID
@@ -18,6 +19,7 @@ int main (const int argc, char* argv[])
 	UnitTest_Archetype();
 	UnitTest_EntityPool();
 	UnitTest_Registry();
+	UnitTest_TransformHierarchy();
 
 	AE_LOGI( "Tests.ECS finished" );
 	return 0;
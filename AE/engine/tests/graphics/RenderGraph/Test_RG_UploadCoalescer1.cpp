@@ -0,0 +1,123 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "Test_RenderGraph.h"
+#include "graphics/Public/UploadCoalescer.h"
+
+namespace
+{
+	struct UC1_TestData
+	{
+		GAutorelease<BufferID>		buf;
+		const Bytes					buf_size	= 1_Kb;
+		Array<ubyte>				expected;
+		UploadCoalescer				coalescer;
+		AsyncTask					result;
+		bool						isOK		= false;
+		GfxMemAllocatorPtr			gfxAlloc;
+	};
+
+
+	class UC1_UploadTask final : public RenderTask
+	{
+	public:
+		UC1_TestData&	t;
+
+		UC1_UploadTask (UC1_TestData& t, CommandBatchPtr batch, DebugLabel dbg) __NE___ :
+			RenderTask{ RVRef(batch), dbg }, t{ t }
+		{}
+
+		void  Run () __Th_OV
+		{
+			DirectCtx::Transfer	ctx{ *this };
+
+			t.coalescer.Flush( ctx );
+
+			// [0, 512) and [600, 700) are merged ranges
+			const auto	stat = t.coalescer.GetStatistic();
+			CHECK_TE( stat.requests == 5 );
+			CHECK_TE( stat.dataSize == 862_b );
+			CHECK_TE( stat.stagingSize == 612_b );
+			CHECK_TE( stat.copies == 2 );
+
+			ctx.AccumBarriers()
+				.BufferBarrier( t.buf, EResourceState::CopyDst, EResourceState::CopySrc );
+
+			auto	read_res = ctx.ReadbackBuffer( t.buf, ReadbackBufferDesc{}.DataSize( t.buf_size ));
+			CHECK_TE( read_res.IsCompleted() );
+
+			t.result = AsyncTask{ read_res.Then( [p = &t] (const BufferMemView &view)
+								{
+									p->isOK = (view == ArrayView<ubyte>{ p->expected });
+								})};
+
+			ctx.AccumBarriers()
+				.MemoryBarrier( EResourceState::CopyDst, EResourceState::Host_Read );
+
+			Execute( ctx );
+		}
+	};
+
+
+	static bool  UploadCoalescer1Test ()
+	{
+		auto&			rts			= GraphicsScheduler();
+		auto&			res_mngr	= rts.GetResourceManager();
+		UC1_TestData	t;
+
+		t.gfxAlloc	= res_mngr.CreateLinearGfxMemAllocator();
+		t.buf		= res_mngr.CreateBuffer( BufferDesc{ t.buf_size, EBufferUsage::Transfer }.SetMemory( EMemoryType::DeviceLocal ), "dst_buf", t.gfxAlloc );
+		CHECK_ERR( t.buf );
+
+		t.expected.resize( usize(t.buf_size) );
+
+		// data from the latest upload must be used for overlapped ranges
+		const auto	Upload = [&t] (Bytes offset, Bytes size, ubyte value)
+		{{
+			Array<ubyte>	data;
+			data.resize( usize(size), value );
+
+			CHECK_ERR( t.coalescer.Upload( t.buf, offset, ArrayView<ubyte>{data} ));
+
+			std::fill_n( t.expected.begin() + usize(offset), usize(size), value );
+			return true;
+		}};
+
+		CHECK_ERR( Upload( 0_b,   256_b, 1 ));
+		CHECK_ERR( Upload( 256_b, 256_b, 2 ));	// adjacent
+		CHECK_ERR( Upload( 128_b, 200_b, 3 ));	// overlapped
+		CHECK_ERR( Upload( 640_b, 50_b,  4 ));	// separate range
+		CHECK_ERR( Upload( 600_b, 100_b, 5 ));	// overwrites previous
+
+		CHECK_ERR( rts.WaitNextFrame( c_ThreadArr, c_MaxTimeout ));
+		CHECK_ERR( rts.BeginFrame() );
+
+		auto		batch	= rts.BeginCmdBatch( EQueueType::Graphics, 0, {"UploadCoalescer1"} );
+		CHECK_ERR( batch );
+
+		AsyncTask	task1	= batch->Run< UC1_UploadTask >( Tuple{ArgRef(t)}, Tuple{}, True{"Last"}, {"Upload task"} );
+		AsyncTask	end		= rts.EndFrame( Tuple{task1} );
+
+		CHECK_ERR( Scheduler().Wait( {end}, c_MaxTimeout ));
+		CHECK_ERR( end->Status() == EStatus::Completed );
+
+		CHECK_ERR( rts.WaitAll( c_MaxTimeout ));
+
+		CHECK_ERR( Scheduler().Wait( {t.result}, c_MaxTimeout ));
+		CHECK_ERR( t.result->Status() == EStatus::Completed );
+
+		CHECK_ERR( t.isOK );
+		return true;
+	}
+
+} // namespace
+
+
+bool RGTest::Test_UploadCoalescer1 ()
+{
+	bool	result = true;
+
+	RG_CHECK( UploadCoalescer1Test() );
+
+	AE_LOGI( TEST_NAME << " - passed" );
+	return result;
+}
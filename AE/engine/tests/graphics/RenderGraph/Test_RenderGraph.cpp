@@ -31,6 +31,7 @@ RGTest::RGTest () :
 
 	_tests.emplace_back( &RGTest::Test_UploadStream1 );
 	_tests.emplace_back( &RGTest::Test_UploadStream2 );
+	_tests.emplace_back( &RGTest::Test_UploadCoalescer1 );
 
 	_tests.emplace_back( &RGTest::Test_CopyBuffer1 );
 	_tests.emplace_back( &RGTest::Test_CopyBuffer2 );
@@ -97,6 +97,7 @@ private:
 	bool  Test_CopyImage2 ();
 	bool  Test_UploadStream1 ();
 	bool  Test_UploadStream2 ();
+	bool  Test_UploadCoalescer1 ();
 
 	bool  Test_Compute1 ();
 	bool  Test_Compute2 ();			// with RG
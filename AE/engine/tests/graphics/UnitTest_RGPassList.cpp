@@ -0,0 +1,108 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "TestsGraphics.pch.h"
+
+namespace
+{
+	using AE::RG::_hidden_::RGPassListBase;
+	using AE::RG::_hidden_::ResourceKey;
+
+	using ResUsage	= RGPassListBase::ResUsage;
+	using PassRange	= RGPassListBase::PassRange;
+
+
+	static void  RGPassList_Test1 ()
+	{
+		const ResourceKey	buf0	{ BufferID{ 0, 1 }};
+		const ResourceKey	buf1	{ BufferID{ 1, 1 }};
+		const ResourceKey	img0	{ ImageID{ 0, 1 }};
+
+		// pass 0: write buf0
+		// pass 1: write buf1			- independent
+		// pass 2: read buf0, buf1		- depends on 0, 1
+		// pass 3: read buf0			- same state as in pass 2
+		// pass 4: write img0			- independent
+		// pass 5: write buf0, read img0
+		const Array<ResUsage>	res = {
+			ResUsage{ buf0, EResourceState::CopyDst },
+			ResUsage{ buf1, EResourceState::CopyDst },
+			ResUsage{ buf0, EResourceState::ShaderStorage_Read | EResourceState::ComputeShader },
+			ResUsage{ buf1, EResourceState::ShaderStorage_Read | EResourceState::ComputeShader },
+			ResUsage{ buf0, EResourceState::ShaderStorage_Read | EResourceState::ComputeShader },
+			ResUsage{ img0, EResourceState::ShaderStorage_Write | EResourceState::ComputeShader },
+			ResUsage{ buf0, EResourceState::CopyDst },
+			ResUsage{ img0, EResourceState::CopySrc },
+		};
+		const Array<PassRange>	passes = {
+			PassRange{ 0, 1 },
+			PassRange{ 1, 1 },
+			PassRange{ 2, 2 },
+			PassRange{ 4, 1 },
+			PassRange{ 5, 1 },
+			PassRange{ 6, 2 },
+		};
+
+		Array<uint>		levels;
+		levels.resize( passes.size() );
+
+		TEST( RGPassListBase::CalcLevels( res, passes, OUT levels ) == 3 );
+		TEST( levels == Array<uint>{ 0, 0, 1, 1, 0, 2 });
+
+		Array<uint>		order;
+		Array<uint>		task_start;
+
+		// single task
+		TEST( RGPassListBase::SplitToTasks( levels, 1, OUT order, OUT task_start ) == 1 );
+		TEST( order == Array<uint>{ 0, 1, 4, 2, 3, 5 });
+		TEST( task_start == Array<uint>{ 0 });
+
+		// one task per level
+		TEST( RGPassListBase::SplitToTasks( levels, 3, OUT order, OUT task_start ) == 3 );
+		TEST( task_start == Array<uint>{ 0, 3, 5 });
+
+		// independent passes in separate tasks
+		TEST( RGPassListBase::SplitToTasks( levels, 9, OUT order, OUT task_start ) == 6 );
+		TEST( task_start == Array<uint>{ 0, 1, 2, 3, 4, 5 });
+	}
+
+
+	static void  RGPassList_Test2 ()
+	{
+		const ResourceKey	buf0	{ BufferID{ 0, 1 }};
+
+		// write after write
+		const Array<ResUsage>	res = {
+			ResUsage{ buf0, EResourceState::ShaderStorage_Write | EResourceState::ComputeShader },
+			ResUsage{ buf0, EResourceState::ShaderStorage_Write | EResourceState::ComputeShader },
+			ResUsage{ buf0, EResourceState::ShaderStorage_Write | EResourceState::ComputeShader },
+		};
+		const Array<PassRange>	passes = {
+			PassRange{ 0, 1 },
+			PassRange{ 1, 1 },
+			PassRange{ 2, 1 },
+		};
+
+		Array<uint>		levels;
+		levels.resize( passes.size() );
+
+		TEST( RGPassListBase::CalcLevels( res, passes, OUT levels ) == 3 );
+		TEST( levels == Array<uint>{ 0, 1, 2 });
+
+		Array<uint>		order;
+		Array<uint>		task_start;
+
+		// levels are merged
+		TEST( RGPassListBase::SplitToTasks( levels, 2, OUT order, OUT task_start ) == 2 );
+		TEST( order == Array<uint>{ 0, 1, 2 });
+		TEST( task_start == Array<uint>{ 0, 2 });
+	}
+}
+
+
+extern void  UnitTest_RGPassList ()
+{
+	RGPassList_Test1();
+	RGPassList_Test2();
+
+	TEST_PASSED();
+}
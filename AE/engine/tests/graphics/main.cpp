@@ -14,6 +14,7 @@ extern void UnitTest_ImageSwizzle ();
 extern void UnitTest_ImageMemView ();
 extern void UnitTest_ImageUtils ();
 extern void UnitTest_PixelFormat ();
+extern void UnitTest_RGPassList ();
 
 #if defined(AE_ENABLE_VULKAN)
 	extern void Test_VulkanDevice (IApplication* app, IWindow* wnd);
@@ -52,6 +53,7 @@ static void  RenderTests (RC<VFS::IVirtualFileStorage> assetStorage, RC<VFS::IVi
 	UnitTest_ImageMemView();
 	UnitTest_ImageUtils();
 	UnitTest_PixelFormat();
+	UnitTest_RGPassList();
 
 	#if defined(AE_ENABLE_VULKAN)
 		Test_VulkanRenderGraph( assetStorage, refStorage );
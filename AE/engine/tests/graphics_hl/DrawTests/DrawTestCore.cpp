@@ -28,6 +28,7 @@ DrawTestCore::DrawTestCore () :
 	_device{ True{"enable info log"} }
 {
 	_tests.emplace_back( &DrawTestCore::Test_Canvas_Rect );
+	_tests.emplace_back( &DrawTestCore::Test_ImageAtlas_AsyncLoad );
 }
 
 /*
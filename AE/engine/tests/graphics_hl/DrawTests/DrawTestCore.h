@@ -79,6 +79,7 @@ protected:
 
 private:
 	bool  Test_Canvas_Rect ();
+	bool  Test_ImageAtlas_AsyncLoad ();
 };
 
 
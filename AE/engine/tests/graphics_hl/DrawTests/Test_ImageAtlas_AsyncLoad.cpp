@@ -0,0 +1,235 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "DrawTestCore.h"
+#include "graphics_hl/Resources/StaticImageAtlas.h"
+#include "threading/DataSource/FileAsyncDataSource.h"
+
+namespace
+{
+	using namespace AE::Serializing;
+	using namespace AE::AssetPacker;
+
+#	include "Packer/ImagePacker.cpp.h"
+#	include "Packer/ImageAtlasPacker.cpp.h"
+
+
+	struct IA1_TestData
+	{
+		Mutex						guard;
+
+		RC<StaticImageAtlas>		atlas;
+		GAutorelease<ImageID>		placeholder;
+		GAutorelease<ImageViewID>	placeholderView;
+
+		Array<ubyte>				pixels;
+		uint2						dim;
+
+		AsyncTask					result;
+		bool						isOK	= false;
+	};
+
+	static const EThreadArray	c_LoadThreadArr	{EThread::Background, EThread::FileIO};
+
+
+	template <typename Ctx>
+	class IA1_UploadTask final : public RenderTask
+	{
+	public:
+		IA1_TestData&	t;
+
+		IA1_UploadTask (IA1_TestData& t, CommandBatchPtr batch, DebugLabel dbg) __NE___ :
+			RenderTask{ batch, dbg },
+			t{ t }
+		{}
+
+		void  Run () __Th_OV
+		{
+			DeferExLock	lock {t.guard};
+			CHECK_TE( lock.try_lock() );
+
+			Ctx		ctx{ *this };
+
+			// small limit to spread upload across several frames
+			CHECK_TE( t.atlas->Upload( ctx, 1_Kb ));
+
+			Execute( ctx );
+		}
+	};
+
+	template <typename Ctx>
+	class IA1_CopyTask final : public RenderTask
+	{
+	public:
+		IA1_TestData&	t;
+
+		IA1_CopyTask (IA1_TestData& t, CommandBatchPtr batch, DebugLabel dbg) __NE___ :
+			RenderTask{ batch, dbg },
+			t{ t }
+		{}
+
+		void  Run () __Th_OV
+		{
+			DeferExLock	lock {t.guard};
+			CHECK_TE( lock.try_lock() );
+
+			Ctx		ctx{ *this };
+
+			// image stays in 'CopyDst' state after upload
+			ctx.ImageBarrier( t.atlas->GetImageID(), EResourceState::CopyDst, EResourceState::CopySrc );
+			ctx.CommitBarriers();
+
+			t.result = AsyncTask{ ctx.ReadbackImage( t.atlas->GetImageID(), Default )
+						.Then(	[p = &t] (const ImageMemView &view)
+								{
+									const ImageMemView	ref { p->pixels, uint3{}, uint3{p->dim, 1}, Bytes{p->dim.x * 4u},
+															  Bytes{p->pixels.size()}, EPixelFormat::RGBA8_UNorm, EImageAspect::Color };
+									p->isOK = (view.Compare( ref ) == 0_b);
+								})};
+
+			ctx.AccumBarriers().MemoryBarrier( EResourceState::CopyDst, EResourceState::Host_Read );
+
+			Execute( ctx );
+		}
+	};
+
+
+	static bool  WriteAtlas (const Path &fname, const uint2 dim, OUT Array<ubyte> &pixels)
+	{
+		ImagePacker::Header	hdr;
+		hdr.dimension	= ushort3{uint3{ dim, 1 }};
+		hdr.arrayLayers	= 1;
+		hdr.mipmaps		= 1;
+		hdr.viewType	= EImage_2D;
+		hdr.format		= EPixelFormat::RGBA8_UNorm;
+
+		ImageAtlasPacker	packer {hdr};
+		packer.rects.push_back( Rectangle<ushort>{  0, 0, 16, 16 });
+		packer.rects.push_back( Rectangle<ushort>{ 16, 8, 32, 32 });
+		CHECK_ERR( packer.map.emplace( ImageInAtlasName::Optimized_t{ImageInAtlasName{"a"}}, 0u ).second );
+		CHECK_ERR( packer.map.emplace( ImageInAtlasName::Optimized_t{ImageInAtlasName{"b"}}, 1u ).second );
+
+		pixels.resize( dim.x * dim.y * 4 );
+		for (usize i = 0; i < pixels.size(); ++i) {
+			pixels[i] = ubyte(i * 7 + 3);
+		}
+
+		auto	stream = MakeRC<FileWStream>( fname );
+		CHECK_ERR( stream->IsOpen() );
+		{
+			Serializer	ser {stream};
+			CHECK_ERR( ImageAtlasPacker_Serialize( packer, ser ));
+		}
+		CHECK_ERR( stream->Write( ArrayView<ubyte>{ pixels }));
+		return true;
+	}
+
+
+	template <typename Ctx>
+	static bool  ImageAtlasAsyncLoad (const Path &fname)
+	{
+		auto&			rts			= GraphicsScheduler();
+		auto&			res_mngr	= rts.GetResourceManager();
+		IA1_TestData	t;
+
+		t.dim = uint2{32, 32};
+		CHECK_ERR( WriteAtlas( fname, t.dim, OUT t.pixels ));
+
+		t.placeholder = res_mngr.CreateImage( ImageDesc{}.SetDimension( uint2{4} ).SetFormat( EPixelFormat::RGBA8_UNorm )
+												.SetUsage( EImageUsage::Sampled | EImageUsage::TransferDst ),
+											  "Placeholder" );
+		CHECK_ERR( t.placeholder );
+
+		t.placeholderView = res_mngr.CreateImageView( ImageViewDesc{}, t.placeholder, "PlaceholderView" );
+		CHECK_ERR( t.placeholderView );
+
+		// file is read in IO thread, image is created in background thread
+		{
+			auto	file = MakeRC<FileAsyncRDataSource>( fname );
+			CHECK_ERR( file->IsOpen() );
+
+			auto	promise = StaticImageAtlas::AsyncLoader{}.Load( file, res_mngr.CreateLinearGfxMemAllocator(), t.placeholderView );
+
+			CHECK_ERR( Scheduler().Wait( {AsyncTask{promise}}, c_LoadThreadArr, c_MaxTimeout ));
+			CHECK_ERR( promise.Status() == EStatus::Completed );
+			CHECK_ERR( promise.WithResult( [&t] (const RC<StaticImageAtlas> &atlas) { t.atlas = atlas; }));
+			CHECK_ERR( t.atlas );
+		}
+
+		// placeholder is used until upload is complete
+		CHECK_ERR( not t.atlas->IsLoaded() );
+		CHECK_ERR( t.atlas->GetImageID() );
+		CHECK_ERR( t.atlas->GetViewID() == t.placeholderView );
+
+		{
+			RectI	rect;
+			CHECK_ERR( t.atlas->Get( ImageInAtlasName{"a"}, OUT rect ));
+			CHECK_ERR( All( rect == RectI{0, 0, 16, 16} ));
+
+			CHECK_ERR( t.atlas->Get( ImageInAtlasName{"b"}, OUT rect ));
+			CHECK_ERR( All( rect == RectI{16, 8, 32, 32} ));
+
+			CHECK_ERR( not t.atlas->Get( ImageInAtlasName{"c"}, OUT rect ));
+		}
+
+		// upload
+		for (uint frame = 0; not t.atlas->IsLoaded(); ++frame)
+		{
+			CHECK_ERR( frame < 100 );
+			CHECK_ERR( t.atlas->GetViewID() == t.placeholderView );
+
+			CHECK_ERR( rts.WaitNextFrame( c_ThreadArr, c_MaxTimeout ));
+			CHECK_ERR( rts.BeginFrame() );
+
+			auto		batch	= rts.BeginCmdBatch( EQueueType::Graphics, 0, {"Atlas upload batch"} );
+			CHECK_ERR( batch );
+
+			AsyncTask	task	= batch->Run< IA1_UploadTask<Ctx> >( Tuple{ArgRef(t)}, Tuple{}, True{"Last"}, {"Upload task"} );
+			AsyncTask	end		= rts.EndFrame( Tuple{task} );
+
+			CHECK_ERR( Scheduler().Wait( {end}, c_MaxTimeout ));
+			CHECK_ERR( end->Status() == EStatus::Completed );
+		}
+
+		CHECK_ERR( t.atlas->GetViewID() != t.placeholderView );
+		CHECK_ERR( t.atlas->GetViewID() );
+
+		// readback
+		{
+			CHECK_ERR( rts.WaitNextFrame( c_ThreadArr, c_MaxTimeout ));
+			CHECK_ERR( rts.BeginFrame() );
+
+			auto		batch	= rts.BeginCmdBatch( EQueueType::Graphics, 0, {"Atlas readback batch"} );
+			CHECK_ERR( batch );
+
+			AsyncTask	task	= batch->Run< IA1_CopyTask<Ctx> >( Tuple{ArgRef(t)}, Tuple{}, True{"Last"}, {"Readback task"} );
+			AsyncTask	end		= rts.EndFrame( Tuple{task} );
+
+			CHECK_ERR( Scheduler().Wait( {end}, c_MaxTimeout ));
+			CHECK_ERR( end->Status() == EStatus::Completed );
+		}
+
+		CHECK_ERR( rts.WaitAll( c_MaxTimeout ));
+
+		CHECK_ERR( Scheduler().Wait( {t.result}, c_MaxTimeout ));
+		CHECK_ERR( t.result->Status() == EStatus::Completed );
+
+		CHECK_ERR( t.isOK );
+		return true;
+	}
+
+} // namespace
+
+
+bool DrawTestCore::Test_ImageAtlas_AsyncLoad ()
+{
+	const Path	fname	{"atlas_async_test.bin"};
+	bool		result	= true;
+
+	RG_CHECK( ImageAtlasAsyncLoad< DirectCtx::Transfer   >( fname ));
+	RG_CHECK( ImageAtlasAsyncLoad< IndirectCtx::Transfer >( fname ));
+
+	FileSystem::DeleteFile( fname );
+
+	AE_LOGI( TEST_NAME << " - passed" );
+	return result;
+}
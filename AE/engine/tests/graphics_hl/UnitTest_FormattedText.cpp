@@ -155,6 +155,33 @@ namespace
 		FormattedText	text4{ str4 };
 		TEST( text4.ToString() == str4 );
 	}
+
+
+	static void FormattedText_Test5 ()
+	{
+		U8StringView	str1 = u8"[style color=#11223344 size=10]ab[b]c[/b]de[/style]1[i]122[/i]45";
+		FormattedText	text1{ str1 };
+
+		for (bool in_place : {false, true})
+		{
+			auto	wstream = MakeRC<ArrayWStream>();
+			{
+				Serializing::Serializer		ser{ wstream };
+				ser.inPlaceLayout = in_place;
+				TEST( text1.Serialize( ser ));
+			}
+
+			FormattedText	text2;
+			{
+				Serializing::Deserializer	des{ MakeRC<MemRefRStream>( wstream->GetData() )};
+				des.inPlaceLayout = in_place;
+				TEST( text2.Deserialize( des ));
+				TEST( des.IsEnd() );
+			}
+			TEST( text2.GetMaxChars() == text1.GetMaxChars() );
+			TEST( text2.ToString() == str1 );
+		}
+	}
 }
 
 
@@ -164,6 +191,7 @@ extern void UnitTest_FormattedText ()
 	FormattedText_Test2();
 	FormattedText_Test3();
 	FormattedText_Test4();
+	FormattedText_Test5();
 
 	TEST_PASSED();
 }
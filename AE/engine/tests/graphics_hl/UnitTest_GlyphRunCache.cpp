@@ -0,0 +1,71 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "TestsGraphicsHL.pch.h"
+
+namespace
+{
+	static void  GlyphRunCache_Test1 ()
+	{
+		GlyphRunCache		cache	{3};
+		GlyphRunCache::Key	key;
+
+		key.heightInPx	= 10.f;
+		key.region		= RectF{ -1.f, -1.f, 1.f, 1.f };
+		key.pxToVp		= float2{ 0.01f };
+
+		const auto	AddRun = [&] (U8StringView text, uint vertCount)
+		{{
+			auto*	run = cache.Add( text, key );
+			TEST( run != null );
+			TEST( run->VertexCount() == 0 );
+			run->positions.resize( vertCount );
+			run->attribs.resize( vertCount );
+		}};
+
+		TEST( cache.Find( u8"a", key ) == null );
+
+		AddRun( u8"a", 4 );
+		AddRun( u8"b", 8 );
+		AddRun( u8"c", 12 );
+		TEST_Eq( cache.Count(), 3 );
+
+		// make 'a' most recently used
+		{
+			auto*	run = cache.Find( u8"a", key );
+			TEST( run != null );
+			TEST_Eq( run->VertexCount(), 4 );
+		}
+
+		// evict 'b'
+		AddRun( u8"d", 16 );
+		TEST_Eq( cache.Count(), 3 );
+		TEST( cache.Find( u8"b", key ) == null );
+		TEST( cache.Find( u8"a", key ) != null );
+		TEST( cache.Find( u8"c", key ) != null );
+		TEST( cache.Find( u8"d", key ) != null );
+
+		// same text with different params
+		{
+			GlyphRunCache::Key	key2 = key;
+			key2.heightInPx = 12.f;
+			TEST( cache.Find( u8"a", key2 ) == null );
+		}
+
+		const auto	stat = cache.GetStatistic();
+		TEST_Eq( stat.evicted, 1 );
+		TEST_Eq( stat.hits, 4 );
+		TEST_Eq( stat.misses, 3 );
+
+		cache.Clear();
+		TEST_Eq( cache.Count(), 0 );
+		TEST( cache.Find( u8"a", key ) == null );
+	}
+}
+
+
+extern void  UnitTest_GlyphRunCache ()
+{
+	GlyphRunCache_Test1();
+
+	TEST_PASSED();
+}
@@ -0,0 +1,170 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "TestsGraphicsHL.pch.h"
+
+#if AE_ENABLE_MEMORY_PROFILER and defined(AE_TEST_PROFILER)
+# include "profiler/Impl/MemoryProfiler.h"
+
+namespace
+{
+	using AE::Profiler::MemoryProfiler;
+	using EAllocator = IMemoryProfiler::EAllocator;
+
+
+	ND_ static MemoryProfiler::AllocatorStat  FindStat (const MemoryProfiler &prof, StringView name)
+	{
+		for (auto& st : prof.GetAllocatorStats())
+		{
+			if ( st.name == name )
+				return st;
+		}
+		TEST( false );
+		return {};
+	}
+
+	ND_ static Bytes  SitesLive (const MemoryProfiler::Snapshot &snap)
+	{
+		Bytes	sum;
+		for (auto& [key, st] : snap.sites) {
+			sum += st.live;
+		}
+		return sum;
+	}
+
+
+	static void  MemoryProfiler_Test1 ()
+	{
+		auto	prof = MakeRC<MemoryProfiler>( MemoryProfiler::TimePoint_t::clock::now(), 1_Kb );
+
+		// allocators and memory are not used, only addresses are required
+		const int			gen_alloc	= 0;
+		const int			lin_alloc	= 0;
+		StaticArray< ubyte, 256 >	mem		= {};
+
+		prof->RegisterAllocator( &gen_alloc, EAllocator::General, "Gen" );
+		prof->RegisterAllocator( &lin_alloc, EAllocator::Linear,  "Lin" );
+
+		// live & peak
+		prof->OnAllocate( &gen_alloc, EAllocator::General, &mem[0],  512_b );
+		prof->OnAllocate( &gen_alloc, EAllocator::General, &mem[64], 512_b );
+		prof->OnAllocate( &gen_alloc, EAllocator::General, &mem[128], 512_b );
+
+		// size is tracked by profiler for general allocator
+		prof->OnDeallocate( &gen_alloc, &mem[0], 0_b );
+
+		// allocated before profiler was attached, must be ignored
+		prof->OnDeallocate( &gen_alloc, &mem[192], 512_b );
+		{
+			auto	st = FindStat( *prof, "Gen" );
+			TEST( st.type == EAllocator::General );
+			TEST( st.live == 1_Kb );
+			TEST( st.peak == 1536_b );
+			TEST_Eq( st.allocCount, 3u );
+			TEST_Eq( st.deallocCount, 1u );
+		}
+
+		prof->OnAllocate( &lin_alloc, EAllocator::Linear, &mem[8], 4_Kb );
+		prof->OnDiscard( &lin_alloc );
+		{
+			auto	st = FindStat( *prof, "Lin" );
+			TEST( st.type == EAllocator::Linear );
+			TEST( st.live == 0_b );
+			TEST( st.peak == 4_Kb );
+		}
+
+		// sampling: at least one sample per 'sampleInterval' bytes
+		TEST( not prof->GetTopSites( 10 ).empty() );
+
+		// snapshots
+		const auto	snap1 = prof->TakeSnapshot();
+		prof->OnAllocate( &gen_alloc, EAllocator::General, &mem[160], 8_Kb );
+		const auto	snap2 = prof->TakeSnapshot();
+
+		TEST( snap1.allocators.at( MemoryProfiler::Caption_t{"Gen"} ) == 1_Kb );
+		TEST( snap2.allocators.at( MemoryProfiler::Caption_t{"Gen"} ) == 9_Kb );
+		TEST( snap2.allocators.at( MemoryProfiler::Caption_t{"Lin"} ) == 0_b );
+		TEST( SitesLive( snap2 ) > SitesLive( snap1 ));
+		TEST( snap2.time >= snap1.time );
+
+		const String	diff = MemoryProfiler::SnapshotDiff( snap1, snap2 );
+		TEST( HasSubString( diff, "Gen: +" ));
+		TEST( not HasSubString( diff, "Lin:" ));	// not changed
+
+		const String	diff2 = MemoryProfiler::SnapshotDiff( snap2, snap1 );
+		TEST( HasSubString( diff2, "Gen: -" ));
+
+		// all sampled allocations are released
+		prof->OnDeallocate( &gen_alloc, &mem[64],  0_b );
+		prof->OnDeallocate( &gen_alloc, &mem[128], 0_b );
+		prof->OnDeallocate( &gen_alloc, &mem[160], 0_b );
+
+		TEST( FindStat( *prof, "Gen" ).live == 0_b );
+		TEST( prof->GetTopSites( 10 ).empty() );
+		TEST( SitesLive( prof->TakeSnapshot() ) == 0_b );
+
+		prof->UnregisterAllocator( &gen_alloc );
+		prof->UnregisterAllocator( &lin_alloc );
+		TEST( prof->GetAllocatorStats().empty() );
+	}
+
+
+	static void  MemoryProfiler_Test2 ()
+	{
+		// allocations from multiple threads
+		auto	prof = MakeRC<MemoryProfiler>( MemoryProfiler::TimePoint_t::clock::now(), 256_b );
+
+		constexpr uint		thread_count	= 4;
+		constexpr uint		alloc_count		= 1000;
+		const int			alloc			= 0;
+		StaticArray< ubyte, thread_count * alloc_count >	mem = {};
+
+		prof->RegisterAllocator( &alloc, EAllocator::General, "MT" );
+
+		StaticArray< StdThread, thread_count >	threads;
+		for (uint t = 0; t < thread_count; ++t)
+		{
+			threads[t] = StdThread{ [&, t] ()
+			{
+				for (uint i = 0; i < alloc_count; ++i) {
+					prof->OnAllocate( &alloc, EAllocator::General, &mem[t * alloc_count + i], 64_b );
+				}
+				for (uint i = 0; i < alloc_count; i += 2) {
+					prof->OnDeallocate( &alloc, &mem[t * alloc_count + i], 0_b );
+				}
+			}};
+		}
+		for (auto& t : threads) {
+			t.join();
+		}
+
+		const auto	st = FindStat( *prof, "MT" );
+		TEST( st.live == 64_b * (thread_count * alloc_count / 2) );
+		TEST( st.peak <= 64_b * (thread_count * alloc_count) );
+		TEST( st.peak >= st.live );
+		TEST_Eq( st.allocCount, thread_count * alloc_count );
+		TEST_Eq( st.deallocCount, thread_count * alloc_count / 2 );
+
+		// samples of not released allocations
+		TEST( not prof->GetTopSites( 10 ).empty() );
+
+		prof->OnDiscard( &alloc );
+		TEST( FindStat( *prof, "MT" ).live == 0_b );
+		TEST( prof->GetTopSites( 10 ).empty() );
+	}
+}
+
+
+extern void UnitTest_MemoryProfiler ()
+{
+	MemoryProfiler_Test1();
+	MemoryProfiler_Test2();
+
+	TEST_PASSED();
+}
+
+#else
+
+extern void UnitTest_MemoryProfiler ()
+{}
+
+#endif
@@ -287,6 +287,58 @@ namespace
 			// TODO: lt_2, lt_3
 		}
 	}
+
+
+	static void  Test_Invalidate1 ()
+	{
+		Widget::Allocator_t		alloc;
+		Widget::TempAllocator_t	alloc2;
+		RC<Widget>				w		= Widget::New( alloc, alloc2 );
+		RC<FixedLayoutPx>		lt_0	= w->Create<FixedLayoutPx>();
+		RC<FixedLayoutPx>		lt_1	= w->Create<FixedLayoutPx>();
+		RC<PaddingLayoutPx>		lt_2	= w->Create<PaddingLayoutPx>();
+		RC<FixedLayoutPx>		lt_3	= w->Create<FixedLayoutPx>();
+
+		lt_1->AddChild( lt_2 );
+		lt_0->AddChild( lt_1 );
+		lt_0->AddChild( lt_3 );
+
+		TEST( w->Initialize( lt_0 ));
+
+		auto	action_map = IController::ActionMapBuilder{}.Build();
+		w->SetActionBindings( action_map );
+
+		lt_0->SetRegion( RectF{ 0.f, 0.f, 100.f, 100.f });
+		lt_1->SetRegion( RectF{ 10.f, 10.f, 50.f, 50.f });
+		lt_2->SetPadding( 2.f );
+		lt_3->SetRegion( RectF{ 60.f, 60.f, 90.f, 90.f });
+
+		w->Update( surf_size, mm_to_px, input );
+		TEST( w->IsLayoutChanged() );
+		TEST( All( lt_2->GlobalRect() == RectF{ 12.f, 12.f, 48.f, 48.f } ));
+
+		// nothing changed
+		w->Update( surf_size, mm_to_px, input );
+		TEST( not w->IsLayoutChanged() );
+
+		// child of invalidated layout must be updated too
+		lt_1->Move( float2{5.f} );
+		w->Update( surf_size, mm_to_px, input );
+		TEST( w->IsLayoutChanged() );
+		TEST( All( lt_1->GlobalRect() == RectF{ 15.f, 15.f, 55.f, 55.f } ));
+		TEST( All( lt_2->GlobalRect() == RectF{ 17.f, 17.f, 53.f, 53.f } ));
+		TEST( All( lt_3->GlobalRect() == RectF{ 60.f, 60.f, 90.f, 90.f } ));
+
+		// root is invalidated
+		lt_0->Move( float2{1.f} );
+		w->Update( surf_size, mm_to_px, input );
+		TEST( All( lt_2->GlobalRect() == RectF{ 18.f, 18.f, 54.f, 54.f } ));
+		TEST( All( lt_3->GlobalRect() == RectF{ 61.f, 61.f, 91.f, 91.f } ));
+
+		// surface size is changed
+		w->Update( surf_size * 2.f, mm_to_px, input );
+		TEST( w->IsLayoutChanged() );
+	}
 }
 
 
@@ -297,6 +349,7 @@ extern void UnitTest_UI_Layouts ()
 	Test_AlignedLayout2();
 	Test_PaddingLayout1();
 	Test_FillStackLayout1();
+	Test_Invalidate1();
 
 	TEST_PASSED();
 }
@@ -8,6 +8,8 @@ using namespace AE::Threading;
 
 extern void UnitTest_FormattedText ();
 extern void UnitTest_UI_Layouts ();
+extern void UnitTest_GlyphRunCache ();
+extern void UnitTest_MemoryProfiler ();
 extern void Test_DrawTests (RC<VFS::IVirtualFileStorage> assetStorage, RC<VFS::IVirtualFileStorage> refStorage);
 
 
@@ -18,6 +20,7 @@ static void  GraphicsTests (RC<VFS::IVirtualFileStorage> assetStorage, RC<VFS::I
 	TaskScheduler::InstanceCtor::Create();
 
 	TaskScheduler::Config	cfg;
+	cfg.maxIOAccessThreads	= 1;	// for async resource loading
 	CHECK_FATAL( Scheduler().Setup( cfg ));
 
 	CHECK_FATAL( Networking::SocketService::Instance().Initialize() );
@@ -25,6 +28,8 @@ static void  GraphicsTests (RC<VFS::IVirtualFileStorage> assetStorage, RC<VFS::I
 
 	UnitTest_FormattedText();
 	UnitTest_UI_Layouts();
+	UnitTest_GlyphRunCache();
+	UnitTest_MemoryProfiler();
 
 	Test_DrawTests( assetStorage, refStorage );
 
@@ -25,7 +25,8 @@ namespace
 	public:
 		explicit Server (RC<MessageFactory> mf)	{ TEST( _Initialize( RVRef(mf), MakeRC<DefaultClientListener>(), null, c_InitialFrameId )); }
 
-		ND_ bool  AddChannel (ushort port)		{ return _AddChannelReliableTCP( port ); }
+		ND_ bool  AddChannel (ushort port, EChannelEncoding enc)					{ return _AddChannelReliableTCP( port, enc ); }
+		ND_ bool  AddShardedChannel (ushort port, uint shards, EChannelEncoding enc)	{ return _AddShardedChannelReliableTCP( port, shards, ETaskQueue::PerFrame, enc ); }
 	};
 
 
@@ -34,7 +35,7 @@ namespace
 	public:
 		explicit Client (RC<MessageFactory> mf, const IpAddress &addr)	{ TEST( _Initialize( RVRef(mf), MakeRC<ServerProvider>( addr ), null, c_InitialFrameId )); }
 
-		ND_ bool  AddChannel ()											{ return _AddChannelReliableTCP(); }
+		ND_ bool  AddChannel (EChannelEncoding enc)						{ return _AddChannelReliableTCP( enc ); }
 		ND_ bool  IsConnected ()										{ return _IsConnected(); }
 	};
 
@@ -105,20 +106,20 @@ namespace
 	};
 
 
-	static void  TcpChannel_Test1 ()
+	static void  TcpChannel_Test (const EChannelEncoding encoding, const ushort port, OUT IChannel::MsgQueueStatistic &clientStat,
+								  const uint shardCount = 1, const uint clientCount = 1)
 	{
 		LocalSocketMngr			mngr;
 		static constexpr uint	frame_count = 40;
 		static constexpr uint	msg_count	= 100;
-		Threading::Barrier		sync {2};
-
-		ulong	client_sent_msgs	= 0;
-		ulong	server_sent_msgs	= 0;
+		Threading::Barrier		sync {1 + clientCount};
 
-		ulong	client_recv_msgs	= 0;
-		ulong	sever_recv_msgs		= 0;
+		Array<ulong>	client_sent_msgs	( clientCount );
+		Array<ulong>	client_recv_msgs	( clientCount );
+		ulong			server_sent_msgs	= 0;
+		ulong			sever_recv_msgs		= 0;
 
-		StdThread	server_thread{ [&server_sent_msgs, &sever_recv_msgs, &sync] ()
+		StdThread	server_thread{ [&server_sent_msgs, &sever_recv_msgs, &sync, encoding, port, shardCount] ()
 			{{
 				auto		mf		= MakeRC<MessageFactory>();
 				Server		server	{mf};
@@ -127,7 +128,10 @@ namespace
 				TEST( mf->Register< CSMsg_Log >( True{} ));
 				TEST( mf->Register< CSMsg_NextFrame >( True{} ));
 
-				TEST( server.AddChannel( c_Port ));
+				if ( shardCount > 1 )
+					TEST( server.AddShardedChannel( port, shardCount, encoding ))
+				else
+					TEST( server.AddChannel( port, encoding ));
 
 				server.Add( MakeRC<LogMsgProducer>( msg_count, mf, "from server"sv, SourceLoc_Current(), server_sent_msgs ));
 				server.Add( MakeRC<LogMsgConsumer>( "from client"sv, sever_recv_msgs ));
@@ -150,51 +154,114 @@ namespace
 				sync.Wait();
 			}}};
 
-		StdThread	client_thread{ [&client_sent_msgs, &client_recv_msgs, &sync] ()
-			{{
-				auto		mf		= MakeRC<MessageFactory>();
-				Client		client	{ mf, IpAddress::FromHostPortTCP( "localhost", c_Port )};
-				FrameUID	fid		= c_InitialFrameId;
+		Array<StdThread>						client_threads;
+		Array<IChannel::MsgQueueStatistic>		client_stat ( clientCount );
 
-				TEST( mf->Register< CSMsg_Log >( True{} ));
-				TEST( mf->Register< CSMsg_NextFrame >( True{} ));
+		for (uint c = 0; c < clientCount; ++c)
+		{
+			client_threads.push_back( StdThread{ [&sent = client_sent_msgs[c], &recv = client_recv_msgs[c], &sync, &cstat = client_stat[c], encoding, port] ()
+				{{
+					auto		mf		= MakeRC<MessageFactory>();
+					Client		client	{ mf, IpAddress::FromHostPortTCP( "localhost", port )};
+					FrameUID	fid		= c_InitialFrameId;
 
-				TEST( client.AddChannel() );
+					TEST( mf->Register< CSMsg_Log >( True{} ));
+					TEST( mf->Register< CSMsg_NextFrame >( True{} ));
 
-				client.Add( MakeRC<LogMsgProducer>( msg_count, mf, "from client"sv, SourceLoc_Current(), client_sent_msgs ));
-				client.Add( MakeRC<LogMsgConsumer>( "from server"sv, client_recv_msgs ));
+					TEST( client.AddChannel( encoding ));
 
-				sync.Wait();
+					client.Add( MakeRC<LogMsgProducer>( msg_count, mf, "from client"sv, SourceLoc_Current(), sent ));
+					client.Add( MakeRC<LogMsgConsumer>( "from server"sv, recv ));
 
-				// wait for connection
-				for (; not client.IsConnected();)
-				{
-					Unused( client.Update( fid ));
-					ThreadUtils::MilliSleep( milliseconds{100} );
-				}
+					sync.Wait();
 
-				sync.Wait();
+					// wait for connection
+					for (; not client.IsConnected();)
+					{
+						Unused( client.Update( fid ));
+						ThreadUtils::MilliSleep( milliseconds{100} );
+					}
 
-				for (uint i = 0; i < frame_count and client.IsConnected(); ++i)
-				{
-					auto	stat = client.Update( fid );
+					sync.Wait();
 
-					if ( (i & 0xF) == 0 )
-						stat = client.Update( fid );
+					for (uint i = 0; i < frame_count and client.IsConnected(); ++i)
+					{
+						auto	stat = client.Update( fid );
+						cstat.rawOutput		+= stat.rawOutput;
+						cstat.packedOutput	+= stat.packedOutput;
+						cstat.rawInput		+= stat.rawInput;
+						cstat.packedInput	+= stat.packedInput;
 
-					if ( stat )
-						fid.Inc();
+						if ( (i & 0xF) == 0 )
+							stat = client.Update( fid );
 
-					ThreadUtils::MilliSleep( milliseconds{100} );
-				}
-				sync.Wait();
-			}}};
+						if ( stat )
+							fid.Inc();
+
+						ThreadUtils::MilliSleep( milliseconds{100} );
+					}
+					sync.Wait();
+				}}});
+		}
 
 		server_thread.join();
-		client_thread.join();
+		for (auto& t : client_threads) {
+			t.join();
+		}
+
+		ulong	client_sent_total = 0;
+		for (uint c = 0; c < clientCount; ++c)
+		{
+			client_sent_total		+= client_sent_msgs[c];
+			clientStat.rawOutput	+= client_stat[c].rawOutput;
+			clientStat.packedOutput	+= client_stat[c].packedOutput;
+			clientStat.rawInput		+= client_stat[c].rawInput;
+			clientStat.packedInput	+= client_stat[c].packedInput;
+
+			// server messages are sent to all clients
+			TEST( Equal( float(server_sent_msgs), float(client_recv_msgs[c]), 90_pct ));
+		}
+		TEST( Equal( float(client_sent_total), float(sever_recv_msgs), 90_pct ));
+	}
+
+
+	static void  TcpChannel_Test1 ()
+	{
+		IChannel::MsgQueueStatistic	stat;
+		TcpChannel_Test( EChannelEncoding::None, c_Port, OUT stat );
+
+		TEST( stat.rawOutput > 0 );
+		TEST( stat.rawOutput == stat.packedOutput );
+		TEST( stat.rawInput == stat.packedInput );
+	}
+
+
+	static void  TcpChannel_Test2 ()
+	{
+		IChannel::MsgQueueStatistic	stat;
+		TcpChannel_Test( EChannelEncoding::All, c_Port+1, OUT stat );
+
+		TEST( stat.rawOutput > 0 );
+		TEST( stat.rawInput > 0 );
+
+	  #ifdef AE_ENABLE_LZ4
+		// same log messages are repeated, delta encoding should remove almost all data
+		TEST( stat.packedOutput * 4 < stat.rawOutput );
+		TEST( stat.packedInput * 4 < stat.rawInput );
+	  #else
+		TEST( stat.rawOutput == stat.packedOutput );
+	  #endif
+	}
+
+
+	static void  TcpChannel_Test3 ()
+	{
+		// 4 clients are distributed across 2 shards
+		IChannel::MsgQueueStatistic	stat;
+		TcpChannel_Test( EChannelEncoding::LZ4, c_Port+2, OUT stat, 2, 4 );
 
-		TEST( Equal( float(client_sent_msgs), float(sever_recv_msgs), 90_pct ));
-		TEST( Equal( float(server_sent_msgs), float(client_recv_msgs), 90_pct ));
+		TEST( stat.rawOutput > 0 );
+		TEST( stat.rawInput > 0 );
 	}
 }
 
@@ -202,6 +269,8 @@ namespace
 extern void UnitTest_TcpChannel ()
 {
 	TcpChannel_Test1();
+	TcpChannel_Test2();
+	TcpChannel_Test3();
 
 	TEST_PASSED();
 }
@@ -0,0 +1,206 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "UnitTest_Common.h"
+#include "res_pack/asset_packer/Packer/ImagePacker.h"
+
+#include "res_loaders/Intermediate/IntermImage.h"
+#include "res_loaders/AllImages/AllImageLoaders.h"
+#include "res_loaders/STB/STBImageSaver.h"
+
+using namespace AE::Graphics;
+
+namespace
+{
+	struct Signature
+	{
+		EImageFormat	format;
+		Array<ubyte>	header;
+	};
+
+	ND_ static Array<Signature>  GetSignatures ()
+	{
+		Array<Signature>	result;
+		result.push_back({ EImageFormat::DDS,			{ 'D', 'D', 'S', ' ', 0x7C, 0, 0, 0 }});
+		result.push_back({ EImageFormat::KTX,			{ 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' }});
+		result.push_back({ EImageFormat::KTX,			{ 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' }});
+		result.push_back({ EImageFormat::PNG,			{ 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n', 0, 0, 0, 0x0D }});
+		result.push_back({ EImageFormat::JPG,			{ 0xFF, 0xD8, 0xFF, 0xE0 }});
+		result.push_back({ EImageFormat::BMP,			{ 'B', 'M', 0x36, 0x10 }});
+		result.push_back({ EImageFormat::TIF,			{ 'I', 'I', '*', 0, 8, 0 }});
+		result.push_back({ EImageFormat::TIF,			{ 'M', 'M', 0, '*', 0, 8 }});
+		result.push_back({ EImageFormat::PSD,			{ '8', 'B', 'P', 'S', 0, 1 }});
+		result.push_back({ EImageFormat::RadianceHDR,	{ '#', '?', 'R', 'A', 'D', 'I', 'A', 'N', 'C', 'E', '\n' }});
+		result.push_back({ EImageFormat::RadianceHDR,	{ '#', '?', 'R', 'G', 'B', 'E', '\n' }});
+		result.push_back({ EImageFormat::OpenEXR,		{ 0x76, 0x2F, 0x31, 0x01, 2, 0 }});
+
+		Array<ubyte>	aeimg;
+		aeimg.resize( sizeof(uint) + 4 );
+		MemCopy( OUT aeimg.data(), &AssetPacker::ImagePacker::Magic, SizeOf<uint> );
+		result.push_back({ EImageFormat::AEImg, RVRef(aeimg) });
+
+		return result;
+	}
+
+
+	static void  DetectImageFileFormat_Test1 ()
+	{
+		const auto	signatures = GetSignatures();
+
+		for (auto& sig : signatures)
+		{
+			// full header
+			TEST_Eq( DetectImageFileFormat( ArrayView<ubyte>{ sig.header }), sig.format );
+
+			// stream position is restored
+			{
+				MemRefRStream	stream {ArrayView<ubyte>{ sig.header }};
+				TEST_Eq( DetectImageFileFormat( stream ), sig.format );
+				TEST_Eq( stream.Position(), 0_b );
+			}
+		}
+
+		// short headers, signature without last byte
+		const auto	ShortHeader = [] (std::initializer_list<ubyte> sig)
+		{{
+			Array<ubyte>	header {sig};
+			header.pop_back();
+
+			TEST_Eq( DetectImageFileFormat( ArrayView<ubyte>{ header }), EImageFormat::Unknown );
+
+			MemRefRStream	stream {ArrayView<ubyte>{ header }};
+			TEST_Eq( DetectImageFileFormat( stream ), EImageFormat::Unknown );
+			TEST_Eq( stream.Position(), 0_b );
+		}};
+		ShortHeader({ 'D', 'D', 'S', ' ' });
+		ShortHeader({ 0xAB, 'K', 'T', 'X', ' ' });
+		ShortHeader({ 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' });
+		ShortHeader({ 0xFF, 0xD8, 0xFF });
+		ShortHeader({ 'B', 'M' });
+		ShortHeader({ 'I', 'I', '*', 0 });
+		ShortHeader({ 'M', 'M', 0, '*' });
+		ShortHeader({ '8', 'B', 'P', 'S' });
+		ShortHeader({ '#', '?', 'R', 'A', 'D', 'I', 'A', 'N', 'C', 'E' });
+		ShortHeader({ '#', '?', 'R', 'G', 'B', 'E' });
+		ShortHeader({ 0x76, 0x2F, 0x31, 0x01 });
+		{
+			const uint		magic = AssetPacker::ImagePacker::Magic;
+			Array<ubyte>	header;
+			header.resize( sizeof(magic) - 1 );
+			MemCopy( OUT header.data(), &magic, Bytes{header.size()} );
+			TEST_Eq( DetectImageFileFormat( ArrayView<ubyte>{ header }), EImageFormat::Unknown );
+		}
+
+		// empty header
+		{
+			TEST_Eq( DetectImageFileFormat( ArrayView<ubyte>{} ), EImageFormat::Unknown );
+
+			MemRefRStream	stream {ArrayView<ubyte>{}};
+			TEST_Eq( DetectImageFileFormat( stream ), EImageFormat::Unknown );
+		}
+
+		// unknown signature, TGA and PCX have no signature
+		{
+			const ubyte		header[] = { 0, 0, 2, 0, 0, 0, 0, 0 };
+			TEST_Eq( DetectImageFileFormat( ArrayView<ubyte>{ header }), EImageFormat::Unknown );
+		}
+
+		// detection starts at current stream position
+		{
+			const auto&		png		= signatures[3].header;
+			Array<ubyte>	data	= { 1, 2, 3 };
+			data.insert( data.end(), png.begin(), png.end() );
+
+			MemRefRStream	stream {ArrayView<ubyte>{ data }};
+			TEST( stream.SeekFwd( 3_b ));
+			TEST_Eq( DetectImageFileFormat( stream ), EImageFormat::PNG );
+			TEST_Eq( stream.Position(), 3_b );
+		}
+	}
+
+
+#ifdef AE_ENABLE_STB
+	static void  LoadImages_Test1 ()
+	{
+		const Path		folder		{"images"};
+		const uint		img_count	= 8;
+		const uint3		dim			{16, 8, 1};
+
+		FileSystem::DeleteDirectory( folder );
+		FileSystem::CreateDirectories( folder );
+
+		Array<Array<ubyte>>	src_pixels;
+
+		// create images
+		for (uint i = 0; i < img_count; ++i)
+		{
+			IntermImage		img;
+			TEST( img.Allocate( EImage::_2D, EPixelFormat::RGBA8_UNorm, dim ));
+
+			auto*	level	= img.GetLevel( 0_mipmap, 0_layer );
+			auto*	pixels	= Cast<ubyte>( level->PixelData() );
+			auto&	dst		= src_pixels.emplace_back();
+
+			for (usize j = 0, cnt = usize(level->DataSize()); j < cnt; ++j) {
+				pixels[j] = ubyte(i * 31 + j);
+			}
+			dst.assign( pixels, pixels + usize(level->DataSize()) );
+
+			STBImageSaver	saver;
+			TEST( saver.SaveImage( folder / ("img_"s << ToString(i) << ".png"), img, EImageFormat::PNG ));
+		}
+
+		Array<IntermImage>		images;
+		Array<IntermImage*>		image_ptrs;
+
+		for (uint i = 0; i < img_count; ++i) {
+			images.emplace_back( Path{"img_"s << ToString(i) << ".png"} );
+		}
+		images.emplace_back( Path{"missing.png"} );
+
+		for (auto& img : images) {
+			image_ptrs.push_back( &img );
+		}
+		image_ptrs.push_back( null );
+
+		const Path					dirs[]	= { folder };
+		AllImageLoaders::BatchConfig	cfg;
+		cfg.directories		= dirs;
+		cfg.memoryBudget	= 1_b;		// each file is larger than budget, files are loaded one by one
+		cfg.threadCount		= 4;
+
+		AllImageLoaders		loader;
+		TEST_Eq( loader.LoadImages( image_ptrs, cfg ), img_count );
+
+		for (uint i = 0; i < img_count; ++i)
+		{
+			const auto&	img = images[i];
+			TEST( img.IsValid() );
+			TEST_Eq( img.PixelFormat(), EPixelFormat::RGBA8_UNorm );
+
+			auto*	level = img.GetLevel( 0_mipmap, 0_layer );
+			TEST( level != null );
+			TEST( All( level->dimension == dim ));
+
+			auto	pixels = level->Pixels();
+			TEST_Eq( pixels.size(), src_pixels[i].size() );
+			TEST( std::equal( pixels.begin(), pixels.end(), src_pixels[i].begin() ));
+		}
+
+		// missing file is left empty
+		TEST( images.back().IsEmpty() );
+
+		FileSystem::DeleteDirectory( folder );
+	}
+#endif
+}
+
+extern void UnitTest_ImageLoader ()
+{
+	DetectImageFileFormat_Test1();
+
+	#ifdef AE_ENABLE_STB
+	LoadImages_Test1();
+	#endif
+
+	TEST_PASSED();
+}
@@ -3,6 +3,7 @@
 #include "UnitTest_Common.h"
 
 extern void UnitTest_AEImage ();
+extern void UnitTest_ImageLoader ();
 
 
 #ifdef AE_PLATFORM_ANDROID
@@ -14,6 +15,7 @@ int main (const int argc, char* argv[])
 	BEGIN_TEST();
 
 	UnitTest_AEImage();
+	UnitTest_ImageLoader();
 
 	AE_LOGI( "Tests.ResourceLoaders finished" );
 	return 0;
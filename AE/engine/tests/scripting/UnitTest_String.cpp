@@ -133,6 +133,27 @@ namespace
 		TEST( Run< U8String() >( se, Cast<char>(script), "ASmain", OUT res ));
 		TEST_Eq( res, ref );
 	}
+
+  #ifdef AE_ENABLE_UTF8PROC
+	static void  ScriptString_Test9 (const ScriptEnginePtr &se)
+	{
+		const CharUtf8	script[] = u8R"#(
+			int ASmain (string invalid) {
+				int		res = 0;
+				res += (Utf8IsValid( "юникод" ) ? 1 : 0);
+				res += (Utf8Length( "юникод" ) == 6 ? 10 : 0);
+				res += (Utf8Length( "abc" ) == 3 ? 100 : 0);
+				res += (Utf8IsValid( invalid ) ? 0 : 1000);
+				return res;
+			}
+		)#";
+
+		String	arg = "ab\xFF\xFE" "cd";
+		int		res = 0;
+		TEST( Run< int(String) >( se, Cast<char>(script), "ASmain", OUT res, arg ));
+		TEST_Eq( res, 1111 );
+	}
+  #endif
 }
 
 
@@ -155,6 +176,10 @@ extern void UnitTest_String ()
 		ScriptString_Test7( se );
 		ScriptString_Test8( se );
 
+	  #ifdef AE_ENABLE_UTF8PROC
+		ScriptString_Test9( se );
+	  #endif
+
 		TEST_PASSED();
 	)
 }
@@ -286,6 +286,76 @@ namespace
 	}
 
 
+	static void  Serialization_Test5 ()
+	{
+		auto	stream = MakeRC<ArrayWStream>();
+
+		const Array<uint>		a1	{6,2,8,92,54,84,95,11,73};
+		const Array<ulong>		a2	{1,2,3};
+		const String			a3	= "wpoeiruthd";
+		const FixedString<32>	a4	= "kjnsvb";
+		const Array<String>		a5	{ "a", "bc", "" };
+		const ubyte				a6	= 0x7F;	// misalign next data
+
+		{
+			Serializer	ser{ stream };
+			ser.inPlaceLayout = true;
+			TEST( ser( a1, a6, ArrayView<ulong>{a2}, a6, StringView{a3}, a4, a5 ));
+		}
+
+		const auto	src = stream->GetData();
+
+		// with copy
+		{
+			Array<uint>			b1;
+			ubyte				b6;
+			Array<ulong>		b2;
+			String				b3;
+			FixedString<32>		b4;
+			Array<String>		b5;
+
+			Deserializer	des{ MakeRC<MemRefRStream>( src )};
+			des.inPlaceLayout = true;
+
+			TEST( des( b1, b6, b2, b6, b3, b4, b5 ));
+			TEST( des.IsEnd() );
+			TEST( a1 == b1 );
+			TEST( a2 == b2 );
+			TEST( a3 == b3 );
+			TEST( a4 == b4 );
+			TEST( a5 == b5 );
+		}
+
+		// in-place
+		{
+			ArrayView<uint>		b1;
+			ubyte				b6;
+			ArrayView<ulong>	b2;
+			StringView			b3;
+			FixedString<32>		b4;
+			Array<String>		b5;
+
+			Deserializer	des{ MakeRC<MemRefRStream>( src )};
+			des.inPlaceLayout	= true;
+			des.inPlaceViews	= true;
+
+			TEST( des( b1, b6, b2, b6, b3, b4, b5 ));
+			TEST( des.IsEnd() );
+			TEST( ArrayView<uint>{a1} == b1 );
+			TEST( ArrayView<ulong>{a2} == b2 );
+			TEST( a3 == b3 );
+			TEST( a4 == b4 );
+			TEST( a5 == b5 );
+
+			TEST( IsCompletelyInside( src.data(), src.data() + src.size(), Cast<ubyte>(b1.data()), Cast<ubyte>(b1.data() + b1.size()) ));
+			TEST( IsCompletelyInside( src.data(), src.data() + src.size(), Cast<ubyte>(b2.data()), Cast<ubyte>(b2.data() + b2.size()) ));
+			TEST( IsCompletelyInside( src.data(), src.data() + src.size(), Cast<ubyte>(b3.data()), Cast<ubyte>(b3.data() + b3.size()) ));
+			TEST( IsMultipleOf( b2.data(), AlignOf<ulong> ));
+			TEST( b3.data()[ b3.size() ] == '\0' );
+		}
+	}
+
+
 	static void  SerializationTraits ()
 	{
 		StaticAssert( IsTriviallySerializable< int >);
@@ -305,6 +375,7 @@ extern void UnitTest_Serialization ()
 	Serialization_Test2();
 	Serialization_Test3();
 	Serialization_Test4();
+	Serialization_Test5();
 
 	TEST_PASSED();
 }
@@ -0,0 +1,630 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+/*
+	Micro-benchmark harness for performance tests.
+
+	Each 'Benchmark' is a group of tests, results are printed when group is destroyed
+	and are collected in global report which is saved by 'BenchmarkReport::Finish()'.
+
+	Modes:
+		Run()		- warm-up and repetitions until 'minIterations' and 'minTime' are reached.
+		BeginIteration() / EndIteration()
+					- manual mode for tests which measure only part of iteration (multithreaded tests).
+
+	Statistics:
+		median, p99, MAD (median absolute deviation), min, mean, allocations per iteration.
+
+	Command line arguments (see 'BenchmarkReport::ParseArgs()'):
+		--bench-out <folder>		- save 'benchmark.json' and 'benchmark.csv' to the folder.
+		--bench-baseline <file>		- compare with CSV which is produced by previous run.
+		--bench-threshold <value>	- regression threshold for median, default is 0.05 (5%).
+		--bench-no-pin				- disable pinning to the fastest CPU core.
+
+	Regression:
+		median is greater than baseline by threshold and difference is greater than 3 * MAD.
+*/
+
+#pragma once
+
+#include "base/Algorithms/Parser.h"
+#include "base/Algorithms/StringUtils.h"
+#include "base/DataSource/File.h"
+#include "base/Platforms/Platform.h"
+#include "base/Utils/Threading.h"
+#include "UnitTest_Shared.h"
+
+
+//
+// Benchmark Report
+//
+
+struct BenchmarkReport
+{
+// types
+public:
+	using Clock_t		= std::chrono::high_resolution_clock;
+	using Duration_t	= nanoseconds;
+
+	struct Stats
+	{
+		Duration_t	median		{};
+		Duration_t	p99			{};
+		Duration_t	mad			{};		// median absolute deviation
+		Duration_t	min			{};
+		Duration_t	mean		{};
+		usize		iterations	= 0;
+		double		allocations	= 0.0;	// per iteration
+	};
+
+	struct Result
+	{
+		String		group;
+		String		name;
+		Stats		stats;
+		Duration_t	baseline	{};		// zero if not exists
+		bool		regression	= false;
+	};
+
+	struct Settings
+	{
+		Path		outFolder;
+		Path		baseline;
+		float		threshold	= 0.05f;
+		bool		pinThread	= true;
+	};
+
+
+// variables
+private:
+	Settings						_settings;
+	Array< Result >					_results;
+	HashMap< String, Duration_t >	_baseline;		// "group/name" -> median
+	bool							_baselineLoaded	= false;
+
+
+// methods
+public:
+	ND_ static BenchmarkReport&  Instance ()
+	{
+		static BenchmarkReport	inst;
+		return inst;
+	}
+
+		void  ParseArgs (int argc, char* argv[]);
+		void  SetSettings (const Settings &s)	{ _settings = s;  _baselineLoaded = false; }
+
+	ND_ Settings const&  GetSettings ()	const	{ return _settings; }
+
+		Result const&  Add (StringView group, StringView name, const Stats &stats);
+
+	// save results, returns 'false' if found regression
+	ND_ bool  Finish ();
+
+	ND_ static bool  PinToFastCore ();
+
+private:
+		void  _LoadBaseline ();
+		void  _SaveJSON (const Path &path) const;
+		void  _SaveCSV (const Path &path) const;
+
+	ND_ static String  _Key (StringView group, StringView name)		{ return String{group} << '/' << name; }
+};
+
+
+
+//
+// Benchmark
+//
+
+struct Benchmark
+{
+// types
+public:
+	using Clock_t		= BenchmarkReport::Clock_t;
+	using Duration_t	= BenchmarkReport::Duration_t;
+	using TimePoint_t	= Clock_t::time_point;
+	using Stats			= BenchmarkReport::Stats;
+	using AllocCountFn	= Function< ulong () >;
+
+	struct Config
+	{
+		uint		warmup			= 2;
+		uint		minIterations	= 10;
+		uint		maxIterations	= 1'000;
+		secondsf	minTime			{0.5f};		// only for 'Run()'
+		secondsf	maxTime			{10.f};		// only for 'Run()'
+
+		Config () {}
+	};
+
+private:
+	struct TestInfo
+	{
+		String				name;
+		Array< Duration_t >	iterations;
+		ulong				allocations		= 0;
+		TimePoint_t			lastStartPoint;
+		ulong				lastAllocCount	= 0;
+		bool				isEnded			= false;
+		Stats				stats;
+	};
+
+
+// variables
+private:
+	Array< TestInfo >	_tests;
+	const String		_groupName;
+	const Config		_config;
+	AllocCountFn		_allocCounter;
+
+
+// methods
+public:
+	explicit Benchmark (StringView name, const Config &cfg = Config{});
+	~Benchmark ();
+
+	// allocation counter which is sampled at begin and end of iteration, see 'Perf_AllocCounter.h'
+	void  SetAllocCounter (AllocCountFn fn)		{ _allocCounter = RVRef(fn); }
+
+	// automatic mode
+	template <typename Fn>
+	void  Run (StringView name, Fn &&fn);
+
+	// manual mode
+	void  BeginTest (StringView name);
+	void  EndTest ();
+
+	void  BeginIteration ();
+	void  EndIteration ();
+
+	ND_ static Stats  CalcStats (ArrayView<Duration_t> iterations, ulong allocations);
+};
+//-----------------------------------------------------------------------------
+
+
+
+/*
+=================================================
+	ParseArgs
+=================================================
+*/
+inline void  BenchmarkReport::ParseArgs (int argc, char* argv[])
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		const StringView	arg		= argv[i];
+		const bool			has_val	= (i+1 < argc);
+
+		if ( arg == "--bench-out" and has_val )
+			_settings.outFolder = Path{ argv[++i] };
+		else
+		if ( arg == "--bench-baseline" and has_val )
+			_settings.baseline = Path{ argv[++i] };
+		else
+		if ( arg == "--bench-threshold" and has_val )
+			_settings.threshold = StringToFloat( argv[++i] );
+		else
+		if ( arg == "--bench-no-pin" )
+			_settings.pinThread = false;
+	}
+	_baselineLoaded = false;
+}
+
+/*
+=================================================
+	Add
+=================================================
+*/
+inline BenchmarkReport::Result const&  BenchmarkReport::Add (StringView group, StringView name, const Stats &stats)
+{
+	_LoadBaseline();
+
+	auto&	res = _results.emplace_back();
+	res.group	= group;
+	res.name	= name;
+	res.stats	= stats;
+
+	auto	it = _baseline.find( _Key( group, name ));
+	if ( it != _baseline.end() )
+	{
+		const double	base	= double(it->second.count());
+		const double	diff	= double(stats.median.count()) - base;
+
+		res.baseline	= it->second;
+		res.regression	= (diff > base * _settings.threshold) and
+						  (diff > 3.0 * double(stats.mad.count()));
+	}
+	return res;
+}
+
+/*
+=================================================
+	Finish
+=================================================
+*/
+inline bool  BenchmarkReport::Finish ()
+{
+	if ( not _settings.outFolder.empty() )
+	{
+		FileSystem::CreateDirectories( _settings.outFolder );
+		_SaveJSON( _settings.outFolder / "benchmark.json" );
+		_SaveCSV( _settings.outFolder / "benchmark.csv" );
+	}
+
+	usize	regressions = 0;
+	for (auto& r : _results)
+	{
+		if ( r.regression )
+		{
+			++regressions;
+			AE_LOGE( "Regression in '"s << r.group << "/" << r.name << "': " << ToString(r.stats.median) <<
+					 ", baseline: " << ToString(r.baseline) );
+		}
+	}
+
+	_results.clear();
+	return regressions == 0;
+}
+
+/*
+=================================================
+	PinToFastCore
+=================================================
+*/
+inline bool  BenchmarkReport::PinToFastCore ()
+{
+	auto&	info	= CpuArchInfo::Get();
+	auto*	core	= info.GetCore( ECoreType::HighPerformance );
+
+	if ( core == null )		core = info.GetCore( ECoreType::Performance );
+	if ( core == null )		core = info.GetCore( ECoreType::EnergyEfficient );
+	if ( core == null )		return false;
+
+	const uint	core_id = BitScanForward( core->physicalBits.to_ullong() );
+
+	AE_LOGI( "bind to core: "s << ToString(core_id) );
+	return ThreadUtils::SetAffinity( core_id );
+}
+
+/*
+=================================================
+	_LoadBaseline
+----
+	CSV format: group,name,median_ns,p99_ns,mad_ns,min_ns,mean_ns,iterations,allocations
+=================================================
+*/
+inline void  BenchmarkReport::_LoadBaseline ()
+{
+	if ( _baselineLoaded )
+		return;
+
+	_baselineLoaded = true;
+	_baseline.clear();
+
+	if ( _settings.baseline.empty() )
+		return;
+
+	FileRStream		file {_settings.baseline};
+	String			content;
+
+	if ( not file.IsOpen() or not file.Read( file.RemainingSize(), OUT content ))
+	{
+		AE_LOGE( "Failed to load benchmark baseline from '"s << ToString(_settings.baseline) << "'" );
+		return;
+	}
+
+	Array<StringView>	lines;
+	Array<StringView>	tokens;
+	Parser::DivideLines( content, OUT lines );
+
+	for (usize i = 1; i < lines.size(); ++i)	// skip header
+	{
+		tokens.clear();
+		Parser::Tokenize( lines[i], ',', OUT tokens );
+
+		if ( tokens.size() >= 3 )
+			_baseline.emplace( _Key( tokens[0], tokens[1] ), Duration_t{ StringToUInt64( tokens[2] )});
+	}
+}
+
+/*
+=================================================
+	_SaveJSON
+=================================================
+*/
+inline void  BenchmarkReport::_SaveJSON (const Path &path) const
+{
+	const auto	Escape = [] (StringView src)
+	{{
+		String	dst;
+		for (char c : src)
+		{
+			if ( c == '"' or c == '\\' )
+				dst << '\\';
+			dst << c;
+		}
+		return dst;
+	}};
+
+	String	str = "{\n  \"results\": [";
+	for (usize i = 0; i < _results.size(); ++i)
+	{
+		auto&	r = _results[i];
+		str << (i ? "," : "") << "\n    {"
+			<< "\"group\": \"" << Escape( r.group ) << "\", "
+			<< "\"name\": \"" << Escape( r.name ) << "\", "
+			<< "\"median_ns\": " << ToString( r.stats.median.count() ) << ", "
+			<< "\"p99_ns\": " << ToString( r.stats.p99.count() ) << ", "
+			<< "\"mad_ns\": " << ToString( r.stats.mad.count() ) << ", "
+			<< "\"min_ns\": " << ToString( r.stats.min.count() ) << ", "
+			<< "\"mean_ns\": " << ToString( r.stats.mean.count() ) << ", "
+			<< "\"iterations\": " << ToString( r.stats.iterations ) << ", "
+			<< "\"allocations\": " << ToString( r.stats.allocations, 2 ) << ", "
+			<< "\"baseline_ns\": " << ToString( r.baseline.count() ) << ", "
+			<< "\"regression\": " << ToString( r.regression ) << "}";
+	}
+	str << "\n  ]\n}\n";
+
+	FileWStream		file {path};
+	CHECK_ERRV( file.IsOpen() );
+	CHECK( file.Write( StringView{str} ));
+}
+
+/*
+=================================================
+	_SaveCSV
+=================================================
+*/
+inline void  BenchmarkReport::_SaveCSV (const Path &path) const
+{
+	String	str = "group,name,median_ns,p99_ns,mad_ns,min_ns,mean_ns,iterations,allocations\n";
+	for (auto& r : _results)
+	{
+		str << r.group << ',' << r.name << ','
+			<< ToString( r.stats.median.count() ) << ','
+			<< ToString( r.stats.p99.count() ) << ','
+			<< ToString( r.stats.mad.count() ) << ','
+			<< ToString( r.stats.min.count() ) << ','
+			<< ToString( r.stats.mean.count() ) << ','
+			<< ToString( r.stats.iterations ) << ','
+			<< ToString( r.stats.allocations, 2 ) << '\n';
+	}
+
+	FileWStream		file {path};
+	CHECK_ERRV( file.IsOpen() );
+	CHECK( file.Write( StringView{str} ));
+}
+//-----------------------------------------------------------------------------
+
+
+
+/*
+=================================================
+	constructor
+=================================================
+*/
+inline Benchmark::Benchmark (StringView name, const Config &cfg) :
+	_groupName{name}, _config{cfg}
+{
+	// group and test names are used in CSV
+	ASSERT( not HasSubString( name, "," ));
+}
+
+/*
+=================================================
+	destructor
+=================================================
+*/
+inline Benchmark::~Benchmark ()
+{
+	if ( _tests.empty() )
+		return;
+
+	auto&	report = BenchmarkReport::Instance();
+
+	Array< TestInfo* >	sorted;
+	for (auto& t : _tests) {
+		sorted.push_back( &t );
+	}
+	std::sort( sorted.begin(), sorted.end(), [](auto* lhs, auto* rhs) { return lhs->stats.median < rhs->stats.median; });
+
+	const Duration_t	first	= sorted.front()->stats.median;
+	usize				max_len	= 0;
+
+	for (auto& t : _tests) {
+		max_len = Max( max_len, t.name.length() );
+	}
+
+	String	str;
+	str << '\n' << _groupName << ':';
+
+	for (auto* t : sorted)
+	{
+		const auto&		res		= report.Add( _groupName, t->name, t->stats );
+		const double	frac	= first.count() == 0 ? 0.0 : (double(t->stats.median.count() - first.count()) / double(first.count())) * 100.0;
+
+		str << "\n  " << t->name;
+		AppendToString( INOUT str, max_len - t->name.length() );
+		str << ": " << ToString( t->stats.median )
+			<< "  p99: " << ToString( t->stats.p99 )
+			<< "  MAD: " << ToString( t->stats.mad )
+			<< "  (" << ToString( t->stats.iterations ) << " iter)";
+
+		if ( t->stats.allocations > 0.0 )
+			str << "  alloc: " << ToString( t->stats.allocations, 1 );
+
+		if ( frac != 0.0 )
+			str << "  +" << ToString( frac, 1 ) << '%';
+
+		if ( res.baseline.count() > 0 )
+		{
+			str << "  baseline: " << ToString( res.baseline );
+			if ( res.regression )
+				str << "  REGRESSION";
+		}
+	}
+	AE_LOGI( str );
+}
+
+/*
+=================================================
+	CalcStats
+=================================================
+*/
+inline Benchmark::Stats  Benchmark::CalcStats (ArrayView<Duration_t> iterations, ulong allocations)
+{
+	Stats	res;
+	if ( iterations.empty() )
+		return res;
+
+	Array<Duration_t>	sorted	{ iterations.begin(), iterations.end() };
+	std::sort( sorted.begin(), sorted.end() );
+
+	const auto	Median = [] (ArrayView<Duration_t> arr)
+	{{
+		const usize	n = arr.size();
+		return (n & 1) ? arr[n/2] : (arr[n/2 - 1] + arr[n/2]) / 2;
+	}};
+
+	Duration_t	sum {};
+	for (auto dt : sorted) {
+		sum += dt;
+	}
+
+	res.iterations	= sorted.size();
+	res.min			= sorted.front();
+	res.mean		= sum / sorted.size();
+	res.median		= Median( sorted );
+	res.p99			= sorted[ Min( (sorted.size() * 99 + 99) / 100, sorted.size() ) - 1 ];		// nearest-rank
+	res.allocations	= double(allocations) / double(sorted.size());
+
+	for (auto& dt : sorted) {
+		dt = dt > res.median ? dt - res.median : res.median - dt;
+	}
+	std::sort( sorted.begin(), sorted.end() );
+	res.mad = Median( sorted );
+
+	return res;
+}
+
+/*
+=================================================
+	Run
+=================================================
+*/
+template <typename Fn>
+void  Benchmark::Run (StringView name, Fn &&fn)
+{
+	for (uint i = 0; i < _config.warmup; ++i) {
+		fn();
+	}
+
+	BeginTest( name );
+
+	const auto	start = Clock_t::now();
+	for (uint i = 0; i < _config.maxIterations; ++i)
+	{
+		BeginIteration();
+		fn();
+		EndIteration();
+
+		const auto	dt = Clock_t::now() - start;
+		if ( i+1 >= _config.minIterations and dt >= _config.minTime )
+			break;
+		if ( dt >= _config.maxTime )
+			break;
+	}
+
+	EndTest();
+}
+
+/*
+=================================================
+	BeginTest
+=================================================
+*/
+inline void  Benchmark::BeginTest (StringView name)
+{
+	ASSERT( _tests.empty() or _tests.back().isEnded );
+	ASSERT( not HasSubString( name, "," ));
+
+	_tests.emplace_back().name = name;
+
+	if ( BenchmarkReport::Instance().GetSettings().pinThread )
+	{
+		static const bool	pinned = BenchmarkReport::PinToFastCore();
+		Unused( pinned );
+	}
+}
+
+/*
+=================================================
+	EndTest
+=================================================
+*/
+inline void  Benchmark::EndTest ()
+{
+	CHECK_ERRV( not _tests.empty() );
+
+	auto&	test = _tests.back();
+	CHECK_ERRV( not test.isEnded );
+	test.isEnded = true;
+
+	CHECK_ERRV( not test.iterations.empty() );
+
+	test.stats = CalcStats( test.iterations, test.allocations );
+}
+
+/*
+=================================================
+	BeginIteration
+=================================================
+*/
+forceinline void  Benchmark::BeginIteration ()
+{
+	CHECK_ERRV( not _tests.empty() );
+
+	// don't reorder instructions
+	CompilerBarrier( EMemoryOrder::Acquire );
+
+	auto&	test = _tests.back();
+	CHECK_ERRV( not test.isEnded );
+
+	test.iterations.emplace_back();
+
+	if ( _allocCounter )
+		test.lastAllocCount = _allocCounter();
+
+	test.lastStartPoint = Clock_t::now();
+
+	// don't reorder instructions
+	CompilerBarrier( EMemoryOrder::Release );
+}
+
+/*
+=================================================
+	EndIteration
+=================================================
+*/
+forceinline void  Benchmark::EndIteration ()
+{
+	// don't reorder instructions
+	CompilerBarrier( EMemoryOrder::Acquire );
+
+	const TimePoint_t	end_time = Clock_t::now();
+
+	CHECK_ERRV( not _tests.empty() );
+
+	auto&	test = _tests.back();
+	CHECK_ERRV( not test.isEnded );
+
+	ASSERT( end_time >= test.lastStartPoint );
+	ASSERT( not test.iterations.empty() );
+
+	test.iterations.back() = TimeCast<Duration_t>( end_time - test.lastStartPoint );
+
+	if ( _allocCounter )
+		test.allocations += _allocCounter() - test.lastAllocCount;
+
+	// don't reorder instructions
+	CompilerBarrier( EMemoryOrder::Release );
+}
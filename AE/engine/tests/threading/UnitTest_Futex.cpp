@@ -0,0 +1,117 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "UnitTest_Common.h"
+
+namespace
+{
+	using Clock_t	= std::chrono::steady_clock;
+	using EStatus	= IAsyncTask::EStatus;
+
+
+	static void  Futex_Test1 ()
+	{
+		Futex	f;
+		TEST( f.Load() == 0 );
+
+		// value is not equal to expected - must not block
+		TEST( f.Wait( 1, c_MaxTimeout ));
+
+		// must return on timeout
+		f.Wait( 0, milliseconds{1} );
+
+		TEST( f.Increment() == 1 );
+		TEST( f.Load() == 1 );
+	}
+
+
+	static void  Futex_Test2 ()
+	{
+		constexpr uint	count	= 20;
+		Futex			f;
+		const auto		start	= Clock_t::now();
+
+		StdThread	thread{ [&f] ()
+		{
+			for (uint key = f.Load(); key < count; key = f.Load()) {
+				f.Wait( key, c_MaxTimeout );
+			}
+		}};
+
+		for (uint i = 0; i < count; ++i)
+		{
+			ThreadUtils::Sleep_500us();
+			f.Increment();
+			f.Wake();
+		}
+		thread.join();
+
+		// thread must be woken up, not resumed on timeout
+		TEST( Clock_t::now() - start < seconds{10} );
+	}
+
+
+#if AE_USE_THREAD_WAKEUP
+	class Wakeup_Task final : public IAsyncTask
+	{
+	public:
+		Atomic<uint>&	counter;
+
+		Wakeup_Task (Atomic<uint> &c) __NE___ : IAsyncTask{ ETaskQueue::PerFrame }, counter{c} {}
+
+		void  Run () __Th_OV
+		{
+			counter.fetch_add( 1 );
+		}
+
+		StringView  DbgName () C_NE_OV { return "Wakeup_Task"; }
+	};
+
+	static void  ThreadWakeup_Test1 ()
+	{
+		LocalTaskScheduler	scheduler {WorkerQueueCount(1)};
+
+		scheduler->AddThread( ThreadMngr::CreateThread( ThreadMngr::ThreadConfig{} ));
+		scheduler->AddThread( ThreadMngr::CreateThread( ThreadMngr::ThreadConfig{} ));
+
+		constexpr uint	count		= 10;
+		Atomic<uint>	counter		{0};
+		nanoseconds		total_time	{0};
+
+		for (uint i = 0; i < count; ++i)
+		{
+			// let worker threads park
+			ThreadUtils::MilliSleep( milliseconds{20} );
+
+			const auto	start	= Clock_t::now();
+			AsyncTask	task	= scheduler->Run<Wakeup_Task>( Tuple{ArgRef(counter)} );
+
+			TEST( scheduler->Wait( {task}, c_MaxTimeout ));
+			TEST( task->Status() == EStatus::Completed );
+
+			total_time += Clock_t::now() - start;
+		}
+		TEST( counter.load() == count );
+
+		// parked threads are resumed after 100ms if wakeup is lost
+		TEST( total_time < milliseconds{50} * count );
+
+		const auto	stat0 = scheduler->GetThreadWakeup()->GetStat( 0 );
+		const auto	stat1 = scheduler->GetThreadWakeup()->GetStat( 1 );
+		TEST( stat0.wakeupLatency.count() > 0 or stat1.wakeupLatency.count() > 0 );
+		TEST( stat0.idleSpinning <= 100 and stat1.idleSpinning <= 100 );
+	}
+#endif
+}
+
+
+extern void UnitTest_Futex ()
+{
+	Futex_Test1();
+	Futex_Test2();
+
+  #if AE_USE_THREAD_WAKEUP
+	ThreadWakeup_Test1();
+  #endif
+
+	TEST_PASSED();
+}
@@ -88,6 +88,100 @@ namespace
 
 		pool.Release( False{} );
 	}
+
+
+	static void  LfIndexedPool_Test3 ()
+	{
+		// generational handles, same as in graphics 'ResourceManager'
+		struct Slot
+		{
+			Atomic<uint>	generation	{0};
+			Atomic<uint>	owner		{0};
+		};
+		struct Handle
+		{
+			uint	index		= UMax;
+			uint	generation	= 0;
+		};
+
+		constexpr uint	num_threads	= 4;
+		constexpr uint	num_iter	= 1'000;
+		constexpr uint	max_alive	= 100;
+
+		LfIndexedPool< Slot, uint, 256, 8 >		pool;
+		Atomic<uint>							errors	{0};
+		Array<StdThread>						threads;
+
+		// single thread: released index is reused with new generation
+		{
+			const uint	idx0 = pool.Assign();
+			const uint	gen0 = pool[idx0].generation.load();
+
+			pool[idx0].generation.fetch_add( 1 );
+			TEST( pool.Unassign( idx0 ));
+
+			const uint	idx1 = pool.Assign();
+			TEST_Eq( idx0, idx1 );
+			TEST( pool[idx1].generation.load() != gen0 );	// old handle is invalid
+
+			TEST( pool.Unassign( idx1 ));
+		}
+
+		// multiple threads: indices are exclusively owned until released
+		for (uint t = 0; t < num_threads; ++t)
+		{
+			threads.push_back( StdThread{ [&pool, &errors, t] ()
+				{
+					Array<Handle>	alive;
+					alive.reserve( max_alive );
+
+					for (uint i = 0; i < num_iter; ++i)
+					{
+						for (uint j = 0; j < max_alive; ++j)
+						{
+							Handle	h;
+							if ( not pool.Assign( OUT h.index ))
+							{
+								errors.fetch_add( 1 );
+								continue;
+							}
+
+							auto&	slot = pool[ h.index ];
+							h.generation = slot.generation.load();
+
+							if ( slot.owner.exchange( t+1 ) != 0 )
+								errors.fetch_add( 1 );
+
+							alive.push_back( h );
+						}
+
+						for (auto& h : alive)
+						{
+							auto&	slot = pool[ h.index ];
+
+							if ( slot.generation.load() != h.generation )	errors.fetch_add( 1 );
+							if ( slot.owner.exchange( 0 ) != t+1 )			errors.fetch_add( 1 );
+
+							slot.generation.fetch_add( 1 );
+
+							if ( not pool.Unassign( h.index ))
+								errors.fetch_add( 1 );
+						}
+						alive.clear();
+					}
+				}});
+		}
+
+		for (auto& t : threads) {
+			t.join();
+		}
+
+		TEST_Eq( errors.load(), 0u );
+
+		for (uint i = 0; i < pool.capacity(); ++i) {
+			TEST( not pool.IsAssigned( i ));
+		}
+	}
 }
 
 
@@ -95,6 +189,7 @@ extern void UnitTest_LfIndexedPool ()
 {
 	LfIndexedPool_Test1();
 	LfIndexedPool_Test2();
+	LfIndexedPool_Test3();
 
 	TEST_PASSED();
 }
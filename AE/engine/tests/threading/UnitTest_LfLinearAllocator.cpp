@@ -5,6 +5,7 @@
 #ifndef AE_DISABLE_THREADS
 namespace
 {
+	template <typename AllocType>
 	static void  LfLinearAllocator_Test1 ()
 	{
 		static constexpr uint	MaxThreads	= 4;
@@ -12,7 +13,7 @@ namespace
 
 		StaticArray< StdThread, MaxThreads >	worker_thread;
 		StaticArray< Array<void*>, MaxThreads >	thread_data;
-		LfLinearAllocator< usize{2_Mb} >		alloc;
+		AllocType								alloc;
 
 		for (uint i = 0; i < MaxThreads; ++i)
 		{
@@ -51,12 +52,41 @@ namespace
 			}
 		}
 	}
+
+
+	// more allocators than slots in thread cache, regions must not be evicted by each other
+	static void  LfLinearAllocator_Test2 ()
+	{
+		using Alloc_t = LfLinearAllocator< usize{64_Kb}, 16, 2, UntypedAllocator, usize{4_Kb} >;
+
+		static constexpr uint	AllocCount	= 64;
+		static constexpr uint	ElemSize	= 16;
+		static constexpr uint	ElemCount	= 96_Kb / ElemSize;
+
+		StaticArray< Unique<Alloc_t>, AllocCount >	allocs;
+		for (auto& a : allocs) {
+			a.reset( new Alloc_t{} );
+		}
+
+		for (uint i = 0; i < ElemCount; ++i)
+		{
+			for (auto& a : allocs) {
+				TEST( a->Allocate( SizeAndAlign{ Bytes{ElemSize}, 16_b }) != null );
+			}
+		}
+
+		for (auto& a : allocs) {
+			TEST( a->CurrentSize() <= Bytes{ElemCount * ElemSize} + Alloc_t::ThreadRegionSize() );
+		}
+	}
 }
 
 
 extern void UnitTest_LfLinearAllocator ()
 {
-	LfLinearAllocator_Test1();
+	LfLinearAllocator_Test1< LfLinearAllocator< usize{2_Mb} >>();
+	LfLinearAllocator_Test1< LfLinearAllocator< usize{2_Mb}, AE_CACHE_LINE, 16, UntypedAllocator, usize{64_Kb} >>();	// with thread regions
+	LfLinearAllocator_Test2();
 
 	TEST_PASSED();
 }
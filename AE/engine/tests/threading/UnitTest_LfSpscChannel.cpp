@@ -0,0 +1,141 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+// [Multithreading test](https://github.com/azhirnov/as-en/blob/dev/AE/engine/tools/lfas/Tests/Test_LfSpscChannel.cpp)
+// [Performance test](https://github.com/azhirnov/as-en/blob/dev/AE/engine/performance/threading/Perf_LfQueue.cpp)
+
+#include "UnitTest_Common.h"
+
+namespace
+{
+	static void  LfSpscChannel_Test1 ()
+	{
+		using T = DebugInstanceCounter< uint, 1 >;
+
+		T::ClearStatistic();
+		{
+			LfSpscChannel< T, 32 >		channel;
+
+			for (uint i = 0; i < 40; ++i)
+			{
+				if ( i < 32 )
+					TEST( channel.Push( T(i) ))
+				else
+					TEST( not channel.Push( T(i) ));
+			}
+			TEST_Eq( channel.Size(), 32 );
+
+			for (uint i = 0; i < 32; ++i)
+			{
+				T	val;
+				TEST( channel.Pop( OUT val ));
+				TEST_Eq( val.value, i );
+			}
+
+			T	val;
+			TEST( not channel.Pop( OUT val ));
+			TEST( channel.Empty() );
+		}
+		TEST( T::CheckStatistic() );
+	}
+
+
+	static void  LfSpscChannel_Test2 ()
+	{
+		using T = DebugInstanceCounter< uint, 2 >;
+
+		T::ClearStatistic();
+		{
+			LfSpscChannel< T, 64 >		channel;
+			Array<T>					src;
+			StaticArray< T, 24 >		dst;
+
+			for (uint i = 0; i < 50; ++i) {
+				src.push_back( T(i) );
+			}
+
+			// batch with wrap around
+			uint	expected = 0;
+			for (uint j = 0; j < 10; ++j)
+			{
+				TEST_Eq( channel.PushBatch( src ), 50 );
+
+				for (usize n = 0; n < 50;)
+				{
+					usize	cnt = channel.PopBatch( OUT dst.data(), dst.size() );
+					TEST( cnt > 0 );
+
+					for (usize i = 0; i < cnt; ++i, ++expected) {
+						TEST_Eq( dst[i].value, expected % 50 );
+					}
+					n += cnt;
+				}
+			}
+
+			// partial push
+			TEST_Eq( channel.PushBatch( src ), 50 );
+			TEST_Eq( channel.PushBatch( src ), 14 );
+
+			// destroy remaining elements
+			channel.Release();
+		}
+		TEST( T::CheckStatistic() );
+	}
+
+
+	static void  LfSpscChannel_Test3 ()
+	{
+		constexpr uint	count	= 1'000'000;
+
+		LfSpscChannel< uint, 256 >	channel;
+		ulong						sum		= 0;
+
+		StdThread	producer{ [&channel] ()
+			{
+				StaticArray< uint, 16 >		batch;
+				for (uint i = 0; i < count;)
+				{
+					const uint	n = Min( uint(batch.size()), count - i );
+					for (uint j = 0; j < n; ++j) {
+						batch[j] = i + j;
+					}
+
+					for (usize pushed = 0; pushed < n;)
+					{
+						pushed += channel.PushBatch( ArrayView<uint>{ batch.data() + pushed, n - pushed });
+						ThreadUtils::Pause();
+					}
+					i += n;
+				}
+			}};
+
+		StaticArray< uint, 32 >		batch;
+		uint						expected = 0;
+
+		for (; expected < count;)
+		{
+			usize	n = channel.PopBatch( OUT batch.data(), batch.size() );
+			for (usize i = 0; i < n; ++i, ++expected)
+			{
+				TEST_Eq( batch[i], expected );
+				sum += batch[i];
+			}
+			if ( n == 0 )
+				ThreadUtils::Pause();
+		}
+
+		producer.join();
+
+		TEST_Eq( sum, ulong(count) * (count - 1) / 2 );
+		TEST( channel.Empty() );
+	}
+}
+
+
+extern void UnitTest_LfSpscChannel ()
+{
+	LfSpscChannel_Test1();
+	LfSpscChannel_Test2();
+	LfSpscChannel_Test3();
+
+	TEST_PASSED();
+}
@@ -0,0 +1,140 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+// [Multithreading test](https://github.com/azhirnov/as-en/blob/dev/AE/engine/tools/lfas/Tests/Test_LfStaticQueue.cpp)
+// [Performance test](https://github.com/azhirnov/as-en/blob/dev/AE/engine/performance/threading/Perf_LfQueue.cpp)
+
+#include "UnitTest_Common.h"
+
+namespace
+{
+	static void  LfStaticQueue_Test1 ()
+	{
+		using T = DebugInstanceCounter< uint, 1 >;
+
+		T::ClearStatistic();
+		{
+			LfStaticQueue< T, 32 >		queue;
+
+			TEST( queue.Empty() );
+
+			for (uint i = 0; i < 20; ++i) {
+				TEST( queue.Push( T(i) ));
+			}
+			TEST_Eq( queue.Size(), 20 );
+
+			// FIFO order
+			for (uint i = 0; i < 20; ++i)
+			{
+				T	val;
+				TEST( queue.Pop( OUT val ));
+				TEST_Eq( val.value, i );
+			}
+
+			for (uint i = 0; i < 10; ++i)
+			{
+				T	val;
+				TEST( not queue.Pop( OUT val ));
+			}
+			TEST( queue.Empty() );
+		}
+		TEST( T::CheckStatistic() );
+	}
+
+
+	static void  LfStaticQueue_Test2 ()
+	{
+		using T = DebugInstanceCounter< uint, 2 >;
+
+		T::ClearStatistic();
+		{
+			LfStaticQueue< T, 64 >		queue;
+
+			// overflow
+			for (uint i = 0; i < 80; ++i)
+			{
+				if ( i < 64 )
+					TEST( queue.Push( T(i) ))
+				else
+					TEST( not queue.Push( T(i) ));
+			}
+
+			// wrap around
+			for (uint j = 0; j < 10; ++j)
+			{
+				for (uint i = 0; i < 40; ++i)
+				{
+					T	val;
+					TEST( queue.Pop( OUT val ));
+				}
+				for (uint i = 0; i < 40; ++i) {
+					TEST( queue.Push( T(i) ));
+				}
+				TEST( not queue.Push( T(0) ));
+			}
+
+			// destroy remaining elements
+			queue.Release();
+		}
+		TEST( T::CheckStatistic() );
+	}
+
+
+	static void  LfStaticQueue_Test3 ()
+	{
+		constexpr uint	num_threads	= 4;
+		constexpr uint	count		= 100'000;
+
+		LfStaticQueue< uint, 1024 >		queue;
+		Atomic<ulong>					sum		{0};
+		Atomic<uint>					popped	{0};
+		Array<StdThread>				threads;
+
+		for (uint t = 0; t < num_threads; ++t)
+		{
+			// producer
+			threads.push_back( StdThread{ [&queue, t] ()
+				{
+					for (uint i = t; i < count; i += num_threads)
+					{
+						for (; not queue.Push( i );) {
+							ThreadUtils::Pause();
+						}
+					}
+				}});
+
+			// consumer
+			threads.push_back( StdThread{ [&queue, &sum, &popped] ()
+				{
+					for (; popped.load() < count;)
+					{
+						uint	val;
+						if ( queue.Pop( OUT val ))
+						{
+							sum.fetch_add( val );
+							popped.fetch_add( 1 );
+						}
+						else
+							ThreadUtils::Pause();
+					}
+				}});
+		}
+
+		for (auto& t : threads) {
+			t.join();
+		}
+
+		TEST_Eq( popped.load(), count );
+		TEST_Eq( sum.load(), ulong(count) * (count - 1) / 2 );
+		TEST( queue.Empty() );
+	}
+}
+
+
+extern void UnitTest_LfStaticQueue ()
+{
+	LfStaticQueue_Test1();
+	LfStaticQueue_Test2();
+	LfStaticQueue_Test3();
+
+	TEST_PASSED();
+}
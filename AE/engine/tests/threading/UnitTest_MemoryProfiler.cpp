@@ -0,0 +1,173 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "UnitTest_Common.h"
+
+#if AE_ENABLE_MEMORY_PROFILER
+namespace
+{
+	class TestMemoryProfiler final : public IMemoryProfiler
+	{
+	public:
+		struct Info
+		{
+			String		name;
+			EAllocator	type		= Default;
+			slong		live		= 0;
+			uint		allocs		= 0;
+			uint		deallocs	= 0;
+			uint		discards	= 0;
+			bool		unregistered= false;
+		};
+		Mutex								guard;
+		FlatHashMap< const void*, Info >	infos;
+
+		void  RegisterAllocator (const void* alloc, EAllocator type, StringView name) __NE_OV
+		{
+			EXLOCK( guard );
+			auto&	info = infos[ alloc ];
+			info.name	= String{name};
+			info.type	= type;
+		}
+
+		void  UnregisterAllocator (const void* alloc) __NE_OV
+		{
+			EXLOCK( guard );
+			infos[ alloc ].unregistered = true;
+		}
+
+		void  OnAllocate (const void* alloc, EAllocator type, const void* ptr, Bytes size) __NE_OV
+		{
+			EXLOCK( guard );
+			auto&	info = infos[ alloc ];
+			info.type	= type;
+			info.live	+= slong(size);
+			++info.allocs;
+			TEST( ptr != null );
+		}
+
+		void  OnDeallocate (const void* alloc, const void* ptr, Bytes size) __NE_OV
+		{
+			EXLOCK( guard );
+			auto&	info = infos[ alloc ];
+			info.live	-= slong(size);
+			++info.deallocs;
+			TEST( ptr != null );
+		}
+
+		void  OnDiscard (const void* alloc) __NE_OV
+		{
+			EXLOCK( guard );
+			auto&	info = infos[ alloc ];
+			info.live	= 0;
+			++info.discards;
+		}
+	};
+
+
+	static void  MemoryProfiler_Test1 ()
+	{
+		auto	prof = MakeRC<TestMemoryProfiler>();
+		MemoryManager().SetProfiler( prof );
+
+		TEST( MemoryProfilerApi::IsEnabled() );
+		TEST( MemoryManager().GetProfiler() == prof );
+
+		// global allocators are registered in 'SetProfiler()'
+		TEST( prof->infos.size() >= 3 );
+		{
+			bool	found = false;
+			for (auto& [key, info] : prof->infos) {
+				found |= (info.name == "GraphicsFrame" and info.type == IMemoryProfiler::EAllocator::Frame);
+			}
+			TEST( found );
+		}
+
+		// linear allocator
+		const void*		lin_ptr = null;
+		{
+			LfLinearAllocator< usize{4_Kb} >	alloc;
+			lin_ptr = &alloc;
+
+			TEST( alloc.Allocate( SizeAndAlign{ 100_b, 8_b }) != null );
+			TEST( alloc.Allocate( SizeAndAlign{ 200_b, 8_b }) != null );
+
+			auto&	info = prof->infos[ lin_ptr ];
+			TEST( info.type == IMemoryProfiler::EAllocator::Linear );
+			TEST_Eq( info.allocs, 2u );
+			TEST_Eq( info.live, 300 );
+
+			alloc.Discard();
+			TEST_Eq( info.live, 0 );
+			TEST_Eq( info.discards, 1u );
+		}
+		TEST( prof->infos[ lin_ptr ].unregistered );
+
+		// fixed block allocator
+		const void*		fb_ptr = null;
+		{
+			LfFixedBlockAllocator< 64*64, 16 >	alloc{ 1_Kb, 8_b };
+			fb_ptr = &alloc;
+
+			void*	p0 = alloc.AllocBlock();
+			void*	p1 = alloc.AllocBlock();
+			TEST( p0 != null and p1 != null );
+
+			auto&	info = prof->infos[ fb_ptr ];
+			TEST( info.type == IMemoryProfiler::EAllocator::FixedBlock );
+			TEST_Eq( info.live, 2*1024 );
+
+			TEST( alloc.DeallocBlock( p0 ));
+			TEST( alloc.DeallocBlock( p1 ));
+			TEST_Eq( info.live, 0 );
+			TEST_Eq( info.deallocs, 2u );
+		}
+		TEST( prof->infos[ fb_ptr ].unregistered );
+
+		// profiled allocator
+		const void*		gen_ptr = null;
+		{
+			ProfiledAllocator		alloc{ AE::GetDefaultAllocator(), "Test" };
+			gen_ptr = &alloc;
+
+			void*	p0 = alloc.Allocate( SizeAndAlign{ 64_b, 8_b });
+			TEST( p0 != null );
+
+			auto&	info = prof->infos[ gen_ptr ];
+			TEST( info.name == "Test" );
+			TEST( info.type == IMemoryProfiler::EAllocator::General );
+			TEST_Eq( info.live, 64 );
+
+			alloc.Deallocate( p0, SizeAndAlign{ 64_b, 8_b });
+			TEST_Eq( info.live, 0 );
+		}
+		TEST( prof->infos[ gen_ptr ].unregistered );
+
+		MemoryManager().SetProfiler( null );
+		TEST( not MemoryProfilerApi::IsEnabled() );
+
+		// events are not reported without profiler
+		{
+			const usize	count = prof->infos.size();
+
+			LfLinearAllocator< usize{4_Kb} >	alloc;
+			TEST( alloc.Allocate( SizeAndAlign{ 100_b, 8_b }) != null );
+
+			TEST_Eq( prof->infos.size(), count );
+		}
+	}
+}
+
+
+extern void UnitTest_MemoryProfiler ()
+{
+	MemoryProfiler_Test1();
+
+	TEST_PASSED();
+}
+
+#else
+
+extern void UnitTest_MemoryProfiler ()
+{}
+
+#endif
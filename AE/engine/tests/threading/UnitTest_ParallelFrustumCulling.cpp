@@ -0,0 +1,113 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "UnitTest_Common.h"
+#include "base/Math/Camera.h"
+#include "base/Math/Random.h"
+
+namespace
+{
+	using FC	= FrustumCulling;
+	using PFC	= ParallelFrustumCulling;
+
+
+	static void  ParallelParts_Test1 ()
+	{
+		LocalTaskScheduler	scheduler {WorkerQueueCount(2)};
+		scheduler->AddThread( ThreadMngr::CreateThread( ThreadMngr::ThreadConfig{} ));
+
+		const usize						count	= 1000;
+		StaticArray< Atomic<uint>, 1000 >	counter;
+		for (auto& c : counter) { c.store( 0 ); }
+
+		// each element must be processed exactly once
+		const usize	num_parts = ParallelParts::Run( count, 64, ETaskQueue::PerFrame,
+								[&counter] (usize, usize first, usize cnt) __NE___
+								{
+									for (usize i = first; i < first + cnt; ++i)
+										counter[i].fetch_add( 1 );
+								});
+		TEST_Eq( num_parts, DivCeil( count, usize{64} ));
+
+		for (auto& c : counter) {
+			TEST( c.load() == 1 );
+		}
+
+		// empty range
+		TEST( ParallelParts::Run( 0, 64, ETaskQueue::PerFrame, [] (usize, usize, usize) __NE___ {}) == 0 );
+	}
+
+
+	static void  ParallelFrustumCulling_Test1 ()
+	{
+		LocalTaskScheduler	scheduler {WorkerQueueCount(2)};
+		scheduler->AddThread( ThreadMngr::CreateThread( ThreadMngr::ThreadConfig{} ));
+		scheduler->AddThread( ThreadMngr::CreateThread( ThreadMngr::ThreadConfig{} ));
+
+		TCamera<float>	camera;
+		FC::Frustum_t	frustum;
+		Random			rnd;
+
+		camera.SetPerspective( 60.0_deg, 1.5f, float2{0.1f, 100.0f} ).Move( float3{ 10.0f, 0.0f, -5.0f });
+		frustum.Setup( camera );
+
+		const usize		count = 10'003;		// not a multiple of batch size
+		Array<float>	min_x (count), min_y (count), min_z (count), max_x (count), max_y (count), max_z (count), radius (count);
+		Array<float4x4>	transforms (count);
+		Array<uint>		visible (count);
+		Array<uint>		ref_visible (count);
+
+		for (usize i = 0; i < count; ++i)
+		{
+			const float3	c = rnd.Uniform( float3{-120.f}, float3{120.f} );
+			const float3	e = rnd.Uniform( float3{0.1f}, float3{10.f} );
+			min_x[i] = c.x - e.x;	max_x[i] = c.x + e.x;
+			min_y[i] = c.y - e.y;	max_y[i] = c.y + e.y;
+			min_z[i] = c.z - e.z;	max_z[i] = c.z + e.z;
+			radius[i] = e.x;
+			transforms[i] = float4x4::Translated( rnd.Uniform( float3{-10.f}, float3{10.f} )) * float4x4::RotateY( Rad{rnd.Uniform( 0.f, 6.f )} );
+		}
+		const FC::AABBs		boxes	{ min_x.data(), min_y.data(), min_z.data(), max_x.data(), max_y.data(), max_z.data(), count };
+		const FC::Spheres	spheres	{ min_x.data(), min_y.data(), min_z.data(), radius.data(), count };
+
+		// result must be the same as in single threaded version for any number of parts
+		for (usize min_per_task : {usize{100}, usize{1000}, usize{3000}, usize{count}, usize{count*2}})
+		{
+			// AABB
+			{
+				const usize	ref_num	= FC::CullAABBs( frustum, boxes, OUT ref_visible.data() );
+				const usize	num		= PFC::CullAABBs( frustum, boxes, null, OUT visible.data(), ETaskQueue::PerFrame, min_per_task );
+
+				TEST( ref_num > 0 and ref_num < count );
+				TEST_Eq( num, ref_num );
+				TEST( ArrayView<uint>{ visible.data(), num } == ArrayView<uint>{ ref_visible.data(), ref_num });
+			}
+
+			// transformed AABB
+			{
+				const usize	ref_num	= FC::CullAABBs( frustum, boxes, transforms.data(), 0, count, OUT ref_visible.data() );
+				const usize	num		= PFC::CullAABBs( frustum, boxes, transforms.data(), OUT visible.data(), ETaskQueue::PerFrame, min_per_task );
+
+				TEST_Eq( num, ref_num );
+				TEST( ArrayView<uint>{ visible.data(), num } == ArrayView<uint>{ ref_visible.data(), ref_num });
+			}
+
+			// spheres
+			{
+				const usize	ref_num	= FC::CullSpheres( frustum, spheres, OUT ref_visible.data() );
+				const usize	num		= PFC::CullSpheres( frustum, spheres, OUT visible.data(), ETaskQueue::PerFrame, min_per_task );
+
+				TEST_Eq( num, ref_num );
+				TEST( ArrayView<uint>{ visible.data(), num } == ArrayView<uint>{ ref_visible.data(), ref_num });
+			}
+		}
+	}
+}
+
+
+extern void UnitTest_ParallelFrustumCulling ()
+{
+	ParallelParts_Test1();
+	ParallelFrustumCulling_Test1();
+
+	TEST_PASSED();
+}
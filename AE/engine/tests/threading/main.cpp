@@ -5,20 +5,25 @@
 extern void UnitTest_AsyncMutex ();
 extern void UnitTest_Barrier ();
 extern void UnitTest_Coroutine ();
+extern void UnitTest_Futex ();
 extern void UnitTest_Promise ();
 extern void UnitTest_Semaphore ();
 extern void UnitTest_TaskDeps ();
 extern void UnitTest_TaskUsage ();
+extern void UnitTest_ParallelFrustumCulling ();
 
 extern void UnitTest_LfChunkList ();
 extern void UnitTest_LfIndexedPool ();
+extern void UnitTest_LfSpscChannel ();
 extern void UnitTest_LfStaticPool ();
 extern void UnitTest_LfStaticIndexedPool ();
+extern void UnitTest_LfStaticQueue ();
 extern void UnitTest_LfTaskQueue ();
 
 extern void UnitTest_LfFixedBlockAllocator3 ();
 extern void UnitTest_LfLinearAllocator ();
 extern void UnitTest_LfStaticBlockAllocator ();
+extern void UnitTest_MemoryProfiler ();
 
 extern void UnitTest_SpinLock ();
 extern void UnitTest_Synchronized ();
@@ -41,24 +46,29 @@ int main (const int argc, char* argv[])
 
 	UnitTest_LfChunkList();
 	UnitTest_LfIndexedPool();
+	UnitTest_LfSpscChannel();
 	UnitTest_LfStaticPool();
 	UnitTest_LfStaticIndexedPool();
+	UnitTest_LfStaticQueue();
 	UnitTest_LfTaskQueue();
 
 	UnitTest_LfFixedBlockAllocator3();
 	UnitTest_LfLinearAllocator();
 	UnitTest_LfStaticBlockAllocator();
+	UnitTest_MemoryProfiler();
 
 	UnitTest_SpinLock();
 	UnitTest_Synchronized();
 	UnitTest_Barrier();
 	UnitTest_Semaphore();
+	UnitTest_Futex();
 
 	UnitTest_TaskDeps();
 	UnitTest_TaskUsage();
 	UnitTest_AsyncMutex ();
 	UnitTest_Promise();
 	UnitTest_Coroutine();
+	UnitTest_ParallelFrustumCulling();
 
 	AE_LOGI( "Tests.Threading finished" );
 	return 0;
@@ -116,6 +116,80 @@ namespace
 			}
 		}
 	}
+
+
+#ifdef AE_ENABLE_ZSTD
+	static void  Archive_Test2 ()
+	{
+		const Path	arch1	{"archive1.bin"};
+		const Path	arch2	{"archive2.bin"};
+		const uint	count	= 200;
+
+		Array<Array<ubyte>>		files;
+		Array<ArrayView<ubyte>>	samples;
+		{
+			Math::Random	rnd;
+			for (uint i = 0; i < count; ++i)
+			{
+				String	str;
+				for (uint j = 0, cnt = rnd.Uniform( 10u, 20u ); j < cnt; ++j)
+				{
+					str << "[material_" << ToString( rnd.Uniform( 0u, 50u )) << "]\n"
+						<< "shader = \"shaders/lit_" << ToString( rnd.Uniform( 0u, 4u )) << ".glsl\"\n"
+						<< "albedo = \"textures/albedo_" << ToString( rnd.Uniform( 0u, 1000u )) << ".ktx\"\n"
+						<< "roughness = " << ToString( rnd.Uniform( 0.f, 1.f )) << "\n\n";
+				}
+				files.emplace_back( str.begin(), str.end() );
+			}
+			for (auto& f : files) {
+				samples.push_back( f );
+			}
+		}
+
+		auto	dict = ZStdDictionary::Train( samples, 4_Kb );
+		TEST( dict and dict->ID() != 0 );
+
+		const auto	GetName = [] (uint i) { return FileName::WithString_t{ "file_"s << ToString(i) }; };
+
+		// create archive with dictionary
+		{
+			ArchivePacker	packer;
+			TEST( packer.Create( "temp/archive1.tmp" ));
+			TEST( packer.SetZStdDictionary( dict ));
+
+			for (uint i = 0; i < count; ++i)
+			{
+				MemRefRStream	stream {ArrayView<ubyte>{ files[i] }};
+				TEST( packer.Add( GetName(i), stream, (i & 1 ? EFileType::ZStd : EFileType::ZStdInMemory) ));
+			}
+			TEST( packer.Store( arch1 ));
+		}
+
+		// copy archive
+		{
+			ArchivePacker	packer;
+			TEST( packer.Create( "temp/archive2.tmp" ));
+			TEST( packer.AddArchive( arch1 ));
+			TEST( packer.Store( arch2 ));
+		}
+
+		// read archives
+		for (auto& arch : {arch1, arch2})
+		{
+			auto	storage	= VirtualFileStorageFactory::CreateStaticArchive( arch );
+			TEST( storage );
+
+			for (uint i = 0; i < count; ++i)
+			{
+				RC<RStream>		stream;
+				TEST( storage->Open( OUT stream, GetName(i) ));
+
+				MemRefRStream	ref {ArrayView<ubyte>{ files[i] }};
+				TEST( CompareFiles( ref, *stream, ArraySizeOf(files[i]) ));
+			}
+		}
+	}
+#endif
 }
 
 extern void UnitTest_ArchiveStorage (const Path &curr)
@@ -128,6 +202,10 @@ extern void UnitTest_ArchiveStorage (const Path &curr)
 
 	Archive_Test1();
 
+	#ifdef AE_ENABLE_ZSTD
+	Archive_Test2();
+	#endif
+
 	FileSystem::SetCurrentPath( curr );
 	FileSystem::DeleteDirectory( folder );
 
@@ -218,6 +218,57 @@ namespace
 			TEST( ok );
 		}
 
+		AE_LOGI( "sequential read from server" );
+		{
+			auto	file = vfs_client.OpenForRead( FileName{a1_name} );
+			TEST( file );
+
+			const Bytes		chunk	= 16_Kb;
+			const Bytes		total	= 1_Mb;
+			const ulong		count	= ulong(total / chunk);
+
+			// second pass should use cached blocks
+			for (uint pass = 0; pass < 2; ++pass)
+			{
+				if ( pass == 1 )
+				{
+					// wait for read-ahead requests
+					for (uint i = 0; i < 1000 and vfs_client.GetCacheStatistic().prefetchInFlight > 0; ++i) {
+						ThreadUtils::MilliSleep( milliseconds{10} );
+					}
+					TEST_Eq( vfs_client.GetCacheStatistic().prefetchInFlight, 0 );
+				}
+
+				const auto	stat = vfs_client.GetCacheStatistic();
+
+				for (Bytes pos; pos < total; pos += chunk)
+				{
+					auto	req  = file->ReadBlock( pos, chunk );
+					TEST( req );
+
+					auto	task = AsyncTask{req->AsPromise().Then(
+									[&a1_data, pos, chunk] (const AsyncRDataSource::Result_t &res)
+									{
+										TEST( res.pos == pos );
+										TEST( res.dataSize == chunk );
+										TEST( MemEqual( res.data, a1_data.data() + pos, chunk ));
+									})};
+
+					TEST( Scheduler().Wait( {task}, c_MaxTimeout ));
+					TEST( req->IsCompleted() );
+				}
+
+				const auto	stat2 = vfs_client.GetCacheStatistic();
+				TEST_Eq( stat2.hits + stat2.misses, stat.hits + stat.misses + count );
+
+				if ( pass == 1 )
+				{
+					TEST_Eq( stat2.hits, stat.hits + count );
+					TEST_Eq( stat2.misses, stat.misses );
+				}
+			}
+		}
+
 		AE_LOGI( "write to server" );
 		{
 			auto	file = vfs_client.OpenForWrite( FileName{a2_name} );
@@ -0,0 +1,297 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "UnitTest_Common.h"
+
+namespace
+{
+
+	//
+	// Memory Dynamic Storage
+	//
+	class MemDynamicStorage final : public IVirtualFileStorage
+	{
+	private:
+		using FileMap_t = FlatHashMap< FileName::Optimized_t, String >;
+
+		mutable Mutex		_guard;
+		FileMap_t			_files;
+
+	public:
+		mutable Atomic<uint>	openCount	{0};
+
+
+	public:
+		void  Add (FileName::Ref name, StringView data)
+		{
+			EXLOCK( _guard );
+			_files.insert_or_assign( FileName::Optimized_t{name}, String{data} );
+		}
+
+		void  Remove (FileName::Ref name)
+		{
+			EXLOCK( _guard );
+			_files.erase( FileName::Optimized_t{name} );
+		}
+
+		bool  Open (OUT RC<RStream> &stream, FileName::Ref name)							C_NE_OV	{ return _Open< ArrayRStream >( OUT stream, name ); }
+		bool  Open (OUT RC<RDataSource> &ds, FileName::Ref name)							C_NE_OV	{ return _Open< ArrayRDataSource >( OUT ds, name ); }
+		bool  Open (OUT RC<AsyncRDataSource> &, FileName::Ref)								C_NE_OV	{ return false; }
+
+		bool  Exists (FileName::Ref name)													C_NE_OV
+		{
+			EXLOCK( _guard );
+			return _files.contains( FileName::Optimized_t{name} );
+		}
+
+		bool  Exists (FileGroupName::Ref)													C_NE_OV	{ return false; }
+
+		void  _Append (INOUT GlobalFileMap_t &)												C_Th_OV	{}	// dynamic storage
+
+		bool  _OpenByIter (OUT RC<RStream> &, FileName::Ref, const void*)					C_NE_OV	{ return false; }
+		bool  _OpenByIter (OUT RC<RDataSource> &, FileName::Ref, const void*)				C_NE_OV	{ return false; }
+		bool  _OpenByIter (OUT RC<AsyncRDataSource> &, FileName::Ref, const void*)			C_NE_OV	{ return false; }
+
+	private:
+		template <typename ImplType, typename ResultType>
+		bool  _Open (OUT ResultType &result, FileName::Ref name) C_NE___
+		{
+			openCount.fetch_add( 1 );
+
+			EXLOCK( _guard );
+			auto	iter = _files.find( FileName::Optimized_t{name} );
+			if ( iter == _files.end() )
+				return false;
+
+			result = MakeRC<ImplType>( Array<ubyte>{ iter->second.begin(), iter->second.end() });
+			return true;
+		}
+	};
+
+
+	ND_ static String  ReadAll (RStream &stream)
+	{
+		String	str;
+		TEST( stream.Read( stream.Size(), OUT str ));
+		return str;
+	}
+
+	ND_ static String  ReadAll (RDataSource &ds)
+	{
+		String	str;
+		TEST( ds.Read( 0_b, ds.Size(), OUT str ));
+		return str;
+	}
+//---------------------------------------------------------
+
+
+	static void  LookupCache_Test1 ()
+	{
+		LocalVFS	vfs;
+		auto		st1		= MakeRC<MemDynamicStorage>();
+		auto		st2		= MakeRC<MemDynamicStorage>();
+
+		const FileName::WithString_t	name_a {"a"};
+		const FileName::WithString_t	name_b {"b"};
+		const FileName::WithString_t	name_c {"c"};
+
+		st1->Add( name_a, "a1" );
+		st2->Add( name_b, "b2" );
+
+		TEST( GetVFS().AddStorage( StorageName{"st1"}, st1 ));
+		TEST( GetVFS().AddStorage( StorageName{"st2"}, st2 ));
+		TEST( GetVFS().MakeImmutable() );
+
+		const auto	Reset		= [&] () {{ st1->openCount.store( 0 );  st2->openCount.store( 0 ); }};
+		const auto	OpenCount	= [&] () {{ return st1->openCount.load() + st2->openCount.load(); }};
+
+		// miss then hit
+		{
+			Reset();
+			auto	stream = GetVFS().Open<RStream>( name_b );
+			TEST( stream );
+			TEST( ReadAll( *stream ) == "b2" );
+			TEST( OpenCount() >= 1 );
+
+			Reset();
+			stream = GetVFS().Open<RStream>( name_b );
+			TEST( stream );
+			TEST( ReadAll( *stream ) == "b2" );
+			TEST_Eq( st1->openCount.load(), 0 );
+			TEST_Eq( st2->openCount.load(), 1 );		// cached storage only
+		}
+
+		// negative result is not cached
+		{
+			Reset();
+			TEST( not GetVFS().Open<RStream>( name_c ));
+			TEST_Eq( OpenCount(), 2 );
+
+			Reset();
+			TEST( not GetVFS().Open<RStream>( name_c ));
+			TEST_Eq( OpenCount(), 2 );
+			TEST( not GetVFS().Exists( name_c ));
+
+			// file added outside of VFS is found without 'ResetLookupCache()'
+			st1->Add( name_c, "c1" );
+			TEST( GetVFS().Exists( name_c ));
+
+			auto	ds = GetVFS().Open<RDataSource>( name_c );
+			TEST( ds );
+			TEST( ReadAll( *ds ) == "c1" );
+		}
+
+		// file is moved to another storage
+		{
+			st2->Remove( name_b );
+			st1->Add( name_b, "b1" );
+
+			auto	stream = GetVFS().Open<RStream>( name_b );
+			TEST( stream );
+			TEST( ReadAll( *stream ) == "b1" );
+
+			Reset();
+			stream = GetVFS().Open<RStream>( name_b );
+			TEST( stream );
+			TEST_Eq( st1->openCount.load(), 1 );
+			TEST_Eq( st2->openCount.load(), 0 );
+		}
+
+		// file is removed
+		{
+			st1->Remove( name_b );
+			TEST( not GetVFS().Exists( name_b ));
+			TEST( not GetVFS().Open<RStream>( name_b ));
+
+			st2->Add( name_b, "b2" );
+			TEST( GetVFS().Exists( name_b ));
+
+			auto	stream = GetVFS().Open<RStream>( name_b );
+			TEST( stream );
+			TEST( ReadAll( *stream ) == "b2" );
+		}
+
+		// reset
+		{
+			st1->Add( name_b, "b1" );
+			GetVFS().ResetLookupCache();
+
+			auto	stream = GetVFS().Open<RStream>( name_b );
+			TEST( stream );
+
+			const String	str = ReadAll( *stream );
+			TEST( str == "b1" or str == "b2" );		// depends on storage order
+		}
+	}
+
+
+	static void  OpenBatch_Test1 ()
+	{
+		LocalVFS	vfs;
+		auto		dyn_st		= MakeRC<MemDynamicStorage>();
+		const uint	num_static	= 20;
+		const uint	count		= 700;	// more than 2 chunks
+
+		const auto	StaticName	= [] (uint i) {{ return "static_"s << ToString( i % num_static ); }};
+		const auto	DynamicName	= [] (uint i) {{ return "dynamic_"s << ToString( i ); }};
+		const auto	MissingName	= [] (uint i) {{ return "missing_"s << ToString( i ); }};
+
+		FileSystem::CreateDirectories( "static" );
+		for (uint i = 0; i < num_static; ++i)
+		{
+			FileWStream	file {Path{"static"} / StaticName( i )};
+			TEST( file.IsOpen() );
+			TEST( file.Write( StringView{StaticName( i )} ));
+		}
+
+		Array<FileName>		names;
+		Array<String>		expected;
+		usize				expected_count = 0;
+
+		for (uint i = 0; i < count; ++i)
+		{
+			String	name;
+			switch ( i % 3 )
+			{
+				case 0 :	name = StaticName( i );		expected.push_back( name );		break;
+				case 1 :	name = DynamicName( i );	expected.push_back( name );		dyn_st->Add( FileName{name}, name );	break;
+				case 2 :	name = MissingName( i );	expected.push_back( Default );	break;
+			}
+			expected_count += usize(not expected.back().empty());
+			names.push_back( FileName{name} );
+		}
+
+		TEST( GetVFS().AddStorage( VirtualFileStorageFactory::CreateStaticFolder( "static" )));
+		TEST( GetVFS().AddStorage( dyn_st ));
+		TEST( GetVFS().MakeImmutable() );
+
+		// streams
+		{
+			Array<RC<RStream>>	result;
+			TEST_Eq( GetVFS().OpenBatch( names, OUT result ), expected_count );
+			TEST_Eq( result.size(), names.size() );
+
+			for (usize i = 0; i < result.size(); ++i)
+			{
+				if ( expected[i].empty() ) {
+					TEST( not result[i] );
+				}else{
+					TEST( result[i] );
+					TEST( ReadAll( *result[i] ) == expected[i] );
+				}
+			}
+		}
+
+		// data sources, result is cleared
+		{
+			Array<RC<RDataSource>>	result;
+			result.resize( 5 );
+
+			TEST_Eq( GetVFS().OpenBatch( names, OUT result ), expected_count );
+			TEST_Eq( result.size(), names.size() );
+
+			for (usize i = 0; i < result.size(); ++i)
+			{
+				if ( expected[i].empty() ) {
+					TEST( not result[i] );
+				}else{
+					TEST( result[i] );
+					TEST( ReadAll( *result[i] ) == expected[i] );
+				}
+			}
+		}
+
+		// empty batch
+		{
+			Array<RC<RStream>>	result;
+			result.resize( 2 );
+			TEST_Eq( GetVFS().OpenBatch( ArrayView<FileName>{}, OUT result ), 0 );
+			TEST( result.empty() );
+		}
+
+		// missing file is added later
+		{
+			dyn_st->Add( names[2], "added" );
+
+			Array<RC<RStream>>	result;
+			TEST_Eq( GetVFS().OpenBatch( ArrayView<FileName>{ names.data(), 3 }, OUT result ), 3 );
+			TEST( result[2] and ReadAll( *result[2] ) == "added" );
+		}
+	}
+}
+
+extern void UnitTest_VirtualFileSystem (const Path &curr)
+{
+	const Path	folder	= curr / "vfs_test3";
+
+	FileSystem::DeleteDirectory( folder );
+	FileSystem::CreateDirectories( folder );
+	TEST( FileSystem::SetCurrentPath( folder ));
+
+	LookupCache_Test1();
+	OpenBatch_Test1();
+
+	FileSystem::SetCurrentPath( curr );
+	FileSystem::DeleteDirectory( folder );
+
+	TEST_PASSED();
+}
@@ -4,6 +4,7 @@
 
 extern void UnitTest_ArchiveStorage (const Path &curr);
 extern void UnitTest_NetworkStorage (const Path &curr);
+extern void UnitTest_VirtualFileSystem (const Path &curr);
 
 
 #ifdef AE_PLATFORM_ANDROID
@@ -16,6 +17,7 @@ int main (const int argc, char* argv[])
 
 	UnitTest_ArchiveStorage( curr );
 	UnitTest_NetworkStorage( curr );
+	UnitTest_VirtualFileSystem( curr );
 
 	AE_LOGI( "Tests.VFS finished" );
 	return 0;
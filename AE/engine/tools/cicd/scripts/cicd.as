@@ -30,6 +30,8 @@ bool  StartsWith (const string &, const string &);
 bool  StartsWithIC (const string &, const string &);
 bool  EndsWith (const string &, const string &);
 bool  EndsWithIC (const string &, const string &);
+bool  Utf8IsValid (const string &);
+uint  Utf8Length (const string &);
 void  LogError (const string & msg);
 void  LogInfo (const string & msg);
 void  LogDebug (const string & msg);
@@ -375,6 +375,7 @@ namespace
 		RenderTechPipelinesPtr		LoadRenderTech (PipelinePackID packId, RenderTechName::Ref name, PipelineCacheID cache)	__NE_OV	{ return _rm->LoadRenderTech( packId, name, cache ); }
 
 		StagingBufferStat			GetStagingBufferFrameStat (FrameUID frameId)						C_NE_OV	{ return _rm->GetStagingBufferFrameStat( frameId ); }
+		ResourcePoolStat			GetResourcePoolStat ()												C_NE_OV	{ return _rm->GetResourcePoolStat(); }
 		FeatureSet const&			GetFeatureSet ()													C_NE_OV	{ return _rm->GetFeatureSet(); }
 
 		GfxMemAllocatorPtr			CreateLinearGfxMemAllocator (Bytes pageSize)						C_NE_OV	{ return _rm->CreateLinearGfxMemAllocator( pageSize ); }
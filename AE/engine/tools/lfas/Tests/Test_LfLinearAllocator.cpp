@@ -8,35 +8,113 @@ namespace
 {
 	using AE::Threading::LfLinearAllocator;
 
-	enum class EAction
+	struct Allocation
 	{
-		Allocate,
-		Deallocate,
-		Read,
-		Write,
+		ubyte*	ptr		= null;
+		usize	size	= 0;
+		ubyte	value	= 0;
 	};
 
 
+	template <typename AllocType>
 	static void  LfLinearAllocator_Test1 ()
 	{
-		using T = DebugInstanceCounter< int, 1 >;
-
 		VirtualMachine::CreateInstance();
-		T::ClearStatistic();
 		{
+			struct PerThread
+			{
+				Array<Allocation>	allocs;
+				ubyte				value	= 0;
+				bool				stop	= false;
+			};
+
+			struct
+			{
+				AllocType									alloc;
+
+				std::mutex									guard;
+				HashMap< std::thread::id, PerThread >		perThread;
+				ubyte										threadCount	= 0;
+
+			}	global;
+
 			auto&	vm = VirtualMachine::Instance();
-			vm.ThreadFenceAcquireRelease();
+			vm.ThreadFenceRelease();
+
+			auto	sc1 = vm.CreateScript( [g = &global, &vm] ()
+			{
+				PerThread*	pt = null;
+				{
+					EXLOCK( g->guard );
+					auto [it, inserted] = g->perThread.emplace( std::this_thread::get_id(), PerThread{} );
+					pt = &it->second;
+					if ( inserted )
+						pt->value = ++g->threadCount;
+				}
+
+				if ( pt->stop )
+					return;
+
+				const usize	size	= 1 + (pt->allocs.size() * 7) % 200;
+				const usize	align	= usize{1} << (pt->allocs.size() % 5);
+
+				ubyte*	ptr = Cast<ubyte>( g->alloc.Allocate( SizeAndAlign{ Bytes{size}, Bytes{align} }));
+				if ( ptr == null )
+				{
+					pt->stop = true;
+					return;
+				}
+
+				TEST( (usize(ptr) & (align-1)) == 0 );
+				std::memset( ptr, pt->value, size );
+
+				pt->allocs.push_back( Allocation{ ptr, size, pt->value });
+				vm.CheckForUncommittedChanges();
+			});
+
+			// 'Discard()' must invalidate thread regions, so repeat a few times
+			for (uint i = 0; i < 3; ++i)
+			{
+				vm.RunParallel({ sc1 }, secondsf{5.0f} );
+				vm.ThreadFenceAcquire();
+
+				Array<Allocation>	all;
+				for (auto& [id, pt] : global.perThread) {
+					all.insert( all.end(), pt.allocs.begin(), pt.allocs.end() );
+				}
+				TEST( not all.empty() );
+
+				std::sort( all.begin(), all.end(), [](auto& lhs, auto& rhs) { return lhs.ptr < rhs.ptr; });
+
+				for (usize j = 0; j < all.size(); ++j)
+				{
+					const auto&	a = all[j];
+
+					// allocations must not overlap
+					if ( j+1 < all.size() )
+						TEST( a.ptr + a.size <= all[j+1].ptr );
+
+					for (usize k = 0; k < a.size; ++k) {
+						TEST( a.ptr[k] == a.value );
+					}
+				}
+
+				global.perThread.clear();
+				global.alloc.Discard();
+				vm.ThreadFenceRelease();
+			}
 
+			global.alloc.Release();
 		}
 		VirtualMachine::DestroyInstance();
-		TEST( T::CheckStatistic() );
 	}
 }
 
 
 extern void Test_LfLinearAllocator ()
 {
-	LfLinearAllocator_Test1();
+	LfLinearAllocator_Test1< LfLinearAllocator< usize{64_Kb}, 8, 8 >>();
+	LfLinearAllocator_Test1< LfLinearAllocator< usize{64_Kb}, 8, 8, UntypedAllocator, usize{4_Kb} >>();
 
 	TEST_PASSED();
 }
@@ -0,0 +1,109 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "UnitTest_Common.h"
+
+#include "threading/Containers/LfSpscChannel.h"
+#include "threading/Primitives/SpinLock.h"
+
+namespace
+{
+	using AE::Threading::LfSpscChannel;
+	using AE::Threading::SpinLock;
+
+
+	void LfSpscChannel_Test1 ()
+	{
+		using T = DebugInstanceCounter< int, 1 >;
+		using TS = Storage<T>;
+
+		VirtualMachine::CreateInstance();
+		T::ClearStatistic();
+
+		{
+			struct
+			{
+				LfSpscChannel< Storage<T>, 64 >		channel;
+
+				// only one thread can be producer or consumer at a time,
+				// lock is used to transfer ownership between threads
+				SpinLock							producer;
+				SpinLock							consumer;
+
+				int									pushCounter	= 0;	// protected by 'producer'
+				int									popCounter	= 0;	// protected by 'consumer'
+
+			}	global;
+
+			auto&	vm = VirtualMachine::Instance();
+			vm.ThreadFenceRelease();
+
+			auto	sc1 = vm.CreateScript( "producer", [g = &global, &vm] ()
+			{
+				if ( not g->producer.try_lock() )
+					return;
+
+				StaticArray< TS, 8 >	batch;
+				for (usize i = 0; i < batch.size(); ++i) {
+					batch[i].Write( T{g->pushCounter + int(i)} );
+				}
+
+				usize	pushed = g->channel.PushBatch( batch );
+
+				for (; pushed < batch.size(); ++pushed)
+				{
+					if ( not g->channel.Push( TS{T{g->pushCounter + int(pushed)}} ))
+						break;
+				}
+				g->pushCounter += int(pushed);
+
+				vm.CheckForUncommittedChanges();
+				g->producer.unlock();
+			});
+
+			auto	sc2 = vm.CreateScript( "consumer", [g = &global, &vm] ()
+			{
+				if ( not g->consumer.try_lock() )
+					return;
+
+				StaticArray< TS, 8 >	batch;
+				const usize				count = g->channel.PopBatch( OUT batch.data(), batch.size() );
+
+				for (usize i = 0; i < count; ++i)
+				{
+					// FIFO order
+					CHECK( batch[i].Read().value == g->popCounter );
+					++g->popCounter;
+				}
+
+				TS	val;
+				if ( g->channel.Pop( OUT val ))
+				{
+					CHECK( val.Read().value == g->popCounter );
+					++g->popCounter;
+				}
+
+				vm.CheckForUncommittedChanges();
+				g->consumer.unlock();
+			});
+
+			vm.RunParallel({ sc1, sc2 }, secondsf{30.0f} );
+
+
+			// destroy all
+			vm.ThreadFenceAcquire();
+
+			global.channel.Release();
+		}
+
+		VirtualMachine::DestroyInstance();
+		TEST( T::CheckStatistic() );
+	}
+}
+
+
+extern void Test_LfSpscChannel ()
+{
+	LfSpscChannel_Test1();
+
+	TEST_PASSED();
+}
@@ -0,0 +1,109 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "UnitTest_Common.h"
+
+#include "threading/Containers/LfStaticQueue.h"
+
+namespace
+{
+	using AE::Threading::LfStaticQueue;
+
+	enum class EAction
+	{
+		Push,
+		Pop,
+	};
+
+
+	void LfStaticQueue_Test1 ()
+	{
+		using T = DebugInstanceCounter< int, 1 >;
+		using TS = Storage<T>;
+
+		VirtualMachine::CreateInstance();
+		T::ClearStatistic();
+
+		{
+			struct PerThread
+			{
+				EAction		act		= EAction::Push;
+				usize		count	= 32;
+			};
+
+			struct
+			{
+				LfStaticQueue< Storage<T>, 256 >			queue;
+
+				std::mutex									guard;
+				HashMap< std::thread::id, PerThread >		perThread;
+
+			}	global;
+
+			auto&	vm = VirtualMachine::Instance();
+			vm.ThreadFenceRelease();
+
+			auto	sc1 = vm.CreateScript( [g = &global, &vm] ()
+			{
+				PerThread*	pt = null;
+				{
+					EXLOCK( g->guard );
+					pt = &g->perThread[ std::this_thread::get_id() ];
+				}
+
+				switch_enum( pt->act )
+				{
+					case EAction::Push :
+					{
+						for (usize i = 0; i < pt->count; ++i)
+						{
+							if ( not g->queue.Push( TS{T{int(i)}} ))
+								break;
+						}
+						vm.CheckForUncommittedChanges();
+
+						pt->act = EAction::Pop;
+						break;
+					}
+
+					case EAction::Pop :
+					{
+						for (usize i = 0; i < pt->count; ++i)
+						{
+							TS	val;
+							if ( g->queue.Pop( OUT val ))
+							{
+								Unused( val.Read() );
+							}
+						}
+						vm.CheckForUncommittedChanges();
+
+						pt->act = EAction::Push;
+						break;
+					}
+				}
+				switch_end
+				std::atomic_thread_fence( std::memory_order_release );
+			});
+
+			vm.RunParallel({ sc1 }, secondsf{30.0f} );
+
+
+			// destroy all
+			vm.ThreadFenceAcquire();
+
+			global.perThread.clear();
+			global.queue.Release();
+		}
+
+		VirtualMachine::DestroyInstance();
+		TEST( T::CheckStatistic() );
+	}
+}
+
+
+extern void Test_LfStaticQueue ()
+{
+	LfStaticQueue_Test1();
+
+	TEST_PASSED();
+}
@@ -7,6 +7,8 @@ extern void Test_SpinLock ();
 extern void Test_LfIndexedPool2 ();
 extern void Test_LfIndexedPool3 ();
 extern void Test_LfStaticPool ();
+extern void Test_LfStaticQueue ();
+extern void Test_LfSpscChannel ();
 extern void Test_LfLinearAllocator ();
 
 
@@ -23,11 +25,12 @@ int main ()
 	Test_LfIndexedPool2();
 	Test_LfIndexedPool3();
 	Test_LfStaticPool();
+	Test_LfStaticQueue();
+	Test_LfSpscChannel();
 	Test_LfLinearAllocator();
 
 	// TODO:
 	//	LfFixedBlockAllocator
-	//	LfStaticQueue
 	//	LfStaticIndexedPool
 
 	return 0;
@@ -6,38 +6,59 @@
 #include "res_loaders/DDS/DDSImageLoader.h"
 #include "res_loaders/KTX/KTXImageLoader.h"
 #include "res_loaders/AE/AEImageLoader.h"
+#include "res_loaders/Intermediate/IntermImage.h"
 
 namespace AE::ResLoader
 {
+namespace
+{
+	static constexpr Bytes	MaxCachedBufferSize	= 256_Mb;
 
 /*
 =================================================
-	LoadImage
+	TryLoad
+----
+	loader may read part of the stream before fail,
+	so rewind stream before each attempt
 =================================================
 */
-	bool  AllImageLoaders::LoadImage (INOUT IntermImage &image, RStream &stream, Bool flipY, RC<IAllocator> allocator, EImageFormat fileFormat) __NE___
+	template <typename LoaderType>
+	ND_ static bool  TryLoad (INOUT IntermImage &image, RStream &stream, const Bytes startPos, Bool flipY, const RC<IAllocator> &allocator, EImageFormat fileFormat) __NE___
+	{
+		if_unlikely( stream.Position() != startPos and not stream.SeekSet( startPos ))
+			return false;
+
+		LoaderType	loader;
+		return loader.LoadImage( image, stream, flipY, allocator, fileFormat );
+	}
+
+/*
+=================================================
+	LoadWithFallback
+----
+	used when format is not detected by signature
+=================================================
+*/
+	ND_ static bool  LoadWithFallback (INOUT IntermImage &image, RStream &stream, const Bytes startPos, Bool flipY, const RC<IAllocator> &allocator, EImageFormat fileFormat) __NE___
 	{
 		// multithreaded
 		if ( fileFormat == Default or fileFormat == EImageFormat::DDS )
 		{
-			DDSImageLoader	loader;
-			if ( loader.LoadImage( image, stream, flipY, allocator, fileFormat ))
+			if ( TryLoad< DDSImageLoader >( image, stream, startPos, flipY, allocator, fileFormat ))
 				return true;
 		}
 
 		// multithreaded
 		if ( fileFormat == Default or fileFormat == EImageFormat::AEImg )
 		{
-			AEImageLoader	loader;
-			if ( loader.LoadImage( image, stream, flipY, allocator, fileFormat ))
+			if ( TryLoad< AEImageLoader >( image, stream, startPos, flipY, allocator, fileFormat ))
 				return true;
 		}
 
 		// multithreaded
 		#ifdef AE_ENABLE_STB
 		{
-			STBImageLoader	loader;
-			if ( loader.LoadImage( image, stream, flipY, allocator, fileFormat ))
+			if ( TryLoad< STBImageLoader >( image, stream, startPos, flipY, allocator, fileFormat ))
 				return true;
 		}
 		#endif
@@ -46,8 +67,7 @@ namespace AE::ResLoader
 		#ifdef AE_ENABLE_KTX
 		if ( fileFormat == Default or fileFormat == EImageFormat::KTX )
 		{
-			KTXImageLoader	loader;
-			if ( loader.LoadImage( image, stream, flipY, allocator, fileFormat ))
+			if ( TryLoad< KTXImageLoader >( image, stream, startPos, flipY, allocator, fileFormat ))
 				return true;
 		}
 		#endif
@@ -55,14 +75,188 @@ namespace AE::ResLoader
 		// DevIL is single threaded set low priority
 		#ifdef AE_ENABLE_DEVIL
 		{
-			DevILLoader		loader;
-			if ( loader.LoadImage( image, stream, flipY, allocator, fileFormat ))
+			if ( TryLoad< DevILLoader >( image, stream, startPos, flipY, allocator, fileFormat ))
 				return true;
 		}
 		#endif
 
 		return false;
 	}
+}
+
+/*
+=================================================
+	LoadImage
+----
+	format detected by signature has priority over file extension,
+	only one loader is used for detected format, except STB which has DevIL as fallback.
+=================================================
+*/
+	bool  AllImageLoaders::LoadImage (INOUT IntermImage &image, RStream &stream, Bool flipY, RC<IAllocator> allocator, EImageFormat fileFormat) __NE___
+	{
+		const Bytes			start_pos	= stream.Position();
+		const EImageFormat	detected	= DetectImageFileFormat( stream );
+
+		switch_enum( detected )
+		{
+			case EImageFormat::DDS :
+				return TryLoad< DDSImageLoader >( image, stream, start_pos, flipY, allocator, detected );
+
+			case EImageFormat::AEImg :
+				return TryLoad< AEImageLoader >( image, stream, start_pos, flipY, allocator, detected );
+
+			case EImageFormat::KTX :
+				#ifdef AE_ENABLE_KTX
+				return TryLoad< KTXImageLoader >( image, stream, start_pos, flipY, allocator, detected );
+				#else
+				return false;
+				#endif
+
+			case EImageFormat::BMP :
+			case EImageFormat::JPG :
+			case EImageFormat::PNG :
+			case EImageFormat::PSD :
+			case EImageFormat::RadianceHDR :
+				#ifdef AE_ENABLE_STB
+				if ( TryLoad< STBImageLoader >( image, stream, start_pos, flipY, allocator, detected ))
+					return true;
+				#endif
+				#ifdef AE_ENABLE_DEVIL
+				return TryLoad< DevILLoader >( image, stream, start_pos, flipY, allocator, detected );
+				#else
+				return false;
+				#endif
+
+			case EImageFormat::TIF :
+			case EImageFormat::OpenEXR :
+				#ifdef AE_ENABLE_DEVIL
+				return TryLoad< DevILLoader >( image, stream, start_pos, flipY, allocator, detected );
+				#else
+				return false;
+				#endif
+
+			case EImageFormat::TGA :
+			case EImageFormat::PCX :
+			case EImageFormat::Unknown :
+			case EImageFormat::_Count :
+				break;
+		}
+		switch_end
+
+		return LoadWithFallback( image, stream, start_pos, flipY, allocator, fileFormat );
+	}
+
+/*
+=================================================
+	LoadImages
+----
+	Threads pull images from shared counter, so large and small files are balanced automatically.
+	Memory budget limits total size of file content in memory,
+	a file which is larger than budget is loaded only when nothing else is in flight.
+=================================================
+*/
+	usize  AllImageLoaders::LoadImages (ArrayView<IntermImage*> images, const BatchConfig &cfg) __NE___
+	{
+		struct SharedState
+		{
+			Atomic<usize>		next		{0};
+			Atomic<usize>		loaded		{0};
+			Mutex				budgetGuard;
+			ConditionVariable	budgetCV;
+			Bytes				inFlight;
+		};
+		SharedState		state;
+
+		const auto	Worker = [this, images, &cfg, &state] ()
+		{
+			Array<ubyte>	buffer;		// per-thread, reused for all files
+
+			for (;;)
+			{
+				const usize	idx = state.next.fetch_add( 1 );
+				if ( idx >= images.size() )
+					break;
+
+				IntermImage*	image = images[idx];
+				Path			filename;
+
+				if_unlikely( image == null )
+				{
+					AE_LOGE( "image ["s << ToString(idx) << "] is null" );
+					continue;
+				}
+
+				if_unlikely( not _FindImage( image->GetPath(), cfg.directories, OUT filename ))
+				{
+					AE_LOGE( "failed to load image '"s << ToString(image->GetPath()) << "', file is not found" );
+					continue;
+				}
+
+				FileRStream		file {filename};
+				if_unlikely( not file.IsOpen() )
+				{
+					AE_LOGE( "failed to load image '"s << ToString(filename) << "', can not open file" );
+					continue;
+				}
+
+				const Bytes		size = file.RemainingSize();
+				{
+					std::unique_lock	lock {state.budgetGuard};
+					state.budgetCV.wait( lock, [&]() { return state.inFlight == 0_b or state.inFlight + size <= cfg.memoryBudget; });
+					state.inFlight += size;
+				}
+
+				bool	ok = false;
+				TRY{
+					buffer.resize( usize(size) );
+					ok = file.Read( OUT buffer.data(), size );
+				}
+				CATCH_ALL(
+					ok = false;
+				)
+
+				if_likely( ok )
+				{
+					MemRefRStream	mem {buffer.data(), size};
+					ok = LoadImage( INOUT *image, mem, cfg.flipY, cfg.allocator, PathToImageFileFormat( filename ));
+				}
+
+				if_unlikely( not ok )
+					AE_LOGE( "failed to load image '"s << ToString(filename) << "'" );
+
+				state.loaded.fetch_add( usize(ok) );
+
+				if_unlikely( Bytes{buffer.capacity()} > MaxCachedBufferSize )
+					Reconstruct( INOUT buffer );
+
+				{
+					EXLOCK( state.budgetGuard );
+					state.inFlight -= size;
+				}
+				state.budgetCV.notify_all();
+			}
+		};
+
+		const usize		thread_count = Clamp( usize{cfg.threadCount == 0 ? ThreadUtils::MaxThreadCount() : cfg.threadCount}, usize{1}, Max( images.size(), usize{1} ));
+		Array<StdThread> threads;
+
+		TRY{
+			threads.reserve( thread_count - 1 );
+			for (usize i = 1; i < thread_count; ++i) {
+				threads.emplace_back( Worker );
+			}
+		}
+		CATCH_ALL()
+
+		// current thread is used as worker too
+		Worker();
+
+		for (auto& t : threads) {
+			t.join();
+		}
+
+		return state.loaded.load();
+	}
 
 
 } // AE::ResLoader
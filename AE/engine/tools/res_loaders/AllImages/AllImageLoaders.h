@@ -13,10 +13,27 @@ namespace AE::ResLoader
 
 	class AllImageLoaders final : public IImageLoader
 	{
+	// types
+	public:
+		struct BatchConfig
+		{
+			ArrayView<Path>		directories;
+			RC<IAllocator>		allocator;					// must be thread-safe, default allocator is used if null
+			Bytes				memoryBudget	= 1_Gb;		// max size of file content which is loaded by all threads at the same time
+			uint				threadCount		= 0;		// 0 - use all cores
+			Bool				flipY;
+		};
+
+
 	// methods
 	public:
 		bool  LoadImage (INOUT IntermImage &image, RStream &stream, Bool flipY, RC<IAllocator> allocator, EImageFormat fileFormat) __NE_OV;
 		using IImageLoader::LoadImage;
+
+		// Files are decoded in parallel, each thread reads whole file into reusable buffer and decodes it from memory.
+		// Images must have a path, file format is detected by signature or by file extension.
+		// Returns number of loaded images, not loaded images are left empty.
+		ND_ usize  LoadImages (ArrayView<IntermImage*> images, const BatchConfig &cfg) __NE___;
 	};
 
 
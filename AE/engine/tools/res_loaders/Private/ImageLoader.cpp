@@ -3,6 +3,7 @@
 #include "res_loaders/Public/ImageLoader.h"
 #include "res_loaders/Public/ImageSaver.h"
 #include "res_loaders/Intermediate/IntermImage.h"
+#include "res_pack/asset_packer/Packer/ImagePacker.h"
 
 namespace AE::ResLoader
 {
@@ -103,6 +104,75 @@ namespace {
 		switch_end
 		return Default;
 	}
+
+/*
+=================================================
+	DetectImageFileFormat
+=================================================
+*/
+namespace {
+	ND_ static bool  StartsWith (ArrayView<ubyte> header, std::initializer_list<ubyte> sig)
+	{
+		if ( header.size() < sig.size() )
+			return false;
+
+		return std::equal( sig.begin(), sig.end(), header.begin() );
+	}
+}
+	EImageFormat  DetectImageFileFormat (ArrayView<ubyte> header) __NE___
+	{
+		if ( StartsWith( header, { 'D', 'D', 'S', ' ' }))
+			return EImageFormat::DDS;
+
+		// KTX 1.x and 2.x: '«KTX 11»' and '«KTX 20»'
+		if ( StartsWith( header, { 0xAB, 'K', 'T', 'X', ' ' }))
+			return EImageFormat::KTX;
+
+		if ( StartsWith( header, { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' }))
+			return EImageFormat::PNG;
+
+		if ( StartsWith( header, { 0xFF, 0xD8, 0xFF }))
+			return EImageFormat::JPG;
+
+		if ( StartsWith( header, { 'B', 'M' }))
+			return EImageFormat::BMP;
+
+		if ( StartsWith( header, { 'I', 'I', '*', 0 }) or StartsWith( header, { 'M', 'M', 0, '*' }))
+			return EImageFormat::TIF;
+
+		if ( StartsWith( header, { '8', 'B', 'P', 'S' }))
+			return EImageFormat::PSD;
+
+		if ( StartsWith( header, { '#', '?', 'R', 'A', 'D', 'I', 'A', 'N', 'C', 'E' }) or
+			 StartsWith( header, { '#', '?', 'R', 'G', 'B', 'E' }))
+			return EImageFormat::RadianceHDR;
+
+		if ( StartsWith( header, { 0x76, 0x2F, 0x31, 0x01 }))
+			return EImageFormat::OpenEXR;
+
+		if ( header.size() >= sizeof(uint) )
+		{
+			uint	magic;
+			MemCopy( OUT &magic, header.data(), SizeOf<uint> );
+
+			if ( magic == AssetPacker::ImagePacker::Magic )
+				return EImageFormat::AEImg;
+		}
+
+		return EImageFormat::Unknown;
+	}
+
+	EImageFormat  DetectImageFileFormat (RStream &stream) __NE___
+	{
+		StaticArray< ubyte, 16 >	header	= {};
+		const Bytes					pos		= stream.Position();
+		const Bytes					size	= stream.ReadSeq( OUT header.data(), Sizeof(header) );
+
+		if_unlikely( not stream.SeekSet( pos ))
+			return EImageFormat::Unknown;
+
+		return DetectImageFileFormat( ArrayView<ubyte>{ header.data(), usize(size) });
+	}
 //-----------------------------------------------------------------------------
 
 
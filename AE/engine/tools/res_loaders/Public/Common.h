@@ -33,6 +33,11 @@ namespace AE::ResLoader
 	ND_ EImageFormat	PathToImageFileFormat (const Path &path)	__NE___;
 	ND_ StringView		ImageFileFormatToExt (EImageFormat)			__NE___;
 
+	// Detects format by file signature, returns 'Unknown' for formats without signature (TGA, PCX).
+	// Stream position is restored.
+	ND_ EImageFormat	DetectImageFileFormat (RStream &stream)		__NE___;
+	ND_ EImageFormat	DetectImageFileFormat (ArrayView<ubyte> header) __NE___;
+
 
 
 	//
@@ -271,14 +271,21 @@ namespace {
 */
 	void  ScriptImageAtlas::_LoadImages () __Th___
 	{
+		Array<IntermImage*>	images;
+		images.reserve( _imageFiles.size() );	// throw
+
 		for (auto& img : _imageFiles)
 		{
 			img.data.reset( new IntermImage{ img.path });
-
-			AllImageLoaders	loader;
-			CHECK_THROW_MSG( loader.LoadImage( *img.data, Default, False{"don't flipY"} ),
-				"failed to load image '"s << ToString(img.path) << "'" );
+			images.push_back( img.data.get() );
 		}
+
+		AllImageLoaders					loader;
+		AllImageLoaders::BatchConfig	cfg;
+		cfg.flipY = False{"don't flipY"};
+
+		CHECK_THROW_MSG( loader.LoadImages( images, cfg ) == images.size(),
+			"failed to load atlas images" );
 	}
 
 
@@ -31,6 +31,7 @@ namespace
 	using EReflectionFlags = PipelineCompiler::EReflectionFlags;
 
 	static Array<Path>	s_SearchDirs;
+	static Array<Path>	s_DepFiles;		// depfiles which are written by pipeline compiler, used in watch mode
 
 /*
 =================================================
@@ -155,6 +156,8 @@ namespace
 
 		Path								_outputCppStructsFile;
 		Path								_outputCppNamesFile;
+		Path								_shaderCacheFolder;
+		Path								_outputDepFile;
 
 		Library												_lib;
 		decltype(&AE::PipelineCompiler::CompilePipelines)	_fnCompilePipelines	= null;
@@ -206,6 +209,16 @@ namespace
 			_reflFlags				= flags;
 		}
 
+		void  SetShaderCacheFolder (const String &path) __Th___
+		{
+			_shaderCacheFolder = FileSystem::ToAbsolute( path );
+		}
+
+		void  SetOutputDepFile (const String &path) __Th___
+		{
+			_outputDepFile = FileSystem::ToAbsolute( path );
+		}
+
 		void  Compile1 (const String &outputPackName) __Th___
 		{
 			return _Compile( outputPackName, false );
@@ -242,6 +255,8 @@ namespace
 			const auto	output_pack_name		= ConvertString( FileSystem::ToAbsolute( outputPackName ));
 			const auto	output_cpp_types_file	= ConvertString( _outputCppStructsFile );
 			const auto	output_cpp_names_file	= ConvertString( _outputCppNamesFile );
+			const auto	shader_cache_folder		= ConvertString( _shaderCacheFolder );
+			const auto	output_dep_file			= ConvertString( _outputDepFile );
 
 			const auto	pipelines				= ConvertArray<PipelineCompiler::PathParams>( _pipelines );
 			const auto	shader_folders			= ConvertArray( _shaderFolders );
@@ -273,6 +288,14 @@ namespace
 			info.cppReflectionFlags		= _reflFlags;
 			info.addNameMapping			= addNameMapping;
 
+			// incremental build
+			info.shaderCacheFolder		= shader_cache_folder.empty() ? null : shader_cache_folder.c_str();
+			info.outputDepFile			= output_dep_file.empty() ? null : output_dep_file.c_str();
+
+			// added before compilation, so depfile from previous successful build will be watched if compilation failed
+			if ( not _outputDepFile.empty() )
+				s_DepFiles.push_back( _outputDepFile );
+
 			CHECK_THROW_MSG( _fnCompilePipelines( &info ));
 
 			// reset
@@ -280,6 +303,7 @@ namespace
 			_shaderFolders.clear();
 			_shaderIncludeDirs.clear();
 			_pplnIncludeDirs.clear();
+			_outputDepFile.clear();
 		}
 	};
 
@@ -658,6 +682,8 @@ namespace
 
 			binder.AddMethod( &ScriptPipelineCompiler::SetOutputCPPFile1,			"SetOutputCPPFile"			);
 			binder.AddMethod( &ScriptPipelineCompiler::SetOutputCPPFile2,			"SetOutputCPPFile"			);
+			binder.AddMethod( &ScriptPipelineCompiler::SetShaderCacheFolder,		"SetShaderCacheFolder"		);
+			binder.AddMethod( &ScriptPipelineCompiler::SetOutputDepFile,			"SetOutputDepFile"			);
 			binder.AddMethod( &ScriptPipelineCompiler::Compile1,					"Compile"					);
 			binder.AddMethod( &ScriptPipelineCompiler::Compile4,					"CompileWithNameMapping"	);
 		}
@@ -755,6 +781,130 @@ namespace
 		return true;
 	}
 
+/*
+=================================================
+	ParseDepFile
+----
+	parse Makefile-style depfile which is written by 'ObjectStorage::SaveDepFile()'
+=================================================
+*/
+	static void  ParseDepFile (const Path &filename, INOUT Array<Path> &files)
+	{
+		String	str;
+		{
+			FileRStream		file {filename};
+			if ( not file.IsOpen() or not file.Read( file.RemainingSize(), OUT str ))
+			{
+				AE_LOGI( "Failed to read depfile '"s << ToString(filename) << "'" );
+				return;
+			}
+		}
+
+		// first line contains target
+		usize	pos = str.find( " \\\n" );
+		while ( pos != String::npos )
+		{
+			pos += 3;
+			const usize	end = Min( str.find( " \\\n", pos ), str.find( '\n', pos ));
+			if ( end == String::npos )
+				break;
+
+			String	path;
+			for (usize i = pos; i < end; ++i)
+			{
+				const char	c = str[i];
+				if ( (c == ' ' or c == '\t') and path.empty() )
+					continue;
+
+				// unescape
+				if ( i+1 < end and ((c == '\\' and (str[i+1] == ' ' or str[i+1] == '#')) or (c == '$' and str[i+1] == '$')) )
+					++i;
+
+				path << str[i];
+			}
+
+			if ( not path.empty() )
+				files.push_back( Path{path} );
+
+			pos = (str[end] == ' ' ? end : String::npos);
+		}
+	}
+
+/*
+=================================================
+	WatchAndRecompile
+----
+	Polls modification time of packer script and all files which are listed in depfiles,
+	reruns packer script if any of them is changed.
+	Use shader cache to recompile only modified shaders.
+	Never returns, process must be terminated by user.
+=================================================
+*/
+	static void  WatchAndRecompile (const Path &respackScript, const Path &outputDir, const milliseconds interval)
+	{
+		using Time_t = FileSystem::Time_t;
+
+		Array<Pair< Path, Time_t >>		watched;
+
+		const auto	UpdateWatchedFiles = [&] ()
+		{{
+			Array<Path>	files;
+			files.push_back( respackScript );
+
+			for (auto& dep : s_DepFiles) {
+				ParseDepFile( dep, INOUT files );
+			}
+
+			if ( s_DepFiles.empty() )
+				AE_LOGI( "Depfile is not specified, only packer script is watched, use 'SetOutputDepFile()' to watch pipelines and shaders" );
+
+			watched.clear();
+			for (auto& path : files) {
+				watched.emplace_back( path, FileSystem::LastWriteTime( path ));
+			}
+			AE_LOGI( "Watching "s << ToString(watched.size()) << " files..." );
+		}};
+
+		UpdateWatchedFiles();
+
+		for (;;)
+		{
+			ThreadUtils::MilliSleep( interval );
+
+			bool	changed = false;
+			for (auto& [path, time] : watched)
+			{
+				if ( FileSystem::LastWriteTime( path ) != time )
+				{
+					AE_LOGI( "File is modified: '"s << ToString(path) << "'" );
+					changed = true;
+					break;
+				}
+			}
+
+			if ( not changed )
+				continue;
+
+			Array<Path>		prev_deps;
+			std::swap( prev_deps, s_DepFiles );
+
+			if ( not RunScript( respackScript, outputDir ))
+			{
+				AE_LOGI( "Failed to rebuild, waiting for changes..." );
+
+				// script may fail before all depfiles are added,
+				// keep previously watched files, otherwise fix in shader or include will not trigger rebuild
+				for (auto& dep : prev_deps)
+				{
+					if ( not ArrayContains( ArrayView<Path>{s_DepFiles}, dep ))
+						s_DepFiles.push_back( dep );
+				}
+			}
+
+			UpdateWatchedFiles();
+		}
+	}
+
 } // namespace
 
 
@@ -769,8 +919,9 @@ namespace
 	{
 		AE::Base::StaticLogger::LoggerScope log{};	// don't check for memleak because of false possitive in 'SpirvToMsl'
 
-		Path	input_script;
-		Path	output_dir		= FileSystem::CurrentPath();
+		Path			input_script;
+		Path			output_dir		= FileSystem::CurrentPath();
+		milliseconds	watch_interval	{0};
 
 		s_SearchDirs.clear();
 
@@ -785,10 +936,22 @@ namespace
 			else
 			if ( type == "-d" )
 				s_SearchDirs.push_back( FileSystem::ToAbsolute( Path{ argv[i+1] }));
+			else
+			if ( type == "-w" )
+				watch_interval = milliseconds{ StringToUInt( StringView{argv[i+1]} )};
 			else
 				RETURN_ERR( "unknown command: '"s << type << "' + '" << argv[i+1] << "'", -1 );
 		}
 
+		if ( watch_interval.count() > 0 )
+		{
+			// rebuild on changes, first build may fail
+			if ( not RunScript( input_script, output_dir ))
+				AE_LOGI( "Failed to build, waiting for changes..." );
+
+			WatchAndRecompile( input_script, output_dir, watch_interval );
+		}
+
 		CHECK_ERR( RunScript( input_script, output_dir ), -2 );
 		return 0;
 	}
@@ -0,0 +1,268 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+
+#include "Compiler/ShaderCache.h"
+
+namespace AE::PipelineCompiler
+{
+
+/*
+=================================================
+	constructor
+=================================================
+*/
+	ShaderCache::ShaderCache (const Path &folder) :
+		_folder{ FileSystem::ToAbsolute( folder )}
+	{
+		if ( not FileSystem::IsDirectory( _folder ))
+			CHECK( FileSystem::CreateDirectories( _folder ));
+	}
+
+/*
+=================================================
+	CalcKey
+=================================================
+*/
+	HashVal  ShaderCache::CalcKey (const SpirvCompiler &compiler, const SpirvCompiler::Input &in)
+	{
+		HashVal	h = compiler.CalcConfigHash();
+		h << HashOf( in.header ) << HashOf( in.source ) << HashOf( in.entry );
+		h << HashOf( in.shaderType ) << HashOf( in.spirvVersion.To100() ) << HashOf( in.options ) << HashOf( in.dbgDescSetIdx );
+		h << HashOf( _Version );
+
+		// reflection is stored with raw uniform data, which depends on compiler build
+		h << HashOf( sizeof(DescriptorSetLayoutDesc::Uniform) ) << HashOf( alignof(DescriptorSetLayoutDesc::Uniform) );
+		return h;
+	}
+
+/*
+=================================================
+	_GetFileName
+=================================================
+*/
+	Path  ShaderCache::_GetFileName (HashVal key) const
+	{
+		return _folder / (ToString<16>( usize{key} ) << ".spvc");
+	}
+
+/*
+=================================================
+	_GetFileHash
+=================================================
+*/
+	bool  ShaderCache::_GetFileHash (const Path &path, OUT HashVal &hash)
+	{
+		auto	it = _fileHashCache.find( path );
+		if ( it != _fileHashCache.end() )
+		{
+			hash = it->second;
+			return true;
+		}
+
+		String	data;
+		{
+			FileRStream		file{ path };
+			if ( not file.IsOpen() or not file.Read( file.RemainingSize(), OUT data ))
+				return false;
+		}
+
+		hash = HashOf( data );
+		_fileHashCache.emplace( path, hash );
+		return true;
+	}
+
+/*
+=================================================
+	Load
+=================================================
+*/
+	bool  ShaderCache::Load (const HashVal key, OUT SpirvBytecode_t &spirv, OUT Reflection_t &reflection, OUT Array<Path> &includedFiles)
+	{
+		spirv.clear();
+		includedFiles.clear();
+		reflection = Reflection_t{};
+
+		const auto	OnMiss = [this, &spirv, &reflection, &includedFiles] ()
+		{{
+			spirv.clear();
+			includedFiles.clear();
+			reflection = Reflection_t{};
+			++_stat.misses;
+			return false;
+		}};
+
+		FileRStream		file{ _GetFileName( key )};
+		if ( not file.IsOpen() )
+			return OnMiss();
+
+		uint	magic	= 0;
+		uint	version	= 0;
+		usize	fkey	= 0;
+		uint	count	= 0;
+
+		if ( not (file.Read( OUT magic ) and file.Read( OUT version ) and file.Read( OUT fkey )) or
+			 magic != _Magic or version != _Version or fkey != usize{key} )
+			return OnMiss();
+
+		// check dependencies
+		if ( not file.Read( OUT count ))
+			return OnMiss();
+
+		includedFiles.reserve( count );
+		for (uint i = 0; i < count; ++i)
+		{
+			uint	len		= 0;
+			String	path;
+			usize	hash	= 0;
+			HashVal	cur_hash;
+
+			if ( not (file.Read( OUT len ) and file.Read( usize{len}, OUT path ) and file.Read( OUT hash )))
+				return OnMiss();
+
+			auto&	inc = includedFiles.emplace_back( path );
+
+			if ( not _GetFileHash( inc, OUT cur_hash ) or usize{cur_hash} != hash )
+				return OnMiss();
+		}
+
+		// read SPIRV
+		if ( not (file.Read( OUT count ) and count > 0 and file.Read( usize{count}, OUT spirv )))
+			return OnMiss();
+
+		// read reflection
+		{
+			auto	mem = MakeRC<ArrayRStream>();
+			if ( not mem->LoadRemainingFrom( file ))
+				return OnMiss();
+
+			Serializing::Deserializer	des{ mem };
+			if ( not _Deserialize( des, OUT reflection ) or not des.IsEnd() )
+				return OnMiss();
+		}
+
+		++_stat.hits;
+		return true;
+	}
+
+/*
+=================================================
+	Store
+----
+	write to temporary file and rename,
+	so other packer processes which use the same folder will not read partially written file.
+=================================================
+*/
+	bool  ShaderCache::Store (const HashVal key, const SpirvBytecode_t &spirv, const Reflection_t &reflection, ArrayView<Path> includedFiles)
+	{
+		CHECK_ERR( not spirv.empty() );
+
+		auto	refl_mem = MakeRC<ArrayWStream>();
+		{
+			Serializing::Serializer		ser{ refl_mem };
+			CHECK_ERR( _Serialize( ser, reflection ));
+		}
+
+		const Path	fname	= _GetFileName( key );
+		Path		tmp		= fname;
+		tmp.replace_extension( ".tmp" );
+		{
+			FileWStream		file{ tmp };
+			CHECK_ERR( file.IsOpen() );
+
+			CHECK_ERR( file.Write( _Magic ) and file.Write( _Version ) and file.Write( usize{key} ));
+			CHECK_ERR( file.Write( uint(includedFiles.size()) ));
+
+			for (auto& path : includedFiles)
+			{
+				HashVal			hash;
+				const String	str	= ToString( path );
+
+				CHECK_ERR( _GetFileHash( path, OUT hash ));
+				CHECK_ERR( file.Write( uint(str.size()) ) and file.Write( str ) and file.Write( usize{hash} ));
+			}
+
+			CHECK_ERR( file.Write( uint(spirv.size()) ) and file.Write( ArrayView<uint>{spirv} ));
+			CHECK_ERR( refl_mem->StoreTo( file ));
+		}
+		return FileSystem::Rename( tmp, fname );
+	}
+
+/*
+=================================================
+	_Serialize
+----
+	uniforms are not sorted in reflection, so 'DescriptorSetLayoutDesc::Serialize()' can not be used
+=================================================
+*/
+	bool  ShaderCache::_Serialize (Serializing::Serializer &ser, const Reflection_t &refl)
+	{
+		bool	result = true;
+
+		result &= ser( uint(refl.layout.descrSets.size()) );
+		for (auto& ds : refl.layout.descrSets)
+		{
+			const auto&	layout = ds.layout;
+
+			result &= ser( ds.bindingIndex, ds.name );
+			result &= ser( layout.features, layout.samplerStorage, layout.name, layout.usage, layout.stages );
+			result &= ser( uint(layout.uniforms.size()) );
+
+			for (auto& [un_name, un] : layout.uniforms)
+			{
+				result &= ser( un_name );
+				result &= ser.stream.Write( un );
+			}
+		}
+
+		result &= ser( refl.layout.pushConstants, refl.layout.specConstants );
+		result &= ser( refl.vertex.supportedTopology, refl.vertex.vertexAttribs );
+		result &= ser( refl.tessellation.patchControlPoints );
+		result &= ser( refl.fragment.fragmentIO, refl.fragment.earlyFragmentTests );
+		result &= ser( refl.compute.localGroupSize, refl.compute.localGroupSpec );
+		result &= ser( refl.mesh.taskGroupSize, refl.mesh.taskGroupSpec, refl.mesh.meshGroupSize, refl.mesh.meshGroupSpec );
+		result &= ser( refl.mesh.topology, refl.mesh.maxPrimitives, refl.mesh.maxIndices, refl.mesh.maxVertices );
+		return result;
+	}
+
+/*
+=================================================
+	_Deserialize
+=================================================
+*/
+	bool  ShaderCache::_Deserialize (Serializing::Deserializer &des, OUT Reflection_t &refl)
+	{
+		uint	ds_count = 0;
+		CHECK_ERR( des( OUT ds_count ));
+		CHECK_ERR( ds_count <= refl.layout.descrSets.capacity() );
+
+		refl.layout.descrSets.resize( ds_count );
+		for (auto& ds : refl.layout.descrSets)
+		{
+			auto&	layout		= ds.layout;
+			uint	un_count	= 0;
+
+			CHECK_ERR( des( OUT ds.bindingIndex, OUT ds.name ));
+			CHECK_ERR( des( OUT layout.features, OUT layout.samplerStorage, OUT layout.name, OUT layout.usage, OUT layout.stages ));
+			CHECK_ERR( des( OUT un_count ));
+			CHECK_ERR( un_count <= DescriptorSetLayoutDesc::MaxUniforms );
+
+			layout.uniforms.resize( un_count );
+			for (auto& [un_name, un] : layout.uniforms)
+			{
+				CHECK_ERR( des( OUT un_name ));
+				CHECK_ERR( des.stream.Read( OUT un ));
+			}
+		}
+
+		bool	result = true;
+		result &= des( OUT refl.layout.pushConstants, OUT refl.layout.specConstants );
+		result &= des( OUT refl.vertex.supportedTopology, OUT refl.vertex.vertexAttribs );
+		result &= des( OUT refl.tessellation.patchControlPoints );
+		result &= des( OUT refl.fragment.fragmentIO, OUT refl.fragment.earlyFragmentTests );
+		result &= des( OUT refl.compute.localGroupSize, OUT refl.compute.localGroupSpec );
+		result &= des( OUT refl.mesh.taskGroupSize, OUT refl.mesh.taskGroupSpec, OUT refl.mesh.meshGroupSize, OUT refl.mesh.meshGroupSpec );
+		result &= des( OUT refl.mesh.topology, OUT refl.mesh.maxPrimitives, OUT refl.mesh.maxIndices, OUT refl.mesh.maxVertices );
+		return result;
+	}
+
+
+} // AE::PipelineCompiler
@@ -0,0 +1,71 @@
+// Copyright (c) Zhirnov Andrey. For more information see 'LICENSE'
+/*
+	Persistent cache for compiled SPIRV, used for incremental pipeline pack rebuilding.
+
+	Key is calculated from shader source, generated header and compiler options.
+	Each entry contains list of included files with content hash,
+	entry is invalidated if any of included files is modified.
+	Entry contains SPIRV and shader reflection, so cache hit does not require glslang.
+	Shaders with debug instrumentation (trace, profiling) are not cached.
+
+	thread-safe:  no
+*/
+
+#pragma once
+
+#include "Compiler/SpirvCompiler.h"
+
+namespace AE::PipelineCompiler
+{
+
+	//
+	// Shader Cache
+	//
+
+	class ShaderCache final : public NothrowAllocatable
+	{
+	// types
+	public:
+		struct Statistic
+		{
+			uint	hits		= 0;
+			uint	misses		= 0;	// not found or invalidated
+		};
+
+	private:
+		static constexpr uint	_Magic		= "SpvCache"_Hash;
+		static constexpr uint	_Version	= 2;
+
+		using FileHashMap_t	= HashMap< Path, HashVal, PathHasher >;
+		using Reflection_t	= SpirvCompiler::ShaderReflection;
+
+
+	// variables
+	private:
+		const Path		_folder;
+		FileHashMap_t	_fileHashCache;		// content hash of included files, files are not changed during compilation
+		Statistic		_stat;
+
+
+	// methods
+	public:
+		explicit ShaderCache (const Path &folder);
+
+		ND_ static HashVal  CalcKey (const SpirvCompiler &compiler, const SpirvCompiler::Input &in);
+
+		// Returns 'true' if cache entry is exists and all included files are not modified.
+		ND_ bool	Load (HashVal key, OUT SpirvBytecode_t &spirv, OUT Reflection_t &reflection, OUT Array<Path> &includedFiles);
+			bool	Store (HashVal key, const SpirvBytecode_t &spirv, const Reflection_t &reflection, ArrayView<Path> includedFiles);
+
+		ND_ Statistic	GetStatistic ()	const	{ return _stat; }
+
+	private:
+		ND_ Path	_GetFileName (HashVal key) const;
+		ND_ bool	_GetFileHash (const Path &path, OUT HashVal &hash);
+
+		ND_ static bool  _Serialize (Serializing::Serializer &, const Reflection_t &);
+		ND_ static bool  _Deserialize (Serializing::Deserializer &, OUT Reflection_t &);
+	};
+
+
+} // AE::PipelineCompiler
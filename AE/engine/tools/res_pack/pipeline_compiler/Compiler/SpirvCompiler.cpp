@@ -436,9 +436,35 @@ namespace AE::PipelineCompiler
 		COMP_CHECK_LOG( _CompileSPIRV( glslang_data, in.options, OUT out.spirv, INOUT out.log ), out.log );
 
 		COMP_CHECK_LOG( _BuildReflection( glslang_data, OUT out.reflection ), out.log );
+
+		out.includedFiles.reserve( includer.GetIncludedFiles().size() );
+		for (auto& [path, info] : includer.GetIncludedFiles()) {
+			out.includedFiles.push_back( path );
+		}
 		return true;
 	}
 
+/*
+=================================================
+	CalcConfigHash
+=================================================
+*/
+	HashVal  SpirvCompiler::CalcConfigHash () const
+	{
+		HashVal	h;
+		h << HashOf( GLSLANG_VERSION_MAJOR ) << HashOf( GLSLANG_VERSION_MINOR ) << HashOf( GLSLANG_VERSION_PATCH );
+		h << HashOf( _preprocessor != null );
+
+	  #ifdef ENABLE_OPT
+		h << HashOf( 1u );
+	  #endif
+
+		for (auto& dir : _directories) {
+			h << HashOf( ToString( dir ));
+		}
+		return h;
+	}
+
 /*
 =================================================
 	ConvertShaderType
@@ -117,6 +117,7 @@ namespace AE::PipelineCompiler
 			SpirvBytecode_t			spirv;
 			Unique<ShaderTrace>		trace;
 			String					log;
+			Array<Path>				includedFiles;	// absolute paths, used for dependency tracking
 
 			Output ();
 			~Output ();
@@ -159,6 +160,9 @@ namespace AE::PipelineCompiler
 		ND_ bool  BuildReflection (const Input &in, OUT ShaderReflection &outReflection, OUT String &log);
 		ND_ bool  Compile (const Input &in, OUT Output &out);
 
+		// Hash of compiler settings which are not part of the 'Input' (include directories, preprocessor, compiler version).
+		ND_ HashVal  CalcConfigHash () const;
+
 
 	private:
 		ND_ bool  _ParseGLSL (const Input &in, INOUT ShaderIncluder &includer, OUT GLSLangResult &glslangData, INOUT String &log);
@@ -216,6 +216,9 @@ namespace
 			obj_storage.spirvCompiler	= MakeUnique<SpirvCompiler>( shader_include_dirs );
 			obj_storage.spirvCompiler->SetDefaultResourceLimits();
 
+			if ( info->shaderCacheFolder != null )
+				obj_storage.shaderCache	= MakeUnique<ShaderCache>( Path{info->shaderCacheFolder} );
+
 			ObjectStorage::SetInstance( &obj_storage );
 		}
 
@@ -242,6 +245,21 @@ namespace
 			CHECK_ERR( script_engine->SaveCppHeader( info->outputScriptFile ));
 		}
 
+		if ( info->outputDepFile != null )
+			CHECK_ERR( obj_storage.SaveDepFile( FileSystem::ToAbsolute( info->outputDepFile ), pack_fname ));
+
+		if ( obj_storage.shaderCache )
+		{
+			const auto	stat = obj_storage.shaderCache->GetStatistic();
+			AE_LOGI( "Shader cache: "s << ToString( stat.hits ) << " hits, " << ToString( stat.misses ) << " misses" );
+
+			if ( info->outShaderCacheStat != null )
+			{
+				info->outShaderCacheStat->hits		= stat.hits;
+				info->outShaderCacheStat->misses	= stat.misses;
+			}
+		}
+
 		ObjectStorage::SetInstance( null );
 		return true;
 	}
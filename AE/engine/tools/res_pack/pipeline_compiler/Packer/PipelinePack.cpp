@@ -2033,6 +2033,7 @@ namespace {
 			offsets[marker] = stream.Position();
 			{
 				Serializing::Serializer		ser{ stream.GetRC<WStream>() };
+				ser.inPlaceLayout = true;
 				CHECK_ERR( ser( marker, _rtech ));
 			}
 			LOG( "Serialized render techniques: "s << ToString(_rtech.size()) );
@@ -2045,6 +2046,7 @@ namespace {
 			offsets[marker] = stream.Position();
 			{
 				Serializing::Serializer		ser{ stream.GetRC<WStream>() };
+				ser.inPlaceLayout = true;
 				CHECK_ERR( ser( marker, _renderStates ));
 			}
 			LOG( "Serialized render states: "s << ToString(_renderStates.size()) );
@@ -2057,6 +2059,7 @@ namespace {
 			offsets[marker] = stream.Position();
 			{
 				Serializing::Serializer		ser{ stream.GetRC<WStream>() };
+				ser.inPlaceLayout = true;
 				CHECK_ERR( ser( marker, _dsStates ));
 			}
 			LOG( "Serialized depth stencil states: "s << ToString(_dsStates.size()) );
@@ -2069,6 +2072,7 @@ namespace {
 			offsets[marker] = stream.Position();
 			{
 				Serializing::Serializer		ser{ stream.GetRC<WStream>() };
+				ser.inPlaceLayout = true;
 				CHECK_ERR( ser( marker, _dsLayouts ));
 			}
 			LOG( "Serialized descriptor set layouts: "s << ToString(_dsLayouts.size()) );
@@ -2081,6 +2085,7 @@ namespace {
 			offsets[marker] = stream.Position();
 			{
 				Serializing::Serializer		ser{ stream.GetRC<WStream>() };
+				ser.inPlaceLayout = true;
 				CHECK_ERR( ser( marker, _pplnLayouts ));
 			}
 			LOG( "Serialized pipeline layouts: "s << ToString(_pplnLayouts.size()) );
@@ -2093,6 +2098,7 @@ namespace {
 			offsets[marker] = stream.Position();
 			{
 				Serializing::Serializer		ser{ stream.GetRC<WStream>() };
+				ser.inPlaceLayout = true;
 				CHECK_ERR( ser( marker, _gpipelineTempl ));
 			}
 			LOG( "Serialized graphics pipelines: "s << ToString(_gpipelineTempl.size()) );
@@ -2105,6 +2111,7 @@ namespace {
 			offsets[marker] = stream.Position();
 			{
 				Serializing::Serializer		ser{ stream.GetRC<WStream>() };
+				ser.inPlaceLayout = true;
 				CHECK_ERR( ser( marker, _mpipelineTempl ));
 			}
 			LOG( "Serialized mesh pipelines: "s << ToString(_mpipelineTempl.size()) );
@@ -2117,6 +2124,7 @@ namespace {
 			offsets[marker] = stream.Position();
 			{
 				Serializing::Serializer		ser{ stream.GetRC<WStream>() };
+				ser.inPlaceLayout = true;
 				CHECK_ERR( ser( marker, _cpipelineTempl ));
 			}
 			LOG( "Serialized compute pipelines: "s << ToString(_cpipelineTempl.size()) );
@@ -2129,6 +2137,7 @@ namespace {
 			offsets[marker] = stream.Position();
 			{
 				Serializing::Serializer		ser{ stream.GetRC<WStream>() };
+				ser.inPlaceLayout = true;
 				CHECK_ERR( ser( marker, _rtpipelineTempl ));
 			}
 			LOG( "Serialized ray tracing pipelines: "s << ToString(_rtpipelineTempl.size()) );
@@ -2141,6 +2150,7 @@ namespace {
 			offsets[marker] = stream.Position();
 			{
 				Serializing::Serializer		ser{ stream.GetRC<WStream>() };
+				ser.inPlaceLayout = true;
 				CHECK_ERR( ser( marker, _gpipelineSpec ));
 			}
 			LOG( "Serialized graphics pipeline specs: "s << ToString(_gpipelineSpec.size()) );
@@ -2153,6 +2163,7 @@ namespace {
 			offsets[marker] = stream.Position();
 			{
 				Serializing::Serializer		ser{ stream.GetRC<WStream>() };
+				ser.inPlaceLayout = true;
 				CHECK_ERR( ser( marker, _mpipelineSpec ));
 			}
 			LOG( "Serialized mesh pipeline specs: "s << ToString(_mpipelineSpec.size()) );
@@ -2165,6 +2176,7 @@ namespace {
 			offsets[marker] = stream.Position();
 			{
 				Serializing::Serializer		ser{ stream.GetRC<WStream>() };
+				ser.inPlaceLayout = true;
 				CHECK_ERR( ser( marker, _cpipelineSpec ));
 			}
 			LOG( "Serialized compute pipeline specs: "s << ToString(_cpipelineSpec.size()) );
@@ -2177,6 +2189,7 @@ namespace {
 			offsets[marker] = stream.Position();
 			{
 				Serializing::Serializer		ser{ stream.GetRC<WStream>() };
+				ser.inPlaceLayout = true;
 				CHECK_ERR( ser( marker, _rtpipelineSpec ));
 			}
 			LOG( "Serialized ray tracing pipeline specs: "s << ToString(_rtpipelineSpec.size()) );
@@ -2189,6 +2202,7 @@ namespace {
 			offsets[marker] = stream.Position();
 			{
 				Serializing::Serializer		ser{ stream.GetRC<WStream>() };
+				ser.inPlaceLayout = true;
 				Array<Pair< PipelineTmplName, PipelineTemplUID >>	ppln_names;
 				ppln_names.reserve( _pipelineTemplMap.size() );
 
@@ -2209,6 +2223,7 @@ namespace {
 			offsets[marker] = stream.Position();
 			{
 				Serializing::Serializer		ser{ stream.GetRC<WStream>() };
+				ser.inPlaceLayout = true;
 				CHECK_ERR( ser( marker, _shaderBindingTables ));
 			}
 			LOG( "Serialized shader binding tables: "s << ToString(_shaderBindingTables.size()) );
@@ -2225,6 +2240,7 @@ namespace {
 			offsets[marker] = stream.Position();
 			{
 				Serializing::Serializer		ser{ stream.GetRC<WStream>() };
+				ser.inPlaceLayout = true;
 				CHECK_ERR( ser( marker, uint(_spirvShaders.size()) ));
 
 				for (auto& code :_spirvShaders)
@@ -2248,6 +2264,7 @@ namespace {
 			offsets[marker] = stream.Position();
 			{
 				Serializing::Serializer		ser{ stream.GetRC<WStream>() };
+				ser.inPlaceLayout = true;
 				CHECK_ERR( ser( marker, uint(_metaliOSShaders.size()) ));
 
 				for (auto& code :_metaliOSShaders)
@@ -2271,6 +2288,7 @@ namespace {
 			offsets[marker] = stream.Position();
 			{
 				Serializing::Serializer		ser{ stream.GetRC<WStream>() };
+				ser.inPlaceLayout = true;
 				CHECK_ERR( ser( marker, uint(_metalMacShaders.size()) ));
 
 				for (auto& code :_metalMacShaders)
@@ -57,6 +57,13 @@ namespace AE::PipelineCompiler
 	};
 
 
+	struct ShaderCacheStatistic
+	{
+		uint		hits		= 0;
+		uint		misses		= 0;	// not found or invalidated
+	};
+
+
 	struct PipelinesInfo
 	{
 		// input pipelines
@@ -82,6 +89,11 @@ namespace AE::PipelineCompiler
 		const CharType *		outputCppNamesFile		= null;		// C++ reflection
 		const CharType *		outputScriptFile		= null;		// script reflection
 		bool					addNameMapping			= false;	// for debugging
+
+		// incremental build
+		const CharType *		shaderCacheFolder		= null;		// persistent SPIRV cache, optional
+		const CharType *		outputDepFile			= null;		// Makefile-style dependency file for 'outputPackName', optional
+		ShaderCacheStatistic *	outShaderCacheStat		= null;		// optional
 	};
 
 
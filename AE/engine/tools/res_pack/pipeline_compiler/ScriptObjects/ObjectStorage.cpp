@@ -723,6 +723,54 @@ namespace AE::PipelineCompiler
 		return true;
 	}
 
+/*
+=================================================
+	SaveDepFile
+----
+	Makefile-style dependency file which is supported by Make and Ninja,
+	used to rebuild pack only if pipeline script, shader or included file is changed.
+=================================================
+*/
+	bool  ObjectStorage::SaveDepFile (const Path &filename, const Path &target) const
+	{
+		FileSystem::CreateDirectories( filename.parent_path() );
+
+		const auto	Escape = [] (const Path &path) -> String
+		{{
+			String	str;
+			for (char c : ToString( path ))
+			{
+				if ( c == ' ' or c == '#' )
+					str << '\\';
+				else
+				if ( c == '$' )
+					str << '$';
+				str << c;
+			}
+			return str;
+		}};
+
+		Array<String>	deps;
+		deps.reserve( dependencies.size() );
+		for (auto& path : dependencies) {
+			deps.push_back( Escape( path ));
+		}
+		std::sort( deps.begin(), deps.end() );
+
+		String	str = Escape( target ) << ':';
+		for (auto& dep : deps) {
+			str << " \\\n  " << dep;
+		}
+		str << '\n';
+
+		auto	file = MakeRC<FileWStream>( filename );
+		CHECK_ERR( file->IsOpen() );
+		CHECK_ERR( file->Write( StringView{str} ));
+
+		AE_LOGI( "Store dependencies to '"s << ToString(filename) << "'" );
+		return true;
+	}
+
 /*
 =================================================
 	CompilePipeline
@@ -749,6 +797,8 @@ namespace AE::PipelineCompiler
 			}
 		}
 
+		dependencies.insert( FileSystem::ToAbsolute( path ));
+
 		return CompilePipelineFromSource( scriptEngine, path, script, includeDirs );
 	}
 
@@ -767,13 +817,18 @@ namespace AE::PipelineCompiler
 		src.dbgLocation		= SourceLoc{ ansi_path, 0 };
 		src.usePreprocessor	= true;
 
-		ScriptModulePtr		module = scriptEngine->CreateModule( {src}, {"SCRIPT"}, includeDirs );
+		Array<Path>			included_files;
+		ScriptModulePtr		module = scriptEngine->CreateModule( {src}, {"SCRIPT"}, includeDirs, OUT &included_files );
 		if ( not module )
 		{
 			AE_LOGI( "Failed to parse pipeline file: '"s << ansi_path << "'" );
 			return false;
 		}
 
+		for (auto& inc : included_files) {
+			dependencies.insert( inc );
+		}
+
 		auto	fn = scriptEngine->CreateScript< void() >( "ASmain", module );
 		if ( not fn )
 		{
@@ -21,6 +21,7 @@
 
 #include "Compiler/SpirvCompiler.h"
 #include "Compiler/MetalCompiler.h"
+#include "Compiler/ShaderCache.h"
 
 namespace AE::PipelineCompiler
 {
@@ -155,6 +156,8 @@ namespace AE::PipelineCompiler
 		Ptr<PipelineStorage>		pplnStorage;
 		Unique< SpirvCompiler >		spirvCompiler;
 		Unique< MetalCompiler >		metalCompiler;
+		Unique< ShaderCache >		shaderCache;		// optional
+		HashSet< Path, PathHasher >	dependencies;		// pipeline scripts, shader sources and includes, for depfile
 		Unique< CompatRTConsts >	_compatRPConstPtr;
 		Unique< StructTypeConsts >	_structTypeConstPtr;
 
@@ -234,6 +237,7 @@ namespace AE::PipelineCompiler
 		ND_ bool  SavePack (WStream &stream, bool addNameMapping, OUT PipelinePackOffsets &offsets)									const;
 		ND_ bool  SaveCppStructs (const Path &filename)																				const;
 		ND_ bool  SaveCppNames (const Path &filename, EReflectionFlags flags)														const;
+		ND_ bool  SaveDepFile (const Path &filename, const Path &target)																const;
 
 
 		ND_ static Ptr<ObjectStorage>  Instance ();
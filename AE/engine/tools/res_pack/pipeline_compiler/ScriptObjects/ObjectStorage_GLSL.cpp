@@ -116,15 +116,33 @@ namespace AE::PipelineCompiler
 		in.shaderDeviceClock	= dbg_feats.shaderDeviceClock;
 		in.shaderSubgroupClock	= dbg_feats.shaderSubgroupClock;
 
-		if_unlikely( not spirvCompiler->Compile( in, OUT out ))
+		if ( not shaderPath.path.empty() )
+			dependencies.insert( FileSystem::ToAbsolute( shaderPath.path ));
+
+		// shader with debug instrumentation is not cached
+		const bool		use_cache	= shaderCache and NoBits( info.options, EShaderOpt::_ShaderTrace_Mask );
+		const HashVal	cache_key	= use_cache ? ShaderCache::CalcKey( *spirvCompiler, in ) : HashVal{};
+
+		// cache entry contains SPIRV and reflection, glslang is not used
+		if ( not (use_cache and shaderCache->Load( cache_key, OUT out.spirv, OUT out.reflection, OUT out.includedFiles )))
 		{
-			AE_LOGI( "Shader source:\n"s << in.header << '\n' << in.source );
-			CHECK_THROW_MSG( false, "Failed to compile shader:\n"s << out.log );
+			if_unlikely( not spirvCompiler->Compile( in, OUT out ))
+			{
+				AE_LOGI( "Shader source:\n"s << in.header << '\n' << in.source );
+				CHECK_THROW_MSG( false, "Failed to compile shader:\n"s << out.log );
+			}
+
+			if ( not out.log.empty() )
+			{
+				AE_LOG_DBG( "Shader compiled with warnings:\n"s << out.log );
+			}
+
+			if ( use_cache )
+				Unused( shaderCache->Store( cache_key, out.spirv, out.reflection, out.includedFiles ));
 		}
 
-		if ( not out.log.empty() )
-		{
-			AE_LOG_DBG( "Shader compiled with warnings:\n"s << out.log );
+		for (auto& path : out.includedFiles) {
+			dependencies.insert( path );
 		}
 
 		compiled.version	= info.version;